@@ -175,6 +175,7 @@ void ResourceAdapterImpl::UpdateConfig(const ResourceConfiguration& config, bool
         }
     }
     resConfig_ = resConfig;
+    IncreaseConfigVersion();
 }
 
 RefPtr<ThemeStyle> ResourceAdapterImpl::GetTheme(int32_t themeId)
@@ -136,6 +136,7 @@ ResourceAdapterImplV2::ResourceAdapterImplV2(
         sysResourceManager_->UpdateResConfig(*resConfig);
     }
     resConfig_ = resConfig;
+    SetResolvedColorMode(resourceInfo.GetResourceConfiguration().GetColorMode());
 }
 
 void ResourceAdapterImplV2::Init(const ResourceInfo& resourceInfo)
@@ -152,10 +153,11 @@ void ResourceAdapterImplV2::Init(const ResourceInfo& resourceInfo)
     sysResourceManager_ = newResMgr;
     packagePathStr_ = (hapPath.empty() || IsDirExist(resPath)) ? resPath : std::string();
     resConfig_ = resConfig;
+    SetResolvedColorMode(resourceInfo.GetResourceConfiguration().GetColorMode());
 }
 
 bool ResourceAdapterImplV2::NeedUpdateResConfig(const std::shared_ptr<Global::Resource::ResConfig>& oldResConfig,
-    const std::shared_ptr<Global::Resource::ResConfig>& newResConfig)
+    const std::shared_ptr<Global::Resource::ResConfig>& newResConfig, bool checkColorMode)
 {
     if (oldResConfig == nullptr) {
         return true;
@@ -176,7 +178,7 @@ bool ResourceAdapterImplV2::NeedUpdateResConfig(const std::shared_ptr<Global::Re
     return oldResConfig->GetDeviceType() != newResConfig->GetDeviceType() ||
            oldResConfig->GetDirection() != newResConfig->GetDirection() ||
            oldResConfig->GetScreenDensity() != newResConfig->GetScreenDensity() ||
-           oldResConfig->GetColorMode() != newResConfig->GetColorMode() ||
+           (checkColorMode && oldResConfig->GetColorMode() != newResConfig->GetColorMode()) ||
            oldResConfig->GetInputDevice() != newResConfig->GetInputDevice() || isLocaleChange;
 }
 
@@ -185,10 +187,20 @@ void ResourceAdapterImplV2::UpdateConfig(const ResourceConfiguration& config, bo
     std::lock_guard<std::mutex> lock(updateResConfigMutex_);
     auto resConfig = ConvertConfigToGlobal(config);
     auto needUpdateResConfig = NeedUpdateResConfig(resConfig_, resConfig) || themeFlag;
+    ApplyResConfig(resConfig, needUpdateResConfig, themeFlag, config.GetColorMode());
+    if (needUpdateResConfig) {
+        IncreaseConfigVersion();
+    }
+}
+
+void ResourceAdapterImplV2::ApplyResConfig(const std::shared_ptr<Global::Resource::ResConfig>& resConfig,
+    bool needUpdateResConfig, bool themeFlag, ColorMode colorMode)
+{
     if (sysResourceManager_ && resConfig != nullptr && needUpdateResConfig) {
         sysResourceManager_->UpdateResConfig(*resConfig, themeFlag);
     }
     resConfig_ = resConfig;
+    SetResolvedColorMode(colorMode);
 }
 
 RefPtr<ThemeStyle> ResourceAdapterImplV2::GetTheme(int32_t themeId)
@@ -777,6 +789,13 @@ void ResourceAdapterImplV2::UpdateColorMode(ColorMode colorMode)
 
     auto resConfig = aceContainer->GetResourceConfiguration();
     resConfig.SetColorMode(colorMode);
-    UpdateConfig(resConfig, false);
+    std::lock_guard<std::mutex> lock(updateResConfigMutex_);
+    auto oldResConfig = resConfig_;
+    auto newResConfig = ConvertConfigToGlobal(resConfig);
+    ApplyResConfig(newResConfig, NeedUpdateResConfig(oldResConfig, newResConfig), false, colorMode);
+    // the callers caching the values keep them by the color mode, a switch of the color mode alone does not count.
+    if (NeedUpdateResConfig(oldResConfig, newResConfig, false)) {
+        IncreaseConfigVersion();
+    }
 }
 } // namespace OHOS::Ace
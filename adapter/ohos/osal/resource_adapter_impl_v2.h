@@ -83,7 +83,9 @@ public:
 private:
     std::string GetActualResourceName(const std::string& resName) const;
     bool NeedUpdateResConfig(const std::shared_ptr<Global::Resource::ResConfig>& oldResConfig,
-        const std::shared_ptr<Global::Resource::ResConfig>& newResConfig);
+        const std::shared_ptr<Global::Resource::ResConfig>& newResConfig, bool checkColorMode = true);
+    void ApplyResConfig(const std::shared_ptr<Global::Resource::ResConfig>& resConfig, bool needUpdateResConfig,
+        bool themeFlag, ColorMode colorMode);
 
     inline std::shared_ptr<Global::Resource::ResourceManager> GetResourceManager() const
     {
@@ -68,6 +68,8 @@ constexpr char DISABLE_ROSEN_FILE_PATH[] = "/etc/disablerosen";
 constexpr char DISABLE_WINDOW_ANIMATION_PATH[] = "/etc/disable_window_size_animation";
 #endif
 constexpr int32_t CONVERT_ASTC_THRESHOLD = 2;
+constexpr int32_t IMAGE_DECODED_CACHE_SIZE = 100;
+constexpr int32_t IMAGE_OBJECT_CACHE_SIZE = 100;
 
 using RsOrientation = Rosen::DisplayOrientation;
 
@@ -294,6 +296,31 @@ int32_t GetImageFileCacheConvertAstcThresholdProp()
     return system::GetIntParameter<int>("persist.image.filecache.astc.threshold", CONVERT_ASTC_THRESHOLD);
 }
 
+bool GetImageFileCachePackEnabled()
+{
+    return system::GetParameter("persist.image.filecache.pack.enable", "false") == "true";
+}
+
+int32_t GetImageDecodedCacheSizeProp()
+{
+    return system::GetIntParameter<int>("persist.ace.image.decodedcache.size", IMAGE_DECODED_CACHE_SIZE);
+}
+
+int32_t GetImageObjectCacheSizeProp()
+{
+    return system::GetIntParameter<int>("persist.ace.image.objectcache.size", IMAGE_OBJECT_CACHE_SIZE);
+}
+
+bool GetTextParagraphCacheEnabled()
+{
+    return system::GetParameter("persist.ace.text.paragraphcache.enabled", "true") == "true";
+}
+
+bool GetSvgDomCacheEnabled()
+{
+    return system::GetParameter("persist.ace.svg.domcache.enabled", "true") == "true";
+}
+
 bool IsUseMemoryMonitor()
 {
     return (system::GetParameter("persist.ace.memorymonitor.enabled", "0") == "1");
@@ -404,6 +431,11 @@ int32_t SystemProperties::astcMax_ = GetAstcMaxErrorProp();
 int32_t SystemProperties::astcPsnr_ = GetAstcPsnrProp();
 bool SystemProperties::imageFileCacheConvertAstc_ = GetImageFileCacheConvertToAstcEnabled();
 int32_t SystemProperties::imageFileCacheConvertAstcThreshold_ = GetImageFileCacheConvertAstcThresholdProp();
+bool SystemProperties::imageFileCachePackEnabled_ = GetImageFileCachePackEnabled();
+int32_t SystemProperties::imageDecodedCacheSize_ = GetImageDecodedCacheSizeProp();
+int32_t SystemProperties::imageObjectCacheSize_ = GetImageObjectCacheSizeProp();
+bool SystemProperties::textParagraphCacheEnabled_ = GetTextParagraphCacheEnabled();
+bool SystemProperties::svgDomCacheEnabled_ = GetSvgDomCacheEnabled();
 ACE_WEAK_SYM bool SystemProperties::extSurfaceEnabled_ = IsExtSurfaceEnabled();
 ACE_WEAK_SYM uint32_t SystemProperties::dumpFrameCount_ = GetSysDumpFrameCount();
 bool SystemProperties::enableScrollableItemPool_ = IsEnableScrollableItemPool();
@@ -736,6 +768,11 @@ bool SystemProperties::GetGridIrregularLayoutEnabled()
     return system::GetBoolParameter("persist.ace.grid.irregular.enabled", false);
 }
 
+bool SystemProperties::GetParallelLayoutEnabled()
+{
+    return system::GetBoolParameter("persist.ace.layout.parallel.enabled", false);
+}
+
 bool SystemProperties::WaterFlowUseSegmentedLayout()
 {
     return system::GetBoolParameter("persist.ace.water.flow.segmented", false);
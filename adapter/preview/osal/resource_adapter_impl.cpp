@@ -305,6 +305,7 @@ void ResourceAdapterImpl::UpdateConfig(const ResourceConfiguration& config, bool
         configuration.orientation_, configuration.resolution_, configuration.deviceType_, configuration.fontRatio_,
         configuration.colorMode_);
     resourceManger_.UpdateConfig(configuration, themeFlag);
+    IncreaseConfigVersion();
 }
 
 RefPtr<ThemeStyle> ResourceAdapterImpl::GetTheme(int32_t themeId)
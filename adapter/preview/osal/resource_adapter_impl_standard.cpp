@@ -168,6 +168,7 @@ void ResourceAdapterImpl::UpdateConfig(const ResourceConfiguration& config, bool
     if (resConfig != nullptr) {
         resourceManager_->UpdateResConfig(*resConfig);
     }
+    IncreaseConfigVersion();
 }
 
 RefPtr<ThemeStyle> ResourceAdapterImpl::GetTheme(int32_t themeId)
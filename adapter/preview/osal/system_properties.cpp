@@ -82,6 +82,11 @@ int SystemProperties::astcMax_ = 0;
 int SystemProperties::astcPsnr_ = 0;
 bool SystemProperties::imageFileCacheConvertAstc_ = false;
 int32_t SystemProperties::imageFileCacheConvertAstcThreshold_ = 2;
+bool SystemProperties::imageFileCachePackEnabled_ = false;
+int32_t SystemProperties::imageDecodedCacheSize_ = 100;
+int32_t SystemProperties::imageObjectCacheSize_ = 100;
+bool SystemProperties::textParagraphCacheEnabled_ = true;
+bool SystemProperties::svgDomCacheEnabled_ = true;
 bool SystemProperties::extSurfaceEnabled_ = false;
 uint32_t SystemProperties::dumpFrameCount_ = 0;
 bool SystemProperties::resourceDecoupling_ = true;
@@ -298,6 +303,11 @@ bool SystemProperties::GetGridIrregularLayoutEnabled()
     return false;
 }
 
+bool SystemProperties::GetParallelLayoutEnabled()
+{
+    return false;
+}
+
 bool SystemProperties::WaterFlowUseSegmentedLayout()
 {
     return false;
@@ -15,78 +15,123 @@
 
 #include "base/geometry/least_square_impl.h"
 
+#include <algorithm>
+
 #include "base/geometry/matrix3.h"
 #include "base/geometry/matrix4.h"
+#include "base/utils/utils.h"
 
 namespace OHOS::Ace {
+namespace {
+// the determinant under which the normal equations of the quadratic are taken as singular.
+constexpr double SINGULAR_DETERMINANT = 1e-20;
+} // namespace
+
 bool LeastSquareImpl::GetLeastSquareParams(std::vector<double>& params)
 {
-    if (xVals_.size() <= 1 || ((paramsNum_ != Matrix3::DIMENSION) && (paramsNum_ != Matrix4::DIMENSION))) {
+    if (GetPointNum() <= 1 || ((paramsNum_ != Matrix3::DIMENSION) && (paramsNum_ != Matrix4::DIMENSION))) {
         return false;
     }
     params.resize(paramsNum_, 0);
-    if (isResolved_) {
-        params.assign(params_.begin(), params_.end());
-        return true;
-    }
-    auto countNum = std::min(countNum_, static_cast<int32_t>(std::distance(xVals_.begin(), xVals_.end())));
-    std::vector<double> xVals;
-    xVals.resize(countNum, 0);
-    std::vector<double> yVals;
-    yVals.resize(countNum, 0);
-    int32_t size = countNum - 1;
-    for (auto iter = xVals_.rbegin(); iter != xVals_.rend(); iter++) {
-        xVals[size] = *iter;
-        size--;
-        if (size < 0) {
-            break;
-        }
+    std::array<double, MAX_PARAMS_NUM> result {};
+    if (!GetLeastSquareParams(result)) {
+        return false;
     }
-    size = countNum - 1;
-    for (auto iter = yVals_.rbegin(); iter != yVals_.rend(); iter++) {
-        yVals[size] = *iter;
-        size--;
-        if (size < 0) {
-            break;
-        }
+    std::copy_n(result.begin(), paramsNum_, params.begin());
+    return true;
+}
+
+bool LeastSquareImpl::GetLeastSquareParams(std::array<double, MAX_PARAMS_NUM>& params)
+{
+    if (GetPointNum() <= 1 || ((paramsNum_ != Matrix3::DIMENSION) && (paramsNum_ != Matrix4::DIMENSION))) {
+        return false;
     }
-    if (paramsNum_ == Matrix3::DIMENSION) {
-        MatrixN3 matrixn3 { countNum };
-        for (auto i = 0; i < countNum; i++) {
-            const auto& value = xVals[i];
-            matrixn3[i][2] = 1;
-            matrixn3[i][1] = value;
-            matrixn3[i][0] = value * value;
-        }
-        Matrix3 invert;
-        auto transpose = matrixn3.Transpose();
-        if (!(transpose * matrixn3).Invert(invert)) {
+    if (!isResolved_) {
+        auto countNum = std::min(countNum_, GetPointNum());
+        std::array<double, MAX_PARAMS_NUM> result {};
+        auto ret = paramsNum_ == Matrix3::DIMENSION ? SolveQuadratic(countNum, result) : SolveCubic(countNum, result);
+        if (!ret) {
             return false;
         }
-        auto matrix3n = invert * transpose;
-        auto ret = matrix3n.MapScalars(yVals, params);
-        if (ret) {
-            params_.assign(params.begin(), params.end());
-            isResolved_ = true;
-        }
-        return ret;
+        params_ = result;
+        isResolved_ = true;
     }
-    MatrixN4 matrixn4 { countNum };
-    for (auto i = 0; i < countNum; i++) {
-        const auto& value = xVals[i];
-        matrixn4[i][3] = 1;
-        matrixn4[i][2] = value;
-        matrixn4[i][1] = value * value;
-        matrixn4[i][0] = value * value * value;
+    params = params_;
+    return true;
+}
+
+bool LeastSquareImpl::SolveQuadratic(int32_t countNum, std::array<double, MAX_PARAMS_NUM>& params) const
+{
+    // the x are taken relative to the last one, which keeps the sums of their powers in range. the determinant does
+    // not change with it.
+    auto pointNum = GetPointNum();
+    auto origin = GetXVal(pointNum - 1);
+    double s1 = 0.0;
+    double s2 = 0.0;
+    double s3 = 0.0;
+    double s4 = 0.0;
+    double t0 = 0.0;
+    double t1 = 0.0;
+    double t2 = 0.0;
+    for (auto i = pointNum - countNum; i < pointNum; i++) {
+        auto x = GetXVal(i) - origin;
+        auto y = GetYVal(i);
+        auto x2 = x * x;
+        s1 += x;
+        s2 += x2;
+        s3 += x2 * x;
+        s4 += x2 * x2;
+        t0 += y;
+        t1 += x * y;
+        t2 += x2 * y;
     }
-    auto transpose = matrixn4.Transpose();
-    auto inversMatrix4 = Matrix4::Invert(transpose * matrixn4);
-    auto matrix4n = inversMatrix4 * transpose;
-    auto ret = matrix4n.MapScalars(yVals, params);
-    if (ret) {
-        params_.assign(params.begin(), params.end());
-        isResolved_ = true;
+    double s0 = countNum;
+    // the normal equations of a * x^2 + b * x + c = y, solved by the Cramer's rule:
+    // | s4 s3 s2 |   | a |   | t2 |
+    // | s3 s2 s1 | * | b | = | t1 |
+    // | s2 s1 s0 |   | c |   | t0 |
+    auto minor0 = s2 * s0 - s1 * s1;
+    auto minor1 = s3 * s0 - s1 * s2;
+    auto minor2 = s3 * s1 - s2 * s2;
+    auto det = s4 * minor0 - s3 * minor1 + s2 * minor2;
+    if (NearZero(det, SINGULAR_DETERMINANT)) {
+        return false;
+    }
+    auto a = (t2 * minor0 - s3 * (t1 * s0 - s1 * t0) + s2 * (t1 * s1 - s2 * t0)) / det;
+    auto b = (s4 * (t1 * s0 - s1 * t0) - t2 * minor1 + s2 * (s3 * t0 - t1 * s2)) / det;
+    auto c = (s4 * (s2 * t0 - t1 * s1) - s3 * (s3 * t0 - t1 * s2) + t2 * minor2) / det;
+    // back to the x of the points.
+    params[0] = a;
+    params[1] = b - 2 * a * origin; // 2: const of formula
+    params[2] = c - b * origin + a * origin * origin;
+    return true;
+}
+
+bool LeastSquareImpl::SolveCubic(int32_t countNum, std::array<double, MAX_PARAMS_NUM>& params) const
+{
+    // sums[k] is the sum of x^k, rhs[k] the sum of x^(3 - k) * y.
+    constexpr int32_t powerNum = 2 * Matrix4::DIMENSION - 1;
+    std::array<double, powerNum> sums {};
+    std::array<double, Matrix4::DIMENSION> rhs {};
+    auto pointNum = GetPointNum();
+    for (auto i = pointNum - countNum; i < pointNum; i++) {
+        auto x = GetXVal(i);
+        auto y = GetYVal(i);
+        double power = 1.0;
+        for (auto k = 0; k < powerNum; k++) {
+            sums[k] += power;
+            if (k < Matrix4::DIMENSION) {
+                rhs[Matrix4::DIMENSION - 1 - k] += power * y;
+            }
+            power *= x;
+        }
     }
-    return ret;
+    // the normal matrix of the columns x^3, x^2, x, 1, it is symmetric.
+    auto normal = [&sums](int32_t row, int32_t col) { return sums[powerNum - 1 - row - col]; };
+    auto invert = Matrix4::Invert(Matrix4(normal(0, 0), normal(0, 1), normal(0, 2), normal(0, 3), normal(1, 0),
+        normal(1, 1), normal(1, 2), normal(1, 3), normal(2, 0), normal(2, 1), normal(2, 2), normal(2, 3), normal(3, 0),
+        normal(3, 1), normal(3, 2), normal(3, 3)));
+    invert.MapScalars(rhs.data(), params.data());
+    return true;
 }
 } // namespace OHOS::Ace
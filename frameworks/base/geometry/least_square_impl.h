@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_GEOMETRY_LEAST_SQUARE_IMPL_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_GEOMETRY_LEAST_SQUARE_IMPL_H
 
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -26,9 +27,15 @@ namespace OHOS::Ace {
  * @brief Least square method of four parametres.
  * the function template is a3 * x^3 + a2 * x^2 + a1 * x + a0 = y with four;
  * the function template is 0 * x^3 + a2 * x^2 + a1 * x + a0 = y with three.
+ * The last points are kept in a ring buffer of a fixed capacity, so that updating and solving never allocate.
  */
 class ACE_EXPORT LeastSquareImpl {
 public:
+    static constexpr int32_t MAX_PARAMS_NUM = 4;
+    // the number of last points kept, the count to compute is limited to it. VelocityTracker needs the moves of its
+    // impulse horizon to be kept at the highest touch sampling rate.
+    static constexpr int32_t MAX_COUNT_NUM = 32;
+
     /**
      * @brief Construct a new Least Square Impl object.
      * @param paramsNum the right number is 4 or 3.
@@ -39,7 +46,10 @@ public:
      * @brief Construct a new Least Square Impl object.
      * @param paramsNum the right number is 4 or 3.
      */
-    LeastSquareImpl(int32_t paramsNum, int32_t countNum) : paramsNum_(paramsNum), countNum_(countNum) {}
+    LeastSquareImpl(int32_t paramsNum, int32_t countNum) : paramsNum_(paramsNum)
+    {
+        SetCountNum(countNum);
+    }
 
     LeastSquareImpl() = default;
     ~LeastSquareImpl() = default;
@@ -47,18 +57,21 @@ public:
     void UpdatePoint(double xVal, double yVal)
     {
         isResolved_ = false;
-        xVals_.emplace_back(xVal);
-        yVals_.emplace_back(yVal);
+        xVals_[head_] = xVal;
+        yVals_[head_] = yVal;
+        head_ = (head_ + 1) % MAX_COUNT_NUM;
+        ++trackNum_;
     }
 
     /**
      * @brief Set the Count Num which to compute.
      *
-     * @param countNum the compute number.
+     * @param countNum the compute number, no more than MAX_COUNT_NUM.
      */
     void SetCountNum(int32_t countNum)
     {
-        countNum_ = countNum;
+        isResolved_ = false;
+        countNum_ = countNum < 1 ? 1 : (countNum > MAX_COUNT_NUM ? MAX_COUNT_NUM : countNum);
     }
 
     /**
@@ -70,33 +83,55 @@ public:
      */
     bool GetLeastSquareParams(std::vector<double>& params);
 
-    inline const std::vector<double>& GetXVals() const
+    /**
+     * @brief Get the Least Square Params object without allocating, the params beyond the params num are 0.
+     */
+    bool GetLeastSquareParams(std::array<double, MAX_PARAMS_NUM>& params);
+
+    // Returns the number of points updated since the last reset.
+    inline int32_t GetTrackNum() const
+    {
+        return trackNum_;
+    }
+
+    // Returns the number of last points kept, which can be read by GetXVal and GetYVal.
+    inline int32_t GetPointNum() const
     {
-        return xVals_;
+        return trackNum_ < MAX_COUNT_NUM ? trackNum_ : MAX_COUNT_NUM;
     }
 
-    inline const std::vector<double>& GetYVals() const
+    // Returns the x of a kept point, 0 for the oldest and GetPointNum() - 1 for the last.
+    inline double GetXVal(int32_t index) const
     {
-        return yVals_;
+        return xVals_[GetSlot(index)];
     }
 
-    inline int32_t GetTrackNum() const
+    inline double GetYVal(int32_t index) const
     {
-        return xVals_.size();
+        return yVals_[GetSlot(index)];
     }
 
     void Reset()
     {
-        xVals_.clear();
-        yVals_.clear();
-        params_.clear();
+        head_ = 0;
+        trackNum_ = 0;
         isResolved_ = false;
     }
 
 private:
-    std::vector<double> xVals_;
-    std::vector<double> yVals_;
-    std::vector<double> params_;
+    inline int32_t GetSlot(int32_t index) const
+    {
+        return (head_ - GetPointNum() + index + MAX_COUNT_NUM) % MAX_COUNT_NUM;
+    }
+
+    bool SolveQuadratic(int32_t countNum, std::array<double, MAX_PARAMS_NUM>& params) const;
+    bool SolveCubic(int32_t countNum, std::array<double, MAX_PARAMS_NUM>& params) const;
+
+    std::array<double, MAX_COUNT_NUM> xVals_ {};
+    std::array<double, MAX_COUNT_NUM> yVals_ {};
+    std::array<double, MAX_PARAMS_NUM> params_ {};
+    int32_t head_ = 0;
+    int32_t trackNum_ = 0;
     int32_t paramsNum_ = 4;
     int32_t countNum_ = 4;
     bool isResolved_ = false;
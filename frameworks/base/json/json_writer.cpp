@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "base/json/json_writer.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "cJSON.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr size_t NUMBER_BUFFER_SIZE = 32;
+constexpr size_t MIN_PRINT_SIZE = 256;
+constexpr size_t MAX_PRINT_SIZE = INT_MAX;
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+constexpr uint32_t HEX_SHIFT = 4;
+constexpr uint8_t HEX_MASK = 0x0f;
+constexpr unsigned char FIRST_PRINTABLE_CHAR = 32;
+
+// cJSON prints numbers that equal their int value with %d, the others with the shortest of %1.15g and %1.17g that
+// reads back the same.
+size_t FormatNumber(double value, char* buffer)
+{
+    if (std::isnan(value) || std::isinf(value)) {
+        return static_cast<size_t>(snprintf(buffer, NUMBER_BUFFER_SIZE, "null"));
+    }
+    int32_t intValue = 0;
+    if (value >= INT_MAX) {
+        intValue = INT_MAX;
+    } else if (value <= static_cast<double>(INT_MIN)) {
+        intValue = INT_MIN;
+    } else {
+        intValue = static_cast<int32_t>(value);
+    }
+    if (value == static_cast<double>(intValue)) {
+        return static_cast<size_t>(snprintf(buffer, NUMBER_BUFFER_SIZE, "%d", intValue));
+    }
+    auto length = snprintf(buffer, NUMBER_BUFFER_SIZE, "%1.15g", value);
+    double readBack = std::strtod(buffer, nullptr);
+    double maxValue = std::max(std::fabs(readBack), std::fabs(value));
+    if (std::fabs(readBack - value) > maxValue * DBL_EPSILON) {
+        length = snprintf(buffer, NUMBER_BUFFER_SIZE, "%1.17g", value);
+    }
+    return static_cast<size_t>(length);
+}
+
+char GetEscapeChar(unsigned char c)
+{
+    switch (c) {
+        case '\"':
+            return '\"';
+        case '\\':
+            return '\\';
+        case '\b':
+            return 'b';
+        case '\f':
+            return 'f';
+        case '\n':
+            return 'n';
+        case '\r':
+            return 'r';
+        case '\t':
+            return 't';
+        default:
+            return '\0';
+    }
+}
+} // namespace
+
+void JsonWriter::BeforeValue()
+{
+    if (afterKey_) {
+        afterKey_ = false;
+        return;
+    }
+    if (hasItem_.empty()) {
+        return;
+    }
+    if (hasItem_.back()) {
+        buffer_.push_back(',');
+    }
+    hasItem_.back() = true;
+}
+
+void JsonWriter::StartObject()
+{
+    BeforeValue();
+    buffer_.push_back('{');
+    hasItem_.push_back(false);
+}
+
+void JsonWriter::EndObject()
+{
+    buffer_.push_back('}');
+    if (!hasItem_.empty()) {
+        hasItem_.pop_back();
+    }
+}
+
+bool JsonWriter::ReopenObject()
+{
+    if (afterKey_ || buffer_.empty() || buffer_.back() != '}') {
+        return false;
+    }
+    buffer_.pop_back();
+    hasItem_.push_back(!buffer_.empty() && buffer_.back() != '{');
+    return true;
+}
+
+void JsonWriter::StartArray()
+{
+    BeforeValue();
+    buffer_.push_back('[');
+    hasItem_.push_back(false);
+}
+
+void JsonWriter::EndArray()
+{
+    buffer_.push_back(']');
+    if (!hasItem_.empty()) {
+        hasItem_.pop_back();
+    }
+}
+
+void JsonWriter::Key(const char* key)
+{
+    BeforeValue();
+    WriteEscaped(key, key ? strlen(key) : 0);
+    buffer_.push_back(':');
+    afterKey_ = true;
+}
+
+void JsonWriter::WriteEscaped(const char* value, size_t length)
+{
+    buffer_.push_back('\"');
+    size_t runStart = 0;
+    for (size_t i = 0; i < length; ++i) {
+        auto c = static_cast<unsigned char>(value[i]);
+        if (c >= FIRST_PRINTABLE_CHAR && c != '\"' && c != '\\') {
+            continue;
+        }
+        buffer_.append(value + runStart, i - runStart);
+        runStart = i + 1;
+        buffer_.push_back('\\');
+        auto escape = GetEscapeChar(c);
+        if (escape != '\0') {
+            buffer_.push_back(escape);
+        } else {
+            buffer_.append("u00");
+            buffer_.push_back(HEX_DIGITS[c >> HEX_SHIFT]);
+            buffer_.push_back(HEX_DIGITS[c & HEX_MASK]);
+        }
+    }
+    buffer_.append(value + runStart, length - runStart);
+    buffer_.push_back('\"');
+}
+
+void JsonWriter::String(const char* value)
+{
+    BeforeValue();
+    WriteEscaped(value, value ? strlen(value) : 0);
+}
+
+void JsonWriter::String(const std::string& value)
+{
+    BeforeValue();
+    WriteEscaped(value.c_str(), value.size());
+}
+
+void JsonWriter::Int(int32_t value)
+{
+    Double(static_cast<double>(value));
+}
+
+void JsonWriter::Double(double value)
+{
+    BeforeValue();
+    char number[NUMBER_BUFFER_SIZE] = { 0 };
+    auto length = FormatNumber(value, number);
+    buffer_.append(number, std::min(length, NUMBER_BUFFER_SIZE - 1));
+}
+
+void JsonWriter::Bool(bool value)
+{
+    BeforeValue();
+    buffer_.append(value ? "true" : "false");
+}
+
+void JsonWriter::Null()
+{
+    BeforeValue();
+    buffer_.append("null");
+}
+
+bool JsonWriter::WriteJsonObject(const JsonObject* object)
+{
+    // print into the free tail of the buffer, growing it until the tree fits.
+    auto start = buffer_.size();
+    auto printSize = std::max(printSize_, MIN_PRINT_SIZE);
+    while (printSize <= MAX_PRINT_SIZE) {
+        buffer_.resize(start + printSize);
+        if (cJSON_PrintPreallocated(const_cast<JsonObject*>(object), buffer_.data() + start,
+            static_cast<int>(printSize), false)) {
+            buffer_.resize(start + strlen(buffer_.data() + start));
+            printSize_ = printSize;
+            return true;
+        }
+        printSize *= 2;
+    }
+    buffer_.resize(start);
+    return false;
+}
+
+bool JsonWriter::Value(const std::unique_ptr<JsonValue>& value)
+{
+    if (!value || !value->GetJsonObject()) {
+        return false;
+    }
+    auto mark = GetMark();
+    BeforeValue();
+    if (!WriteJsonObject(value->GetJsonObject())) {
+        Rollback(mark);
+        return false;
+    }
+    return true;
+}
+
+void JsonWriter::Put(const char* key, const char* value)
+{
+    Key(key);
+    String(value);
+}
+
+void JsonWriter::Put(const char* key, size_t value)
+{
+    Key(key);
+    Double(static_cast<double>(value));
+}
+
+void JsonWriter::Put(const char* key, int32_t value)
+{
+    Key(key);
+    Int(value);
+}
+
+void JsonWriter::Put(const char* key, int64_t value)
+{
+    Key(key);
+    Double(static_cast<double>(value));
+}
+
+void JsonWriter::Put(const char* key, double value)
+{
+    Key(key);
+    Double(value);
+}
+
+void JsonWriter::Put(const char* key, bool value)
+{
+    Key(key);
+    Bool(value);
+}
+
+bool JsonWriter::Put(const char* key, const std::unique_ptr<JsonValue>& value)
+{
+    if (!value || !value->GetJsonObject()) {
+        return false;
+    }
+    auto mark = GetMark();
+    Key(key);
+    if (!Value(value)) {
+        Rollback(mark);
+        return false;
+    }
+    return true;
+}
+
+JsonWriter::Mark JsonWriter::GetMark() const
+{
+    return { buffer_.size(), hasItem_.size(), !hasItem_.empty() && hasItem_.back(), afterKey_ };
+}
+
+void JsonWriter::Rollback(const Mark& mark)
+{
+    if (mark.size > buffer_.size() || mark.depth > hasItem_.size()) {
+        return;
+    }
+    buffer_.resize(mark.size);
+    hasItem_.resize(mark.depth);
+    if (!hasItem_.empty()) {
+        hasItem_.back() = mark.hasItem;
+    }
+    afterKey_ = mark.afterKey;
+}
+
+std::string JsonWriter::ReleaseString()
+{
+    std::string result = std::move(buffer_);
+    Clear();
+    return result;
+}
+
+void JsonWriter::Clear()
+{
+    buffer_.clear();
+    hasItem_.clear();
+    afterKey_ = false;
+}
+
+} // namespace OHOS::Ace
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_WRITER_H
+#define FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/json/json_util.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// Writes unformatted json straight into one growing buffer, in the same format as JsonValue::ToString, without
+// building a cJSON tree first. Members are written in call order; the writer only inserts separators and does not
+// check that the calls form valid json. Clear keeps the buffer capacity, so one writer can be reused.
+class ACE_FORCE_EXPORT JsonWriter final {
+public:
+    // Position of the writer, to drop what was written after it.
+    struct Mark {
+        size_t size = 0;
+        size_t depth = 0;
+        bool hasItem = false;
+        bool afterKey = false;
+    };
+
+    JsonWriter() = default;
+    ~JsonWriter() = default;
+
+    void StartObject();
+    void EndObject();
+    void StartArray();
+    void EndArray();
+    // Writes the key of the next object member.
+    void Key(const char* key);
+
+    void String(const char* value);
+    void String(const std::string& value);
+    void Int(int32_t value);
+    void Double(double value);
+    void Bool(bool value);
+    void Null();
+    // Writes the cJSON tree of value. Writes nothing and returns false for an empty value.
+    bool Value(const std::unique_ptr<JsonValue>& value);
+
+    // Object members, with the same overloads and number conversions as JsonValue::Put.
+    void Put(const char* key, const char* value);
+    void Put(const char* key, size_t value);
+    void Put(const char* key, int32_t value);
+    void Put(const char* key, int64_t value);
+    void Put(const char* key, double value);
+    void Put(const char* key, bool value);
+    bool Put(const char* key, const std::unique_ptr<JsonValue>& value);
+
+    // Reopens the object written last so more members can be appended to it. Returns false and writes nothing if
+    // the last value written is not a closed object.
+    bool ReopenObject();
+
+    Mark GetMark() const;
+    // Drops everything written after mark. The writer must not have closed the container mark was taken in.
+    void Rollback(const Mark& mark);
+
+    size_t GetSize() const
+    {
+        return buffer_.size();
+    }
+
+    // Written bytes, callers may rewrite them in place as long as the size does not change.
+    char* GetData()
+    {
+        return buffer_.data();
+    }
+
+    const std::string& GetString() const
+    {
+        return buffer_;
+    }
+
+    // Moves the written json out and leaves the writer empty.
+    std::string ReleaseString();
+    void Clear();
+
+private:
+    void BeforeValue();
+    void WriteEscaped(const char* value, size_t length);
+    bool WriteJsonObject(const JsonObject* object);
+
+    std::string buffer_;
+    // whether each open container already holds an item, so the next one needs a separator.
+    std::vector<uint8_t> hasItem_;
+    bool afterKey_ = false;
+    // buffer size the last cJSON tree needed, the next one starts printing with it.
+    size_t printSize_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(JsonWriter);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_BASE_JSON_JSON_WRITER_H
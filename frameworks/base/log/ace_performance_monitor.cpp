@@ -88,7 +88,7 @@ void ArkUIPerfMonitor::RecordStateMgmtNode(int64_t num)
 
 void ArkUIPerfMonitor::RecordLayoutNode(int64_t num)
 {
-    layoutNodeNum_ += num;
+    layoutNodeNum_.fetch_add(num, std::memory_order_relaxed);
 }
 
 void ArkUIPerfMonitor::RecordRenderNode(int64_t num)
@@ -138,7 +138,7 @@ void ArkUIPerfMonitor::FlushPerfMonitor()
                      timeSlice_[MonitorTag::STATIC_API];
     auto json = JsonUtil::Create(true);
     json->Put("state_mgmt", stateMgmtNodeNum_);
-    json->Put("layout", layoutNodeNum_);
+    json->Put("layout", layoutNodeNum_.load(std::memory_order_relaxed));
     json->Put("render", renderNodeNum_);
     json->Put("property", propertyNum_);
     json->Put("total", total);
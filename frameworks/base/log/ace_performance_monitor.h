@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_ACE_PERFORMANCE_MONITOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_ACE_PERFORMANCE_MONITOR_H
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
 #include <map>
@@ -73,7 +74,8 @@ private:
     std::map<MonitorTag, int64_t> timeSlice_;
     int64_t propertyNum_;
     int64_t stateMgmtNodeNum_;
-    int64_t layoutNodeNum_;
+    // measure can run on background threads, see UITaskScheduler::FlushParallelMeasureTask.
+    std::atomic<int64_t> layoutNodeNum_;
     int64_t renderNodeNum_;
     TimePoint begin_;
     TimePoint end_;
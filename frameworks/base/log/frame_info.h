@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_INFO_H
 #define FOUNDATION_ACE_FRAMEWORKS_BASE_LOG_FRAME_INFO_H
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -39,12 +40,17 @@ struct TaskInfo {
 };
 
 struct FrameInfo {
-    enum class TaskType { LAYOUT, RENDER };
+    enum class TaskType { LAYOUT, RENDER, IDLE };
 
     uint64_t frameRecvTime_ = 0;
     uint64_t frameTimeStamp_ = 0;
     std::vector<TaskInfo> layoutInfos_;
     std::vector<TaskInfo> renderInfos_;
+    std::vector<TaskInfo> idleInfos_;
+    // idle period after the frame: time until the deadline, time used and tasks left for the next idle period.
+    uint64_t idleBudget_ = 0;
+    uint64_t idleTime_ = 0;
+    uint64_t idlePendingCount_ = 0;
 
     void AddTaskInfo(const std::string& tag, const int32_t id, uint64_t time, TaskType type)
     {
@@ -55,9 +61,31 @@ struct FrameInfo {
             case TaskType::RENDER:
                 renderInfos_.push_back({ tag, id, time});
                 break;
+            case TaskType::IDLE:
+                idleInfos_.push_back({ tag, id, time});
+                break;
         }
     }
 
+    void AddIdleInfo(uint64_t budget, uint64_t time, uint64_t pendingCount)
+    {
+        idleBudget_ += budget;
+        idleTime_ += time;
+        idlePendingCount_ = pendingCount;
+    }
+
+    const std::string GetIdleInfo() const
+    {
+        std::string info;
+        info.append("budget: ");
+        info.append(std::to_string(idleBudget_));
+        info.append(", \ttime cost: ");
+        info.append(std::to_string(idleTime_));
+        info.append(", \tpending: ");
+        info.append(std::to_string(idlePendingCount_));
+        return info;
+    }
+
     const std::string GetTimeInfo() const
     {
         std::string info;
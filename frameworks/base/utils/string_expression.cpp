@@ -15,6 +15,8 @@
 
 #include "base/utils/string_expression.h"
 
+#include <algorithm>
+#include <array>
 #include <regex>
 
 #include "base/log/log.h"
@@ -303,4 +305,127 @@ double CalculateExp(const std::string& expression, const std::function<double(co
     }
     return 0.0;
 }
+
+namespace {
+// the depth of the stack CompiledExp calculates on without allocating.
+constexpr size_t COMPILED_EXP_STACK_SIZE = 16;
+
+// The unit checks of CalculateFourOperationsExp, which only depend on whether the operands have a unit.
+bool IsUnitMismatched(char op, bool hasUnit1, bool hasUnit2)
+{
+    switch (op) {
+        case '+':
+        case '-':
+            return hasUnit1 != hasUnit2;
+        case '*':
+            return hasUnit1 && hasUnit2;
+        case '/':
+            return hasUnit1;
+        default:
+            return false;
+    }
+}
+
+double NormalizeToPx(const Dimension& dim, double vpScale, double fpScale, double lpxScale, double parentLength)
+{
+    double result = -1.0;
+    dim.NormalizeToPx(vpScale, fpScale, lpxScale, parentLength, result);
+    return result;
+}
+} // namespace
+
+std::shared_ptr<const CompiledExp> CompiledExp::Compile(const std::string& expression)
+{
+    auto compiledExp = std::make_shared<CompiledExp>();
+    std::string ops = "+-*/()";
+    std::vector<Token> tokens;
+    // whether each value on the stack has a unit, as CalculateExpImpl would have it.
+    std::vector<bool> hasUnits;
+    for (const auto& item : ConvertDal2Rpn(expression)) {
+        if (ops.find(item) == ops.npos) {
+            std::string value = item;
+            Dimension dim = StringUtils::StringToDimensionWithUnit(value, DimensionUnit::PX, 0.0f, true);
+            if (dim.Unit() == DimensionUnit::INVALID) {
+                return compiledExp;
+            }
+            tokens.push_back({ dim, 0 });
+            hasUnits.push_back(dim.Unit() != DimensionUnit::NONE);
+            compiledExp->depth_ = std::max(compiledExp->depth_, hasUnits.size());
+            continue;
+        }
+        if (hasUnits.size() <= 1) {
+            return compiledExp;
+        }
+        bool hasUnit1 = hasUnits.back();
+        hasUnits.pop_back();
+        bool hasUnit2 = hasUnits.back();
+        hasUnits.pop_back();
+        if (IsUnitMismatched(item[0], hasUnit1, hasUnit2)) {
+            return compiledExp;
+        }
+        tokens.push_back({ Dimension(), item[0] });
+        hasUnits.push_back(hasUnit1 || hasUnit2);
+    }
+    if (hasUnits.size() != 1 || !hasUnits.back()) {
+        return compiledExp;
+    }
+    compiledExp->tokens_ = std::move(tokens);
+    compiledExp->isValid_ = true;
+    return compiledExp;
+}
+
+double CompiledExp::Calculate(double vpScale, double fpScale, double lpxScale, double parentLength) const
+{
+    if (!isValid_) {
+        return 0.0;
+    }
+    if (depth_ <= COMPILED_EXP_STACK_SIZE) {
+        std::array<Dimension, COMPILED_EXP_STACK_SIZE> stack;
+        return CalculateOnStack(stack.data(), vpScale, fpScale, lpxScale, parentLength);
+    }
+    std::vector<Dimension> stack(depth_);
+    return CalculateOnStack(stack.data(), vpScale, fpScale, lpxScale, parentLength);
+}
+
+double CompiledExp::CalculateOnStack(
+    Dimension* stack, double vpScale, double fpScale, double lpxScale, double parentLength) const
+{
+    size_t size = 0;
+    // an operator without an operation of its own pushes the last result, as in CalculateExpImpl.
+    double opRes = 0.0;
+    for (const auto& token : tokens_) {
+        if (token.op == 0) {
+            stack[size++] = token.value;
+            continue;
+        }
+        const Dimension& num1 = stack[size - 1];
+        const Dimension& num2 = stack[size - 2];
+        double value1 = NormalizeToPx(num1, vpScale, fpScale, lpxScale, parentLength);
+        double value2 = NormalizeToPx(num2, vpScale, fpScale, lpxScale, parentLength);
+        switch (token.op) {
+            case '+':
+                opRes = value2 + value1;
+                break;
+            case '-':
+                opRes = value2 - value1;
+                break;
+            case '*':
+                opRes = value2 * value1;
+                break;
+            case '/':
+                if (NearZero(value1)) {
+                    return 0.0;
+                }
+                opRes = value2 / value1;
+                break;
+            default:
+                break;
+        }
+        auto unit = (num1.Unit() == DimensionUnit::NONE && num2.Unit() == DimensionUnit::NONE) ? DimensionUnit::NONE
+                                                                                              : DimensionUnit::PX;
+        size -= 2;
+        stack[size++] = Dimension(opRes, unit);
+    }
+    return NormalizeToPx(stack[0], vpScale, fpScale, lpxScale, parentLength);
+}
 } // namespace OHOS::Ace::StringExpression
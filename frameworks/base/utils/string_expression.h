@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -35,6 +36,32 @@ std::vector<std::string> ConvertDal2Rpn(std::string formula);
 
 double CalculateExp(const std::string& expression, const std::function<double(const Dimension&)>& calcFunc);
 
+// A calc expression parsed once into the reverse polish notation with its values and units resolved, so it can be
+// calculated for every layout without parsing the string again. The result is the same as CalculateExp with a
+// calcFunc normalizing the dimensions to px by the scales.
+class CompiledExp final {
+public:
+    static std::shared_ptr<const CompiledExp> Compile(const std::string& expression);
+
+    // Calculates the expression without any allocation unless it nests deeper than the stack on hand.
+    double Calculate(double vpScale, double fpScale, double lpxScale, double parentLength) const;
+
+private:
+    struct Token {
+        Dimension value;
+        // one of the operators of the expression, or 0 for a value.
+        char op = 0;
+    };
+
+    double CalculateOnStack(
+        Dimension* stack, double vpScale, double fpScale, double lpxScale, double parentLength) const;
+
+    std::vector<Token> tokens_;
+    size_t depth_ = 0;
+    // the expression fails on its units or its form whatever the scales are, it calculates to 0.
+    bool isValid_ = false;
+};
+
 #ifdef ACE_UNITTEST
 bool PushOpStack(const std::string& formula, std::string& curNum, std::vector<std::string>& result,
     std::vector<std::string>& opStack);
@@ -15,6 +15,8 @@
 
 #include "base/utils/string_utils.h"
 
+#include "base/utils/utf.h"
+
 #ifndef WINDOWS_PLATFORM
 #include "securec.h"
 #endif
@@ -29,6 +31,20 @@ const std::wstring DEFAULT_WSTRING = L"error";
 const std::u16string DEFAULT_USTRING = u"error";
 const std::u32string DEFAULT_U32STRING = U"error";
 
+std::u16string Str8ToStr16(const std::string& str)
+{
+    std::u16string result;
+    Utf8ToUtf16(str, result);
+    return result;
+}
+
+std::string Str16ToStr8(const std::u16string& str)
+{
+    std::string result;
+    Utf16ToUtf8(str, result);
+    return result;
+}
+
 const std::string FormatString(const char* fmt, ...)
 {
     va_list args;
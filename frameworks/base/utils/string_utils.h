@@ -44,25 +44,10 @@ constexpr double GRADIANS_VALUE = 400.0; // one turn means 400 grad
 constexpr double RADIANS_VALUE = 2 * M_PI; // one turn means 2*pi rad
 const char ELLIPSIS[] = "...";
 
-inline std::u16string Str8ToStr16(const std::string& str)
-{
-    if (str == DEFAULT_STRING) {
-        return DEFAULT_USTRING;
-    }
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert(DEFAULT_STRING, DEFAULT_USTRING);
-    std::u16string result = convert.from_bytes(str);
-    return result == DEFAULT_USTRING ? u"" : result;
-}
+// An ill-formed text converts to an empty string.
+ACE_FORCE_EXPORT std::u16string Str8ToStr16(const std::string& str);
 
-inline std::string Str16ToStr8(const std::u16string& str)
-{
-    if (str == DEFAULT_USTRING) {
-        return DEFAULT_STRING;
-    }
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert(DEFAULT_STRING);
-    std::string result = convert.to_bytes(str);
-    return result == DEFAULT_STRING ? "" : result;
-}
+ACE_FORCE_EXPORT std::string Str16ToStr8(const std::u16string& str);
 
 inline std::wstring ToWstring(const std::string& str)
 {
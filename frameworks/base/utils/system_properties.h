@@ -449,6 +449,43 @@ public:
         return imageFileCacheConvertAstcThreshold_;
     }
 
+    static bool IsImageFileCachePackEnabled()
+    {
+        return imageFileCachePackEnabled_;
+    }
+
+    // in MB, 0 disables the cache.
+    static int32_t GetImageDecodedCacheSize()
+    {
+        return imageDecodedCacheSize_;
+    }
+
+    // in MB, 0 disables the cache.
+    static int32_t GetImageObjectCacheSize()
+    {
+        return imageObjectCacheSize_;
+    }
+
+    static bool IsTextParagraphCacheEnabled()
+    {
+        return textParagraphCacheEnabled_;
+    }
+
+    static void SetTextParagraphCacheEnabled(bool textParagraphCacheEnabled)
+    {
+        textParagraphCacheEnabled_ = textParagraphCacheEnabled;
+    }
+
+    static bool IsSvgDomCacheEnabled()
+    {
+        return svgDomCacheEnabled_;
+    }
+
+    static void SetSvgDomCacheEnabled(bool svgDomCacheEnabled)
+    {
+        svgDomCacheEnabled_ = svgDomCacheEnabled;
+    }
+
     static void SetExtSurfaceEnabled(bool extSurfaceEnabled)
     {
         extSurfaceEnabled_ = extSurfaceEnabled;
@@ -495,6 +532,8 @@ public:
 
     static bool GetGridIrregularLayoutEnabled();
 
+    static bool GetParallelLayoutEnabled();
+
     static bool WaterFlowUseSegmentedLayout();
 
     static bool GetSideBarContainerBlurEnable();
@@ -583,6 +622,11 @@ private:
     static int32_t astcPsnr_;
     static bool imageFileCacheConvertAstc_;
     static int32_t imageFileCacheConvertAstcThreshold_;
+    static bool imageFileCachePackEnabled_;
+    static int32_t imageDecodedCacheSize_;
+    static int32_t imageObjectCacheSize_;
+    static bool textParagraphCacheEnabled_;
+    static bool svgDomCacheEnabled_;
     static bool extSurfaceEnabled_;
     static uint32_t dumpFrameCount_;
     static bool resourceDecoupling_;
@@ -15,10 +15,18 @@
 
 #include "utf.h"
 
+#include <algorithm>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <tuple>
 
+#if defined(__aarch64__)
+#include <arm_neon.h>
+#elif defined(__SSE2__) && defined(__x86_64__)
+#include <emmintrin.h>
+#endif
+
 namespace OHOS::Ace {
 
 /*
@@ -211,18 +219,23 @@ size_t DebuggerConvertRegionUtf16ToUtf8(const uint16_t* utf16In, uint8_t* utf8Ou
 
 bool IsUTF8(std::string& data)
 {
-    if (data.empty()) {
+    return IsUTF8(reinterpret_cast<const uint8_t*>(data.c_str()), data.size());
+}
+
+bool IsUTF8(const uint8_t* data, size_t size)
+{
+    if (size == 0) {
         return false;
     }
 
     bool hasZeroByte = false;
     bool hasMultiByteUTF8 = false;
 
-    for (size_t i = 0; i < data.size(); ++i) {
+    for (size_t i = 0; i < size; ++i) {
         unsigned char c = data[i];
 
         // Check for UTF-16LE byte order mark (BOM)
-        if (i == 0 && data.size() >= INDEX_TWO && data[INDEX_ONE] == UTF16LE_ZERO_BYTE &&
+        if (i == 0 && size >= INDEX_TWO && data[INDEX_ONE] == UTF16LE_ZERO_BYTE &&
             (c == UTF16LE_BOM_FF || c == UTF16LE_BOM_FE)) {
             return false;
         }
@@ -234,18 +247,18 @@ bool IsUTF8(std::string& data)
 
         // Check for multi-byte UTF-8 sequences
         if ((c & UTF8_HIGH_BIT) != 0) { // High bit is set, indicating a non-ASCII character
-            if ((c & UTF8_TWO_BYTE_MASK) == UTF8_TWO_BYTE_PATTERN && i + INDEX_ONE < data.size() &&
+            if ((c & UTF8_TWO_BYTE_MASK) == UTF8_TWO_BYTE_PATTERN && i + INDEX_ONE < size &&
                 (data[i + INDEX_ONE ] & UTF8_HIGH_BIT) == UTF8_MULTIBYTE_FOLLOWER) {
                 // Two-byte UTF-8 character
                 hasMultiByteUTF8 = true;
                 i += INDEX_ONE; // Skip the next byte
-            } else if ((c & UTF8_THREE_BYTE_MASK) == UTF8_THREE_BYTE_PATTERN && i + INDEX_TWO < data.size() &&
+            } else if ((c & UTF8_THREE_BYTE_MASK) == UTF8_THREE_BYTE_PATTERN && i + INDEX_TWO < size &&
                        (data[i + INDEX_ONE] & UTF8_HIGH_BIT) == UTF8_MULTIBYTE_FOLLOWER &&
                        (data[i + INDEX_TWO] & UTF8_HIGH_BIT) == UTF8_MULTIBYTE_FOLLOWER) {
                 // Three-byte UTF-8 character
                 hasMultiByteUTF8 = true;
                 i += INDEX_TWO; // Skip the next two bytes
-            } else if ((c & UTF8_FOUR_BYTE_MASK) == UTF8_FOUR_BYTE_PATTERN && i + INDEX_THREE < data.size() &&
+            } else if ((c & UTF8_FOUR_BYTE_MASK) == UTF8_FOUR_BYTE_PATTERN && i + INDEX_THREE < size &&
                        (data[i + INDEX_ONE] & UTF8_HIGH_BIT) == UTF8_MULTIBYTE_FOLLOWER &&
                        (data[i + INDEX_TWO] & UTF8_HIGH_BIT) == UTF8_MULTIBYTE_FOLLOWER &&
                        (data[i + INDEX_THREE] & UTF8_HIGH_BIT) == UTF8_MULTIBYTE_FOLLOWER) {
@@ -270,9 +283,12 @@ bool IsUTF8(std::string& data)
 
 void ConvertIllegalStr(std::string& str)
 {
-    if (IsUTF8(str)) {
-        uint8_t* buf8 = (uint8_t*)str.c_str();
-        size_t utf8Len = str.size();
+    ConvertIllegalStr(reinterpret_cast<uint8_t*>(str.data()), str.size());
+}
+
+void ConvertIllegalStr(uint8_t* buf8, size_t utf8Len)
+{
+    if (IsUTF8(buf8, utf8Len)) {
         auto utf16Len = MUtf8ToUtf16Size(buf8, utf8Len);
         std::unique_ptr<uint16_t[]> buf16 = std::make_unique<uint16_t[]>(utf16Len);
         auto resultLen = ConvertRegionUtf8ToUtf16(buf8, buf16.get(), utf8Len, utf16Len, 0);
@@ -282,4 +298,601 @@ void ConvertIllegalStr(std::string& str)
     }
 }
 
+namespace {
+// the fast paths take 16 bytes of UTF-8 or 8 code units of UTF-16 at a time, the width of a vector register.
+constexpr size_t UTF8_BLOCK_SIZE = 16;
+constexpr size_t UTF16_BLOCK_SIZE = 8;
+constexpr uint32_t INVALID_CODE_POINT = std::numeric_limits<uint32_t>::max();
+
+constexpr uint8_t UTF8_FOLLOWER_MASK = 0xc0;
+constexpr uint8_t UTF8_FOLLOWER_MIN = 0x80;
+constexpr uint8_t UTF8_FOLLOWER_MAX = 0xbf;
+constexpr uint8_t UTF8_2B_FIRST_MAX = 0xdf;
+constexpr uint8_t UTF8_3B_FIRST_MAX = 0xef;
+constexpr uint8_t UTF8_3B_SURROGATE_FIRST = 0xed;
+constexpr uint8_t UTF8_3B_SURROGATE_SECOND_MIN = 0xa0; // 0xeda080 is the first surrogate, 0xd800
+constexpr uint8_t UTF8_4B_FIRST_MAX = 0xf4;
+constexpr uint8_t UTF8_4B_LAST_SECOND_MAX = 0x8f; // the maximum for 4 bytes is 0x10ffff, which is 0xf48fbfbf
+constexpr uint32_t MASK_3BIT = 0x07;
+
+// a code unit takes 2 bytes of UTF-8 with one of the bits of the first mask, 3 bytes with one of the second.
+constexpr uint16_t UTF16_2B_MASK = 0xff80;
+constexpr uint16_t UTF16_3B_MASK = 0xf800;
+
+// Each branch below has the same kernels, which go through the whole blocks at the start of a text and return the count
+// of code units they went through. AsciiBlocksSize stops at the first block that is not ASCII, WidenAsciiBlocks and
+// NarrowAsciiBlocks copy the blocks of ASCII between the encodings, and CountBmpBlocks adds the UTF-8 size of the
+// blocks up to the first one with a surrogate. CountUtf16Blocks and CountUtf8Blocks add the size of all the blocks,
+// counted as if they were well-formed.
+#if defined(__aarch64__)
+constexpr int BYTE_HIGH_BIT = 7;
+constexpr int LANE_HIGH_BIT = 15;
+
+size_t AsciiBlocksSize(const uint8_t* utf8, size_t len)
+{
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len; index += UTF8_BLOCK_SIZE) {
+        if (vmaxvq_u8(vld1q_u8(utf8 + index)) > UTF8_1B_MAX) {
+            break;
+        }
+    }
+    return index;
+}
+
+size_t WidenAsciiBlocks(const uint8_t* utf8, size_t len, char16_t* utf16)
+{
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len; index += UTF8_BLOCK_SIZE) {
+        uint8x16_t block = vld1q_u8(utf8 + index);
+        if (vmaxvq_u8(block) > UTF8_1B_MAX) {
+            break;
+        }
+        auto* out = reinterpret_cast<uint16_t*>(utf16 + index);
+        vst1q_u16(out, vmovl_u8(vget_low_u8(block)));
+        vst1q_u16(out + UTF16_BLOCK_SIZE, vmovl_high_u8(block));
+    }
+    return index;
+}
+
+size_t NarrowAsciiBlocks(const char16_t* utf16, size_t len, uint8_t* utf8)
+{
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        uint16x8_t block = vld1q_u16(reinterpret_cast<const uint16_t*>(utf16 + index));
+        if (vmaxvq_u16(block) > UTF8_1B_MAX) {
+            break;
+        }
+        vst1_u8(utf8 + index, vmovn_u16(block));
+    }
+    return index;
+}
+
+size_t CountBmpBlocks(const char16_t* utf16, size_t len, size_t& utf8Size)
+{
+    const uint16x8_t surrogateMask = vdupq_n_u16(SURROGATE_MASK);
+    const uint16x8_t surrogate = vdupq_n_u16(DECODE_LEAD_LOW);
+    const uint16x8_t twoBytesMin = vdupq_n_u16(UTF8_1B_MAX + 1);
+    const uint16x8_t threeBytesMin = vdupq_n_u16(UTF8_2B_MAX + 1);
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        uint16x8_t block = vld1q_u16(reinterpret_cast<const uint16_t*>(utf16 + index));
+        if (vmaxvq_u16(vceqq_u16(vandq_u16(block, surrogateMask), surrogate)) != 0) {
+            break;
+        }
+        uint16x8_t extraBytes = vaddq_u16(vshrq_n_u16(vcgeq_u16(block, twoBytesMin), LANE_HIGH_BIT),
+            vshrq_n_u16(vcgeq_u16(block, threeBytesMin), LANE_HIGH_BIT));
+        utf8Size += UTF16_BLOCK_SIZE + vaddvq_u16(extraBytes);
+    }
+    return index;
+}
+
+size_t CountUtf16Blocks(const uint8_t* utf8, size_t len, size_t& utf16Size)
+{
+    const uint8x16_t followerMask = vdupq_n_u8(UTF8_FOLLOWER_MASK);
+    const uint8x16_t follower = vdupq_n_u8(UTF8_FOLLOWER_MIN);
+    const uint8x16_t fourBytesFirst = vdupq_n_u8(UTF8_4B_FIRST);
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len; index += UTF8_BLOCK_SIZE) {
+        uint8x16_t block = vld1q_u8(utf8 + index);
+        uint8x16_t notFollowers = vmvnq_u8(vceqq_u8(vandq_u8(block, followerMask), follower));
+        uint8x16_t units = vaddq_u8(vshrq_n_u8(notFollowers, BYTE_HIGH_BIT),
+            vshrq_n_u8(vcgeq_u8(block, fourBytesFirst), BYTE_HIGH_BIT));
+        utf16Size += vaddvq_u8(units);
+    }
+    return index;
+}
+
+size_t CountUtf8Blocks(const char16_t* utf16, size_t len, size_t& utf8Size)
+{
+    const uint16x8_t surrogateMask = vdupq_n_u16(SURROGATE_MASK);
+    const uint16x8_t surrogate = vdupq_n_u16(DECODE_LEAD_LOW);
+    const uint16x8_t twoBytesMin = vdupq_n_u16(UTF8_1B_MAX + 1);
+    const uint16x8_t threeBytesMin = vdupq_n_u16(UTF8_2B_MAX + 1);
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        uint16x8_t block = vld1q_u16(reinterpret_cast<const uint16_t*>(utf16 + index));
+        uint16x8_t extraBytes = vaddq_u16(vshrq_n_u16(vcgeq_u16(block, twoBytesMin), LANE_HIGH_BIT),
+            vshrq_n_u16(vcgeq_u16(block, threeBytesMin), LANE_HIGH_BIT));
+        uint16x8_t surrogates =
+            vshrq_n_u16(vceqq_u16(vandq_u16(block, surrogateMask), surrogate), LANE_HIGH_BIT);
+        utf8Size += UTF16_BLOCK_SIZE + vaddvq_u16(extraBytes) - vaddvq_u16(surrogates);
+    }
+    return index;
+}
+#elif defined(__SSE2__) && defined(__x86_64__)
+// _mm_movemask_epi8 gives a bit for each byte, two for each code unit.
+constexpr int ALL_LANES = 0xffff;
+
+size_t AsciiBlocksSize(const uint8_t* utf8, size_t len)
+{
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len; index += UTF8_BLOCK_SIZE) {
+        if (_mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8 + index))) != 0) {
+            break;
+        }
+    }
+    return index;
+}
+
+size_t WidenAsciiBlocks(const uint8_t* utf8, size_t len, char16_t* utf16)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len; index += UTF8_BLOCK_SIZE) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8 + index));
+        if (_mm_movemask_epi8(block) != 0) {
+            break;
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16 + index), _mm_unpacklo_epi8(block, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(utf16 + index + UTF16_BLOCK_SIZE), _mm_unpackhi_epi8(block, zero));
+    }
+    return index;
+}
+
+size_t NarrowAsciiBlocks(const char16_t* utf16, size_t len, uint8_t* utf8)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i nonAsciiMask = _mm_set1_epi16(static_cast<int16_t>(UTF16_2B_MASK));
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16 + index));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(block, nonAsciiMask), zero)) != ALL_LANES) {
+            break;
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(utf8 + index), _mm_packus_epi16(block, block));
+    }
+    return index;
+}
+
+size_t CountBmpBlocks(const char16_t* utf16, size_t len, size_t& utf8Size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i twoBytesMask = _mm_set1_epi16(static_cast<int16_t>(UTF16_2B_MASK));
+    const __m128i threeBytesMask = _mm_set1_epi16(static_cast<int16_t>(UTF16_3B_MASK));
+    const __m128i surrogate = _mm_set1_epi16(static_cast<int16_t>(DECODE_LEAD_LOW));
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i sums = zero;
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16 + index));
+        __m128i threeBytesBits = _mm_and_si128(block, threeBytesMask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(threeBytesBits, surrogate)) != 0) {
+            break;
+        }
+        // each code unit takes 3 bytes, less one below 0x800 and one more below 0x80.
+        __m128i belowThreeBytes = _mm_and_si128(_mm_cmpeq_epi16(threeBytesBits, zero), one);
+        __m128i belowTwoBytes = _mm_and_si128(_mm_cmpeq_epi16(_mm_and_si128(block, twoBytesMask), zero), one);
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(_mm_add_epi16(belowThreeBytes, belowTwoBytes), zero));
+    }
+    utf8Size += index * CONST_3 -
+                static_cast<size_t>(_mm_cvtsi128_si64(sums) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+    return index;
+}
+size_t CountUtf16Blocks(const uint8_t* utf8, size_t len, size_t& utf16Size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    // the bytes compare as signed, so the followers are the ones up to 0xbf, below the ones of ASCII.
+    const __m128i followerMax = _mm_set1_epi8(static_cast<char>(UTF8_FOLLOWER_MAX));
+    const __m128i fourBytesFirst = _mm_set1_epi8(static_cast<char>(UTF8_4B_FIRST));
+    __m128i sums = zero;
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len; index += UTF8_BLOCK_SIZE) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf8 + index));
+        __m128i fourBytesFirsts = _mm_cmpeq_epi8(_mm_max_epu8(block, fourBytesFirst), block);
+        __m128i units = _mm_sub_epi8(zero, _mm_add_epi8(_mm_cmpgt_epi8(block, followerMax), fourBytesFirsts));
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(units, zero));
+    }
+    utf16Size += static_cast<size_t>(_mm_cvtsi128_si64(sums) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+    return index;
+}
+
+size_t CountUtf8Blocks(const char16_t* utf16, size_t len, size_t& utf8Size)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i twoBytesMask = _mm_set1_epi16(static_cast<int16_t>(UTF16_2B_MASK));
+    const __m128i threeBytesMask = _mm_set1_epi16(static_cast<int16_t>(UTF16_3B_MASK));
+    const __m128i surrogate = _mm_set1_epi16(static_cast<int16_t>(DECODE_LEAD_LOW));
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i sums = zero;
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(utf16 + index));
+        __m128i threeBytesBits = _mm_and_si128(block, threeBytesMask);
+        // each code unit takes 3 bytes, less one below 0x800, one more below 0x80 and one for a surrogate.
+        __m128i fewerBytes = _mm_or_si128(_mm_cmpeq_epi16(threeBytesBits, zero),
+            _mm_cmpeq_epi16(threeBytesBits, surrogate));
+        __m128i belowTwoBytes = _mm_cmpeq_epi16(_mm_and_si128(block, twoBytesMask), zero);
+        __m128i savedBytes = _mm_add_epi16(_mm_and_si128(fewerBytes, one), _mm_and_si128(belowTwoBytes, one));
+        sums = _mm_add_epi64(sums, _mm_sad_epu8(savedBytes, zero));
+    }
+    utf8Size += index * CONST_3 -
+                static_cast<size_t>(_mm_cvtsi128_si64(sums) + _mm_cvtsi128_si64(_mm_unpackhi_epi64(sums, sums)));
+    return index;
+}
+#else
+// without vector registers a block is read as two words.
+constexpr uint64_t UTF8_NON_ASCII_WORD_MASK = 0x8080808080808080;
+constexpr uint64_t UTF16_NON_ASCII_WORD_MASK = 0xff80ff80ff80ff80;
+
+bool IsAsciiBlock(const uint8_t* utf8)
+{
+    uint64_t words[CONST_2];
+    std::memcpy(words, utf8, UTF8_BLOCK_SIZE);
+    return ((words[0] | words[1]) & UTF8_NON_ASCII_WORD_MASK) == 0;
+}
+
+size_t AsciiBlocksSize(const uint8_t* utf8, size_t len)
+{
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len && IsAsciiBlock(utf8 + index); index += UTF8_BLOCK_SIZE) {}
+    return index;
+}
+
+size_t WidenAsciiBlocks(const uint8_t* utf8, size_t len, char16_t* utf16)
+{
+    size_t index = 0;
+    for (; index + UTF8_BLOCK_SIZE <= len && IsAsciiBlock(utf8 + index); index += UTF8_BLOCK_SIZE) {
+        for (size_t offset = 0; offset < UTF8_BLOCK_SIZE; ++offset) {
+            utf16[index + offset] = utf8[index + offset];
+        }
+    }
+    return index;
+}
+
+size_t NarrowAsciiBlocks(const char16_t* utf16, size_t len, uint8_t* utf8)
+{
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        uint64_t words[CONST_2];
+        std::memcpy(words, utf16 + index, sizeof(words));
+        if (((words[0] | words[1]) & UTF16_NON_ASCII_WORD_MASK) != 0) {
+            break;
+        }
+        for (size_t offset = 0; offset < UTF16_BLOCK_SIZE; ++offset) {
+            utf8[index + offset] = static_cast<uint8_t>(utf16[index + offset]);
+        }
+    }
+    return index;
+}
+
+size_t CountBmpBlocks(const char16_t* utf16, size_t len, size_t& utf8Size)
+{
+    size_t index = 0;
+    for (; index + UTF16_BLOCK_SIZE <= len; index += UTF16_BLOCK_SIZE) {
+        size_t blockSize = 0;
+        bool hasSurrogate = false;
+        for (size_t offset = 0; offset < UTF16_BLOCK_SIZE; ++offset) {
+            uint16_t unit = utf16[index + offset];
+            hasSurrogate |= (unit & SURROGATE_MASK) == DECODE_LEAD_LOW;
+            blockSize += 1 + ((unit & UTF16_2B_MASK) != 0) + ((unit & UTF16_3B_MASK) != 0);
+        }
+        if (hasSurrogate) {
+            break;
+        }
+        utf8Size += blockSize;
+    }
+    return index;
+}
+size_t CountUtf16Blocks(const uint8_t* utf8, size_t len, size_t& utf16Size)
+{
+    size_t blocksSize = len - len % UTF8_BLOCK_SIZE;
+    for (size_t index = 0; index < blocksSize; ++index) {
+        utf16Size += static_cast<size_t>(utf8[index] > UTF8_FOLLOWER_MAX || utf8[index] <= UTF8_1B_MAX) +
+                     static_cast<size_t>(utf8[index] >= UTF8_4B_FIRST);
+    }
+    return blocksSize;
+}
+
+size_t CountUtf8Blocks(const char16_t* utf16, size_t len, size_t& utf8Size)
+{
+    size_t blocksSize = len - len % UTF16_BLOCK_SIZE;
+    for (size_t index = 0; index < blocksSize; ++index) {
+        uint16_t unit = utf16[index];
+        bool isSurrogate = (unit & SURROGATE_MASK) == DECODE_LEAD_LOW;
+        utf8Size += 1 + ((unit & UTF16_2B_MASK) != 0) + ((unit & UTF16_3B_MASK) != 0 && !isSurrogate);
+    }
+    return blocksSize;
+}
+#endif
+
+bool IsFollower(uint8_t byte)
+{
+    return byte >= UTF8_FOLLOWER_MIN && byte <= UTF8_FOLLOWER_MAX;
+}
+
+// Decodes the code point at the start of the len bytes at utf8, returns it and the count of its bytes. An ill-formed
+// sequence gives INVALID_CODE_POINT and the count of bytes in its maximal subpart, the bytes one replacement character
+// stands for.
+std::pair<uint32_t, size_t> DecodeUtf8(const uint8_t* utf8, size_t len)
+{
+    uint8_t first = utf8[0];
+    if (first <= UTF8_1B_MAX) {
+        return { first, 1 };
+    }
+    if (first >= UTF8_2B_FIRST_MIN && first <= UTF8_2B_FIRST_MAX) {
+        if (len < CONST_2 || !IsFollower(utf8[1])) {
+            return { INVALID_CODE_POINT, 1 };
+        }
+        return { ((first & MASK_5BIT) << DATA_WIDTH) | (utf8[1] & MASK_6BIT), CONST_2 };
+    }
+    // the second byte has a narrower range after some first bytes, which rules out overlong forms, surrogates and
+    // code points above 0x10ffff.
+    uint8_t secondMin = UTF8_FOLLOWER_MIN;
+    uint8_t secondMax = UTF8_FOLLOWER_MAX;
+    if (first >= UTF8_3B_FIRST && first <= UTF8_3B_FIRST_MAX) {
+        if (first == UTF8_3B_FIRST) {
+            secondMin = UTF8_3B_SECOND_MIN;
+        } else if (first == UTF8_3B_SURROGATE_FIRST) {
+            secondMax = UTF8_3B_SURROGATE_SECOND_MIN - 1;
+        }
+        if (len < CONST_2 || utf8[1] < secondMin || utf8[1] > secondMax) {
+            return { INVALID_CODE_POINT, 1 };
+        }
+        if (len < CONST_3 || !IsFollower(utf8[CONST_2])) {
+            return { INVALID_CODE_POINT, CONST_2 };
+        }
+        return { ((first & MASK_4BIT) << (DATA_WIDTH * CONST_2)) | ((utf8[1] & MASK_6BIT) << DATA_WIDTH) |
+                     (utf8[CONST_2] & MASK_6BIT),
+            CONST_3 };
+    }
+    if (first >= UTF8_4B_FIRST && first <= UTF8_4B_FIRST_MAX) {
+        if (first == UTF8_4B_FIRST) {
+            secondMin = UTF8_4B_SECOND_MIN;
+        } else if (first == UTF8_4B_FIRST_MAX) {
+            secondMax = UTF8_4B_LAST_SECOND_MAX;
+        }
+        if (len < CONST_2 || utf8[1] < secondMin || utf8[1] > secondMax) {
+            return { INVALID_CODE_POINT, 1 };
+        }
+        if (len < CONST_3 || !IsFollower(utf8[CONST_2])) {
+            return { INVALID_CODE_POINT, CONST_2 };
+        }
+        if (len < CONST_4 || !IsFollower(utf8[CONST_3])) {
+            return { INVALID_CODE_POINT, CONST_3 };
+        }
+        return { ((first & MASK_3BIT) << (DATA_WIDTH * CONST_3)) | ((utf8[1] & MASK_6BIT) << (DATA_WIDTH * CONST_2)) |
+                     ((utf8[CONST_2] & MASK_6BIT) << DATA_WIDTH) | (utf8[CONST_3] & MASK_6BIT),
+            CONST_4 };
+    }
+    return { INVALID_CODE_POINT, 1 };
+}
+
+// Decodes the code point at utf16[index] and moves index past it. A lone surrogate gives INVALID_CODE_POINT.
+uint32_t DecodeUtf16(const char16_t* utf16, size_t len, size_t& index)
+{
+    uint16_t first = utf16[index++];
+    if ((first & SURROGATE_MASK) != DECODE_LEAD_LOW) {
+        return first;
+    }
+    if (first > DECODE_LEAD_HIGH || index >= len || !IsUTF16LowSurrogate(utf16[index])) {
+        return INVALID_CODE_POINT;
+    }
+    uint16_t second = utf16[index++];
+    return ((first - DECODE_LEAD_LOW) << UTF16_OFFSET) + (second - DECODE_TRAIL_LOW) + DECODE_SECOND_FACTOR;
+}
+
+// The count of UTF-16 code units the text converts to if it is well-formed, counted without decoding it.
+size_t CountUtf16Units(const uint8_t* utf8, size_t len)
+{
+    size_t asciiSize = AsciiBlocksSize(utf8, len);
+    size_t size = asciiSize;
+    size_t index = asciiSize + CountUtf16Blocks(utf8 + asciiSize, len - asciiSize, size);
+    for (; index < len; ++index) {
+        size += static_cast<size_t>(utf8[index] > UTF8_FOLLOWER_MAX || utf8[index] <= UTF8_1B_MAX) +
+                static_cast<size_t>(utf8[index] >= UTF8_4B_FIRST);
+    }
+    return size;
+}
+
+// The count of UTF-8 bytes the text converts to if it is well-formed, a surrogate takes 2 of the 4 bytes of its pair.
+size_t CountUtf8Bytes(const char16_t* utf16, size_t len)
+{
+    size_t size = 0;
+    for (size_t index = CountUtf8Blocks(utf16, len, size); index < len; ++index) {
+        uint16_t unit = utf16[index];
+        bool isSurrogate = (unit & SURROGATE_MASK) == DECODE_LEAD_LOW;
+        size += 1 + ((unit & UTF16_2B_MASK) != 0) + ((unit & UTF16_3B_MASK) != 0 && !isSurrogate);
+    }
+    return size;
+}
+} // namespace
+
+size_t Utf8ToUtf16Size(const char* utf8, size_t utf8Len, InvalidUtfPolicy policy)
+{
+    if (utf8 == nullptr && utf8Len > 0) {
+        return UTF_CONVERT_FAILED;
+    }
+    const auto* bytes = reinterpret_cast<const uint8_t*>(utf8);
+    size_t size = 0;
+    size_t index = 0;
+    while (index < utf8Len) {
+        if (bytes[index] <= UTF8_1B_MAX) {
+            size_t asciiSize = AsciiBlocksSize(bytes + index, utf8Len - index);
+            index += asciiSize;
+            size += asciiSize;
+            // the ASCII after the last whole block.
+            for (; index < utf8Len && bytes[index] <= UTF8_1B_MAX; ++index) {
+                ++size;
+            }
+            continue;
+        }
+        auto [codePoint, codePointSize] = DecodeUtf8(bytes + index, utf8Len - index);
+        index += codePointSize;
+        if (codePoint == INVALID_CODE_POINT && policy == InvalidUtfPolicy::FAIL) {
+            return UTF_CONVERT_FAILED;
+        }
+        size += (codePoint != INVALID_CODE_POINT && codePoint >= LO_SUPPLEMENTS_MIN) ? CONST_2 : 1;
+    }
+    return size;
+}
+
+size_t Utf16ToUtf8Size(const char16_t* utf16, size_t utf16Len, InvalidUtfPolicy policy)
+{
+    if (utf16 == nullptr && utf16Len > 0) {
+        return UTF_CONVERT_FAILED;
+    }
+    size_t size = 0;
+    size_t index = 0;
+    while (index < utf16Len) {
+        index += CountBmpBlocks(utf16 + index, utf16Len - index, size);
+        // the code units of the block with a surrogate, or after the last whole block.
+        size_t blockEnd = std::min(index + UTF16_BLOCK_SIZE, utf16Len);
+        while (index < blockEnd) {
+            uint32_t codePoint = DecodeUtf16(utf16, utf16Len, index);
+            if (codePoint == INVALID_CODE_POINT) {
+                if (policy == InvalidUtfPolicy::FAIL) {
+                    return UTF_CONVERT_FAILED;
+                }
+                codePoint = UTF16_REPLACEMENT_CHARACTER;
+            }
+            size += UTF8Length(codePoint);
+        }
+    }
+    return size;
+}
+
+size_t ConvertUtf8ToUtf16(const char* utf8, size_t utf8Len, char16_t* utf16, size_t utf16Capacity,
+    InvalidUtfPolicy policy)
+{
+    if ((utf8 == nullptr && utf8Len > 0) || (utf16 == nullptr && utf16Capacity > 0)) {
+        return UTF_CONVERT_FAILED;
+    }
+    const auto* bytes = reinterpret_cast<const uint8_t*>(utf8);
+    size_t index = 0;
+    size_t outIndex = 0;
+    while (index < utf8Len) {
+        if (bytes[index] <= UTF8_1B_MAX) {
+            size_t asciiSize =
+                WidenAsciiBlocks(bytes + index, std::min(utf8Len - index, utf16Capacity - outIndex), utf16 + outIndex);
+            index += asciiSize;
+            outIndex += asciiSize;
+            for (; index < utf8Len && bytes[index] <= UTF8_1B_MAX; ++index) {
+                if (outIndex == utf16Capacity) {
+                    return UTF_CONVERT_FAILED;
+                }
+                utf16[outIndex++] = bytes[index];
+            }
+            continue;
+        }
+        auto [codePoint, codePointSize] = DecodeUtf8(bytes + index, utf8Len - index);
+        index += codePointSize;
+        if (codePoint == INVALID_CODE_POINT) {
+            if (policy == InvalidUtfPolicy::FAIL) {
+                return UTF_CONVERT_FAILED;
+            }
+            codePoint = UTF16_REPLACEMENT_CHARACTER;
+        }
+        if (codePoint < LO_SUPPLEMENTS_MIN) {
+            if (outIndex == utf16Capacity) {
+                return UTF_CONVERT_FAILED;
+            }
+            utf16[outIndex++] = static_cast<char16_t>(codePoint);
+            continue;
+        }
+        if (utf16Capacity - outIndex < CONST_2) {
+            return UTF_CONVERT_FAILED;
+        }
+        utf16[outIndex++] = static_cast<char16_t>((codePoint >> UTF16_OFFSET) + U16_LEAD);
+        utf16[outIndex++] = static_cast<char16_t>((codePoint & MASK_10BIT) + U16_TAIL);
+    }
+    return outIndex;
+}
+
+size_t ConvertUtf16ToUtf8(const char16_t* utf16, size_t utf16Len, char* utf8, size_t utf8Capacity,
+    InvalidUtfPolicy policy)
+{
+    if ((utf16 == nullptr && utf16Len > 0) || (utf8 == nullptr && utf8Capacity > 0)) {
+        return UTF_CONVERT_FAILED;
+    }
+    auto* bytes = reinterpret_cast<uint8_t*>(utf8);
+    size_t index = 0;
+    size_t outIndex = 0;
+    while (index < utf16Len) {
+        if (utf16[index] <= UTF8_1B_MAX) {
+            size_t asciiSize =
+                NarrowAsciiBlocks(utf16 + index, std::min(utf16Len - index, utf8Capacity - outIndex), bytes + outIndex);
+            index += asciiSize;
+            outIndex += asciiSize;
+            for (; index < utf16Len && utf16[index] <= UTF8_1B_MAX; ++index) {
+                if (outIndex == utf8Capacity) {
+                    return UTF_CONVERT_FAILED;
+                }
+                bytes[outIndex++] = static_cast<uint8_t>(utf16[index]);
+            }
+            continue;
+        }
+        uint32_t codePoint = DecodeUtf16(utf16, utf16Len, index);
+        if (codePoint == INVALID_CODE_POINT) {
+            if (policy == InvalidUtfPolicy::FAIL) {
+                return UTF_CONVERT_FAILED;
+            }
+            codePoint = UTF16_REPLACEMENT_CHARACTER;
+        }
+        size_t encodedSize = EncodeUTF8(codePoint, bytes, utf8Capacity, outIndex);
+        if (encodedSize == 0) {
+            return UTF_CONVERT_FAILED;
+        }
+        outIndex += encodedSize;
+    }
+    return outIndex;
+}
+
+bool Utf8ToUtf16(const std::string& utf8, std::u16string& utf16, InvalidUtfPolicy policy)
+{
+    // the count is exact for well-formed text, which the conversion checks.
+    size_t size = CountUtf16Units(reinterpret_cast<const uint8_t*>(utf8.data()), utf8.size());
+    utf16.resize(size);
+    size_t convertedSize = ConvertUtf8ToUtf16(utf8.data(), utf8.size(), utf16.data(), size, policy);
+    if (convertedSize == UTF_CONVERT_FAILED && policy == InvalidUtfPolicy::REPLACE) {
+        // the replacements of ill-formed text need more code units than the count.
+        size = Utf8ToUtf16Size(utf8.data(), utf8.size(), policy);
+        utf16.resize(size);
+        convertedSize = ConvertUtf8ToUtf16(utf8.data(), utf8.size(), utf16.data(), size, policy);
+    }
+    if (convertedSize == UTF_CONVERT_FAILED) {
+        utf16.clear();
+        return false;
+    }
+    utf16.resize(convertedSize);
+    return true;
+}
+
+bool Utf16ToUtf8(const std::u16string& utf16, std::string& utf8, InvalidUtfPolicy policy)
+{
+    size_t size = CountUtf8Bytes(utf16.data(), utf16.size());
+    utf8.resize(size);
+    size_t convertedSize = ConvertUtf16ToUtf8(utf16.data(), utf16.size(), utf8.data(), size, policy);
+    if (convertedSize == UTF_CONVERT_FAILED && policy == InvalidUtfPolicy::REPLACE) {
+        size = Utf16ToUtf8Size(utf16.data(), utf16.size(), policy);
+        utf8.resize(size);
+        convertedSize = ConvertUtf16ToUtf8(utf16.data(), utf16.size(), utf8.data(), size, policy);
+    }
+    if (convertedSize == UTF_CONVERT_FAILED) {
+        utf8.clear();
+        return false;
+    }
+    utf8.resize(convertedSize);
+    return true;
+}
+
 } // namespace OHOS::Ace
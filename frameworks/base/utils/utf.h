@@ -145,8 +145,13 @@ size_t DebuggerConvertRegionUtf16ToUtf8(const uint16_t* utf16In, uint8_t* utf8Ou
 
 void ConvertIllegalStr(std::string& str);
 
+// Same as above for the utf8Len bytes at buf8, which are rewritten in place.
+void ConvertIllegalStr(uint8_t* buf8, size_t utf8Len);
+
 bool IsUTF8(std::string& data);
 
+bool IsUTF8(const uint8_t* data, size_t size);
+
 inline std::pair<uint16_t, uint16_t> SplitUtf16Pair(uint32_t pair)
 {
     constexpr size_t P1_MASK = 0xffff;
@@ -154,6 +159,35 @@ inline std::pair<uint16_t, uint16_t> SplitUtf16Pair(uint32_t pair)
     return { pair >> P2_SHIFT, pair & P1_MASK };
 }
 
+// How the transcoders below treat an ill-formed sequence, a stray or truncated byte of UTF-8 or a lone surrogate of
+// UTF-16.
+enum class InvalidUtfPolicy : uint8_t {
+    FAIL,    // the conversion fails.
+    REPLACE, // each maximal ill-formed subpart becomes U+FFFD, as the Unicode standard recommends.
+};
+
+// Returned by the transcoders when the text is ill-formed under InvalidUtfPolicy::FAIL or the buffer is too small.
+constexpr size_t UTF_CONVERT_FAILED = SIZE_MAX;
+
+// The count of UTF-16 code units the UTF-8 text converts to.
+size_t Utf8ToUtf16Size(const char* utf8, size_t utf8Len, InvalidUtfPolicy policy = InvalidUtfPolicy::FAIL);
+
+// The count of UTF-8 bytes the UTF-16 text converts to.
+size_t Utf16ToUtf8Size(const char16_t* utf16, size_t utf16Len, InvalidUtfPolicy policy = InvalidUtfPolicy::FAIL);
+
+// Converts the text into the buffer and returns the count of code units written. The size functions above give the
+// capacity the buffer needs.
+size_t ConvertUtf8ToUtf16(const char* utf8, size_t utf8Len, char16_t* utf16, size_t utf16Capacity,
+    InvalidUtfPolicy policy = InvalidUtfPolicy::FAIL);
+
+size_t ConvertUtf16ToUtf8(const char16_t* utf16, size_t utf16Len, char* utf8, size_t utf8Capacity,
+    InvalidUtfPolicy policy = InvalidUtfPolicy::FAIL);
+
+// Same as above into a string sized for the text. When the conversion fails, the result is empty and false returned.
+bool Utf8ToUtf16(const std::string& utf8, std::u16string& utf16, InvalidUtfPolicy policy = InvalidUtfPolicy::FAIL);
+
+bool Utf16ToUtf8(const std::u16string& utf16, std::string& utf8, InvalidUtfPolicy policy = InvalidUtfPolicy::FAIL);
+
 } // namespace OHOS::Ace
 
 #endif
\ No newline at end of file
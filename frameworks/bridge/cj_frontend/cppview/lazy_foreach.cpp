@@ -69,7 +69,7 @@ std::pair<std::string, RefPtr<NG::UINode>> CJLazyForEachBuilder::OnGetChildByInd
 }
 
 std::pair<std::string, RefPtr<NG::UINode>> CJLazyForEachBuilder::OnGetChildByIndexNew(int32_t index,
-    std::map<int32_t, NG::LazyForEachChild>& cachedItems,
+    NG::LazyForEachCachedItems& cachedItems,
     std::unordered_map<std::string, NG::LazyForEachCacheChild>& expiringItems)
 {
     std::pair<std::string, RefPtr<NG::UINode>> result;
@@ -43,7 +43,7 @@ public:
     std::pair<std::string, RefPtr<NG::UINode>> OnGetChildByIndex(
         int32_t index, std::unordered_map<std::string, std::pair<int32_t, RefPtr<NG::UINode>>>& cachedItems) override;
     std::pair<std::string, RefPtr<NG::UINode>> OnGetChildByIndexNew(int32_t index,
-        std::map<int32_t, NG::LazyForEachChild>& cachedItems,
+        NG::LazyForEachCachedItems& cachedItems,
         std::unordered_map<std::string, NG::LazyForEachCacheChild>& expiringItems) override;
     void ReleaseChildGroupById(const std::string& id) override;
     void RegisterDataChangeListener(const RefPtr<V2::DataChangeListener>& listener) override;
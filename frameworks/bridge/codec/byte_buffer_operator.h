@@ -16,20 +16,25 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_BYTE_BUFFER_OPERATOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_BYTE_BUFFER_OPERATOR_H
 
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <map>
 #include <set>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #include "base/log/log.h"
 #include "base/utils/noncopyable.h"
+#include "frameworks/bridge/codec/codec_data.h"
 
 namespace OHOS::Ace::Framework {
 
 class ByteBufferReader final {
 public:
-    explicit ByteBufferReader(const std::vector<uint8_t>& buffer) : buffer_(buffer) {}
+    explicit ByteBufferReader(const std::vector<uint8_t>& buffer) : data_(buffer.data()), size_(buffer.size()) {}
+    ByteBufferReader(const uint8_t* data, size_t size) : data_(data), size_(data ? size : 0) {}
     ~ByteBufferReader() = default;
 
     bool ReadData(uint8_t& value) const
@@ -69,36 +74,84 @@ public:
     bool ReadData(std::map<std::string, std::string>& dst) const;
     bool ReadData(std::set<std::string>& dst) const;
 
+    // Borrow the next array from the buffer instead of copying it.
+    bool ReadData(CodecArrayView<char>& dst) const
+    {
+        return ReadArrayView(dst);
+    }
+    bool ReadData(CodecArrayView<int8_t>& dst) const
+    {
+        return ReadArrayView(dst);
+    }
+    bool ReadData(CodecArrayView<int16_t>& dst) const
+    {
+        return ReadArrayView(dst);
+    }
+    bool ReadData(CodecArrayView<int32_t>& dst) const
+    {
+        return ReadArrayView(dst);
+    }
+
+    // Whether the values of the next array are aligned for T, so that they can be borrowed.
+    template<class T>
+    bool IsNextArrayAligned() const
+    {
+        auto address = reinterpret_cast<uintptr_t>(data_ + readPos_ + sizeof(int32_t));
+        return address % alignof(T) == 0;
+    }
+
 private:
     template<class T>
     bool ReadValue(T& value) const
     {
-        if (readPos_ + sizeof(T) > buffer_.size()) {
-            LOGW("Exceed buffer size, readPos = %{public}u, buffer size = %{public}zu", readPos_, buffer_.size());
+        if (sizeof(T) > size_ - readPos_) {
+            LOGW("Exceed buffer size, readPos = %{public}zu, buffer size = %{public}zu", readPos_, size_);
             return false;
         }
-        value = *reinterpret_cast<const T*>(buffer_.data() + readPos_);
+        // the values are not aligned in the buffer.
+        std::memcpy(&value, data_ + readPos_, sizeof(T));
         readPos_ += sizeof(T);
         return true;
     }
 
     template<class T>
-    bool ReadArray(T& dst) const
+    bool ReadArrayData(const T*& data, size_t& length) const
     {
-        int32_t length = -1;
-        if (!ReadData(length) || length < 0 ||
-            readPos_ + static_cast<uint32_t>(sizeof(typename T::value_type) * length) > buffer_.size()) {
+        int32_t size = -1;
+        if (!ReadData(size) || size < 0 || static_cast<size_t>(size) > (size_ - readPos_) / sizeof(T)) {
             LOGW("Could not read array length or array length is invalid");
             return false;
         }
-        auto data = reinterpret_cast<const typename T::value_type*>(buffer_.data() + readPos_);
-        dst.assign(data, data + length);
-        readPos_ += static_cast<uint32_t>(sizeof(typename T::value_type) * length);
+        data = reinterpret_cast<const T*>(data_ + readPos_);
+        length = static_cast<size_t>(size);
+        readPos_ += sizeof(T) * length;
         return true;
     }
 
-    const std::vector<uint8_t>& buffer_;
-    mutable uint32_t readPos_ = 0;
+    template<class T>
+    bool ReadArray(T& dst) const
+    {
+        const typename T::value_type* data = nullptr;
+        size_t length = 0;
+        if (!ReadArrayData(data, length)) {
+            return false;
+        }
+        dst.resize(length);
+        if (length > 0) {
+            std::memcpy(dst.data(), data, sizeof(typename T::value_type) * length);
+        }
+        return true;
+    }
+
+    template<class T>
+    bool ReadArrayView(CodecArrayView<T>& dst) const
+    {
+        return ReadArrayData(dst.data, dst.size);
+    }
+
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    mutable size_t readPos_ = 0;
 
     ACE_DISALLOW_COPY_AND_MOVE(ByteBufferReader);
 };
@@ -108,6 +161,11 @@ public:
     ByteBufferWriter(std::vector<uint8_t>& buffer) : buffer_(buffer) {}
     ~ByteBufferWriter() = default;
 
+    void Reserve(size_t size)
+    {
+        buffer_.reserve(buffer_.size() + size);
+    }
+
     void WriteData(uint8_t value)
     {
         WriteValue(value);
@@ -124,22 +182,35 @@ public:
     {
         WriteValue(value);
     }
-    void WriteData(const std::string& src)
+    void WriteData(std::string_view src)
     {
-        WriteArray(src);
+        WriteArray(src.data(), src.size());
     }
 
     void WriteData(const std::vector<int8_t>& src)
     {
-        WriteArray(src);
+        WriteArray(src.data(), src.size());
     }
     void WriteData(const std::vector<int16_t>& src)
     {
-        WriteArray(src);
+        WriteArray(src.data(), src.size());
     }
     void WriteData(const std::vector<int32_t>& src)
     {
-        WriteArray(src);
+        WriteArray(src.data(), src.size());
+    }
+
+    void WriteData(CodecArrayView<int8_t> src)
+    {
+        WriteArray(src.data, src.size);
+    }
+    void WriteData(CodecArrayView<int16_t> src)
+    {
+        WriteArray(src.data, src.size);
+    }
+    void WriteData(CodecArrayView<int32_t> src)
+    {
+        WriteArray(src.data, src.size);
     }
 
     void WriteData(const std::map<std::string, std::string>& mapValue);
@@ -154,11 +225,11 @@ private:
     }
 
     template<class T>
-    void WriteArray(const T& array)
+    void WriteArray(const T* array, size_t size)
     {
-        WriteData(static_cast<int32_t>(array.size()));
-        auto data = reinterpret_cast<const uint8_t*>(array.data());
-        buffer_.insert(buffer_.end(), data, data + sizeof(typename T::value_type) * array.size());
+        WriteData(static_cast<int32_t>(size));
+        auto data = reinterpret_cast<const uint8_t*>(array);
+        buffer_.insert(buffer_.end(), data, data + sizeof(T) * size);
     }
 
     std::vector<uint8_t>& buffer_;
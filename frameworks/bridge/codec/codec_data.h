@@ -16,11 +16,15 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_CODEC_DATA_H
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_CODEC_DATA_H
 
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <variant>
 #include <vector>
 
@@ -43,6 +47,26 @@ enum class BufferDataType : uint8_t {
     TYPE_OBJECT,
 };
 
+// Values borrowed from a codec buffer, only valid as long as the buffer is.
+template<class T>
+struct CodecArrayView final {
+    const T* data = nullptr;
+    size_t size = 0;
+
+    const T* begin() const
+    {
+        return data;
+    }
+    const T* end() const
+    {
+        return data + size;
+    }
+    bool empty() const
+    {
+        return size == 0;
+    }
+};
+
 class CodecData final {
 public:
     CodecData() = default;
@@ -74,6 +98,18 @@ public:
     explicit CodecData(std::vector<int16_t>&& val) : type_(BufferDataType::TYPE_INT16_ARRAY), data_(std::move(val)) {}
     explicit CodecData(std::vector<int32_t>&& val) : type_(BufferDataType::TYPE_INT32_ARRAY), data_(std::move(val)) {}
 
+    // The buffer a borrowed value points to must outlive this data. The view accessors read the value in place, the
+    // owning accessors copy it out of the buffer on their first call and keep the copy, shared with the copies of
+    // this data.
+    explicit CodecData(CodecArrayView<char> val, BufferDataType type = BufferDataType::TYPE_STRING)
+        : type_(type), data_(val), ownedCopy_(std::make_shared<OwnedCopy>()) {}
+    explicit CodecData(CodecArrayView<int8_t> val)
+        : type_(BufferDataType::TYPE_INT8_ARRAY), data_(val), ownedCopy_(std::make_shared<OwnedCopy>()) {}
+    explicit CodecData(CodecArrayView<int16_t> val)
+        : type_(BufferDataType::TYPE_INT16_ARRAY), data_(val), ownedCopy_(std::make_shared<OwnedCopy>()) {}
+    explicit CodecData(CodecArrayView<int32_t> val)
+        : type_(BufferDataType::TYPE_INT32_ARRAY), data_(val), ownedCopy_(std::make_shared<OwnedCopy>()) {}
+
     BufferDataType GetType() const
     {
         return type_;
@@ -186,6 +222,40 @@ public:
         return GetValue<std::string>();
     }
 
+    bool IsBorrowed() const
+    {
+        return std::holds_alternative<CodecArrayView<char>>(data_) ||
+               std::holds_alternative<CodecArrayView<int8_t>>(data_) ||
+               std::holds_alternative<CodecArrayView<int16_t>>(data_) ||
+               std::holds_alternative<CodecArrayView<int32_t>>(data_);
+    }
+
+    // The view accessors read both the owned and the borrowed values, without copying them.
+    std::string_view GetStringView() const
+    {
+        auto view = std::get_if<CodecArrayView<char>>(&data_);
+        if (view != nullptr) {
+            return std::string_view(view->data, view->size);
+        }
+        return GetValue<std::string>();
+    }
+    std::string_view GetObjectView() const
+    {
+        return GetStringView();
+    }
+    CodecArrayView<int8_t> GetInt8ArrayView() const
+    {
+        return GetArrayView<int8_t>();
+    }
+    CodecArrayView<int16_t> GetInt16ArrayView() const
+    {
+        return GetArrayView<int16_t>();
+    }
+    CodecArrayView<int32_t> GetInt32ArrayView() const
+    {
+        return GetArrayView<int32_t>();
+    }
+
 private:
     template<class T>
     struct CopyableUniquePtr final {
@@ -211,12 +281,30 @@ private:
     using EncodedData = std::variant<int32_t, int64_t, double, CopyableUniquePtr<std::string>,
         CopyableUniquePtr<std::map<std::string, std::string>>, CopyableUniquePtr<std::set<std::string>>,
         CopyableUniquePtr<std::vector<int8_t>>, CopyableUniquePtr<std::vector<int16_t>>,
-        CopyableUniquePtr<std::vector<int32_t>>>;
+        CopyableUniquePtr<std::vector<int32_t>>, CodecArrayView<char>, CodecArrayView<int8_t>,
+        CodecArrayView<int16_t>, CodecArrayView<int32_t>>;
+
+    // Copy of a borrowed value made by the first owning accessor. The accessors are const and may run on several
+    // threads at once, so the copy is made under a once flag instead of replacing the borrowed value.
+    struct OwnedCopy final {
+        std::once_flag flag;
+        EncodedData data;
+    };
+
+    template<class T>
+    static constexpr bool IS_BORROWABLE = std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<int8_t>> ||
+                                          std::is_same_v<T, std::vector<int16_t>> ||
+                                          std::is_same_v<T, std::vector<int32_t>>;
 
     template<class T>
     const T& GetValue() const
     {
-        auto val = std::get_if<CopyableUniquePtr<T>>(&data_);
+        const CopyableUniquePtr<T>* val = std::get_if<CopyableUniquePtr<T>>(&data_);
+        if constexpr (IS_BORROWABLE<T>) {
+            if (val == nullptr) {
+                val = GetOwnedCopy<T>();
+            }
+        }
         if (val != nullptr) {
             return *(val->ptr);
         } else {
@@ -225,8 +313,34 @@ private:
         }
     }
 
+    // Copy of a borrowed value the owning accessors can return a reference to.
+    template<class T>
+    const CopyableUniquePtr<T>* GetOwnedCopy() const
+    {
+        auto view = std::get_if<CodecArrayView<typename T::value_type>>(&data_);
+        if (view == nullptr || !ownedCopy_) {
+            return nullptr;
+        }
+        std::call_once(ownedCopy_->flag,
+            [this, view]() { ownedCopy_->data = CopyableUniquePtr<T>(T(view->begin(), view->end())); });
+        return std::get_if<CopyableUniquePtr<T>>(&ownedCopy_->data);
+    }
+
+    template<class T>
+    CodecArrayView<T> GetArrayView() const
+    {
+        auto view = std::get_if<CodecArrayView<T>>(&data_);
+        if (view != nullptr) {
+            return *view;
+        }
+        const auto& value = GetValue<std::vector<T>>();
+        return { value.data(), value.size() };
+    }
+
     BufferDataType type_ = BufferDataType::TYPE_NULL;
     EncodedData data_;
+    // only set for borrowed values.
+    std::shared_ptr<OwnedCopy> ownedCopy_;
 };
 
 } // namespace OHOS::Ace::Framework
@@ -39,6 +39,29 @@ inline bool ReadDataFromByteBuffer(const ByteBufferReader& buffer, CodecData& re
     return false;
 }
 
+template<class T>
+inline bool ReadArrayFromByteBuffer(const ByteBufferReader& buffer, CodecData& resultData, bool borrowValues)
+{
+    // the wider values are read in place, they are only borrowed when they are aligned in the buffer.
+    if (borrowValues && buffer.IsNextArrayAligned<T>()) {
+        return ReadDataFromByteBuffer<CodecArrayView<T>>(buffer, resultData);
+    }
+    return ReadDataFromByteBuffer<std::vector<T>>(buffer, resultData);
+}
+
+inline bool ReadStringFromByteBuffer(const ByteBufferReader& buffer, CodecData& resultData, bool borrowValues)
+{
+    if (borrowValues) {
+        return ReadDataFromByteBuffer<CodecArrayView<char>>(buffer, resultData);
+    }
+    return ReadDataFromByteBuffer<std::string>(buffer, resultData);
+}
+
+constexpr size_t GetArrayEncodedSize(size_t valueSize, size_t count)
+{
+    return sizeof(int32_t) + valueSize * count;
+}
+
 } // namespace
 
 bool StandardCodecBufferReader::ReadType(BufferDataType& type)
@@ -111,13 +134,13 @@ bool StandardCodecBufferReader::ReadData(CodecData& resultData)
         case BufferDataType::TYPE_DOUBLE:
             return ReadDataFromByteBuffer<double>(byteBufferReader_, resultData);
         case BufferDataType::TYPE_STRING:
-            return ReadDataFromByteBuffer<std::string>(byteBufferReader_, resultData);
+            return ReadStringFromByteBuffer(byteBufferReader_, resultData, borrowValues_);
         case BufferDataType::TYPE_INT8_ARRAY:
-            return ReadDataFromByteBuffer<std::vector<int8_t>>(byteBufferReader_, resultData);
+            return ReadArrayFromByteBuffer<int8_t>(byteBufferReader_, resultData, borrowValues_);
         case BufferDataType::TYPE_INT16_ARRAY:
-            return ReadDataFromByteBuffer<std::vector<int16_t>>(byteBufferReader_, resultData);
+            return ReadArrayFromByteBuffer<int16_t>(byteBufferReader_, resultData, borrowValues_);
         case BufferDataType::TYPE_INT32_ARRAY:
-            return ReadDataFromByteBuffer<std::vector<int32_t>>(byteBufferReader_, resultData);
+            return ReadArrayFromByteBuffer<int32_t>(byteBufferReader_, resultData, borrowValues_);
         case BufferDataType::TYPE_MAP:
             return ReadDataFromByteBuffer<std::map<std::string, std::string>>(byteBufferReader_, resultData);
         case BufferDataType::TYPE_SET:
@@ -125,7 +148,7 @@ bool StandardCodecBufferReader::ReadData(CodecData& resultData)
         case BufferDataType::TYPE_FUNCTION:
             return ReadDataFromByteBuffer<int32_t>(byteBufferReader_, resultData);
         case BufferDataType::TYPE_OBJECT:
-            return ReadDataFromByteBuffer<std::string>(byteBufferReader_, resultData);
+            return ReadStringFromByteBuffer(byteBufferReader_, resultData, borrowValues_);
         default:
             LOGW("Unknown type");
             return false;
@@ -139,6 +162,7 @@ void StandardCodecBufferWriter::WriteType(BufferDataType type)
 
 void StandardCodecBufferWriter::WriteDataList(const std::vector<CodecData>& dataList)
 {
+    byteBufferWriter_.Reserve(GetEncodedSize(dataList));
     byteBufferWriter_.WriteData(static_cast<uint8_t>(dataList.size()));
     for (const auto& data : dataList) {
         WriteData(data);
@@ -160,16 +184,16 @@ void StandardCodecBufferWriter::WriteData(const CodecData& data)
             byteBufferWriter_.WriteData(data.GetDoubleValue());
             break;
         case BufferDataType::TYPE_STRING:
-            byteBufferWriter_.WriteData(data.GetStringValue());
+            byteBufferWriter_.WriteData(data.GetStringView());
             break;
         case BufferDataType::TYPE_INT8_ARRAY:
-            byteBufferWriter_.WriteData(data.GetInt8ArrayValue());
+            byteBufferWriter_.WriteData(data.GetInt8ArrayView());
             break;
         case BufferDataType::TYPE_INT16_ARRAY:
-            byteBufferWriter_.WriteData(data.GetInt16ArrayValue());
+            byteBufferWriter_.WriteData(data.GetInt16ArrayView());
             break;
         case BufferDataType::TYPE_INT32_ARRAY:
-            byteBufferWriter_.WriteData(data.GetInt32ArrayValue());
+            byteBufferWriter_.WriteData(data.GetInt32ArrayView());
             break;
         case BufferDataType::TYPE_MAP:
             byteBufferWriter_.WriteData(data.GetMapValue());
@@ -181,11 +205,57 @@ void StandardCodecBufferWriter::WriteData(const CodecData& data)
             byteBufferWriter_.WriteData(data.GetFunctionValue());
             break;
         case BufferDataType::TYPE_OBJECT:
-            byteBufferWriter_.WriteData(data.GetObjectValue());
+            byteBufferWriter_.WriteData(data.GetObjectView());
             break;
         default:
             break;
     }
 }
 
+size_t StandardCodecBufferWriter::GetEncodedSize(const CodecData& data)
+{
+    size_t size = sizeof(uint8_t);
+    switch (data.GetType()) {
+        case BufferDataType::TYPE_INT:
+        case BufferDataType::TYPE_FUNCTION:
+            return size + sizeof(int32_t);
+        case BufferDataType::TYPE_LONG:
+            return size + sizeof(int64_t);
+        case BufferDataType::TYPE_DOUBLE:
+            return size + sizeof(double);
+        case BufferDataType::TYPE_STRING:
+        case BufferDataType::TYPE_OBJECT:
+            return size + GetArrayEncodedSize(sizeof(char), data.GetStringView().size());
+        case BufferDataType::TYPE_INT8_ARRAY:
+            return size + GetArrayEncodedSize(sizeof(int8_t), data.GetInt8ArrayView().size);
+        case BufferDataType::TYPE_INT16_ARRAY:
+            return size + GetArrayEncodedSize(sizeof(int16_t), data.GetInt16ArrayView().size);
+        case BufferDataType::TYPE_INT32_ARRAY:
+            return size + GetArrayEncodedSize(sizeof(int32_t), data.GetInt32ArrayView().size);
+        case BufferDataType::TYPE_MAP:
+            size += sizeof(int32_t);
+            for (const auto& [key, value] : data.GetMapValue()) {
+                size += GetArrayEncodedSize(sizeof(char), key.size()) + GetArrayEncodedSize(sizeof(char), value.size());
+            }
+            return size;
+        case BufferDataType::TYPE_SET:
+            size += sizeof(int32_t);
+            for (const auto& value : data.GetSetValue()) {
+                size += GetArrayEncodedSize(sizeof(char), value.size());
+            }
+            return size;
+        default:
+            return size;
+    }
+}
+
+size_t StandardCodecBufferWriter::GetEncodedSize(const std::vector<CodecData>& dataList)
+{
+    size_t size = sizeof(uint8_t);
+    for (const auto& data : dataList) {
+        size += GetEncodedSize(data);
+    }
+    return size;
+}
+
 } // namespace OHOS::Ace::Framework
\ No newline at end of file
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_CODEC_BUFFER_OPERATOR_H
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_CODEC_BUFFER_OPERATOR_H
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -29,6 +30,11 @@ namespace OHOS::Ace::Framework {
 class ACE_EXPORT StandardCodecBufferReader final {
 public:
     explicit StandardCodecBufferReader(const std::vector<uint8_t>& buffer) : byteBufferReader_(buffer) {}
+    // Reads memory owned by the caller. With borrowValues, the strings and arrays read point into the memory instead
+    // of being copied, so the memory must outlive them.
+    StandardCodecBufferReader(const uint8_t* data, size_t size, bool borrowValues = false)
+        : byteBufferReader_(data, size), borrowValues_(borrowValues)
+    {}
     ~StandardCodecBufferReader() = default;
 
     bool ReadData(CodecData& resultData);
@@ -39,10 +45,12 @@ private:
     bool ReadType(BufferDataType& type);
 
     ByteBufferReader byteBufferReader_;
+    bool borrowValues_ = false;
 
     ACE_DISALLOW_COPY_AND_MOVE(StandardCodecBufferReader);
 };
 
+// Appends to the buffer of the caller, which may keep it between calls to write without allocating again.
 class StandardCodecBufferWriter final {
 public:
     explicit StandardCodecBufferWriter(std::vector<uint8_t>& buffer) : byteBufferWriter_(buffer) {}
@@ -51,6 +59,14 @@ public:
     void WriteData(const CodecData& data);
     void WriteDataList(const std::vector<CodecData>& dataList);
 
+    void Reserve(size_t size)
+    {
+        byteBufferWriter_.Reserve(size);
+    }
+
+    static size_t GetEncodedSize(const CodecData& data);
+    static size_t GetEncodedSize(const std::vector<CodecData>& dataList);
+
 private:
     void WriteType(BufferDataType type);
 
@@ -26,8 +26,13 @@ bool StandardFunctionCodec::EncodeFunctionCall(const FunctionCall& functionCall,
         return false;
     }
 
+    const auto& funcName = functionCall.GetFuncName();
     StandardCodecBufferWriter bufferWriter(resultBuffer);
-    bufferWriter.WriteData(CodecData(functionCall.GetFuncName()));
+    // the name is only borrowed for writing it.
+    CodecData funcNameData(CodecArrayView<char> { funcName.data(), funcName.size() });
+    bufferWriter.Reserve(StandardCodecBufferWriter::GetEncodedSize(funcNameData) +
+                         StandardCodecBufferWriter::GetEncodedSize(functionCall.GetArgs()));
+    bufferWriter.WriteData(funcNameData);
     bufferWriter.WriteDataList(functionCall.GetArgs());
     return true;
 }
@@ -54,7 +59,13 @@ bool StandardFunctionCodec::DecodeFunctionCall(const std::vector<uint8_t>& buffe
 
 bool StandardFunctionCodec::DecodePlatformMessage(const std::vector<uint8_t>& buffer, CodecData& platformMessage)
 {
-    StandardCodecBufferReader bufferReader(buffer);
+    return DecodePlatformMessage(buffer.data(), buffer.size(), platformMessage);
+}
+
+bool StandardFunctionCodec::DecodePlatformMessage(
+    const uint8_t* data, size_t size, CodecData& platformMessage, bool borrowValues)
+{
+    StandardCodecBufferReader bufferReader(data, size, borrowValues);
     if (!bufferReader.ReadData(platformMessage)) {
         LOGW("Decode platform message failed");
         return false;
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_FUNCTION_CODEC_H
 #define FOUNDATION_ACE_FRAMEWORKS_BRIDGE_CODEC_STANDARD_FUNCTION_CODEC_H
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -35,6 +36,9 @@ public:
     bool EncodeFunctionCall(const FunctionCall& functionCall, std::vector<uint8_t>& resultBuffer) override;
     bool DecodeFunctionCall(const std::vector<uint8_t>& buffer, FunctionCall& functionCall) override;
     bool DecodePlatformMessage(const std::vector<uint8_t>& buffer, CodecData& platformMessage) override;
+    // Decodes a message in memory owned by the caller, without copying it to a buffer first. With borrowValues, the
+    // strings and arrays of the message point into the memory, which must outlive the message.
+    bool DecodePlatformMessage(const uint8_t* data, size_t size, CodecData& platformMessage, bool borrowValues = false);
 
 private:
     ACE_DISALLOW_COPY_AND_MOVE(StandardFunctionCodec);
@@ -186,7 +186,7 @@ class ModifierWithKey<T extends number | string | boolean | object | Function> {
   applyStage(node: KNode, component?: ArkComponent): boolean {
     if (this.stageValue === undefined || this.stageValue === null) {
       this.value = this.stageValue;
-      this.applyPeer(node, true, component);
+      this.applyPeerOrBatch(node, true, component);
       return true;
     }
     const stageTypeInfo: string = typeof this.stageValue;
@@ -201,18 +201,139 @@ class ModifierWithKey<T extends number | string | boolean | object | Function> {
     }
     if (different) {
       this.value = this.stageValue;
-      this.applyPeer(node, false, component);
+      this.applyPeerOrBatch(node, false, component);
     }
     return false;
   }
 
+  applyPeerOrBatch(node: KNode, reset: boolean, component?: ArkComponent): void {
+    if (attributeBatch.isOpen() && this.applyBatch(reset)) {
+      return;
+    }
+    // the updates in the batch go first, so that the attributes are applied in the order they were set.
+    attributeBatch.flush();
+    this.applyPeer(node, reset, component);
+  }
+
   applyPeer(node: KNode, reset: boolean, component?: ArkComponent): void { }
 
+  // Adds the update to the open attribute batch and returns true, or returns false when the value has to be parsed
+  // by the native module and goes through applyPeer.
+  applyBatch(reset: boolean): boolean {
+    return false;
+  }
+
   checkObjectDiff(): boolean {
     return true;
   }
 }
 
+// mirrors ArkUIAttributeBatchOp in arkoala_api.h, the values have to stay the same.
+enum AttributeBatchOp {
+  BACKGROUND_COLOR = 0,
+  WIDTH = 1,
+  HEIGHT = 2,
+  OPACITY = 3,
+  Z_INDEX = 4,
+  VISIBILITY = 5,
+  ENABLED = 6,
+  FLEX_GROW = 7,
+  FLEX_SHRINK = 8,
+  ALIGN_SELF = 9,
+  ASPECT_RATIO = 10,
+  DISPLAY_PRIORITY = 11,
+}
+
+const ATTRIBUTE_BATCH_INITIAL_CAPACITY = 256;
+const ATTRIBUTE_BATCH_HEADER_SIZE = 2;
+const ATTRIBUTE_BATCH_UNIT_VP = 1;
+
+// Packs the attribute updates of nodes into one buffer, which the native module applies in a single call with one
+// dirty mark per node. The buffer holds a section per node, the index of the node and the count of its values,
+// followed by its commands, each of them the attribute, the count of its arguments and the arguments. The numbers are
+// packed as they were set, the native module checks them the way the setters do.
+class AttributeBatch {
+  private nodes: KNode[] = [];
+  private values: Float64Array = new Float64Array(ATTRIBUTE_BATCH_INITIAL_CAPACITY);
+  private length: number = 0;
+  private openNode: KNode = null;
+  private sectionStart: number = -1;
+
+  isOpen(): boolean {
+    return this.sectionStart >= 0;
+  }
+
+  beginNode(node: KNode): void {
+    this.endNode();
+    this.reserve(ATTRIBUTE_BATCH_HEADER_SIZE);
+    this.openNode = node;
+    this.sectionStart = this.length;
+    this.values[this.length++] = this.nodes.length;
+    this.values[this.length++] = 0;
+    this.nodes.push(node);
+  }
+
+  endNode(): void {
+    if (!this.isOpen()) {
+      return;
+    }
+    const sectionLength = this.length - this.sectionStart - ATTRIBUTE_BATCH_HEADER_SIZE;
+    if (sectionLength === 0) {
+      this.length = this.sectionStart;
+      this.nodes.pop();
+    } else {
+      this.values[this.sectionStart + 1] = sectionLength;
+    }
+    this.openNode = null;
+    this.sectionStart = -1;
+  }
+
+  push(op: AttributeBatchOp, first: number, second?: number): boolean {
+    const argCount = second === undefined ? 1 : 2;
+    this.reserve(ATTRIBUTE_BATCH_HEADER_SIZE + argCount);
+    this.values[this.length++] = op;
+    this.values[this.length++] = argCount;
+    this.values[this.length++] = first;
+    if (second !== undefined) {
+      this.values[this.length++] = second;
+    }
+    return true;
+  }
+
+  pushReset(op: AttributeBatchOp): boolean {
+    this.reserve(ATTRIBUTE_BATCH_HEADER_SIZE);
+    this.values[this.length++] = op;
+    this.values[this.length++] = 0;
+    return true;
+  }
+
+  // Applies the updates in the buffer, the node being built stays open for the updates after them.
+  flush(): void {
+    const openNode = this.openNode;
+    const wasOpen = this.isOpen();
+    this.endNode();
+    if (this.length > 0) {
+      getUINativeModule().common.applyAttributeBatch(this.nodes, this.values.buffer, this.length);
+    }
+    this.nodes = [];
+    this.length = 0;
+    if (wasOpen) {
+      this.beginNode(openNode);
+    }
+  }
+
+  private reserve(count: number): void {
+    if (this.length + count <= this.values.length) {
+      return;
+    }
+    const values = new Float64Array(Math.max(this.values.length * 2, this.length + count));
+    values.set(this.values.subarray(0, this.length));
+    this.values = values;
+  }
+}
+
+const attributeBatch = new AttributeBatch();
+
 class BackgroundColorModifier extends ModifierWithKey<ResourceColor> {
   constructor(value: ResourceColor) {
     super(value);
@@ -225,6 +346,15 @@ class BackgroundColorModifier extends ModifierWithKey<ResourceColor> {
       getUINativeModule().common.setBackgroundColor(node, this.value);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.BACKGROUND_COLOR);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.BACKGROUND_COLOR, this.value);
+  }
 
   checkObjectDiff(): boolean {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
@@ -243,6 +373,15 @@ class WidthModifier extends ModifierWithKey<Length> {
       getUINativeModule().common.setWidth(node, this.value);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.WIDTH);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.WIDTH, this.value, ATTRIBUTE_BATCH_UNIT_VP);
+  }
 
   checkObjectDiff(): boolean {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
@@ -296,6 +435,15 @@ class HeightModifier extends ModifierWithKey<Length> {
       getUINativeModule().common.setHeight(node, this.value);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.HEIGHT);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.HEIGHT, this.value, ATTRIBUTE_BATCH_UNIT_VP);
+  }
 
   checkObjectDiff(): boolean {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
@@ -542,6 +690,15 @@ class ZIndexModifier extends ModifierWithKey<number> {
       getUINativeModule().common.setZIndex(node, this.value);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.Z_INDEX);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.Z_INDEX, this.value);
+  }
 }
 
 class OpacityModifier extends ModifierWithKey<number | Resource> {
@@ -556,6 +713,15 @@ class OpacityModifier extends ModifierWithKey<number | Resource> {
       getUINativeModule().common.setOpacity(node, this.value);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.OPACITY);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.OPACITY, this.value);
+  }
 
   checkObjectDiff(): boolean {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
@@ -2057,6 +2223,15 @@ class VisibilityModifier extends ModifierWithKey<number> {
       getUINativeModule().common.setVisibility(node, this.value!);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.VISIBILITY);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.VISIBILITY, this.value);
+  }
   checkObjectDiff(): boolean {
     return this.stageValue !== this.value;
   }
@@ -2220,6 +2395,15 @@ class AlignSelfModifier extends ModifierWithKey<number> {
       getUINativeModule().common.setAlignSelf(node, this.value!);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.ALIGN_SELF);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.ALIGN_SELF, this.value);
+  }
   checkObjectDiff(): boolean {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -2256,6 +2440,15 @@ class DisplayPriorityModifier extends ModifierWithKey<number> {
       getUINativeModule().common.setDisplayPriority(node, this.value!);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.DISPLAY_PRIORITY);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.DISPLAY_PRIORITY, this.value);
+  }
   checkObjectDiff(): boolean {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -2582,6 +2775,15 @@ class FlexGrowModifier extends ModifierWithKey<number> {
       getUINativeModule().common.setFlexGrow(node, this.value!);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.FLEX_GROW);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.FLEX_GROW, this.value);
+  }
   checkObjectDiff(): boolean {
     return this.stageValue !== this.value;
   }
@@ -2599,6 +2801,15 @@ class FlexShrinkModifier extends ModifierWithKey<number> {
       getUINativeModule().common.setFlexShrink(node, this.value!);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.FLEX_SHRINK);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.FLEX_SHRINK, this.value);
+  }
   checkObjectDiff(): boolean {
     return this.stageValue !== this.value;
   }
@@ -2616,6 +2827,15 @@ class AspectRatioModifier extends ModifierWithKey<number> {
       getUINativeModule().common.setAspectRatio(node, this.value!);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.ASPECT_RATIO);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.ASPECT_RATIO, this.value);
+  }
   checkObjectDiff(): boolean {
     return this.stageValue !== this.value;
   }
@@ -2687,6 +2907,15 @@ class EnabledModifier extends ModifierWithKey<boolean> {
       getUINativeModule().common.setEnabled(node, this.value);
     }
   }
+  applyBatch(reset: boolean): boolean {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.ENABLED);
+    }
+    if (typeof this.value !== 'boolean') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.ENABLED, this.value ? 1 : 0);
+  }
 }
 
 class UseShadowBatchingModifier extends ModifierWithKey<boolean> {
@@ -3020,11 +3249,17 @@ class ArkComponent implements CommonMethod<CommonAttribute> {
   applyModifierPatch(): void {
     let expiringItems = [];
     let expiringItemsWithKeys = [];
-    this._modifiersWithKeys.forEach((value, key) => {
-      if (value.applyStage(this.nativePtr, this)) {
-        expiringItemsWithKeys.push(key);
-      }
-    });
+    attributeBatch.beginNode(this.nativePtr);
+    try {
+      this._modifiersWithKeys.forEach((value, key) => {
+        if (value.applyStage(this.nativePtr, this)) {
+          expiringItemsWithKeys.push(key);
+        }
+      });
+    } finally {
+      attributeBatch.endNode();
+      attributeBatch.flush();
+    }
     expiringItemsWithKeys.forEach(key => {
       this._modifiersWithKeys.delete(key);
     });
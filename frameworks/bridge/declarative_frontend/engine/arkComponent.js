@@ -131,7 +131,7 @@ class ModifierWithKey {
   applyStage(node, component) {
     if (this.stageValue === undefined || this.stageValue === null) {
       this.value = this.stageValue;
-      this.applyPeer(node, true, component);
+      this.applyPeerOrBatch(node, true, component);
       return true;
     }
     const stageTypeInfo = typeof this.stageValue;
@@ -148,15 +148,118 @@ class ModifierWithKey {
     }
     if (different) {
       this.value = this.stageValue;
-      this.applyPeer(node, false, component);
+      this.applyPeerOrBatch(node, false, component);
     }
     return false;
   }
+  applyPeerOrBatch(node, reset, component) {
+    if (attributeBatch.isOpen() && this.applyBatch(reset)) {
+      return;
+    }
+    attributeBatch.flush();
+    this.applyPeer(node, reset, component);
+  }
   applyPeer(node, reset, component) { }
+  applyBatch(reset) {
+    return false;
+  }
   checkObjectDiff() {
     return true;
   }
 }
+let AttributeBatchOp;
+(function (AttributeBatchOp) {
+    AttributeBatchOp[AttributeBatchOp['BACKGROUND_COLOR'] = 0] = 'BACKGROUND_COLOR';
+    AttributeBatchOp[AttributeBatchOp['WIDTH'] = 1] = 'WIDTH';
+    AttributeBatchOp[AttributeBatchOp['HEIGHT'] = 2] = 'HEIGHT';
+    AttributeBatchOp[AttributeBatchOp['OPACITY'] = 3] = 'OPACITY';
+    AttributeBatchOp[AttributeBatchOp['Z_INDEX'] = 4] = 'Z_INDEX';
+    AttributeBatchOp[AttributeBatchOp['VISIBILITY'] = 5] = 'VISIBILITY';
+    AttributeBatchOp[AttributeBatchOp['ENABLED'] = 6] = 'ENABLED';
+    AttributeBatchOp[AttributeBatchOp['FLEX_GROW'] = 7] = 'FLEX_GROW';
+    AttributeBatchOp[AttributeBatchOp['FLEX_SHRINK'] = 8] = 'FLEX_SHRINK';
+    AttributeBatchOp[AttributeBatchOp['ALIGN_SELF'] = 9] = 'ALIGN_SELF';
+    AttributeBatchOp[AttributeBatchOp['ASPECT_RATIO'] = 10] = 'ASPECT_RATIO';
+    AttributeBatchOp[AttributeBatchOp['DISPLAY_PRIORITY'] = 11] = 'DISPLAY_PRIORITY';
+})(AttributeBatchOp || (AttributeBatchOp = {}));
+const ATTRIBUTE_BATCH_INITIAL_CAPACITY = 256;
+const ATTRIBUTE_BATCH_HEADER_SIZE = 2;
+const ATTRIBUTE_BATCH_UNIT_VP = 1;
+class AttributeBatch {
+  constructor() {
+    this.nodes = [];
+    this.values = new Float64Array(ATTRIBUTE_BATCH_INITIAL_CAPACITY);
+    this.length = 0;
+    this.openNode = null;
+    this.sectionStart = -1;
+  }
+  isOpen() {
+    return this.sectionStart >= 0;
+  }
+  beginNode(node) {
+    this.endNode();
+    this.reserve(ATTRIBUTE_BATCH_HEADER_SIZE);
+    this.openNode = node;
+    this.sectionStart = this.length;
+    this.values[this.length++] = this.nodes.length;
+    this.values[this.length++] = 0;
+    this.nodes.push(node);
+  }
+  endNode() {
+    if (!this.isOpen()) {
+      return;
+    }
+    const sectionLength = this.length - this.sectionStart - ATTRIBUTE_BATCH_HEADER_SIZE;
+    if (sectionLength === 0) {
+      this.length = this.sectionStart;
+      this.nodes.pop();
+    }
+    else {
+      this.values[this.sectionStart + 1] = sectionLength;
+    }
+    this.openNode = null;
+    this.sectionStart = -1;
+  }
+  push(op, first, second) {
+    const argCount = second === undefined ? 1 : 2;
+    this.reserve(ATTRIBUTE_BATCH_HEADER_SIZE + argCount);
+    this.values[this.length++] = op;
+    this.values[this.length++] = argCount;
+    this.values[this.length++] = first;
+    if (second !== undefined) {
+      this.values[this.length++] = second;
+    }
+    return true;
+  }
+  pushReset(op) {
+    this.reserve(ATTRIBUTE_BATCH_HEADER_SIZE);
+    this.values[this.length++] = op;
+    this.values[this.length++] = 0;
+    return true;
+  }
+  flush() {
+    const openNode = this.openNode;
+    const wasOpen = this.isOpen();
+    this.endNode();
+    if (this.length > 0) {
+      getUINativeModule().common.applyAttributeBatch(this.nodes, this.values.buffer, this.length);
+    }
+    this.nodes = [];
+    this.length = 0;
+    if (wasOpen) {
+      this.beginNode(openNode);
+    }
+  }
+  reserve(count) {
+    if (this.length + count <= this.values.length) {
+      return;
+    }
+    const values = new Float64Array(Math.max(this.values.length * 2, this.length + count));
+    values.set(this.values.subarray(0, this.length));
+    this.values = values;
+  }
+}
+const attributeBatch = new AttributeBatch();
 class BackgroundColorModifier extends ModifierWithKey {
   constructor(value) {
     super(value);
@@ -169,6 +272,15 @@ class BackgroundColorModifier extends ModifierWithKey {
       getUINativeModule().common.setBackgroundColor(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.BACKGROUND_COLOR);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.BACKGROUND_COLOR, this.value);
+  }
   checkObjectDiff() {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -186,6 +298,15 @@ class WidthModifier extends ModifierWithKey {
       getUINativeModule().common.setWidth(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.WIDTH);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.WIDTH, this.value, ATTRIBUTE_BATCH_UNIT_VP);
+  }
   checkObjectDiff() {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -236,6 +357,15 @@ class HeightModifier extends ModifierWithKey {
       getUINativeModule().common.setHeight(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.HEIGHT);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.HEIGHT, this.value, ATTRIBUTE_BATCH_UNIT_VP);
+  }
   checkObjectDiff() {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -473,6 +603,15 @@ class ZIndexModifier extends ModifierWithKey {
       getUINativeModule().common.setZIndex(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.Z_INDEX);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.Z_INDEX, this.value);
+  }
 }
 ZIndexModifier.identity = Symbol('zIndex');
 class OpacityModifier extends ModifierWithKey {
@@ -487,6 +626,15 @@ class OpacityModifier extends ModifierWithKey {
       getUINativeModule().common.setOpacity(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.OPACITY);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.OPACITY, this.value);
+  }
   checkObjectDiff() {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -1950,6 +2098,15 @@ class VisibilityModifier extends ModifierWithKey {
       getUINativeModule().common.setVisibility(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.VISIBILITY);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.VISIBILITY, this.value);
+  }
   checkObjectDiff() {
     return this.stageValue !== this.value;
   }
@@ -2114,6 +2271,15 @@ class AlignSelfModifier extends ModifierWithKey {
       getUINativeModule().common.setAlignSelf(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.ALIGN_SELF);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.ALIGN_SELF, this.value);
+  }
   checkObjectDiff() {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -2149,6 +2315,15 @@ class DisplayPriorityModifier extends ModifierWithKey {
       getUINativeModule().common.setDisplayPriority(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.DISPLAY_PRIORITY);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.DISPLAY_PRIORITY, this.value);
+  }
   checkObjectDiff() {
     return !isBaseOrResourceEqual(this.stageValue, this.value);
   }
@@ -2461,6 +2636,15 @@ class FlexGrowModifier extends ModifierWithKey {
       getUINativeModule().common.setFlexGrow(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.FLEX_GROW);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.FLEX_GROW, this.value);
+  }
   checkObjectDiff() {
     return this.stageValue !== this.value;
   }
@@ -2478,6 +2662,15 @@ class FlexShrinkModifier extends ModifierWithKey {
       getUINativeModule().common.setFlexShrink(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.FLEX_SHRINK);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.FLEX_SHRINK, this.value);
+  }
   checkObjectDiff() {
     return this.stageValue !== this.value;
   }
@@ -2495,6 +2688,15 @@ class AspectRatioModifier extends ModifierWithKey {
       getUINativeModule().common.setAspectRatio(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.ASPECT_RATIO);
+    }
+    if (typeof this.value !== 'number') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.ASPECT_RATIO, this.value);
+  }
   checkObjectDiff() {
     return this.stageValue !== this.value;
   }
@@ -2563,6 +2765,15 @@ class EnabledModifier extends ModifierWithKey {
       getUINativeModule().common.setEnabled(node, this.value);
     }
   }
+  applyBatch(reset) {
+    if (reset) {
+      return attributeBatch.pushReset(AttributeBatchOp.ENABLED);
+    }
+    if (typeof this.value !== 'boolean') {
+      return false;
+    }
+    return attributeBatch.push(AttributeBatchOp.ENABLED, this.value ? 1 : 0);
+  }
 }
 EnabledModifier.identity = Symbol('enabled');
 class UseShadowBatchingModifier extends ModifierWithKey {
@@ -2935,11 +3146,18 @@ class ArkComponent {
   applyModifierPatch() {
     let expiringItems = [];
     let expiringItemsWithKeys = [];
-    this._modifiersWithKeys.forEach((value, key) => {
-      if (value.applyStage(this.nativePtr, this)) {
-        expiringItemsWithKeys.push(key);
-      }
-    });
+    attributeBatch.beginNode(this.nativePtr);
+    try {
+      this._modifiersWithKeys.forEach((value, key) => {
+        if (value.applyStage(this.nativePtr, this)) {
+          expiringItemsWithKeys.push(key);
+        }
+      });
+    }
+    finally {
+      attributeBatch.endNode();
+      attributeBatch.flush();
+    }
     expiringItemsWithKeys.forEach(key => {
       this._modifiersWithKeys.delete(key);
     });
@@ -197,16 +197,15 @@ shared_ptr<JsValue> JsiDeclarativeGroupJsBridge::ProcessJsRequestSync(const shar
     } else {
         return res;
     }
-    std::vector<uint8_t> messageData = std::vector<uint8_t>(resData, resData + position);
-
     shared_ptr<JsValue> callBackResult;
     CodecData codecResult;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    // decodes the result where the dispatcher left it, reading the string in place until it is given to the runtime.
+    if (codec.DecodePlatformMessage(resData, position > 0 ? static_cast<size_t>(position) : 0, codecResult, true)) {
+        auto resultString = codecResult.GetStringView();
         if (resultString.empty()) {
             callBackResult = runtime->NewNull();
         } else {
-            callBackResult = runtime->NewString(resultString);
+            callBackResult = runtime->NewString(std::string(resultString));
         }
     }
     return callBackResult;
@@ -375,12 +374,12 @@ void JsiDeclarativeGroupJsBridge::TriggerModuleJsCallback(
     shared_ptr<JsValue> callBackResult;
     CodecData codecResult;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    if (codec.DecodePlatformMessage(messageData.data(), messageData.size(), codecResult, true)) {
+        auto resultString = codecResult.GetStringView();
         if (resultString.empty()) {
             callBackResult = runtime_->NewNull();
         } else {
-            callBackResult = runtime_->NewString(resultString);
+            callBackResult = runtime_->NewString(std::string(resultString));
         }
     } else {
         callBackResult = runtime_->NewString("invalid response data");
@@ -447,12 +446,12 @@ void JsiDeclarativeGroupJsBridge::CallEventJsCallback(int32_t callbackId, std::v
     shared_ptr<JsValue> callBackEvent;
     CodecData codecEvent;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(eventData, codecEvent)) {
-        std::string eventString = codecEvent.GetStringValue();
+    if (codec.DecodePlatformMessage(eventData.data(), eventData.size(), codecEvent, true)) {
+        auto eventString = codecEvent.GetStringView();
         if (eventString.empty()) {
             callBackEvent = runtime_->NewNull();
         } else {
-            callBackEvent = runtime_->NewString(eventString);
+            callBackEvent = runtime_->NewString(std::string(eventString));
         }
     } else {
         return;
@@ -928,6 +928,8 @@ ArkUINativeModuleValue ArkUINativeModule::GetArkUINativeModule(ArkUIRuntimeCallI
         panda::FunctionRef::New(const_cast<panda::EcmaVM*>(vm), CommonBridge::LessThanAPITargetVersion));
     common->Set(vm, panda::StringRef::NewFromUtf8(vm, "getApiTargetVersion"),
         panda::FunctionRef::New(const_cast<panda::EcmaVM*>(vm), CommonBridge::GetApiTargetVersion));
+    common->Set(vm, panda::StringRef::NewFromUtf8(vm, "applyAttributeBatch"),
+        panda::FunctionRef::New(const_cast<panda::EcmaVM*>(vm), CommonBridge::ApplyAttributeBatch));
     common->Set(vm, panda::StringRef::NewFromUtf8(vm, "setBorderWithDashParams"),
         panda::FunctionRef::New(const_cast<panda::EcmaVM*>(vm), CommonBridge::SetBorderWithDashParams));
     object->Set(vm, panda::StringRef::NewFromUtf8(vm, "common"), common);
@@ -71,6 +71,8 @@ constexpr double HALF_DIMENSION = 50.0;
 constexpr uint32_t DEFAULT_DURATION = 1000;
 constexpr int64_t MICROSEC_TO_MILLISEC = 1000;
 constexpr int32_t MAX_ALIGN_VALUE = 8;
+// a section of an attribute batch is the index of its node and the count of its values, followed by the values.
+constexpr int32_t ATTRIBUTE_BATCH_SECTION_HEADER_SIZE = 2;
 constexpr int32_t BACKWARD_COMPAT_MAGIC_NUMBER_OFFSCREEN = 1000;
 constexpr SharedTransitionEffectType DEFAULT_SHARED_EFFECT = SharedTransitionEffectType::SHARED_EFFECT_EXCHANGE;
 constexpr int32_t DEFAULT_TAP_FINGER = 1;
@@ -7133,4 +7135,45 @@ ArkUINativeModuleValue CommonBridge::GetApiTargetVersion(ArkUIRuntimeCallInfo* r
     int32_t apiTargetVersion = container->GetApiTargetVersion();
     return panda::NumberRef::New(vm, apiTargetVersion);
 }
+
+// Applies the attribute updates the frontend packed for many nodes in a single call. The buffer holds a section per
+// node, each of them is the command buffer of ArkUIAttributeBatchOp the common modifier applies to the node.
+ArkUINativeModuleValue CommonBridge::ApplyAttributeBatch(ArkUIRuntimeCallInfo* runtimeCallInfo)
+{
+    EcmaVM* vm = runtimeCallInfo->GetVM();
+    CHECK_NULL_RETURN(vm, panda::JSValueRef::Undefined(vm));
+    Local<JSValueRef> nodesArg = runtimeCallInfo->GetCallArgRef(NUM_0);
+    Local<JSValueRef> bufferArg = runtimeCallInfo->GetCallArgRef(NUM_1);
+    Local<JSValueRef> lengthArg = runtimeCallInfo->GetCallArgRef(NUM_2);
+    if (!nodesArg->IsArray(vm) || !bufferArg->IsArrayBuffer(vm) || !lengthArg->IsNumber()) {
+        return panda::JSValueRef::Undefined(vm);
+    }
+    auto nodes = static_cast<Local<panda::ArrayRef>>(nodesArg);
+    auto buffer = static_cast<Local<panda::ArrayBufferRef>>(bufferArg);
+    auto* values = static_cast<const ArkUI_Float64*>(buffer->GetBuffer(vm));
+    CHECK_NULL_RETURN(values, panda::JSValueRef::Undefined(vm));
+    auto capacity = static_cast<int32_t>(buffer->ByteLength(vm) / sizeof(ArkUI_Float64));
+    auto length = std::clamp(lengthArg->Int32Value(vm), 0, capacity);
+    auto nodeCount = nodes->Length(vm);
+    auto* modifier = GetArkUINodeModifiers()->getCommonModifier();
+    int32_t index = 0;
+    while (index + ATTRIBUTE_BATCH_SECTION_HEADER_SIZE <= length) {
+        auto nodeIndex = values[index];
+        auto sectionLength = values[index + 1];
+        index += ATTRIBUTE_BATCH_SECTION_HEADER_SIZE;
+        if (!(sectionLength >= 0 && sectionLength <= length - index)) {
+            break;
+        }
+        auto sectionSize = static_cast<int32_t>(sectionLength);
+        if (nodeIndex >= 0 && nodeIndex < nodeCount) {
+            auto nodeArg = panda::ArrayRef::GetValueAt(vm, nodes, static_cast<uint32_t>(nodeIndex));
+            if (nodeArg->IsNativePointer(vm)) {
+                auto nativeNode = nodePtr(nodeArg->ToNativePointer(vm)->Value());
+                modifier->applyAttributeBatch(nativeNode, values + index, sectionSize);
+            }
+        }
+        index += sectionSize;
+    }
+    return panda::JSValueRef::Undefined(vm);
+}
 } // namespace OHOS::Ace::NG
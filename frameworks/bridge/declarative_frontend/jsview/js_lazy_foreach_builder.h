@@ -187,7 +187,7 @@ public:
     }
 
     std::pair<std::string, RefPtr<NG::UINode>> OnGetChildByIndexNew(int32_t index,
-        std::map<int32_t, NG::LazyForEachChild>& cachedItems,
+        NG::LazyForEachCachedItems& cachedItems,
         std::unordered_map<std::string, NG::LazyForEachCacheChild>& expiringItems) override
     {
         std::pair<std::string, RefPtr<NG::UINode>> info;
@@ -16,6 +16,7 @@
 #include "bridge/declarative_frontend/jsview/js_repeat_virtual_scroll.h"
 
 #include <string>
+#include <vector>
 
 #include "base/log/ace_trace.h"
 #include "base/log/log_wrapper.h"
@@ -71,32 +72,32 @@ void JSRepeatVirtualScroll::Create(const JSCallbackInfo& info)
     };
 
     auto onGetKeys4Range = [execCtx = info.GetExecutionContext(), func = JSFUNC(handlers, "onGetKeys4Range")](
-                               uint32_t from, uint32_t to) -> std::list<std::string> {
-        std::list<std::string> list;
-        JAVASCRIPT_EXECUTION_SCOPE_WITH_CHECK(execCtx, list);
+                               uint32_t from, uint32_t to, std::vector<std::string>& keys) -> void {
+        keys.clear();
+        JAVASCRIPT_EXECUTION_SCOPE_WITH_CHECK(execCtx);
         auto params = ConvertToJSValues(from, to);
         JSRef<JSVal> jsVal = func->Call(JSRef<JSObject>(), params.size(), params.data());
-        // convert js-array to std::list
+        // convert js-array into the reused vector
         JSRef<JSArray> jsArr = JSRef<JSArray>::Cast(jsVal);
+        keys.reserve(jsArr->Length());
         for (size_t i = 0; i < jsArr->Length(); i++) {
-            list.emplace_back(jsArr->GetValueAt(i)->ToString());
+            keys.emplace_back(jsArr->GetValueAt(i)->ToString());
         }
-        return list;
     };
 
     auto onGetTypes4Range = [execCtx = info.GetExecutionContext(), func = JSFUNC(handlers, "onGetTypes4Range")](
-                                uint32_t from, uint32_t to) -> std::list<std::string> {
-        std::list<std::string> list;
-        JAVASCRIPT_EXECUTION_SCOPE_WITH_CHECK(execCtx, list);
+                                uint32_t from, uint32_t to, std::vector<std::string>& ttypes) -> void {
+        ttypes.clear();
+        JAVASCRIPT_EXECUTION_SCOPE_WITH_CHECK(execCtx);
         auto params = ConvertToJSValues(from, to);
         JSRef<JSVal> jsVal = func->Call(JSRef<JSObject>(), params.size(), params.data());
 
-        // convert js-array to std::list
+        // convert js-array into the reused vector
         JSRef<JSArray> jsArr = JSRef<JSArray>::Cast(jsVal);
+        ttypes.reserve(jsArr->Length());
         for (size_t i = 0; i < jsArr->Length(); i++) {
-            list.emplace_back(jsArr->GetValueAt(i)->ToString());
+            ttypes.emplace_back(jsArr->GetValueAt(i)->ToString());
         }
-        return list;
     };
 
     RepeatVirtualScrollModel::GetInstance()->Create(
@@ -318,12 +318,11 @@ shared_ptr<JsValue> JsiGroupJsBridge::ProcessJsRequestSync(const shared_ptr<JsRu
         LOGW("Dispatcher Upgrade fail when dispatch request message to platform");
         return res;
     }
-    std::vector<uint8_t> messageData = std::vector<uint8_t>(resData, resData + position);
-
     shared_ptr<JsValue> callBackResult;
     CodecData codecResult;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    // decodes the result where the dispatcher left it, copying the string once for the runtime.
+    if (codec.DecodePlatformMessage(resData, position > 0 ? static_cast<size_t>(position) : 0, codecResult, true)) {
+        std::string resultString(codecResult.GetStringView());
         LOGI("sync resultString = %{private}s", resultString.c_str());
         if (resultString.empty()) {
             callBackResult = runtime->NewNull();
@@ -511,12 +510,12 @@ void JsiGroupJsBridge::TriggerModuleJsCallback(int32_t callbackId, int32_t code,
     shared_ptr<JsValue> callBackResult;
     CodecData codecResult;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        std::string resultString = codecResult.GetStringValue();
+    if (codec.DecodePlatformMessage(messageData.data(), messageData.size(), codecResult, true)) {
+        auto resultString = codecResult.GetStringView();
         if (resultString.empty()) {
             callBackResult = runtime_->NewNull();
         } else {
-            callBackResult = runtime_->NewString(resultString);
+            callBackResult = runtime_->NewString(std::string(resultString));
         }
     } else {
         LOGE("trigger JS resolve callback function error, decode message fail, callbackId:%{private}d", callbackId);
@@ -595,12 +594,12 @@ void JsiGroupJsBridge::CallEventJsCallback(int32_t callbackId, std::vector<uint8
     shared_ptr<JsValue> callBackEvent;
     CodecData codecEvent;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(eventData, codecEvent)) {
-        std::string eventString = codecEvent.GetStringValue();
+    if (codec.DecodePlatformMessage(eventData.data(), eventData.size(), codecEvent, true)) {
+        auto eventString = codecEvent.GetStringView();
         if (eventString.empty()) {
             callBackEvent = runtime_->NewNull();
         } else {
-            callBackEvent = runtime_->NewString(eventString);
+            callBackEvent = runtime_->NewString(std::string(eventString));
         }
     } else {
         LOGE("trigger Js callback function error, decode message fail, callbackId:%{private}d", callbackId);
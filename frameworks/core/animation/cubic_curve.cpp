@@ -15,6 +15,9 @@
 
 #include "core/animation/cubic_curve.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "base/log/log_wrapper.h"
 #include "base/utils/macros.h"
 
@@ -23,11 +26,27 @@ namespace {
 
 constexpr float FRACTION_PARAMETER_MAX = 1.0f;
 constexpr float FRACTION_PARAMETER_MIN = 0.0f;
+constexpr float SOLVE_ERROR_BOUND = 1e-5f; // Control curve accuracy, as the distance between Bx(m) and time
+constexpr float NEWTON_MIN_SLOPE = 0.02f;  // Newton-Raphson diverges on flatter parts of Bx
+constexpr int32_t MAX_NEWTON_ITERATIONS = 4;
+constexpr int32_t MAX_BISECTION_ITERATIONS = 16;
+// a guess from the table is close enough for two steps to reach the bound on all but the flattest curves.
+constexpr int32_t BATCH_NEWTON_ITERATIONS = 2;
 
 }   // namespace
 CubicCurve::CubicCurve(float x0, float y0, float x1, float y1)
     : x0_(x0), y0_(y0), x1_(x1), y1_(y1)
-{}
+{
+    cx_ = 3.0f * x0_;
+    bx_ = 3.0f * (x1_ - x0_) - cx_;
+    ax_ = 1.0f - cx_ - bx_;
+    cy_ = 3.0f * y0_;
+    by_ = 3.0f * (y1_ - y0_) - cy_;
+    ay_ = 1.0f - cy_ - by_;
+    for (int32_t index = 0; index < SAMPLE_COUNT; ++index) {
+        samples_[index] = SampleX(static_cast<float>(index) / (SAMPLE_COUNT - 1));
+    }
+}
 
 float CubicCurve::MoveInternal(float time)
 {
@@ -39,22 +58,92 @@ float CubicCurve::MoveInternal(float time)
         TAG_LOGI(AceLogTag::ACE_ANIMATION, "CubicCurve MoveInternal: time is less than 0 or larger than 1, return 1");
         return FRACTION_PARAMETER_MAX;
     }
-    // let P0 = (0,0), P3 = (1,1)
-    float start = 0.0f;
-    float end = 1.0f;
-    while (true) {
-        float midpoint = (start + end) / 2;
-        float estimate = CalculateCubic(x0_, x1_, midpoint);
-        if (NearEqual(time, estimate, cubicErrorBound_)) {
-            return CalculateCubic(y0_, y1_, midpoint);
+    return SampleY(SolveParameter(time));
+}
+
+void CubicCurve::MoveBatchInternal(const float* times, float* values, size_t count)
+{
+    // values hold the m of each time until the last pass, the Newton-Raphson passes in between have no branch so
+    // that they run over the arrays in vector registers.
+    for (size_t index = 0; index < count; ++index) {
+        int32_t interval = 0;
+        values[index] = GuessParameter(times[index], interval);
+    }
+    for (int32_t iteration = 0; iteration < BATCH_NEWTON_ITERATIONS; ++iteration) {
+        for (size_t index = 0; index < count; ++index) {
+            float m = values[index];
+            float slope = SampleSlopeX(m);
+            bool steep = slope >= NEWTON_MIN_SLOPE;
+            float next = m - (SampleX(m) - times[index]) / (steep ? slope : 1.0f);
+            next = std::clamp(next, FRACTION_PARAMETER_MIN, FRACTION_PARAMETER_MAX);
+            values[index] = steep ? next : m;
+        }
+    }
+    for (size_t index = 0; index < count; ++index) {
+        float time = times[index];
+        // the same result as MoveInternal for a nan time or a time out of range, without a log per time.
+        if (!(time >= FRACTION_PARAMETER_MIN && time <= FRACTION_PARAMETER_MAX)) {
+            values[index] = FRACTION_PARAMETER_MAX;
+            continue;
+        }
+        float m = values[index];
+        if (std::fabs(SampleX(m) - time) >= SOLVE_ERROR_BOUND) {
+            m = SolveParameter(time);
+        }
+        values[index] = SampleY(m);
+    }
+}
+
+float CubicCurve::GuessParameter(float time, int32_t& interval) const
+{
+    // let P0 = (0,0), P3 = (1,1), Bx rises from 0 to 1 through the samples, time lies in the first interval whose end
+    // is past it.
+    interval = 0;
+    while (interval < SAMPLE_COUNT - 2 && samples_[interval + 1] <= time) {
+        ++interval;
+    }
+    float step = 1.0f / (SAMPLE_COUNT - 1);
+    float span = samples_[interval + 1] - samples_[interval];
+    float offset = span > 0.0f ? (time - samples_[interval]) / span : 0.0f;
+    return (static_cast<float>(interval) + offset) * step;
+}
+
+float CubicCurve::SolveParameter(float time) const
+{
+    int32_t interval = 0;
+    float m = GuessParameter(time, interval);
+    float step = 1.0f / (SAMPLE_COUNT - 1);
+    float start = static_cast<float>(interval) * step;
+    float end = start + step;
+    for (int32_t iteration = 0; iteration <= MAX_NEWTON_ITERATIONS; ++iteration) {
+        float error = SampleX(m) - time;
+        if (std::fabs(error) < SOLVE_ERROR_BOUND) {
+            return m;
         }
+        float slope = SampleSlopeX(m);
+        if (iteration == MAX_NEWTON_ITERATIONS || slope < NEWTON_MIN_SLOPE) {
+            break;
+        }
+        m = std::clamp(m - error / slope, start, end);
+    }
+    return BisectParameter(time, start, end);
+}
 
-        if (estimate < time) {
+float CubicCurve::BisectParameter(float time, float start, float end) const
+{
+    for (int32_t iteration = 0; iteration < MAX_BISECTION_ITERATIONS; ++iteration) {
+        float midpoint = (start + end) / 2;
+        float error = SampleX(midpoint) - time;
+        if (std::fabs(error) < SOLVE_ERROR_BOUND) {
+            return midpoint;
+        }
+        if (error < 0.0f) {
             start = midpoint;
         } else {
             end = midpoint;
         }
     }
+    return (start + end) / 2;
 }
 
 const std::string CubicCurve::ToString()
@@ -76,9 +165,4 @@ bool CubicCurve::IsEqual(const RefPtr<Curve>& curve) const
         && NearEqual(other->GetX1(), x1_) && NearEqual(other->GetY1(), y1_);
 }
 
-float CubicCurve::CalculateCubic(float a, float b, float m)
-{
-    return 3.0f * a * (1.0f - m) * (1.0f - m) * m + 3.0f * b * (1.0f - m) * m * m + m * m * m;
-}
-
 } // namespace OHOS::Ace
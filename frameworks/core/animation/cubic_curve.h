@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_CUBIC_CURVE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_ANIMATION_CUBIC_CURVE_H
 
+#include <array>
+
 #include "core/animation/curve.h"
 
 namespace OHOS::Ace {
@@ -27,6 +29,8 @@ class NativeCurveHelper;
 // so Bx(m) = 3m(1-m)^2*x0_ + 3m^2*x1_ + m^3
 //    By(m) = 3m(1-m)^2*y0_ + 3m^2*y1_ + m^3
 // in function MoveInternal, assume time as Bx(m), we let Bx(m) approaching time, and we can get m and the output By(m)
+// m is found by Newton-Raphson from a guess taken in a table of Bx sampled at construction, and by a bounded bisection
+// when the slope is too flat for Newton-Raphson to converge.
 class ACE_EXPORT CubicCurve : public Curve {
     DECLARE_ACE_TYPE(CubicCurve, Curve);
 
@@ -35,6 +39,7 @@ public:
     ~CubicCurve() override = default;
 
     float MoveInternal(float time) override;
+    void MoveBatchInternal(const float* times, float* values, size_t count) override;
     const std::string ToString() override;
 
     float GetX0() const
@@ -60,14 +65,42 @@ public:
     bool IsEqual(const RefPtr<Curve>& curve) const override;
 
 private:
-    // Bx(m) or By(m) = 3m(1-m)^2*a + 3m^2*b + m^3, where a = x0_ ,b = x1_ or a = y0_ ,b = y1_
-    static float CalculateCubic(float a, float b, float m);
-
-    float cubicErrorBound_ = 0.001f; // Control curve accuracy
-    float x0_;                       // X-axis of the first point (P1)
-    float y0_;                       // Y-axis of the first point (P1)
-    float x1_;                       // X-axis of the second point (P2)
-    float y1_;                       // Y-axis of the second point (P2)
+    // Bx is sampled at m = 0, 0.1, ..., 1.
+    static constexpr int32_t SAMPLE_COUNT = 11;
+
+    // Bx(m) = ((ax_*m + bx_)*m + cx_)*m, the polynomial form of the formula above.
+    float SampleX(float m) const
+    {
+        return ((ax_ * m + bx_) * m + cx_) * m;
+    }
+
+    float SampleY(float m) const
+    {
+        return ((ay_ * m + by_) * m + cy_) * m;
+    }
+
+    // the derivative of Bx at m.
+    float SampleSlopeX(float m) const
+    {
+        return (3.0f * ax_ * m + 2.0f * bx_) * m + cx_;
+    }
+
+    // returns the m where Bx(m) is time, the time must be between 0.0 and 1.0.
+    float SolveParameter(float time) const;
+    float GuessParameter(float time, int32_t& interval) const;
+    float BisectParameter(float time, float start, float end) const;
+
+    float x0_; // X-axis of the first point (P1)
+    float y0_; // Y-axis of the first point (P1)
+    float x1_; // X-axis of the second point (P2)
+    float y1_; // Y-axis of the second point (P2)
+    float ax_;
+    float bx_;
+    float cx_;
+    float ay_;
+    float by_;
+    float cy_;
+    std::array<float, SAMPLE_COUNT> samples_;
 
     friend class NativeCurveHelper;
 };
@@ -44,8 +44,26 @@ public:
         return MoveInternal(time);
     }
 
+    // Writes the values at count times to values, for the interpolators driving many properties with one curve.
+    // Both arrays hold count floats and must not overlap.
+    void MoveBatch(const float* times, float* values, size_t count)
+    {
+        CHECK_NULL_VOID(times);
+        CHECK_NULL_VOID(values);
+        MoveBatchInternal(times, values, count);
+    }
+
     // Each subclass needs to override this method to implement motion in the 0.0 to 1.0 time range.
     virtual float MoveInternal(float time) = 0;
+
+    // The subclasses whose evaluation runs in steps override this method to run each step over all the times.
+    virtual void MoveBatchInternal(const float* times, float* values, size_t count)
+    {
+        for (size_t index = 0; index < count; ++index) {
+            values[index] = MoveInternal(times[index]);
+        }
+    }
+
     virtual const std::string ToString()
     {
         return "";
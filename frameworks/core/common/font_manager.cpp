@@ -53,6 +53,7 @@ void FontManager::RegisterFont(const std::string& familyName, const std::string&
     }
     RefPtr<FontLoader> fontLoader = FontLoader::Create(familyName, familySrc);
     fontLoaders_.emplace_back(fontLoader);
+    MarkFontChanged();
     fontLoader->AddFont(context, bundleName, moduleName);
 
     fontLoader->SetVariationChanged([weak = WeakClaim(this), familyName]() {
@@ -66,6 +67,7 @@ void FontManager::SetFontFamily(const char* familyName, const char* familySrc)
 {
     RefPtr<FontLoader> fontLoader = FontLoader::Create(familyName, familySrc);
     fontLoader->SetDefaultFontFamily(familyName, familySrc);
+    MarkFontChanged();
 }
 
 bool FontManager::IsDefaultFontChanged()
@@ -224,6 +226,7 @@ void FontManager::RemoveFontNode(const WeakPtr<RenderNode>& node)
 
 void FontManager::RebuildFontNode()
 {
+    MarkFontChanged();
 #ifndef NG_BUILD
     for (auto iter = fontNodes_.begin(); iter != fontNodes_.end();) {
         auto fontNode = iter->Upgrade();
@@ -260,6 +263,7 @@ void FontManager::UnRegisterCallback(const WeakPtr<RenderNode>& node)
 
 void FontManager::RebuildFontNodeNG()
 {
+    MarkFontChanged();
     for (auto iter = fontNodesNG_.begin(); iter != fontNodesNG_.end();) {
         auto fontNode = iter->Upgrade();
         CHECK_NULL_VOID(fontNode);
@@ -296,6 +300,7 @@ void FontManager::RemoveVariationNode(const WeakPtr<RenderNode>& node)
 
 void FontManager::NotifyVariationNodes()
 {
+    MarkFontChanged();
 #ifndef NG_BUILD
     for (const auto& node : variationNodes_) {
         auto refNode = node.Upgrade();
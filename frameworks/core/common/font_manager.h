@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_MANAGER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_FONT_MANAGER_H
 
+#include <atomic>
+#include <cstdint>
 #include <list>
 #include <set>
 #include <vector>
@@ -120,10 +122,22 @@ public:
     void SetAppCustomFont(const std::string& familyName);
     const std::string& GetAppCustomFont() const;
 
+    // Changes whenever the fonts text is shaped with may have changed, so that shaping results can be cached.
+    static uint64_t GetFontGeneration()
+    {
+        return fontGeneration_.load(std::memory_order_relaxed);
+    }
+
+    static void MarkFontChanged()
+    {
+        fontGeneration_.fetch_add(1, std::memory_order_relaxed);
+    }
+
 protected:
     static float fontWeightScale_;
     static bool isDefaultFontChanged_;
     static std::string appCustomFont_;
+    static inline std::atomic<uint64_t> fontGeneration_ { 0 };
 
 private:
     std::list<RefPtr<FontLoader>> fontLoaders_;
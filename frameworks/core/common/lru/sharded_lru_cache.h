@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_LRU_SHARDED_LRU_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_LRU_SHARDED_LRU_CACHE_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+struct LRUShardStats {
+    size_t count = 0;
+    size_t bytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+// String keyed LRU cache split into shards, each guarded by its own mutex, so threads looking up different keys
+// rarely wait on each other. The count and byte limits are shared by all shards: when an insertion exceeds them,
+// the entry used least recently across all shards is evicted, which keeps the cache close to one global LRU
+// without taking more than one shard lock at a time.
+template<typename T>
+class ShardedLRUCache final {
+public:
+    static constexpr size_t SHARD_COUNT = 16;
+    static constexpr size_t NO_LIMIT = std::numeric_limits<size_t>::max();
+
+    ShardedLRUCache(size_t countLimit, size_t sizeLimit) : countLimit_(countLimit), sizeLimit_(sizeLimit) {}
+    ~ShardedLRUCache() = default;
+
+    void SetCountLimit(size_t countLimit)
+    {
+        countLimit_ = countLimit;
+        Trim();
+    }
+
+    void SetSizeLimit(size_t sizeLimit)
+    {
+        sizeLimit_ = sizeLimit;
+        Trim();
+    }
+
+    size_t GetCountLimit() const
+    {
+        return countLimit_;
+    }
+
+    size_t GetSizeLimit() const
+    {
+        return sizeLimit_;
+    }
+
+    // Caches value as the most recently used entry of key, replacing the old value. Returns false and drops any
+    // old value if the entry can never fit in the limits.
+    bool Put(const std::string& key, const T& value, size_t cost)
+    {
+        if (countLimit_ == 0 || cost > sizeLimit_) {
+            Erase(key);
+            return false;
+        }
+        auto& shard = GetShard(key);
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto tick = clock_.fetch_add(1, std::memory_order_relaxed);
+            auto iter = shard.index.find(key);
+            if (iter != shard.index.end()) {
+                auto& entry = *iter->second;
+                shard.bytes = shard.bytes - entry.cost + cost;
+                bytes_ += cost;
+                bytes_ -= entry.cost;
+                entry.value = value;
+                entry.cost = cost;
+                entry.tick = tick;
+                shard.entries.splice(shard.entries.begin(), shard.entries, iter->second);
+            } else {
+                shard.entries.push_front(Entry { key, value, cost, tick });
+                shard.index.emplace(key, shard.entries.begin());
+                shard.bytes += cost;
+                bytes_ += cost;
+                ++count_;
+            }
+            UpdateTailTick(shard);
+        }
+        Trim();
+        return true;
+    }
+
+    // Returns a default constructed T if key is not cached.
+    T Get(const std::string& key)
+    {
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter == shard.index.end()) {
+            ++shard.misses;
+            return T();
+        }
+        ++shard.hits;
+        iter->second->tick = clock_.fetch_add(1, std::memory_order_relaxed);
+        shard.entries.splice(shard.entries.begin(), shard.entries, iter->second);
+        UpdateTailTick(shard);
+        return iter->second->value;
+    }
+
+    // Looks key up without refreshing it or counting a hit, for dumps and diagnostics.
+    T Peek(const std::string& key) const
+    {
+        const auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        return iter == shard.index.end() ? T() : iter->second->value;
+    }
+
+    bool Erase(const std::string& key)
+    {
+        auto& shard = GetShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto iter = shard.index.find(key);
+        if (iter == shard.index.end()) {
+            return false;
+        }
+        RemoveEntry(shard, iter->second);
+        return true;
+    }
+
+    void Clear()
+    {
+        for (auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            while (!shard.entries.empty()) {
+                RemoveEntry(shard, std::prev(shard.entries.end()));
+            }
+        }
+    }
+
+    size_t Count() const
+    {
+        return count_;
+    }
+
+    size_t Bytes() const
+    {
+        return bytes_;
+    }
+
+    // Visits the entries of each shard from the most to the least recently used, one shard lock at a time.
+    void ForEach(const std::function<void(const std::string&, const T&, size_t)>& func) const
+    {
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (const auto& entry : shard.entries) {
+                func(entry.key, entry.value, entry.cost);
+            }
+        }
+    }
+
+    std::vector<LRUShardStats> GetStats() const
+    {
+        std::vector<LRUShardStats> stats;
+        stats.reserve(SHARD_COUNT);
+        for (const auto& shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            stats.push_back({ shard.entries.size(), shard.bytes, shard.hits, shard.misses, shard.evictions });
+        }
+        return stats;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        T value;
+        size_t cost = 0;
+        // value of clock_ when the entry was last used, orders entries across shards.
+        uint64_t tick = 0;
+    };
+    using EntryList = std::list<Entry>;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        EntryList entries;
+        // tick of the least recently used entry, read without the lock to choose the shard to evict from.
+        std::atomic<uint64_t> tailTick = std::numeric_limits<uint64_t>::max();
+        std::unordered_map<std::string, typename EntryList::iterator> index;
+        size_t bytes = 0;
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t evictions = 0;
+    };
+
+    static size_t GetShardIndex(const std::string& key)
+    {
+        // the shard index takes the high bits of a mixed hash, the shard maps bucket by the low bits.
+        constexpr uint64_t HASH_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+        constexpr uint32_t SHARD_SHIFT = 60;
+        auto hash = static_cast<uint64_t>(std::hash<std::string>()(key));
+        return static_cast<size_t>((hash * HASH_MULTIPLIER) >> SHARD_SHIFT);
+    }
+
+    Shard& GetShard(const std::string& key)
+    {
+        return shards_[GetShardIndex(key)];
+    }
+
+    const Shard& GetShard(const std::string& key) const
+    {
+        return shards_[GetShardIndex(key)];
+    }
+
+    bool OverLimit() const
+    {
+        return count_ > countLimit_ || bytes_ > sizeLimit_;
+    }
+
+    static void UpdateTailTick(Shard& shard)
+    {
+        shard.tailTick.store(shard.entries.empty() ? std::numeric_limits<uint64_t>::max() : shard.entries.back().tick,
+            std::memory_order_relaxed);
+    }
+
+    void RemoveEntry(Shard& shard, typename EntryList::iterator iter)
+    {
+        shard.bytes -= iter->cost;
+        bytes_ -= iter->cost;
+        --count_;
+        shard.index.erase(iter->key);
+        shard.entries.erase(iter);
+        UpdateTailTick(shard);
+    }
+
+    void Trim()
+    {
+        while (OverLimit()) {
+            // the tail of each shard is its least recently used entry, evict the oldest tail.
+            size_t victim = SHARD_COUNT;
+            uint64_t oldestTick = std::numeric_limits<uint64_t>::max();
+            for (size_t i = 0; i < SHARD_COUNT; ++i) {
+                auto tick = shards_[i].tailTick.load(std::memory_order_relaxed);
+                if (tick < oldestTick) {
+                    oldestTick = tick;
+                    victim = i;
+                }
+            }
+            if (victim == SHARD_COUNT) {
+                return;
+            }
+            auto& shard = shards_[victim];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            // another thread may have trimmed or refreshed entries meanwhile.
+            if (!shard.entries.empty() && OverLimit()) {
+                RemoveEntry(shard, std::prev(shard.entries.end()));
+                ++shard.evictions;
+            }
+        }
+    }
+
+    static_assert((SHARD_COUNT & (SHARD_COUNT - 1)) == 0 && SHARD_COUNT == 16, "the shard shift assumes 16 shards");
+
+    std::array<Shard, SHARD_COUNT> shards_;
+    std::atomic<size_t> countLimit_;
+    std::atomic<size_t> sizeLimit_;
+    std::atomic<size_t> count_ = 0;
+    std::atomic<size_t> bytes_ = 0;
+    std::atomic<uint64_t> clock_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ShardedLRUCache);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_LRU_SHARDED_LRU_CACHE_H
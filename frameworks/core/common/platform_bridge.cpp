@@ -51,8 +51,8 @@ void PlatformBridge::HandleCallback(int32_t callbackId, std::vector<uint8_t>&& m
     std::string resultString;
     CodecData codecResult;
     StandardFunctionCodec codec;
-    if (codec.DecodePlatformMessage(messageData, codecResult)) {
-        resultString = codecResult.GetStringValue();
+    if (codec.DecodePlatformMessage(messageData.data(), messageData.size(), codecResult, true)) {
+        resultString = codecResult.GetStringView();
         if (resultString.empty()) {
             LOGE("reply message is empty!");
             return;
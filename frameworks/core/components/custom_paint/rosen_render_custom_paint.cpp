@@ -3039,7 +3039,8 @@ sk_sp<SkImage> RosenRenderCustomPaint::GetImage(const std::string& src)
     auto image = ImageProvider::GetSkImage(src, context);
     if (image) {
         auto rasterizedImage = image->makeRasterImage();
-        imageCache_->CacheImage(src, std::make_shared<CachedImage>(rasterizedImage));
+        auto cachedImage = std::make_shared<CachedImage>(rasterizedImage);
+        imageCache_->CacheImage(src, cachedImage, cachedImage->GetMemorySize());
         return rasterizedImage;
     }
 
@@ -3070,7 +3071,8 @@ std::shared_ptr<RSImage> RosenRenderCustomPaint::GetImage(const std::string& src
         if (image->ReadPixels(rsBitmap, 0, 0)) {
             auto rasterizedImage = std::make_shared<RSImage>();
             rasterizedImage->BuildFromBitmap(rsBitmap);
-            imageCache_->CacheImage(src, std::make_shared<CachedImage>(rasterizedImage));
+            auto cachedImage = std::make_shared<CachedImage>(rasterizedImage);
+            imageCache_->CacheImage(src, cachedImage, cachedImage->GetMemorySize());
             return rasterizedImage;
         }
     }
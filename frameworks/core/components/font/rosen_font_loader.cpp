@@ -16,6 +16,7 @@
 #include "core/components/font/rosen_font_loader.h"
 
 #include "base/network/download_manager.h"
+#include "core/common/font_manager.h"
 #include "core/common/resource/resource_manager.h"
 #include "core/common/resource/resource_object.h"
 #include "core/common/resource/resource_wrapper.h"
@@ -307,6 +308,8 @@ void RosenFontLoader::PostLoadFontTask(const std::vector<uint8_t>& fontData, con
 
 void RosenFontLoader::NotifyCallbacks()
 {
+    // texts shaped with a fallback font before the font was loaded are shaped again.
+    FontManager::MarkFontChanged();
     for (const auto& [node, callback] : callbacksNG_) {
         if (callback) {
             callback();
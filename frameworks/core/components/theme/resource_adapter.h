@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_RESOURCE_ADAPTER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_RESOURCE_ADAPTER_H
 
+#include <atomic>
+
 #include "base/image/pixel_map.h"
 #include "base/utils/resource_configuration.h"
 #include "core/components/theme/theme_style.h"
@@ -225,6 +227,40 @@ public:
         const std::string& bundleName, const std::string& moduleName);
 
     virtual void UpdateColorMode(ColorMode colorMode) {}
+
+    /*
+     * Get the count of the configuration updates, for the callers caching the values resolved against it.
+     * Switching the color mode by UpdateColorMode does not count, the callers keep the values of each color mode.
+     * @return the count, which changes whenever the values of a color mode may have changed.
+     */
+    uint32_t GetConfigVersion() const
+    {
+        return configVersion_.load(std::memory_order_acquire);
+    }
+
+    /*
+     * Get the color mode the values are resolved in.
+     * @return the color mode of the configuration in use.
+     */
+    ColorMode GetResolvedColorMode() const
+    {
+        return resolvedColorMode_.load(std::memory_order_acquire);
+    }
+
+protected:
+    void IncreaseConfigVersion()
+    {
+        configVersion_.fetch_add(1, std::memory_order_acq_rel);
+    }
+
+    void SetResolvedColorMode(ColorMode colorMode)
+    {
+        resolvedColorMode_.store(colorMode, std::memory_order_release);
+    }
+
+private:
+    std::atomic<uint32_t> configVersion_ { 0 };
+    std::atomic<ColorMode> resolvedColorMode_ { ColorMode::COLOR_MODE_UNDEFINED };
 };
 
 } // namespace OHOS::Ace
@@ -91,6 +91,60 @@ const ResValueWrapper* ThemeConstants::GetPlatformConstants(uint32_t key)
     return nullptr;
 }
 
+void ThemeConstants::UpdateThemeConstants(const std::string& bundleName, const std::string& moduleName)
+{
+    if (resAdapter_) {
+        resAdapter_->UpdateResourceManager(bundleName, moduleName);
+    }
+    if (bundleName == bundleName_ && moduleName == moduleName_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(resolvedValuesMutex_);
+    bundleName_ = bundleName;
+    moduleName_ = moduleName;
+    // the resources of the application are used unless both of the bundle and the module are given.
+    resourceModule_ = (bundleName.empty() || moduleName.empty()) ? "" : bundleName + "/" + moduleName;
+}
+
+void ThemeConstants::ClearResolvedValues()
+{
+    std::lock_guard<std::mutex> lock(resolvedValuesMutex_);
+    resolvedValues_.clear();
+}
+
+ThemeConstants::ModuleResolvedValues& ThemeConstants::GetModuleResolvedValues(uint32_t configVersion) const
+{
+    if (configVersion != resolvedVersion_) {
+        resolvedValues_.clear();
+        resolvedVersion_ = configVersion;
+    }
+    return resolvedValues_[resourceModule_];
+}
+
+template<class T, class Resolve>
+T ThemeConstants::GetResolvedValue(
+    ResolvedValueMap<T> ResolvedValues::*valueMap, const std::string& resName, const Resolve& resolve) const
+{
+    auto configVersion = resAdapter_->GetConfigVersion();
+    auto colorMode = resAdapter_->GetResolvedColorMode();
+    {
+        std::lock_guard<std::mutex> lock(resolvedValuesMutex_);
+        const auto& values = GetModuleResolvedValues(configVersion).values[colorMode].*valueMap;
+        auto iter = values.find(resName);
+        if (iter != values.end()) {
+            return iter->second;
+        }
+    }
+    // the adapter takes locks of its own, the value is resolved out of the lock.
+    T value = resolve();
+    std::lock_guard<std::mutex> lock(resolvedValuesMutex_);
+    // a value resolved against a configuration or a color mode switched meanwhile is not kept.
+    if (configVersion == resAdapter_->GetConfigVersion() && colorMode == resAdapter_->GetResolvedColorMode()) {
+        (GetModuleResolvedValues(configVersion).values[colorMode].*valueMap).emplace(resName, value);
+    }
+    return value;
+}
+
 Color ThemeConstants::GetColor(uint32_t key) const
 {
     if (IsGlobalResource(key)) {
@@ -115,7 +169,8 @@ Color ThemeConstants::GetColorByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_COLOR;
     }
-    return resAdapter_->GetColorByName(resName);
+    return GetResolvedValue(&ResolvedValues::colors, resName,
+        [this, &resName]() { return resAdapter_->GetColorByName(resName); });
 }
 
 Dimension ThemeConstants::GetDimension(uint32_t key) const
@@ -147,11 +202,13 @@ Dimension ThemeConstants::GetDimensionByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_DIMENSION;
     }
-    auto result = resAdapter_->GetDimensionByName(resName);
-    if (NearZero(result.Value())) {
-        result = StringUtils::StringToDimension(resAdapter_->GetStringByName(resName));
-    }
-    return result;
+    return GetResolvedValue(&ResolvedValues::dimensions, resName, [this, &resName]() {
+        auto result = resAdapter_->GetDimensionByName(resName);
+        if (NearZero(result.Value())) {
+            result = StringUtils::StringToDimension(resAdapter_->GetStringByName(resName));
+        }
+        return result;
+    });
 }
 
 int32_t ThemeConstants::GetInt(uint32_t key) const
@@ -178,7 +235,8 @@ int32_t ThemeConstants::GetIntByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_INT;
     }
-    return resAdapter_->GetIntByName(resName);
+    return GetResolvedValue(
+        &ResolvedValues::ints, resName, [this, &resName]() { return resAdapter_->GetIntByName(resName); });
 }
 
 double ThemeConstants::GetDouble(uint32_t key) const
@@ -205,7 +263,8 @@ double ThemeConstants::GetDoubleByName(const std::string& resName) const
     if (!resAdapter_) {
         return ERROR_VALUE_DOUBLE;
     }
-    return resAdapter_->GetDoubleByName(resName);
+    return GetResolvedValue(
+        &ResolvedValues::doubles, resName, [this, &resName]() { return resAdapter_->GetDoubleByName(resName); });
 }
 
 std::string ThemeConstants::GetString(uint32_t key) const
@@ -232,7 +291,8 @@ std::string ThemeConstants::GetStringByName(const std::string& resName) const
     if (!resAdapter_) {
         return "";
     }
-    return resAdapter_->GetStringByName(resName);
+    return GetResolvedValue(
+        &ResolvedValues::strings, resName, [this, &resName]() { return resAdapter_->GetStringByName(resName); });
 }
 
 std::string ThemeConstants::GetPluralString(uint32_t key, int count) const
@@ -298,7 +358,8 @@ std::string ThemeConstants::GetMediaPathByName(const std::string& resName) const
     if (!resAdapter_) {
         return "";
     }
-    return resAdapter_->GetMediaPathByName(resName);
+    return GetResolvedValue(&ResolvedValues::mediaPaths, resName,
+        [this, &resName]() { return resAdapter_->GetMediaPathByName(resName); });
 }
 
 std::string ThemeConstants::GetRawfile(const std::string& fileName) const
@@ -341,15 +402,17 @@ bool ThemeConstants::GetBooleanByName(const std::string& resName) const
     if (!resAdapter_) {
         return false;
     }
-    return resAdapter_->GetBooleanByName(resName);
+    return GetResolvedValue(
+        &ResolvedValues::booleans, resName, [this, &resName]() { return resAdapter_->GetBooleanByName(resName); });
 }
 
 uint32_t ThemeConstants::GetSymbolByName(const char* name) const
 {
-    if (!resAdapter_) {
+    if (!resAdapter_ || !name) {
         return ERROR_VALUE_UINT;
     }
-    return resAdapter_->GetSymbolByName(name);
+    return GetResolvedValue(
+        &ResolvedValues::symbols, name, [this, name]() { return resAdapter_->GetSymbolByName(name); });
 }
 
 std::vector<uint32_t> ThemeConstants::GetIntArray(uint32_t key) const
@@ -376,7 +439,27 @@ bool ThemeConstants::GetResourceIdByName(const std::string& resName, const std::
     if (!resAdapter_) {
         return false;
     }
-    return resAdapter_->GetIdByName(resName, resType, resId);
+    auto configVersion = resAdapter_->GetConfigVersion();
+    {
+        std::lock_guard<std::mutex> lock(resolvedValuesMutex_);
+        const auto& resourceIds = GetModuleResolvedValues(configVersion).resourceIds;
+        auto typeIter = resourceIds.find(resType);
+        if (typeIter != resourceIds.end()) {
+            auto idIter = typeIter->second.find(resName);
+            if (idIter != typeIter->second.end()) {
+                resId = idIter->second;
+                return true;
+            }
+        }
+    }
+    if (!resAdapter_->GetIdByName(resName, resType, resId)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(resolvedValuesMutex_);
+    if (configVersion == resAdapter_->GetConfigVersion()) {
+        GetModuleResolvedValues(configVersion).resourceIds[resType].emplace(resName, resId);
+    }
+    return true;
 }
 
 InternalResource::ResourceId ThemeConstants::GetResourceId(uint32_t key) const
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_CONSTANTS_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_THEME_THEME_CONSTANTS_H
 
+#include <mutex>
 #include <unordered_map>
 
 #include "base/geometry/dimension.h"
@@ -50,6 +51,7 @@ public:
         if (resAdapter_) {
             resAdapter_->Init(resourceInfo);
         }
+        ClearResolvedValues();
     }
 
     void UpdateConfig(const ResourceConfiguration& config)
@@ -57,8 +59,15 @@ public:
         if (resAdapter_) {
             resAdapter_->UpdateConfig(config);
         }
+        ClearResolvedValues();
     }
 
+    /*
+     * Drop the values resolved by name, which are kept until the configuration of the resource adapter changes.
+     * Called when the resources may have changed without it, as in a reload of the pipeline.
+     */
+    void ClearResolvedValues();
+
     void ParseTheme();
 
     /*
@@ -331,12 +340,7 @@ public:
         return customStyleMap_.find(key) != customStyleMap_.end();
     }
 
-    void UpdateThemeConstants(const std::string& bundleName, const std::string& moduleName)
-    {
-        if (resAdapter_) {
-            resAdapter_->UpdateResourceManager(bundleName, moduleName);
-        }
-    }
+    void UpdateThemeConstants(const std::string& bundleName, const std::string& moduleName);
 
     uint32_t GetResourceLimitKeys() const
     {
@@ -362,6 +366,29 @@ public:
     }
 
 private:
+    template<class T>
+    using ResolvedValueMap = std::unordered_map<std::string, T>;
+
+    // The values resolved by name in a color mode.
+    struct ResolvedValues {
+        ResolvedValueMap<Color> colors;
+        ResolvedValueMap<Dimension> dimensions;
+        ResolvedValueMap<int32_t> ints;
+        ResolvedValueMap<double> doubles;
+        ResolvedValueMap<std::string> strings;
+        ResolvedValueMap<bool> booleans;
+        ResolvedValueMap<uint32_t> symbols;
+        ResolvedValueMap<std::string> mediaPaths;
+    };
+
+    // The values resolved by name from the resources of a module, against the configuration of resolvedVersion_.
+    struct ModuleResolvedValues {
+        // the ids of the names, by the type of the resources. The color mode does not change them.
+        std::unordered_map<std::string, ResolvedValueMap<uint32_t>> resourceIds;
+        // the values, by the color mode the adapter resolved them in.
+        std::unordered_map<ColorMode, ResolvedValues> values;
+    };
+
     static const ResValueWrapper* GetPlatformConstants(uint32_t key);
     static const ResValueWrapper* styleMapDefault[];
     static uint32_t DefaultMapCount;
@@ -377,11 +404,25 @@ private:
     double GetBlendAlpha(const BlendAlpha& blendAlpha) const;
     void ParseCustomStyle(const std::string& content);
     void LoadFile(const RefPtr<Asset>& asset);
+    ModuleResolvedValues& GetModuleResolvedValues(uint32_t configVersion) const;
+    template<class T, class Resolve>
+    T GetResolvedValue(
+        ResolvedValueMap<T> ResolvedValues::*valueMap, const std::string& resName, const Resolve& resolve) const;
 
     RefPtr<ResourceAdapter> resAdapter_;
     RefPtr<ThemeStyle> currentThemeStyle_;
     ThemeConstantsMap customStyleMap_;
 
+    // Guards the values resolved by name, which the const getters fill in.
+    mutable std::mutex resolvedValuesMutex_;
+    // the values resolved by name, by the module whose resources resolved them.
+    mutable std::unordered_map<std::string, ModuleResolvedValues> resolvedValues_;
+    mutable uint32_t resolvedVersion_ = 0;
+    // the bundle and the module of the resources in use, empty for the resources of the application.
+    std::string bundleName_;
+    std::string moduleName_;
+    std::string resourceModule_;
+
     ACE_DISALLOW_COPY_AND_MOVE(ThemeConstants);
 };
 
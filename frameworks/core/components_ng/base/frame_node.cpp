@@ -15,7 +15,10 @@
 
 #include "core/components_ng/base/frame_node.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
+#include <limits>
 
 #include "base/geometry/dimension.h"
 #include "base/geometry/ng/offset_t.h"
@@ -39,6 +42,7 @@
 #include "core/components/common/layout/grid_system_manager.h"
 #include "core/components_ng/base/extension_handler.h"
 #include "core/components_ng/base/frame_scene_status.h"
+#include "core/components_ng/base/hit_test_index.h"
 #include "core/components_ng/base/inspector.h"
 #include "core/components_ng/base/inspector_filter.h"
 #include "core/components_ng/base/ui_node.h"
@@ -60,6 +64,7 @@
 #include "core/components_v2/inspector/inspector_constants.h"
 #include "core/event/touch_event.h"
 #include "core/gestures/gesture_info.h"
+#include "core/pipeline_ng/dirty_node_queue.h"
 #include "core/pipeline_ng/pipeline_context.h"
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
@@ -97,6 +102,69 @@ constexpr float HIGHT_RATIO_LIMIT = 0.8;
 constexpr int32_t MIN_OPINC_AREA = 10000;
 } // namespace
 namespace OHOS::Ace::NG {
+namespace {
+// containers with fewer frame children test all of them, the hit test index does not pay off.
+constexpr size_t HIT_TEST_INDEX_MIN_CHILDREN = 64;
+// levels of unclipped descendants below a frame child held by its touch test bounds, deeper ones make the child
+// always tested. It bounds both the cost of the bounds and the ancestors a moved node marks dirty.
+constexpr int32_t HIT_TEST_BOUNDS_MAX_DEPTH = 8;
+// touch test bounds are grown by it to absorb the rounding of mapping them back and forth.
+constexpr float TOUCH_TEST_BOUNDS_PADDING = 1.0f;
+
+// Maps rect by the inverse of the 2d part of matrix, which is what MapPointTo applies. Returns std::nullopt when the
+// matrix can not be inverted, the points mapped into rect are unbounded then.
+std::optional<RectF> MapRectByInverse(const RectF& rect, const Matrix4& matrix)
+{
+    double scaleX = matrix.Get(0, 0);
+    double skewX = matrix.Get(0, 1);
+    double skewY = matrix.Get(1, 0);
+    double scaleY = matrix.Get(1, 1);
+    double determinant = scaleX * scaleY - skewX * skewY;
+    if (NearZero(determinant) || !std::isfinite(determinant)) {
+        return std::nullopt;
+    }
+    double translateX = matrix.Get(0, 3);
+    double translateY = matrix.Get(1, 3);
+    double left = std::numeric_limits<double>::max();
+    double top = std::numeric_limits<double>::max();
+    double right = std::numeric_limits<double>::lowest();
+    double bottom = std::numeric_limits<double>::lowest();
+    for (auto x : { rect.Left(), rect.Right() }) {
+        for (auto y : { rect.Top(), rect.Bottom() }) {
+            double dx = x - translateX;
+            double dy = y - translateY;
+            double mappedX = (scaleY * dx - skewX * dy) / determinant;
+            double mappedY = (scaleX * dy - skewY * dx) / determinant;
+            left = std::min(left, mappedX);
+            top = std::min(top, mappedY);
+            right = std::max(right, mappedX);
+            bottom = std::max(bottom, mappedY);
+        }
+    }
+    return RectF(static_cast<float>(left - TOUCH_TEST_BOUNDS_PADDING),
+        static_cast<float>(top - TOUCH_TEST_BOUNDS_PADDING),
+        static_cast<float>(right - left + 2 * TOUCH_TEST_BOUNDS_PADDING),
+        static_cast<float>(bottom - top + 2 * TOUCH_TEST_BOUNDS_PADDING));
+}
+
+bool CheckSubTreeMeasureOnBackground(const RefPtr<UINode>& node)
+{
+    CHECK_NULL_RETURN(node, true);
+    auto frameNode = AceType::DynamicCast<FrameNode>(node);
+    if (frameNode) {
+        return frameNode->CanMeasureOnBackground();
+    }
+    // lazy children are created by js during measure, which is bound to the UI thread.
+    if (node->GetTag() == V2::JS_LAZY_FOR_EACH_ETS_TAG || node->GetTag() == V2::JS_REPEAT_ETS_TAG) {
+        return false;
+    }
+    bool result = true;
+    for (const auto& child : node->GetChildren()) {
+        result = CheckSubTreeMeasureOnBackground(child) && result;
+    }
+    return result;
+}
+} // namespace
 
 const std::set<std::string> FrameNode::layoutTags_ = { "Flex", "Stack", "Row", "Column", "WindowScene", "root",
     "__Common__", "Swiper", "Grid", "GridItem", "page", "stage", "FormComponent", "Tabs", "TabContent" };
@@ -454,6 +522,7 @@ FrameNode::FrameNode(
     const std::string& tag, int32_t nodeId, const RefPtr<Pattern>& pattern, bool isRoot, bool isLayoutNode)
     : UINode(tag, nodeId, isRoot), LayoutWrapper(WeakClaim(this)), pattern_(pattern)
 {
+    static_assert(DIRTY_QUEUE_OWNER_COUNT == DIRTY_QUEUE_TYPE_COUNT, "one dirty queue owner per dirty queue type");
     isLayoutNode_ = isLayoutNode;
     frameProxy_ = std::make_unique<FrameProxy>(this);
     renderContext_->InitContext(IsRootNode(), pattern_->GetContextParam(), isLayoutNode);
@@ -1626,31 +1695,91 @@ void FrameNode::SetGeometryNode(const RefPtr<GeometryNode>& node)
 
 void FrameNode::CreateLayoutTask(bool forceUseMainThread)
 {
-    if (!isLayoutDirtyMarked_) {
+    if (!PrepareLayoutTask()) {
         return;
     }
+    MeasureLayoutTask();
+    FinishLayoutTask();
+}
+
+bool FrameNode::PrepareLayoutTask()
+{
+    if (!isLayoutDirtyMarked_) {
+        return false;
+    }
     SetRootMeasureNode(true);
     UpdateLayoutPropertyFlag();
     SetSkipSyncGeometryNode(false);
     if (layoutProperty_->GetLayoutRect()) {
         SetActive(true);
+    }
+    return true;
+}
+
+void FrameNode::MeasureLayoutTask()
+{
+    if (layoutProperty_->GetLayoutRect()) {
         Measure(std::nullopt);
+        return;
+    }
+    ACE_SCOPED_TRACE("CreateTaskMeasure[%s][self:%d][parent:%d]", GetTag().c_str(), GetId(),
+        GetAncestorNodeOfFrame() ? GetAncestorNodeOfFrame()->GetId() : 0);
+    Measure(GetLayoutConstraint());
+}
+
+void FrameNode::FinishLayoutTask()
+{
+    if (layoutProperty_->GetLayoutRect()) {
         Layout();
     } else {
-        {
-            ACE_SCOPED_TRACE("CreateTaskMeasure[%s][self:%d][parent:%d]", GetTag().c_str(), GetId(),
-                GetAncestorNodeOfFrame() ? GetAncestorNodeOfFrame()->GetId() : 0);
-            Measure(GetLayoutConstraint());
-        }
-        {
-            ACE_SCOPED_TRACE("CreateTaskLayout[%s][self:%d][parent:%d]", GetTag().c_str(), GetId(),
-                GetAncestorNodeOfFrame() ? GetAncestorNodeOfFrame()->GetId() : 0);
-            Layout();
-        }
+        ACE_SCOPED_TRACE("CreateTaskLayout[%s][self:%d][parent:%d]", GetTag().c_str(), GetId(),
+            GetAncestorNodeOfFrame() ? GetAncestorNodeOfFrame()->GetId() : 0);
+        Layout();
     }
     SetRootMeasureNode(false);
 }
 
+bool FrameNode::CanMeasureOnBackground()
+{
+    auto state = measureThreadState_.load(std::memory_order_relaxed);
+    if (state != MeasureThreadState::UNKNOWN) {
+        return state == MeasureThreadState::BACKGROUND;
+    }
+    bool result = true;
+    // nodes with extension, overlay or geometry transition interact with other subtrees while measuring.
+    if (extensionHandler_ || overlayNode_ || layoutProperty_->GetGeometryTransition()) {
+        result = false;
+    } else {
+        const auto& layoutAlgorithm = GetLayoutAlgorithm();
+        result = layoutAlgorithm && (layoutAlgorithm->CanRunOnWhichThread() & MAIN_TASK) != MAIN_TASK;
+    }
+    // visit every child, so that a cached node only has cached descendants, see ResetMeasureOnBackground.
+    for (const auto& child : GetChildren()) {
+        result = CheckSubTreeMeasureOnBackground(child) && result;
+    }
+    measureThreadState_.store(
+        result ? MeasureThreadState::BACKGROUND : MeasureThreadState::MAIN, std::memory_order_relaxed);
+    return result;
+}
+
+void FrameNode::ResetMeasureOnBackground()
+{
+    if (measureThreadState_.exchange(MeasureThreadState::UNKNOWN, std::memory_order_relaxed) ==
+        MeasureThreadState::UNKNOWN) {
+        return;
+    }
+    // an unknown node has no cached ancestor, so the walk stops at the first one.
+    auto parent = GetParent();
+    while (parent) {
+        auto frameNode = AceType::DynamicCast<FrameNode>(parent);
+        if (frameNode && frameNode->measureThreadState_.exchange(MeasureThreadState::UNKNOWN,
+                             std::memory_order_relaxed) == MeasureThreadState::UNKNOWN) {
+            return;
+        }
+        parent = parent->GetParent();
+    }
+}
+
 std::optional<UITask> FrameNode::CreateRenderTask(bool forceUseMainThread)
 {
     if (!isRenderDirtyMarked_) {
@@ -1671,10 +1800,14 @@ std::optional<UITask> FrameNode::CreateRenderTask(bool forceUseMainThread)
             pipeline->SetNeedRenderNode(self);
         }
     };
-    if (forceUseMainThread || wrapper->CheckShouldRunOnMain()) {
+    if (forceUseMainThread) {
         return UITask(std::move(task), MAIN_TASK);
     }
-    return UITask(std::move(task), wrapper->CanRunOnWhichThread());
+    UITask renderTask(std::move(task), wrapper->CanRunOnWhichThread());
+    if ((renderTask.GetTaskThreadType() & BACKGROUND_TASK) == BACKGROUND_TASK) {
+        renderTask.SetBackgroundTask([wrapper]() { wrapper->FlushBackground(); });
+    }
+    return renderTask;
 }
 
 LayoutConstraintF FrameNode::GetLayoutConstraint() const
@@ -1879,6 +2012,9 @@ void FrameNode::RebuildRenderContextTree()
     for (const auto& child : children) {
         frameChildren_.emplace(child);
     }
+    // the touch test bounds of the ancestors hold the frame children.
+    hitTestIndexDirty_ = true;
+    NotifyGeometryChanged();
     renderContext_->RebuildFrame(this, children);
     pattern_->OnRebuildFrame();
     needSyncRenderTree_ = false;
@@ -2056,6 +2192,7 @@ void FrameNode::MarkDirtyNode(bool isMeasureBoundary, bool isRenderBoundary, Pro
     CHECK_NULL_VOID(context);
 
     if (CheckNeedRequestMeasureAndLayout(layoutFlag)) {
+        ResetMeasureOnBackground();
         if ((!isMeasureBoundary && IsNeedRequestParentMeasure())) {
             if (RequestParentDirty()) {
                 return;
@@ -2215,11 +2352,19 @@ bool FrameNode::IsOutOfTouchTestRegion(const PointF& parentRevertPoint, int32_t
         if (clip) {
             return true;
         }
-        for (auto iter = frameChildren_.rbegin(); iter != frameChildren_.rend(); ++iter) {
-            const auto& child = iter->Upgrade();
-            if (child && !child->IsOutOfTouchTestRegion(subRevertPoint, sourceType)) {
-                isInChildRegion = true;
-                break;
+        std::vector<WeakPtr<FrameNode>> candidates;
+        if (GetTouchTestCandidates(subRevertPoint, candidates)) {
+            isInChildRegion = std::any_of(candidates.begin(), candidates.end(), [&](const WeakPtr<FrameNode>& weak) {
+                auto child = weak.Upgrade();
+                return child && !child->IsOutOfTouchTestRegion(subRevertPoint, sourceType);
+            });
+        } else {
+            for (auto iter = frameChildren_.rbegin(); iter != frameChildren_.rend(); ++iter) {
+                const auto& child = iter->Upgrade();
+                if (child && !child->IsOutOfTouchTestRegion(subRevertPoint, sourceType)) {
+                    isInChildRegion = true;
+                    break;
+                }
             }
         }
         if (!isInChildRegion) {
@@ -2362,19 +2507,20 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
         }
     }
 
-    for (auto iter = frameChildren_.rbegin(); iter != frameChildren_.rend(); ++iter) {
+    // returns true when the child blocks the children after it.
+    auto touchTestChild = [&](const WeakPtr<FrameNode>& weak) {
         if (GetHitTestMode() == HitTestMode::HTMBLOCK) {
-            break;
+            return true;
         }
         if (onTouchInterceptresult != HitTestMode::HTMBLOCK) {
             if (touchRes.strategy == TouchTestStrategy::FORWARD) {
-                break;
+                return true;
             }
         }
 
-        const auto& child = iter->Upgrade();
+        auto child = weak.Upgrade();
         if (!child) {
-            continue;
+            return false;
         }
         if (onTouchInterceptresult != HitTestMode::HTMBLOCK) {
             std::string id;
@@ -2382,7 +2528,7 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
                 id = child->GetInspectorId().value();
             }
             if (touchRes.strategy == TouchTestStrategy::FORWARD_COMPETITION && touchRes.id == id) {
-                continue;
+                return false;
             }
         }
 
@@ -2395,7 +2541,7 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
                 (child->GetHitTestMode() == HitTestMode::HTMDEFAULT) ||
                 (child->GetHitTestMode() == HitTestMode::HTMTRANSPARENT_SELF) ||
                 ((child->GetHitTestMode() != HitTestMode::HTMTRANSPARENT) && IsExclusiveEventForChild())) {
-                break;
+                return true;
             }
         }
 
@@ -2405,7 +2551,23 @@ HitTestResult FrameNode::TouchTest(const PointF& globalPoint, const PointF& pare
                 (child->GetHitTestMode() == HitTestMode::HTMTRANSPARENT_SELF) ||
                 ((child->GetHitTestMode() != HitTestMode::HTMTRANSPARENT) && IsExclusiveEventForChild()))) {
             consumed = true;
-            break;
+            return true;
+        }
+        return false;
+    };
+    // the children out of the index bounds of the point would return OUT_OF_REGION, only the others are tested.
+    std::vector<WeakPtr<FrameNode>> candidates;
+    if (GetTouchTestCandidates(subRevertPoint, candidates)) {
+        for (const auto& candidate : candidates) {
+            if (touchTestChild(candidate)) {
+                break;
+            }
+        }
+    } else {
+        for (auto iter = frameChildren_.rbegin(); iter != frameChildren_.rend(); ++iter) {
+            if (touchTestChild(*iter)) {
+                break;
+            }
         }
     }
 
@@ -2514,6 +2676,87 @@ std::vector<RectF> FrameNode::GetResponseRegionList(const RectF& rect, int32_t s
     return responseRegionList;
 }
 
+std::optional<RectF> FrameNode::GetTouchTestBounds(int32_t depth)
+{
+    auto paintRect = renderContext_->GetPaintRectWithoutTransform();
+    // one index serves touch and mouse, take the regions of both.
+    auto regions = GetResponseRegionList(paintRect, static_cast<int32_t>(SourceType::TOUCH));
+    auto mouseRegions = GetResponseRegionList(paintRect, static_cast<int32_t>(SourceType::MOUSE));
+    regions.insert(regions.end(), mouseRegions.begin(), mouseRegions.end());
+    std::optional<RectF> bounds;
+    for (const auto& region : regions) {
+        bounds = bounds ? bounds->CombineRectT(region) : region;
+    }
+    // unclipped children are hit out of the node as well, see IsOutOfTouchTestRegion.
+    if (!renderContext_->GetClipEdge().value_or(false) && !frameChildren_.empty()) {
+        if (depth >= HIT_TEST_BOUNDS_MAX_DEPTH) {
+            return std::nullopt;
+        }
+        for (const auto& weak : frameChildren_) {
+            auto child = weak.Upgrade();
+            if (!child) {
+                continue;
+            }
+            auto childBounds = child->GetTouchTestBounds(depth + 1);
+            if (!childBounds) {
+                return std::nullopt;
+            }
+            auto region = childBounds.value() + paintRect.GetOffset();
+            bounds = bounds ? bounds->CombineRectT(region) : region;
+        }
+    }
+    if (!bounds) {
+        return RectF();
+    }
+    return MapRectByInverse(bounds.value(), GetOrRefreshRevertMatrixFromCache());
+}
+
+bool FrameNode::GetTouchTestCandidates(const PointF& subRevertPoint, std::vector<WeakPtr<FrameNode>>& candidates)
+{
+    if (frameChildren_.size() < HIT_TEST_INDEX_MIN_CHILDREN) {
+        hitTestIndex_.reset();
+        hitTestChildren_.clear();
+        return false;
+    }
+    if (!hitTestIndex_ || hitTestIndexDirty_) {
+        ACE_SCOPED_TRACE("BuildHitTestIndex %zu", frameChildren_.size());
+        hitTestChildren_.assign(frameChildren_.rbegin(), frameChildren_.rend());
+        std::vector<std::optional<RectF>> bounds;
+        bounds.reserve(hitTestChildren_.size());
+        for (const auto& weak : hitTestChildren_) {
+            auto child = weak.Upgrade();
+            bounds.emplace_back(child ? child->GetTouchTestBounds(0) : std::nullopt);
+        }
+        if (!hitTestIndex_) {
+            hitTestIndex_ = std::make_unique<HitTestIndex>();
+        }
+        hitTestIndex_->Build(bounds);
+        hitTestIndexDirty_ = false;
+    }
+    std::vector<int32_t> items;
+    hitTestIndex_->Query(subRevertPoint, items);
+    candidates.clear();
+    candidates.reserve(items.size());
+    for (auto item : items) {
+        candidates.emplace_back(hitTestChildren_[item]);
+    }
+    return true;
+}
+
+void FrameNode::NotifyGeometryChanged()
+{
+    // the node is in the touch test bounds of its parent, and of further ancestors as long as none of them clips,
+    // up to the depth the bounds follow. Indexes of other containers are kept.
+    auto parent = GetAncestorNodeOfFrame();
+    for (int32_t depth = 0; parent && depth <= HIT_TEST_BOUNDS_MAX_DEPTH; ++depth) {
+        parent->hitTestIndexDirty_ = true;
+        if (parent->renderContext_->GetClipEdge().value_or(false)) {
+            break;
+        }
+        parent = parent->GetAncestorNodeOfFrame();
+    }
+}
+
 std::vector<RectF> FrameNode::GetResponseRegionListForRecognizer(int32_t sourceType)
 {
     auto paintRect = renderContext_->GetPaintRectWithoutTransform();
@@ -3827,6 +4070,7 @@ void FrameNode::MarkNeedSyncRenderTree(bool needRebuild)
 {
     if (needRebuild) {
         frameProxy_->ResetChildren(true);
+        ResetMeasureOnBackground();
     }
     needSyncRenderTree_ = true;
 }
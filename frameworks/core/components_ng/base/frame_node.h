@@ -16,6 +16,8 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_FRAME_NODE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_FRAME_NODE_H
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <list>
 #include <utility>
@@ -59,12 +61,14 @@ class AccessibilityEventInfo;
 } // namespace OHOS::Accessibility
 
 namespace OHOS::Ace::NG {
+class HitTestIndex;
 class InspectorFilter;
 class PipelineContext;
 class Pattern;
 class StateModifyTask;
 class UITask;
 struct DirtySwapConfig;
+enum DirtyQueueType : uint8_t;
 
 // FrameNode will display rendering region in the screen.
 class ACE_FORCE_EXPORT FrameNode : public UINode, public LayoutWrapper {
@@ -201,6 +205,16 @@ public:
 
     void CreateLayoutTask(bool forceUseMainThread = false);
 
+    // The phases of CreateLayoutTask, used by parallel layout. PrepareLayoutTask and FinishLayoutTask must run on the
+    // UI thread, MeasureLayoutTask may run on a background thread when CanMeasureOnBackground returns true.
+    bool PrepareLayoutTask();
+    void MeasureLayoutTask();
+    void FinishLayoutTask();
+    // The result is cached per subtree and dropped by ResetMeasureOnBackground when a measure property, the
+    // children, the overlay or the extension handler of the node or of a descendant changes.
+    bool CanMeasureOnBackground();
+    void ResetMeasureOnBackground();
+
     std::optional<UITask> CreateRenderTask(bool forceUseMainThread = false);
 
     void SwapDirtyLayoutWrapperOnMainThread(const RefPtr<LayoutWrapper>& dirty);
@@ -488,6 +502,10 @@ public:
     void RemoveLastHotZoneRect() const;
 
     virtual bool IsOutOfTouchTestRegion(const PointF& parentLocalPoint, int32_t sourceType);
+    // Bounds in the sub space of the parent out of which IsOutOfTouchTestRegion always returns true, for touch and
+    // mouse sources. std::nullopt when there are no such bounds, or when unclipped descendants are deeper than the
+    // bounds follow. depth is the number of levels below the frame child of the indexed container.
+    virtual std::optional<RectF> GetTouchTestBounds(int32_t depth);
     bool CheckRectIntersect(const RectF& dest, std::vector<RectF>& origin);
 
     bool IsLayoutDirtyMarked() const
@@ -500,6 +518,17 @@ public:
         isLayoutDirtyMarked_ = marked;
     }
 
+    // The dirty node queue holding the node, see DirtyNodeQueue.
+    const void* GetDirtyQueueOwner(DirtyQueueType queueType) const
+    {
+        return dirtyQueueOwners_[queueType];
+    }
+
+    void SetDirtyQueueOwner(DirtyQueueType queueType, const void* owner)
+    {
+        dirtyQueueOwners_[queueType] = owner;
+    }
+
     bool HasPositionProp() const
     {
         CHECK_NULL_RETURN(renderContext_, false);
@@ -608,6 +637,7 @@ public:
     void SetOverlayNode(const RefPtr<FrameNode>& overlayNode)
     {
         overlayNode_ = overlayNode;
+        ResetMeasureOnBackground();
     }
 
     RefPtr<FrameNode> GetOverlayNode() const
@@ -821,6 +851,7 @@ public:
     void SetExtensionHandler(const RefPtr<ExtensionHandler>& handler)
     {
         extensionHandler_ = handler;
+        ResetMeasureOnBackground();
         if (extensionHandler_) {
             extensionHandler_->AttachFrameNode(this);
         }
@@ -907,8 +938,13 @@ public:
     void NotifyTransformInfoChanged()
     {
         isLocalRevertMatrixAvailable_ = false;
+        NotifyGeometryChanged();
     }
 
+    // Notified when the paint rect, transform, clip or response region changed, marks the hit test indexes of the
+    // ancestors whose touch test bounds cover this node dirty.
+    void NotifyGeometryChanged();
+
     void AddPredictLayoutNode(const RefPtr<FrameNode>& node)
     {
         predictLayoutNode_.emplace_back(node);
@@ -970,6 +1006,10 @@ private:
     void UpdateChildrenLayoutWrapper(const RefPtr<LayoutWrapperNode>& self, bool forceMeasure, bool forceLayout);
     void AdjustLayoutWrapperTree(const RefPtr<LayoutWrapperNode>& parent, bool forceMeasure, bool forceLayout) override;
 
+    // Fills candidates with the frame children which may be hit at subRevertPoint, in the order of TouchTest.
+    // Returns false when the node keeps no hit test index and every frame child has to be tested.
+    bool GetTouchTestCandidates(const PointF& subRevertPoint, std::vector<WeakPtr<FrameNode>>& candidates);
+
     LayoutConstraintF GetLayoutConstraint() const;
     OffsetF GetParentGlobalOffset() const;
 
@@ -1086,7 +1126,12 @@ private:
 
     bool isPropertyDiffMarked_ = false;
     bool isLayoutDirtyMarked_ = false;
+    enum class MeasureThreadState : uint8_t { UNKNOWN = 0, MAIN, BACKGROUND };
+    std::atomic<MeasureThreadState> measureThreadState_ { MeasureThreadState::UNKNOWN };
     bool isRenderDirtyMarked_ = false;
+    // one slot per DirtyQueueType, checked against DIRTY_QUEUE_TYPE_COUNT in frame_node.cpp.
+    static constexpr size_t DIRTY_QUEUE_OWNER_COUNT = 2;
+    const void* dirtyQueueOwners_[DIRTY_QUEUE_OWNER_COUNT] = { nullptr };
     bool isMeasureBoundary_ = false;
     bool hasPendingRequest_ = false;
     bool isPrivacySensitive_ = false;
@@ -1126,6 +1171,11 @@ private:
     Matrix4 localRevertMatrix_ = Matrix4::CreateIdentity();
     // control the localMat_ and localRevertMatrix_ available or not, set to false when any transform info is set
     bool isLocalRevertMatrixAvailable_ = false;
+    // index of the frame children bounds for the hit test of large containers, rebuilt after a descendant moved.
+    std::unique_ptr<HitTestIndex> hitTestIndex_;
+    // frame children in the order of TouchTest, as indexed by hitTestIndex_.
+    std::vector<WeakPtr<FrameNode>> hitTestChildren_;
+    bool hitTestIndexDirty_ = true;
     bool isFind_ = false;
 
     bool isRestoreInfoUsed_ = false;
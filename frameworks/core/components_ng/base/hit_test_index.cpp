@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/base/hit_test_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t MAX_GRID_SIDE = 256;
+// items covering more cells than this part of the grid are kept out of the cells and checked at every query.
+constexpr int32_t WIDE_ITEM_CELLS_DIVISOR = 4;
+
+bool IsFiniteRect(const RectF& rect)
+{
+    return std::isfinite(rect.GetX()) && std::isfinite(rect.GetY()) && std::isfinite(rect.Width()) &&
+           std::isfinite(rect.Height()) && rect.Width() >= 0.0f && rect.Height() >= 0.0f;
+}
+
+// clamps before converting, a float out of the int32_t range is undefined to convert.
+int32_t ClampToInt(float value, int32_t min, int32_t max)
+{
+    if (!(value > static_cast<float>(min))) {
+        return min;
+    }
+    if (value >= static_cast<float>(max)) {
+        return max;
+    }
+    return static_cast<int32_t>(value);
+}
+} // namespace
+
+void HitTestIndex::Build(const std::vector<std::optional<RectF>>& bounds)
+{
+    Reset();
+    auto count = static_cast<int32_t>(bounds.size());
+    bounds_.resize(bounds.size(), std::nullopt);
+    std::vector<int32_t> boundedItems;
+    boundedItems.reserve(bounds.size());
+    for (int32_t i = 0; i < count; ++i) {
+        const auto& rect = bounds[i];
+        if (!rect || !IsFiniteRect(rect.value())) {
+            unboundedItems_.emplace_back(i);
+            continue;
+        }
+        bounds_[i] = rect.value();
+        gridRect_ = boundedItems.empty() ? rect.value() : gridRect_.CombineRectT(rect.value());
+        boundedItems.emplace_back(i);
+    }
+    if (boundedItems.empty()) {
+        return;
+    }
+
+    // about one cell per item, shaped after the grid so that long lists get thin cells.
+    auto itemCount = static_cast<float>(boundedItems.size());
+    auto width = std::max(gridRect_.Width(), 1.0f);
+    auto height = std::max(gridRect_.Height(), 1.0f);
+    columns_ = ClampToInt(std::round(std::sqrt(itemCount * width / height)), 1, MAX_GRID_SIDE);
+    rows_ = ClampToInt(std::ceil(itemCount / static_cast<float>(columns_)), 1, MAX_GRID_SIDE);
+    cellWidth_ = width / static_cast<float>(columns_);
+    cellHeight_ = height / static_cast<float>(rows_);
+
+    auto cellCount = columns_ * rows_;
+    auto wideItemCells = std::max(cellCount / WIDE_ITEM_CELLS_DIVISOR, 1);
+    std::vector<int32_t> wideItems;
+    cellStarts_.assign(cellCount + 1, 0);
+    // count the items of every cell, then fill the cells in item order so that every cell stays sorted.
+    auto forEachCell = [this](const RectF& rect, auto&& func) {
+        auto left = GetColumn(rect.Left());
+        auto right = GetColumn(rect.Right());
+        auto top = GetRow(rect.Top());
+        auto bottom = GetRow(rect.Bottom());
+        for (auto row = top; row <= bottom; ++row) {
+            for (auto column = left; column <= right; ++column) {
+                func(row * columns_ + column);
+            }
+        }
+    };
+    auto coveredCells = [this](const RectF& rect) {
+        auto columns = GetColumn(rect.Right()) - GetColumn(rect.Left()) + 1;
+        return columns * (GetRow(rect.Bottom()) - GetRow(rect.Top()) + 1);
+    };
+    for (auto item : boundedItems) {
+        if (coveredCells(bounds_[item].value()) > wideItemCells) {
+            wideItems.emplace_back(item);
+            continue;
+        }
+        forEachCell(bounds_[item].value(), [this](int32_t cell) { ++cellStarts_[cell + 1]; });
+    }
+    for (int32_t cell = 0; cell < cellCount; ++cell) {
+        cellStarts_[cell + 1] += cellStarts_[cell];
+    }
+    cellItems_.resize(cellStarts_[cellCount]);
+    std::vector<int32_t> cellEnds(cellStarts_.begin(), cellStarts_.end() - 1);
+    for (auto item : boundedItems) {
+        if (coveredCells(bounds_[item].value()) > wideItemCells) {
+            continue;
+        }
+        forEachCell(
+            bounds_[item].value(), [this, item, &cellEnds](int32_t cell) { cellItems_[cellEnds[cell]++] = item; });
+    }
+    if (!wideItems.empty()) {
+        std::vector<int32_t> alwaysItems;
+        alwaysItems.reserve(unboundedItems_.size() + wideItems.size());
+        std::merge(unboundedItems_.begin(), unboundedItems_.end(), wideItems.begin(), wideItems.end(),
+            std::back_inserter(alwaysItems));
+        unboundedItems_ = std::move(alwaysItems);
+    }
+}
+
+void HitTestIndex::Query(const PointF& point, std::vector<int32_t>& result) const
+{
+    result.clear();
+    auto unboundedIter = unboundedItems_.begin();
+    auto addUnboundedItemsBefore = [this, &point, &result, &unboundedIter](int32_t item) {
+        for (; unboundedIter != unboundedItems_.end() && *unboundedIter < item; ++unboundedIter) {
+            if (IsInBounds(*unboundedIter, point)) {
+                result.emplace_back(*unboundedIter);
+            }
+        }
+    };
+    if (columns_ > 0 && rows_ > 0 && GreatOrEqual(point.GetX(), gridRect_.Left()) &&
+        LessOrEqual(point.GetX(), gridRect_.Right()) && GreatOrEqual(point.GetY(), gridRect_.Top()) &&
+        LessOrEqual(point.GetY(), gridRect_.Bottom())) {
+        auto cell = GetRow(point.GetY()) * columns_ + GetColumn(point.GetX());
+        for (auto i = cellStarts_[cell]; i < cellStarts_[cell + 1]; ++i) {
+            auto item = cellItems_[i];
+            addUnboundedItemsBefore(item);
+            if (IsInBounds(item, point)) {
+                result.emplace_back(item);
+            }
+        }
+    }
+    addUnboundedItemsBefore(GetItemCount());
+}
+
+void HitTestIndex::Reset()
+{
+    bounds_.clear();
+    unboundedItems_.clear();
+    gridRect_.Reset();
+    columns_ = 0;
+    rows_ = 0;
+    cellWidth_ = 0.0f;
+    cellHeight_ = 0.0f;
+    cellStarts_.clear();
+    cellItems_.clear();
+}
+
+bool HitTestIndex::IsInBounds(int32_t index, const PointF& point) const
+{
+    const auto& bounds = bounds_[index];
+    if (!bounds) {
+        return true;
+    }
+    const auto& rect = bounds.value();
+    return GreatOrEqual(point.GetX(), rect.Left()) && LessOrEqual(point.GetX(), rect.Right()) &&
+           GreatOrEqual(point.GetY(), rect.Top()) && LessOrEqual(point.GetY(), rect.Bottom());
+}
+
+int32_t HitTestIndex::GetColumn(float x) const
+{
+    return ClampToInt(std::floor((x - gridRect_.Left()) / cellWidth_), 0, columns_ - 1);
+}
+
+int32_t HitTestIndex::GetRow(float y) const
+{
+    return ClampToInt(std::floor((y - gridRect_.Top()) / cellHeight_), 0, rows_ - 1);
+}
+
+} // namespace OHOS::Ace::NG
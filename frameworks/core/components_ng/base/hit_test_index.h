@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_HIT_TEST_INDEX_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_HIT_TEST_INDEX_H
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "base/geometry/ng/point_t.h"
+#include "base/geometry/ng/rect_t.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::NG {
+
+// Uniform grid over the hit bounds of a list of items, to find the items a point may hit without visiting all of
+// them. Every cell keeps the items overlapping it in ascending order, so a query keeps the order of the list.
+class ACE_EXPORT HitTestIndex final {
+public:
+    HitTestIndex() = default;
+    ~HitTestIndex() = default;
+
+    // bounds[i] holds the bounds of item i, std::nullopt marks an item which may be hit at any point.
+    void Build(const std::vector<std::optional<RectF>>& bounds);
+    // Replaces result with the ascending indexes of the items whose bounds contain point.
+    void Query(const PointF& point, std::vector<int32_t>& result) const;
+    void Reset();
+
+    int32_t GetItemCount() const
+    {
+        return static_cast<int32_t>(bounds_.size());
+    }
+
+private:
+    bool IsInBounds(int32_t index, const PointF& point) const;
+    int32_t GetColumn(float x) const;
+    int32_t GetRow(float y) const;
+
+    std::vector<std::optional<RectF>> bounds_;
+    std::vector<int32_t> unboundedItems_;
+    RectF gridRect_;
+    int32_t columns_ = 0;
+    int32_t rows_ = 0;
+    float cellWidth_ = 0.0f;
+    float cellHeight_ = 0.0f;
+    // items of cell c are cellItems_[cellStarts_[c], cellStarts_[c + 1]).
+    std::vector<int32_t> cellStarts_;
+    std::vector<int32_t> cellItems_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(HitTestIndex);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_BASE_HIT_TEST_INDEX_H
@@ -18,6 +18,7 @@
 #include <unistd.h>
 #include <unordered_set>
 
+#include "base/json/json_writer.h"
 #include "base/memory/ace_type.h"
 #include "base/utils/utils.h"
 #include "core/common/ace_application_info.h"
@@ -110,6 +111,24 @@ TouchEvent GetUpPoint(const TouchEvent& downPoint)
         .SetTime(std::chrono::high_resolution_clock::now())
         .SetSourceType(SourceType::TOUCH);
 }
+
+// writes the children member, or nothing if putChild writes none of children.
+template<typename F>
+void PutInspectorChildren(JsonWriter& writer, const std::vector<RefPtr<NG::UINode>>& children, F&& putChild)
+{
+    auto mark = writer.GetMark();
+    bool hasChild = false;
+    writer.Key(INSPECTOR_CHILDREN);
+    writer.StartArray();
+    for (const auto& uiNode : children) {
+        hasChild = putChild(uiNode) || hasChild;
+    }
+    writer.EndArray();
+    if (!hasChild) {
+        writer.Rollback(mark);
+    }
+}
+
 #ifdef PREVIEW
 void GetFrameNodeChildren(const RefPtr<NG::UINode>& uiNode, std::vector<RefPtr<NG::UINode>>& children, int32_t pageId,
     bool isLayoutInspector = false)
@@ -138,8 +157,7 @@ void GetFrameNodeChildren(const RefPtr<NG::UINode>& uiNode, std::vector<RefPtr<N
     }
 }
 
-void GetSpanInspector(
-    const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS::Ace::JsonValue>& jsonNodeArray, int pageId)
+bool GetSpanInspector(const RefPtr<NG::UINode>& parent, JsonWriter& writer, int pageId)
 {
     // span rect follows parent text size
     auto spanParentNode = parent->GetParent();
@@ -149,16 +167,16 @@ void GetSpanInspector(
         }
         spanParentNode = spanParentNode->GetParent();
     }
-    CHECK_NULL_VOID(spanParentNode);
+    CHECK_NULL_RETURN(spanParentNode, false);
     auto node = AceType::DynamicCast<FrameNode>(spanParentNode);
-    auto jsonNode = JsonUtil::Create(true);
     auto jsonObject = JsonUtil::Create(true);
 
     InspectorFilter filter;
     parent->ToJsonValue(jsonObject, filter);
-    jsonNode->PutRef(INSPECTOR_ATTRS, std::move(jsonObject));
-    jsonNode->Put(INSPECTOR_TYPE, parent->GetTag().c_str());
-    jsonNode->Put(INSPECTOR_ID, parent->GetId());
+    writer.StartObject();
+    writer.Put(INSPECTOR_ATTRS, jsonObject);
+    writer.Put(INSPECTOR_TYPE, parent->GetTag().c_str());
+    writer.Put(INSPECTOR_ID, parent->GetId());
     RectF rect = node->GetTransformRectRelativeToWindow();
     rect = rect.Constrain(deviceRect);
     if (rect.IsEmpty()) {
@@ -171,24 +189,23 @@ void GetSpanInspector(
                       .append(std::to_string(rect.Width()))
                       .append(",")
                       .append(std::to_string(rect.Height()));
-    jsonNode->Put(INSPECTOR_RECT, strRec.c_str());
-    jsonNode->Put(INSPECTOR_DEBUGLINE, parent->GetDebugLine().c_str());
-    jsonNode->Put(INSPECTOR_VIEW_ID, parent->GetViewId().c_str());
-    jsonNodeArray->PutRef(std::move(jsonNode));
+    writer.Put(INSPECTOR_RECT, strRec.c_str());
+    writer.Put(INSPECTOR_DEBUGLINE, parent->GetDebugLine().c_str());
+    writer.Put(INSPECTOR_VIEW_ID, parent->GetViewId().c_str());
+    writer.EndObject();
+    return true;
 }
 
-void GetInspectorChildren(const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS::Ace::JsonValue>& jsonNodeArray,
-    int pageId, bool isActive, const InspectorFilter& filter = InspectorFilter(), uint32_t depth = UINT32_MAX,
-    bool isLayoutInspector = false)
+bool GetInspectorChildren(const RefPtr<NG::UINode>& parent, JsonWriter& writer, int pageId, bool isActive,
+    const InspectorFilter& filter = InspectorFilter(), uint32_t depth = UINT32_MAX, bool isLayoutInspector = false)
 {
     // Span is a special case in Inspector since span inherits from UINode
     if (AceType::InstanceOf<SpanNode>(parent)) {
-        GetSpanInspector(parent, jsonNodeArray, pageId);
-        return;
+        return GetSpanInspector(parent, writer, pageId);
     }
-    auto jsonNode = JsonUtil::Create(true);
-    jsonNode->Put(INSPECTOR_TYPE, parent->GetTag().c_str());
-    jsonNode->Put(INSPECTOR_ID, parent->GetId());
+    writer.StartObject();
+    writer.Put(INSPECTOR_TYPE, parent->GetTag().c_str());
+    writer.Put(INSPECTOR_ID, parent->GetId());
     auto node = AceType::DynamicCast<FrameNode>(parent);
     if (node) {
         RectF rect;
@@ -204,14 +221,14 @@ void GetInspectorChildren(const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS
                           .append(std::to_string(rect.Top())).append(",")
                           .append(std::to_string(rect.Width())).append(",")
                           .append(std::to_string(rect.Height()));
-        jsonNode->Put(INSPECTOR_RECT, strRec.c_str());
-        jsonNode->Put(INSPECTOR_DEBUGLINE, node->GetDebugLine().c_str());
-        jsonNode->Put(INSPECTOR_VIEW_ID, node->GetViewId().c_str());
+        writer.Put(INSPECTOR_RECT, strRec.c_str());
+        writer.Put(INSPECTOR_DEBUGLINE, node->GetDebugLine().c_str());
+        writer.Put(INSPECTOR_VIEW_ID, node->GetViewId().c_str());
         auto jsonObject = JsonUtil::Create(true);
 
         InspectorFilter filter;
         parent->ToJsonValue(jsonObject, filter);
-        jsonNode->PutRef(INSPECTOR_ATTRS, std::move(jsonObject));
+        writer.Put(INSPECTOR_ATTRS, jsonObject);
     }
 
     std::vector<RefPtr<NG::UINode>> children;
@@ -225,15 +242,12 @@ void GetInspectorChildren(const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS
         }
     }
     if (depth) {
-        auto jsonChildrenArray = JsonUtil::CreateArray(true);
-        for (auto uiNode : children) {
-            GetInspectorChildren(uiNode, jsonChildrenArray, pageId, isActive, filter, depth - 1);
-        }
-        if (jsonChildrenArray->GetArraySize()) {
-            jsonNode->PutRef(INSPECTOR_CHILDREN, std::move(jsonChildrenArray));
-        }
+        PutInspectorChildren(writer, children, [&](const RefPtr<NG::UINode>& uiNode) {
+            return GetInspectorChildren(uiNode, writer, pageId, isActive, filter, depth - 1);
+        });
     }
-    jsonNodeArray->PutRef(std::move(jsonNode));
+    writer.EndObject();
+    return true;
 }
 
 #else
@@ -262,8 +276,7 @@ void GetFrameNodeChildren(const RefPtr<NG::UINode>& uiNode, std::vector<RefPtr<N
     }
 }
 
-void GetSpanInspector(
-    const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS::Ace::JsonValue>& jsonNodeArray, int pageId)
+bool GetSpanInspector(const RefPtr<NG::UINode>& parent, JsonWriter& writer, int pageId)
 {
     // span rect follows parent text size
     auto spanParentNode = parent->GetParent();
@@ -273,23 +286,24 @@ void GetSpanInspector(
         }
         spanParentNode = spanParentNode->GetParent();
     }
-    CHECK_NULL_VOID(spanParentNode);
+    CHECK_NULL_RETURN(spanParentNode, false);
     auto node = AceType::DynamicCast<FrameNode>(spanParentNode);
-    auto jsonNode = JsonUtil::Create(true);
     auto jsonObject = JsonUtil::Create(true);
 
     InspectorFilter filter;
     parent->ToJsonValue(jsonObject, filter);
-    jsonNode->PutRef(INSPECTOR_ATTRS, std::move(jsonObject));
-    jsonNode->Put(INSPECTOR_TYPE, parent->GetTag().c_str());
-    jsonNode->Put(INSPECTOR_ID, parent->GetId());
-    jsonNode->Put(INSPECTOR_DEBUGLINE, parent->GetDebugLine().c_str());
+    writer.StartObject();
+    writer.Put(INSPECTOR_ATTRS, jsonObject);
+    writer.Put(INSPECTOR_TYPE, parent->GetTag().c_str());
+    writer.Put(INSPECTOR_ID, parent->GetId());
+    writer.Put(INSPECTOR_DEBUGLINE, parent->GetDebugLine().c_str());
     RectF rect = node->GetTransformRectRelativeToWindow();
-    jsonNode->Put(INSPECTOR_RECT, rect.ToBounds().c_str());
-    jsonNodeArray->PutRef(std::move(jsonNode));
+    writer.Put(INSPECTOR_RECT, rect.ToBounds().c_str());
+    writer.EndObject();
+    return true;
 }
 
-void GetCustomNodeInfo(const RefPtr<NG::UINode> &customNode, std::unique_ptr<OHOS::Ace::JsonValue> &jsonNode)
+void GetCustomNodeInfo(const RefPtr<NG::UINode>& customNode, JsonWriter& writer)
 {
     // custom node rect follows parent size
     auto hostNode = customNode->GetParent();
@@ -300,36 +314,35 @@ void GetCustomNodeInfo(const RefPtr<NG::UINode> &customNode, std::unique_ptr<OHO
         hostNode = hostNode->GetParent();
     }
     CHECK_NULL_VOID(hostNode);
-    jsonNode->Put(INSPECTOR_COMPONENT_TYPE, "custom");
+    writer.Put(INSPECTOR_COMPONENT_TYPE, "custom");
     auto node = AceType::DynamicCast<CustomNode>(customNode);
     CHECK_NULL_VOID(node);
     auto parentNode = AceType::DynamicCast<FrameNode>(hostNode);
-    jsonNode->Put(INSPECTOR_STATE_VAR, node->GetStateInspectorInfo());
+    writer.Put(INSPECTOR_STATE_VAR, node->GetStateInspectorInfo());
     RectF rect = parentNode->GetTransformRectRelativeToWindow();
-    jsonNode->Put(INSPECTOR_RECT, rect.ToBounds().c_str());
-    jsonNode->Put(INSPECTOR_DEBUGLINE, customNode->GetDebugLine().c_str());
-    jsonNode->Put(INSPECTOR_CUSTOM_VIEW_TAG, node->GetCustomTag().c_str());
+    writer.Put(INSPECTOR_RECT, rect.ToBounds().c_str());
+    writer.Put(INSPECTOR_DEBUGLINE, customNode->GetDebugLine().c_str());
+    writer.Put(INSPECTOR_CUSTOM_VIEW_TAG, node->GetCustomTag().c_str());
 }
 
-void GetInspectorChildren(const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS::Ace::JsonValue>& jsonNodeArray,
-    int pageId, bool isActive, const InspectorFilter& filter = InspectorFilter(), uint32_t depth = UINT32_MAX,
-    bool isLayoutInspector = false)
+bool GetInspectorChildren(const RefPtr<NG::UINode>& parent, JsonWriter& writer, int pageId, bool isActive,
+    const InspectorFilter& filter = InspectorFilter(), uint32_t depth = UINT32_MAX, bool isLayoutInspector = false)
 {
     // Span is a special case in Inspector since span inherits from UINode
     if (AceType::InstanceOf<SpanNode>(parent)) {
-        GetSpanInspector(parent, jsonNodeArray, pageId);
-        return;
+        return GetSpanInspector(parent, writer, pageId);
     }
     if (AceType::InstanceOf<CustomNode>(parent) && !isLayoutInspector) {
-        return;
+        return false;
     }
-    auto jsonNode = JsonUtil::Create(true);
-    jsonNode->Put(INSPECTOR_TYPE, parent->GetTag().c_str());
-    jsonNode->Put(INSPECTOR_ID, parent->GetId());
+    auto nodeStart = writer.GetSize();
+    writer.StartObject();
+    writer.Put(INSPECTOR_TYPE, parent->GetTag().c_str());
+    writer.Put(INSPECTOR_ID, parent->GetId());
     if (parent->GetTag() == V2::JS_VIEW_ETS_TAG) {
-        GetCustomNodeInfo(parent, jsonNode);
+        GetCustomNodeInfo(parent, writer);
     } else {
-        jsonNode->Put(INSPECTOR_COMPONENT_TYPE, "build-in");
+        writer.Put(INSPECTOR_COMPONENT_TYPE, "build-in");
     }
     auto node = AceType::DynamicCast<FrameNode>(parent);
     if (node) {
@@ -338,15 +351,14 @@ void GetInspectorChildren(const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS
         if (isActive) {
             rect = node->GetTransformRectRelativeToWindow();
         }
-        jsonNode->Put(INSPECTOR_RECT, rect.ToBounds().c_str());
-        jsonNode->Put(INSPECTOR_DEBUGLINE, node->GetDebugLine().c_str());
+        writer.Put(INSPECTOR_RECT, rect.ToBounds().c_str());
+        writer.Put(INSPECTOR_DEBUGLINE, node->GetDebugLine().c_str());
     }
     auto jsonObject = JsonUtil::Create(true);
     parent->ToJsonValue(jsonObject, filter);
-    jsonNode->PutRef(INSPECTOR_ATTRS, std::move(jsonObject));
-    std::string jsonNodeStr = jsonNode->ToString();
-    ConvertIllegalStr(jsonNodeStr);
-    auto jsonNodeNew = JsonUtil::ParseJsonString(jsonNodeStr);
+    writer.Put(INSPECTOR_ATTRS, jsonObject);
+    // fix illegal utf8 in the fields of this node only, its children fix their own.
+    ConvertIllegalStr(reinterpret_cast<uint8_t*>(writer.GetData() + nodeStart), writer.GetSize() - nodeStart);
     std::vector<RefPtr<NG::UINode>> children;
     for (const auto& item : parent->GetChildren()) {
         GetFrameNodeChildren(item, children, pageId, isLayoutInspector);
@@ -358,15 +370,12 @@ void GetInspectorChildren(const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS
         }
     }
     if (depth) {
-        auto jsonChildrenArray = JsonUtil::CreateArray(true);
-        for (auto uiNode : children) {
-            GetInspectorChildren(uiNode, jsonChildrenArray, pageId, isActive, filter, depth - 1, isLayoutInspector);
-        }
-        if (jsonChildrenArray->GetArraySize()) {
-            jsonNodeNew->PutRef(INSPECTOR_CHILDREN, std::move(jsonChildrenArray));
-        }
+        PutInspectorChildren(writer, children, [&](const RefPtr<NG::UINode>& uiNode) {
+            return GetInspectorChildren(uiNode, writer, pageId, isActive, filter, depth - 1, isLayoutInspector);
+        });
     }
-    jsonNodeArray->PutRef(std::move(jsonNodeNew));
+    writer.EndObject();
+    return true;
 }
 #endif
 
@@ -384,43 +393,60 @@ RefPtr<NG::UINode> GetOverlayNode(const RefPtr<NG::UINode>& pageNode)
     return overlayNode;
 }
 
-void GetContextInfo(const RefPtr<PipelineContext>& context, std::unique_ptr<JsonValue>& jsonRoot)
+void GetContextInfo(const RefPtr<PipelineContext>& context, JsonWriter& writer)
 {
     auto scale = context->GetViewScale();
     auto rootHeight = context->GetRootHeight();
     auto rootWidth = context->GetRootWidth();
     deviceRect.SetRect(0, 0, rootWidth * scale, rootHeight * scale);
-    jsonRoot->Put(INSPECTOR_WIDTH, std::to_string(rootWidth * scale).c_str());
-    jsonRoot->Put(INSPECTOR_HEIGHT, std::to_string(rootHeight * scale).c_str());
-    jsonRoot->Put(INSPECTOR_RESOLUTION, std::to_string(PipelineBase::GetCurrentDensity()).c_str());
+    writer.Put(INSPECTOR_WIDTH, std::to_string(rootWidth * scale).c_str());
+    writer.Put(INSPECTOR_HEIGHT, std::to_string(rootHeight * scale).c_str());
+    writer.Put(INSPECTOR_RESOLUTION, std::to_string(PipelineBase::GetCurrentDensity()).c_str());
 }
 
-std::string GetInspectorInfo(std::vector<RefPtr<NG::UINode>> children, int32_t pageId,
-    std::unique_ptr<JsonValue> jsonRoot, bool isLayoutInspector, const InspectorFilter& filter = InspectorFilter())
+// root of an inspector tree without children, returned when the tree can not be built.
+std::string GetRootInspector(const RefPtr<PipelineContext>& context)
 {
-    auto jsonNodeArray = JsonUtil::CreateArray(true);
-    auto depth = filter.GetFilterDepth();
-    for (auto& uiNode : children) {
-        GetInspectorChildren(uiNode, jsonNodeArray, pageId, true, filter, depth - 1, isLayoutInspector);
-    }
-    if (jsonNodeArray->GetArraySize()) {
-        jsonRoot->PutRef(INSPECTOR_CHILDREN, std::move(jsonNodeArray));
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put(INSPECTOR_TYPE, INSPECTOR_ROOT);
+    if (context) {
+        GetContextInfo(context, writer);
+    }
+    writer.EndObject();
+    return writer.ReleaseString();
+}
+
+std::string GetInspectorInfo(const std::vector<RefPtr<NG::UINode>>& children, int32_t pageId,
+    const RefPtr<PipelineContext>& context, bool isLayoutInspector, const InspectorFilter& filter = InspectorFilter())
+{
+    // the tree is written node by node into one buffer, only the attributes of the current node are built as json
+    // objects, so the memory used does not grow with a json tree of the whole page.
+    JsonWriter writer;
+    if (isLayoutInspector) {
+        writer.StartObject();
+        writer.Put("type", "root");
+        writer.Key("content");
     }
+    writer.StartObject();
+    writer.Put(INSPECTOR_TYPE, INSPECTOR_ROOT);
+    GetContextInfo(context, writer);
+    auto depth = filter.GetFilterDepth();
+    PutInspectorChildren(writer, children, [&](const RefPtr<NG::UINode>& uiNode) {
+        return GetInspectorChildren(uiNode, writer, pageId, true, filter, depth - 1, isLayoutInspector);
+    });
+    writer.EndObject();
 
     if (isLayoutInspector) {
-        auto jsonTree = JsonUtil::Create(true);
-        jsonTree->Put("type", "root");
-        jsonTree->PutRef("content", std::move(jsonRoot));
         auto pipeline = PipelineContext::GetCurrentContextSafely();
         if (pipeline) {
-            jsonTree->Put("VsyncID", (int32_t)pipeline->GetFrameCount());
-            jsonTree->Put("ProcessID", getpid());
-            jsonTree->Put("WindowID", (int32_t)pipeline->GetWindowId());
+            writer.Put("VsyncID", (int32_t)pipeline->GetFrameCount());
+            writer.Put("ProcessID", getpid());
+            writer.Put("WindowID", (int32_t)pipeline->GetWindowId());
         }
-        return jsonTree->ToString();
+        writer.EndObject();
     }
-
-    return jsonRoot->ToString();
+    return writer.ReleaseString();
 }
 } // namespace
 
@@ -460,21 +486,23 @@ std::string Inspector::GetInspectorNodeByKey(const std::string& key, const Inspe
     auto inspectorElement = GetInspectorByKey(rootNode, key);
     CHECK_NULL_RETURN(inspectorElement, "");
 
-    auto jsonNode = JsonUtil::Create(true);
-    jsonNode->Put(INSPECTOR_TYPE, inspectorElement->GetTag().c_str());
-    jsonNode->Put(INSPECTOR_ID, inspectorElement->GetId());
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put(INSPECTOR_TYPE, inspectorElement->GetTag().c_str());
+    writer.Put(INSPECTOR_ID, inspectorElement->GetId());
     auto frameNode = AceType::DynamicCast<FrameNode>(inspectorElement);
     if (frameNode) {
         auto rect = frameNode->GetTransformRectRelativeToWindow();
-        jsonNode->Put(INSPECTOR_RECT, rect.ToBounds().c_str());
+        writer.Put(INSPECTOR_RECT, rect.ToBounds().c_str());
     }
     auto jsonAttrs = JsonUtil::Create(true);
     std::string debugLine = inspectorElement->GetDebugLine();
-    jsonNode->Put(INSPECTOR_DEBUGLINE, debugLine.c_str());
+    writer.Put(INSPECTOR_DEBUGLINE, debugLine.c_str());
 
     inspectorElement->ToJsonValue(jsonAttrs, filter);
-    jsonNode->PutRef(INSPECTOR_ATTRS, std::move(jsonAttrs));
-    return jsonNode->ToString();
+    writer.Put(INSPECTOR_ATTRS, jsonAttrs);
+    writer.EndObject();
+    return writer.ReleaseString();
 }
 
 void Inspector::GetRectangleById(const std::string& key, Rectangle& rectangle)
@@ -561,15 +589,12 @@ std::string Inspector::GetInspector(bool isLayoutInspector)
 
 std::string Inspector::GetInspector(bool isLayoutInspector, const InspectorFilter& filter, bool& needThrow)
 {
-    auto jsonRoot = JsonUtil::Create(true);
-    jsonRoot->Put(INSPECTOR_TYPE, INSPECTOR_ROOT);
     needThrow = false;
     auto context = NG::PipelineContext::GetCurrentContext();
     if (context == nullptr) {
         needThrow = true;
-        return jsonRoot->ToString();
+        return GetRootInspector(nullptr);
     }
-    GetContextInfo(context, jsonRoot);
 
     RefPtr<UINode> pageRootNode;
     const std::string key = filter.GetFilterID();
@@ -579,13 +604,13 @@ std::string Inspector::GetInspector(bool isLayoutInspector, const InspectorFilte
         auto rootNode = context->GetStageManager()->GetLastPage();
         if (rootNode == nullptr) {
             needThrow = true;
-            return jsonRoot->ToString();
+            return GetRootInspector(context);
         }
         pageRootNode = GetInspectorByKey(rootNode, key);
     }
     if (pageRootNode == nullptr) {
         needThrow = true;
-        return jsonRoot->ToString();
+        return GetRootInspector(context);
     }
     auto pageId = context->GetStageManager()->GetLastPage()->GetPageId();
     std::vector<RefPtr<NG::UINode>> children;
@@ -600,96 +625,93 @@ std::string Inspector::GetInspector(bool isLayoutInspector, const InspectorFilte
     } else {
         children.emplace_back(pageRootNode);
     }
-    return GetInspectorInfo(children, pageId, std::move(jsonRoot), isLayoutInspector, filter);
+    return GetInspectorInfo(children, pageId, context, isLayoutInspector, filter);
 }
 
 std::string Inspector::GetInspectorOfNode(RefPtr<NG::UINode> node)
 {
-    auto jsonRoot = JsonUtil::Create(true);
-
     auto context = NG::PipelineContext::GetCurrentContext();
-    CHECK_NULL_RETURN(context, jsonRoot->ToString());
-    GetContextInfo(context, jsonRoot);
-    CHECK_NULL_RETURN(node, jsonRoot->ToString());
+    CHECK_NULL_RETURN(context, "{}");
+    JsonWriter writer;
+    // the context info also sets the device rect the node rect is constrained to, so it is taken before the node.
+    writer.StartObject();
+    GetContextInfo(context, writer);
+    writer.EndObject();
+    CHECK_NULL_RETURN(node, writer.ReleaseString());
     auto pageId = context->GetStageManager()->GetLastPage()->GetPageId();
-    auto jsonNodeArray = JsonUtil::CreateArray(true);
-    GetInspectorChildren(node, jsonNodeArray, pageId, true);
-    if (jsonNodeArray->GetArraySize()) {
-        jsonRoot = jsonNodeArray->GetArrayItem(0);
-        jsonRoot->Delete(INSPECTOR_CHILDREN);
-        GetContextInfo(context, jsonRoot);
-    }
-
-    return jsonRoot->ToString();
+    // the children are not part of the result, only write the node itself and append the context info to it.
+    writer.Clear();
+    if (!GetInspectorChildren(node, writer, pageId, true, InspectorFilter(), 0) || !writer.ReopenObject()) {
+        writer.Clear();
+        writer.StartObject();
+    }
+    GetContextInfo(context, writer);
+    writer.EndObject();
+    return writer.ReleaseString();
 }
 
 std::string Inspector::GetSubWindowInspector(bool isLayoutInspector)
 {
-    auto jsonRoot = JsonUtil::Create(true);
-    jsonRoot->Put(INSPECTOR_TYPE, INSPECTOR_ROOT);
-
     auto context = NG::PipelineContext::GetCurrentContext();
-    CHECK_NULL_RETURN(context, jsonRoot->ToString());
-    GetContextInfo(context, jsonRoot);
+    CHECK_NULL_RETURN(context, GetRootInspector(nullptr));
     auto overlayNode = context->GetOverlayManager()->GetRootNode().Upgrade();
-    CHECK_NULL_RETURN(overlayNode, jsonRoot->ToString());
+    CHECK_NULL_RETURN(overlayNode, GetRootInspector(context));
     auto pageId = 0;
     std::vector<RefPtr<NG::UINode>> children;
     GetFrameNodeChildren(overlayNode, children, pageId, isLayoutInspector);
 
-    return GetInspectorInfo(children, 0, std::move(jsonRoot), isLayoutInspector);
+    return GetInspectorInfo(children, 0, context, isLayoutInspector);
 }
 
-void FillSimplifiedInspectorAttrs(const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS::Ace::JsonValue>& jsonNode)
+void FillSimplifiedInspectorAttrs(const RefPtr<NG::UINode>& parent, JsonWriter& writer)
 {
     auto tmpJson = JsonUtil::Create(true);
 
     InspectorFilter filter;
     parent->ToJsonValue(tmpJson, filter);
-    jsonNode->Put(INSPECTOR_ATTR_ID, tmpJson->GetString(INSPECTOR_ATTR_ID).c_str());
+    writer.Put(INSPECTOR_ATTR_ID, tmpJson->GetString(INSPECTOR_ATTR_ID).c_str());
 
-    auto jsonObject = JsonUtil::Create(true);
+    writer.Key(INSPECTOR_ATTRS);
+    writer.StartObject();
     if (tmpJson->Contains(INSPECTOR_LABEL)) {
-        jsonObject->Put(INSPECTOR_LABEL, tmpJson->GetString(INSPECTOR_LABEL).c_str());
+        writer.Put(INSPECTOR_LABEL, tmpJson->GetString(INSPECTOR_LABEL).c_str());
     }
     if (tmpJson->Contains(INSPECTOR_CONTENT)) {
-        jsonObject->Put(INSPECTOR_CONTENT, tmpJson->GetString(INSPECTOR_CONTENT).c_str());
+        writer.Put(INSPECTOR_CONTENT, tmpJson->GetString(INSPECTOR_CONTENT).c_str());
     }
-    jsonObject->Put(INSPECTOR_ENABLED, tmpJson->GetBool(INSPECTOR_ENABLED));
-    jsonObject->Put(INSPECTOR_OPACITY, tmpJson->GetDouble(INSPECTOR_OPACITY));
-    jsonObject->Put(INSPECTOR_ZINDEX, tmpJson->GetInt(INSPECTOR_ZINDEX));
-    jsonObject->Put(INSPECTOR_VISIBILITY, tmpJson->GetString(INSPECTOR_VISIBILITY).c_str());
-    jsonNode->PutRef(INSPECTOR_ATTRS, std::move(jsonObject));
+    writer.Put(INSPECTOR_ENABLED, tmpJson->GetBool(INSPECTOR_ENABLED));
+    writer.Put(INSPECTOR_OPACITY, tmpJson->GetDouble(INSPECTOR_OPACITY));
+    writer.Put(INSPECTOR_ZINDEX, tmpJson->GetInt(INSPECTOR_ZINDEX));
+    writer.Put(INSPECTOR_VISIBILITY, tmpJson->GetString(INSPECTOR_VISIBILITY).c_str());
+    writer.EndObject();
 }
 
-void GetSimplifiedSpanInspector(
-    const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS::Ace::JsonValue>& jsonNodeArray, int pageId)
+bool GetSimplifiedSpanInspector(const RefPtr<NG::UINode>& parent, JsonWriter& writer, int pageId)
 {
     // span rect follows parent text size
     auto spanParentNode = parent->GetParent();
-    CHECK_NULL_VOID(spanParentNode);
+    CHECK_NULL_RETURN(spanParentNode, false);
     auto node = AceType::DynamicCast<FrameNode>(spanParentNode);
-    CHECK_NULL_VOID(node);
-    auto jsonNode = JsonUtil::Create(true);
+    CHECK_NULL_RETURN(node, false);
+    writer.StartObject();
 
-    FillSimplifiedInspectorAttrs(parent, jsonNode);
+    FillSimplifiedInspectorAttrs(parent, writer);
 
-    jsonNode->Put(INSPECTOR_TYPE, parent->GetTag().c_str());
+    writer.Put(INSPECTOR_TYPE, parent->GetTag().c_str());
     RectF rect = node->GetTransformRectRelativeToWindow();
-    jsonNode->Put(INSPECTOR_RECT, rect.ToBounds().c_str());
-    jsonNodeArray->PutRef(std::move(jsonNode));
+    writer.Put(INSPECTOR_RECT, rect.ToBounds().c_str());
+    writer.EndObject();
+    return true;
 }
 
-void GetSimplifiedInspectorChildren(
-    const RefPtr<NG::UINode>& parent, std::unique_ptr<OHOS::Ace::JsonValue>& jsonNodeArray, int pageId, bool isActive)
+bool GetSimplifiedInspectorChildren(const RefPtr<NG::UINode>& parent, JsonWriter& writer, int pageId, bool isActive)
 {
     // Span is a special case in Inspector since span inherits from UINode
     if (AceType::InstanceOf<SpanNode>(parent)) {
-        GetSimplifiedSpanInspector(parent, jsonNodeArray, pageId);
-        return;
+        return GetSimplifiedSpanInspector(parent, writer, pageId);
     }
-    auto jsonNode = JsonUtil::Create(true);
-    jsonNode->Put(INSPECTOR_TYPE, parent->GetTag().c_str());
+    writer.StartObject();
+    writer.Put(INSPECTOR_TYPE, parent->GetTag().c_str());
     auto node = AceType::DynamicCast<FrameNode>(parent);
 
     RectF rect;
@@ -698,49 +720,53 @@ void GetSimplifiedInspectorChildren(
         rect = node->GetTransformRectRelativeToWindow();
     }
 
-    jsonNode->Put(INSPECTOR_RECT, rect.ToBounds().c_str());
+    writer.Put(INSPECTOR_RECT, rect.ToBounds().c_str());
 
-    FillSimplifiedInspectorAttrs(parent, jsonNode);
+    FillSimplifiedInspectorAttrs(parent, writer);
 
     std::vector<RefPtr<NG::UINode>> children;
     for (const auto& item : parent->GetChildren()) {
         GetFrameNodeChildren(item, children, pageId);
     }
-    auto jsonChildrenArray = JsonUtil::CreateArray(true);
-    for (auto uiNode : children) {
-        GetSimplifiedInspectorChildren(uiNode, jsonChildrenArray, pageId, isActive);
-    }
-    if (jsonChildrenArray->GetArraySize()) {
-        jsonNode->PutRef(INSPECTOR_CHILDREN, std::move(jsonChildrenArray));
-    }
-    jsonNodeArray->PutRef(std::move(jsonNode));
+    PutInspectorChildren(writer, children, [&](const RefPtr<NG::UINode>& uiNode) {
+        return GetSimplifiedInspectorChildren(uiNode, writer, pageId, isActive);
+    });
+    writer.EndObject();
+    return true;
+}
+
+std::string EndSimplifiedInspector(JsonWriter& writer)
+{
+    writer.EndObject();
+    return writer.ReleaseString();
 }
 
 std::string Inspector::GetSimplifiedInspector(int32_t containerId)
 {
     TAG_LOGI(AceLogTag::ACE_UIEVENT, "GetSimplifiedInspector start: container %{public}d", containerId);
-    auto jsonRoot = JsonUtil::Create(true);
-    jsonRoot->Put(INSPECTOR_TYPE, INSPECTOR_ROOT);
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put(INSPECTOR_TYPE, INSPECTOR_ROOT);
 
     auto context = NG::PipelineContext::GetContextByContainerId(containerId);
-    CHECK_NULL_RETURN(context, jsonRoot->ToString());
+    CHECK_NULL_RETURN(context, EndSimplifiedInspector(writer));
     auto scale = context->GetViewScale();
     auto rootHeight = context->GetRootHeight();
     auto rootWidth = context->GetRootWidth();
     deviceRect.SetRect(0, 0, rootWidth * scale, rootHeight * scale);
-    jsonRoot->Put(INSPECTOR_WIDTH, std::to_string(rootWidth * scale).c_str());
-    jsonRoot->Put(INSPECTOR_HEIGHT, std::to_string(rootHeight * scale).c_str());
-    jsonRoot->Put(INSPECTOR_RESOLUTION, std::to_string(SystemProperties::GetResolution()).c_str());
+    writer.Put(INSPECTOR_WIDTH, std::to_string(rootWidth * scale).c_str());
+    writer.Put(INSPECTOR_HEIGHT, std::to_string(rootHeight * scale).c_str());
+    writer.Put(INSPECTOR_RESOLUTION, std::to_string(SystemProperties::GetResolution()).c_str());
 
     auto pageRootNode = context->GetStageManager()->GetLastPage();
-    CHECK_NULL_RETURN(pageRootNode, jsonRoot->ToString());
+    CHECK_NULL_RETURN(pageRootNode, EndSimplifiedInspector(writer));
 
     auto pagePattern = pageRootNode->GetPattern<PagePattern>();
-    CHECK_NULL_RETURN(pagePattern, jsonRoot->ToString());
+    CHECK_NULL_RETURN(pagePattern, EndSimplifiedInspector(writer));
     auto pageInfo = pagePattern->GetPageInfo();
-    CHECK_NULL_RETURN(pageInfo, jsonRoot->ToString());
-    jsonRoot->Put(INSPECTOR_PAGE_URL, pageInfo->GetPageUrl().c_str());
-    jsonRoot->Put(INSPECTOR_NAV_DST_NAME, Recorder::EventRecorder::Get().GetNavDstName().c_str());
+    CHECK_NULL_RETURN(pageInfo, EndSimplifiedInspector(writer));
+    writer.Put(INSPECTOR_PAGE_URL, pageInfo->GetPageUrl().c_str());
+    writer.Put(INSPECTOR_NAV_DST_NAME, Recorder::EventRecorder::Get().GetNavDstName().c_str());
 
     auto pageId = context->GetStageManager()->GetLastPage()->GetPageId();
     std::vector<RefPtr<NG::UINode>> children;
@@ -751,15 +777,11 @@ std::string Inspector::GetSimplifiedInspector(int32_t containerId)
     if (overlayNode) {
         GetFrameNodeChildren(overlayNode, children, pageId);
     }
-    auto jsonNodeArray = JsonUtil::CreateArray(true);
-    for (auto& uiNode : children) {
-        GetSimplifiedInspectorChildren(uiNode, jsonNodeArray, pageId, true);
-    }
-    if (jsonNodeArray->GetArraySize()) {
-        jsonRoot->PutRef(INSPECTOR_CHILDREN, std::move(jsonNodeArray));
-    }
+    PutInspectorChildren(writer, children, [&](const RefPtr<NG::UINode>& uiNode) {
+        return GetSimplifiedInspectorChildren(uiNode, writer, pageId, true);
+    });
 
-    return jsonRoot->ToString();
+    return EndSimplifiedInspector(writer);
 }
 
 bool Inspector::SendEventByKey(const std::string& key, int action, const std::string& params)
@@ -1642,6 +1642,7 @@ void GestureEventHub::SetResponseRegion(const std::vector<DimensionRect>& respon
     if (responseRegionFunc_) {
         responseRegionFunc_(responseRegion_);
     }
+    NotifyResponseRegionChanged();
 }
 
 void GestureEventHub::RemoveLastResponseRect()
@@ -1658,6 +1659,14 @@ void GestureEventHub::RemoveLastResponseRect()
     if (responseRegionFunc_) {
         responseRegionFunc_(responseRegion_);
     }
+    NotifyResponseRegionChanged();
+}
+
+void GestureEventHub::NotifyResponseRegionChanged()
+{
+    auto host = GetFrameNode();
+    CHECK_NULL_VOID(host);
+    host->NotifyGeometryChanged();
 }
 
 void GestureEventHub::SetOnTouchEvent(TouchEventFunc&& touchEventFunc)
@@ -491,6 +491,7 @@ public:
         if (!mouseResponseRegion_.empty()) {
             isResponseRegion_ = true;
         }
+        NotifyResponseRegionChanged();
     }
 
     void AddResponseRect(const DimensionRect& responseRect)
@@ -501,6 +502,7 @@ public:
         if (responseRegionFunc_) {
             responseRegionFunc_(responseRegion_);
         }
+        NotifyResponseRegionChanged();
     }
 
     void RemoveLastResponseRect();
@@ -681,6 +683,9 @@ private:
 
     void UpdateGestureHierarchy();
 
+    // the hit test index of the pipeline depends on the response regions.
+    void NotifyResponseRegionChanged();
+
     void AddGestureToGestureHierarchy(const RefPtr<NG::Gesture>& gesture);
 
     // old path.
@@ -102,6 +102,23 @@ ImageLoadingContext::~ImageLoadingContext()
     }
 }
 
+void ImageLoadingContext::SetLoadPriority(ImageLoadPriority loadPriority)
+{
+    if (loadPriority_ == loadPriority) {
+        return;
+    }
+    loadPriority_ = loadPriority;
+    if (syncLoad_) {
+        return;
+    }
+    auto state = stateManager_->GetCurrentState();
+    if (state == ImageLoadingState::DATA_LOADING) {
+        ImageProvider::UpdateTaskPriority(src_.GetKey());
+    } else if (state == ImageLoadingState::MAKE_CANVAS_IMAGE) {
+        ImageProvider::UpdateTaskPriority(canvasKey_);
+    }
+}
+
 SizeF ImageLoadingContext::CalculateTargetSize(const SizeF& srcSize, const SizeF& dstSize, const SizeF& rawImageSize)
 {
     if (!srcSize.IsPositive()) {
@@ -142,6 +142,14 @@ public:
         loadInVipChannel_ = loadInVipChannel;
     }
 
+    ImageLoadPriority GetLoadPriority() const
+    {
+        return loadPriority_;
+    }
+
+    // reorders the pending background task of this context
+    void SetLoadPriority(ImageLoadPriority loadPriority);
+
     void CallbackAfterMeasureIfNeed();
 
     void OnDataReadyOnCompleteCallBack();
@@ -200,6 +208,7 @@ private:
     bool autoResize_ = true;
     bool syncLoad_ = false;
     bool loadInVipChannel_ = false;
+    std::atomic<ImageLoadPriority> loadPriority_ = ImageLoadPriority::ONSCREEN;
 
     DynamicRangeMode dynamicMode_ = DynamicRangeMode::STANDARD;
     AIImageQuality imageQuality_ = AIImageQuality::NONE;
@@ -17,6 +17,8 @@
 
 #include <cstdint>
 #include <mutex>
+#include <tuple>
+#include <vector>
 
 #include "base/log/ace_trace.h"
 #include "base/memory/referenced.h"
@@ -44,6 +46,13 @@
 #include "core/pipeline_ng/pipeline_context.h"
 
 namespace OHOS::Ace::NG {
+namespace {
+// background tasks of each priority running at the same time, so decoding images on screen is not delayed by images
+// that are not shown yet.
+constexpr std::array<int32_t, static_cast<size_t>(ImageLoadPriority::COUNT)> MAX_RUNNING_TASKS = { 4, 2, 1 };
+// network loads wait for their download, they have their own slots so a slow server does not hold back decodes.
+constexpr std::array<int32_t, static_cast<size_t>(ImageLoadPriority::COUNT)> MAX_RUNNING_NETWORK_TASKS = { 4, 2, 1 };
+} // namespace
 
 void ImageProvider::CacheImageObject(const RefPtr<ImageObject>& obj)
 {
@@ -59,6 +68,10 @@ void ImageProvider::CacheImageObject(const RefPtr<ImageObject>& obj)
 
 std::mutex ImageProvider::taskMtx_;
 std::unordered_map<std::string, ImageProvider::Task> ImageProvider::tasks_;
+std::array<std::list<std::string>, ImageProvider::PRIORITY_COUNT> ImageProvider::pendingTasks_;
+std::array<int32_t, ImageProvider::PRIORITY_COUNT> ImageProvider::runningTasks_ = {};
+std::array<std::list<std::string>, ImageProvider::PRIORITY_COUNT> ImageProvider::networkPendingTasks_;
+std::array<int32_t, ImageProvider::PRIORITY_COUNT> ImageProvider::networkRunningTasks_ = {};
 
 bool ImageProvider::PrepareImageData(const RefPtr<ImageObject>& imageObj)
 {
@@ -165,6 +178,9 @@ void ImageProvider::SuccessCallback(
 void ImageProvider::CreateImageObjHelper(const ImageSourceInfo& src, bool sync)
 {
     ACE_SCOPED_TRACE("CreateImageObj %s", src.ToString().c_str());
+    if (!sync && AbortIfCanceled(src.GetKey())) {
+        return;
+    }
     // load image data
     auto imageLoader = ImageLoader::CreateImageLoader(src);
     if (!imageLoader) {
@@ -178,6 +194,9 @@ void ImageProvider::CreateImageObjHelper(const ImageSourceInfo& src, bool sync)
         FailCallback(src.GetKey(), "Failed to load image data", sync);
         return;
     }
+    if (!sync && AbortIfCanceled(src.GetKey())) {
+        return;
+    }
 
     // build ImageObject
     RefPtr<ImageObject> imageObj = ImageProvider::BuildImageObject(src, data);
@@ -219,6 +238,8 @@ bool ImageProvider::RegisterTask(const std::string& key, const WeakPtr<ImageLoad
     auto it = tasks_.find(key);
     if (it != tasks_.end()) {
         it->second.ctxs_.insert(ctx);
+        // a canceled task that has not stopped yet loads for the new ctx instead
+        it->second.canceled_ = false;
         return false;
     }
     tasks_[key].ctxs_.insert(ctx);
@@ -234,29 +255,159 @@ std::set<WeakPtr<ImageLoadingContext>> ImageProvider::EndTask(const std::string&
         return {};
     }
     auto ctxs = it->second.ctxs_;
-    if (ctxs.empty()) {
+    if (ctxs.empty() && !it->second.canceled_) {
         TAG_LOGW(AceLogTag::ACE_IMAGE, "registered task has empty context %{public}s", key.c_str());
     }
     tasks_.erase(it);
     return ctxs;
 }
 
+bool ImageProvider::AbortIfCanceled(const std::string& key)
+{
+    std::scoped_lock<std::mutex> lock(taskMtx_);
+    auto it = tasks_.find(key);
+    if (it == tasks_.end() || !it->second.canceled_) {
+        return false;
+    }
+    tasks_.erase(it);
+    return true;
+}
+
 void ImageProvider::CancelTask(const std::string& key, const WeakPtr<ImageLoadingContext>& ctx)
 {
     std::scoped_lock<std::mutex> lock(taskMtx_);
     auto it = tasks_.find(key);
     CHECK_NULL_VOID(it != tasks_.end());
-    CHECK_NULL_VOID(it->second.ctxs_.find(ctx) != it->second.ctxs_.end());
-    // only one LoadingContext waiting for this task, can just cancel
-    if (it->second.ctxs_.size() == 1) {
-        bool canceled = it->second.bgTask_.Cancel();
-        if (canceled) {
+    auto& task = it->second;
+    CHECK_NULL_VOID(task.ctxs_.find(ctx) != task.ctxs_.end());
+    // other LoadingContext still waiting for this task, remove ctx from set
+    task.ctxs_.erase(ctx);
+    if (!task.ctxs_.empty()) {
+        return;
+    }
+    if (task.pending_) {
+        // not started yet, can just drop it
+        GetPendingTasks(task.network_)[static_cast<size_t>(task.priority_)].erase(task.pendingPos_);
+        tasks_.erase(it);
+        return;
+    }
+    task.canceled_ = task.running_;
+}
+
+void ImageProvider::UpdateTaskPriority(const std::string& key)
+{
+    std::set<WeakPtr<ImageLoadingContext>> ctxs;
+    {
+        std::scoped_lock<std::mutex> lock(taskMtx_);
+        auto it = tasks_.find(key);
+        CHECK_NULL_VOID(it != tasks_.end() && it->second.pending_);
+        ctxs = it->second.ctxs_;
+    }
+    // a task shared by several LoadingContexts runs with the highest priority among them. Upgrade ctxs without the
+    // lock, releasing the last reference of a ctx cancels its task.
+    auto priority = ImageLoadPriority::COUNT;
+    for (const auto& ctxWp : ctxs) {
+        auto ctx = ctxWp.Upgrade();
+        if (ctx && ctx->GetLoadPriority() < priority) {
+            priority = ctx->GetLoadPriority();
+        }
+    }
+    CHECK_NULL_VOID(priority != ImageLoadPriority::COUNT);
+    std::scoped_lock<std::mutex> lock(taskMtx_);
+    auto it = tasks_.find(key);
+    CHECK_NULL_VOID(it != tasks_.end());
+    auto& task = it->second;
+    if (!task.pending_ || task.priority_ == priority) {
+        return;
+    }
+    auto& pendingTasks = GetPendingTasks(task.network_);
+    auto& from = pendingTasks[static_cast<size_t>(task.priority_)];
+    auto& to = pendingTasks[static_cast<size_t>(priority)];
+    to.splice(to.end(), from, task.pendingPos_);
+    task.priority_ = priority;
+}
+
+void ImageProvider::ScheduleTask(
+    const std::string& key, const WeakPtr<ImageLoadingContext>& ctxWp, std::function<void()>&& task, bool network)
+{
+    auto ctx = ctxWp.Upgrade();
+    {
+        std::scoped_lock<std::mutex> lock(taskMtx_);
+        auto it = tasks_.find(key);
+        CHECK_NULL_VOID(it != tasks_.end());
+        auto& info = it->second;
+        if (!ctx) {
             tasks_.erase(it);
             return;
         }
+        info.bgTask_ = std::move(task);
+        info.priority_ = ctx->GetLoadPriority();
+        info.containerId_ = ctx->GetContainerId();
+        info.network_ = network;
+        auto& pending = GetPendingTasks(network)[static_cast<size_t>(info.priority_)];
+        info.pendingPos_ = pending.insert(pending.end(), key);
+        info.pending_ = true;
+    }
+    PostPendingTasks();
+}
+
+void ImageProvider::PostPendingTasks()
+{
+    std::vector<ReadyTask> readyTasks;
+    {
+        std::scoped_lock<std::mutex> lock(taskMtx_);
+        TakeReadyTasks(false, readyTasks);
+        TakeReadyTasks(true, readyTasks);
+    }
+    for (auto& [key, task, priority, network, containerId] : readyTasks) {
+        auto posted = ImageUtils::PostToBg(
+            [task = std::move(task), priority = priority, network = network] {
+                task();
+                ImageProvider::OnTaskFinished(priority, network);
+            },
+            "ArkUIImageProviderLoadTask", containerId);
+        if (!posted) {
+            // free the slot and drop the task, so a later load of the same key is not merged into it
+            std::scoped_lock<std::mutex> lock(taskMtx_);
+            --GetRunningTasks(network)[static_cast<size_t>(priority)];
+            auto it = tasks_.find(key);
+            if (it != tasks_.end() && it->second.running_) {
+                tasks_.erase(it);
+            }
+        }
+    }
+}
+
+void ImageProvider::TakeReadyTasks(bool network, std::vector<ReadyTask>& readyTasks)
+{
+    auto& pendingTasks = GetPendingTasks(network);
+    auto& runningTasks = GetRunningTasks(network);
+    const auto& maxRunningTasks = network ? MAX_RUNNING_NETWORK_TASKS : MAX_RUNNING_TASKS;
+    for (size_t priority = 0; priority < PRIORITY_COUNT; ++priority) {
+        auto& pending = pendingTasks[priority];
+        while (!pending.empty() && runningTasks[priority] < maxRunningTasks[priority]) {
+            auto it = tasks_.find(pending.front());
+            pending.pop_front();
+            if (it == tasks_.end()) {
+                continue;
+            }
+            auto& task = it->second;
+            task.pending_ = false;
+            task.running_ = true;
+            ++runningTasks[priority];
+            readyTasks.emplace_back(it->first, std::move(task.bgTask_), task.priority_, network, task.containerId_);
+            task.bgTask_ = nullptr;
+        }
     }
-    // other LoadingContext still waiting for this task, remove ctx from set
-    it->second.ctxs_.erase(ctx);
+}
+
+void ImageProvider::OnTaskFinished(ImageLoadPriority priority, bool network)
+{
+    {
+        std::scoped_lock<std::mutex> lock(taskMtx_);
+        --GetRunningTasks(network)[static_cast<size_t>(priority)];
+    }
+    PostPendingTasks();
 }
 
 void ImageProvider::CreateImageObject(const ImageSourceInfo& src, const WeakPtr<ImageLoadingContext>& ctxWp, bool sync)
@@ -268,14 +419,8 @@ void ImageProvider::CreateImageObject(const ImageSourceInfo& src, const WeakPtr<
     if (sync) {
         CreateImageObjHelper(src, true);
     } else {
-        std::scoped_lock<std::mutex> lock(taskMtx_);
-        // wrap with [CancelableCallback] and record in [tasks_] map
-        CancelableCallback<void()> task;
-        task.Reset([src, ctxWp] { ImageProvider::CreateImageObjHelper(src); });
-        tasks_[src.GetKey()].bgTask_ = task;
-        auto ctx = ctxWp.Upgrade();
-        CHECK_NULL_VOID(ctx);
-        ImageUtils::PostToBg(task, "ArkUIImageProviderCreateImageObject", ctx->GetContainerId());
+        ScheduleTask(src.GetKey(), ctxWp, [src] { ImageProvider::CreateImageObjHelper(src); },
+            src.GetSrcType() == SrcType::NETWORK);
     }
 }
 
@@ -328,22 +473,19 @@ void ImageProvider::MakeCanvasImage(const RefPtr<ImageObject>& obj, const WeakPt
     if (imageDecoderOptions.sync) {
         MakeCanvasImageHelper(obj, size, key, imageDecoderOptions);
     } else {
-        std::scoped_lock<std::mutex> lock(taskMtx_);
-        // wrap with [CancelableCallback] and record in [tasks_] map
-        CancelableCallback<void()> task;
-        task.Reset([key, obj, size, imageDecoderOptions] {
+        ScheduleTask(key, ctxWp, [key, obj, size, imageDecoderOptions] {
             MakeCanvasImageHelper(obj, size, key, imageDecoderOptions);
         });
-        tasks_[key].bgTask_ = task;
-        auto ctx = ctxWp.Upgrade();
-        CHECK_NULL_VOID(ctx);
-        ImageUtils::PostToBg(task, "ArkUIImageProviderMakeCanvasImage", ctx->GetContainerId());
     }
 }
 
 void ImageProvider::MakeCanvasImageHelper(const RefPtr<ImageObject>& obj, const SizeF& size, const std::string& key,
     const ImageDecoderOptions& imageDecoderOptions)
 {
+    // skip decoding images nobody waits for anymore, e.g. list items recycled during a fast scroll
+    if (!imageDecoderOptions.sync && AbortIfCanceled(key)) {
+        return;
+    }
     ImageDecoder decoder(obj, size, imageDecoderOptions.forceResize);
     RefPtr<CanvasImage> image;
     if (SystemProperties::GetImageFrameworkEnabled()) {
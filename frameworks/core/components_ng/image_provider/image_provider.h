@@ -16,9 +16,15 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_IMAGE_PROVIDER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_IMAGE_PROVIDER_IMAGE_PROVIDER_H
 
+#include <array>
+#include <cstdint>
 #include <functional>
+#include <list>
 #include <set>
+#include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 #include "base/thread/cancelable_callback.h"
 #include "core/components_ng/image_provider/image_data.h"
@@ -55,6 +61,15 @@ struct ImageDecoderOptions {
     bool isHdrDecoderNeed = false;
 };
 
+// Order in which background load tasks start: images on screen first, then images built ahead of being shown, then
+// images scrolled out of the screen.
+enum class ImageLoadPriority : int32_t {
+    ONSCREEN = 0,
+    PREFETCH,
+    OFFSCREEN,
+    COUNT,
+};
+
 class ImageObject;
 
 // load & decode images
@@ -93,9 +108,13 @@ public:
     // Query imageObj from cache, if hit, notify dataReady and returns true
     static RefPtr<ImageObject> QueryImageObjectFromCache(const ImageSourceInfo& src);
 
-    // cancel a scheduled background task
+    // cancel a scheduled background task. A task that already started stops at its next check once no
+    // LoadingContext waits for it.
     static void CancelTask(const std::string& key, const WeakPtr<ImageLoadingContext>& ctx);
 
+    // reorder a pending background task after the load priority of a LoadingContext waiting for it changed
+    static void UpdateTaskPriority(const std::string& key);
+
     static RefPtr<ImageObject> BuildImageObject(const ImageSourceInfo& src, const RefPtr<ImageData>& data);
 
     static void CacheImageObject(const RefPtr<ImageObject>& obj);
@@ -114,6 +133,22 @@ private:
     // mark a task as finished, erase from map and retrieve corresponding ctxs
     static std::set<WeakPtr<ImageLoadingContext>> EndTask(const std::string& key);
 
+    // erase a canceled task from map, returns true if the task should stop
+    static bool AbortIfCanceled(const std::string& key);
+
+    // queue a background task by the priority of ctx, it is posted when a slot of its priority is free. Network
+    // loads queue for the slots of network loads.
+    static void ScheduleTask(const std::string& key, const WeakPtr<ImageLoadingContext>& ctxWp,
+        std::function<void()>&& task, bool network = false);
+
+    // post pending tasks from the highest priority while their priority has free slots
+    static void PostPendingTasks();
+    // key, task, priority, whether it is a network load and container id of a task taken from the queue
+    using ReadyTask = std::tuple<std::string, std::function<void()>, ImageLoadPriority, bool, int32_t>;
+    // move pending tasks into readyTasks while their priority has free slots, called with taskMtx_ held
+    static void TakeReadyTasks(bool network, std::vector<ReadyTask>& readyTasks);
+    static void OnTaskFinished(ImageLoadPriority priority, bool network);
+
     static RefPtr<ImageObject> QueryThumbnailCache(const ImageSourceInfo& src);
 
     // helper function to create image object from ImageSourceInfo
@@ -128,12 +163,37 @@ private:
     static void FailCallback(const std::string& key, const std::string& errorMsg, bool sync = false);
 
     struct Task {
-        CancelableCallback<void()> bgTask_;
+        std::function<void()> bgTask_;
         std::set<WeakPtr<ImageLoadingContext>> ctxs_;
+        ImageLoadPriority priority_ = ImageLoadPriority::ONSCREEN;
+        int32_t containerId_ = -1;
+        // position in pendingTasks_ of priority_, valid while the task is pending
+        std::list<std::string>::iterator pendingPos_;
+        bool pending_ = false;
+        bool running_ = false;
+        // set when the last LoadingContext cancels a running task
+        bool canceled_ = false;
+        // queued for the slots of network loads
+        bool network_ = false;
     };
 
     static std::mutex taskMtx_;
     static std::unordered_map<std::string, Task> tasks_;
+    static constexpr size_t PRIORITY_COUNT = static_cast<size_t>(ImageLoadPriority::COUNT);
+    static std::array<std::list<std::string>, PRIORITY_COUNT> pendingTasks_;
+    static std::array<int32_t, PRIORITY_COUNT> runningTasks_;
+    static std::array<std::list<std::string>, PRIORITY_COUNT> networkPendingTasks_;
+    static std::array<int32_t, PRIORITY_COUNT> networkRunningTasks_;
+
+    static std::array<std::list<std::string>, PRIORITY_COUNT>& GetPendingTasks(bool network)
+    {
+        return network ? networkPendingTasks_ : pendingTasks_;
+    }
+
+    static std::array<int32_t, PRIORITY_COUNT>& GetRunningTasks(bool network)
+    {
+        return network ? networkRunningTasks_ : runningTasks_;
+    }
 };
 
 } // namespace OHOS::Ace::NG
@@ -17,15 +17,15 @@
 #include "core/common/container_scope.h"
 
 namespace OHOS::Ace::NG {
-void ImageUtils::PostTask(
+bool ImageUtils::PostTask(
     std::function<void()>&& task, TaskExecutor::TaskType taskType, const char* taskTypeName, PriorityType priorityType)
 {
     auto taskExecutor = Container::CurrentTaskExecutorSafelyWithCheck();
     if (!taskExecutor) {
         LOGE("taskExecutor is null when try post task to %{public}s", taskTypeName);
-        return;
+        return false;
     }
-    taskExecutor->PostTask(
+    return taskExecutor->PostTask(
         [task, id = Container::CurrentId()] {
             ContainerScope scope(id);
             CHECK_NULL_VOID(task);
@@ -43,12 +43,12 @@ void ImageUtils::PostToUI(
     ImageUtils::PostTask(std::move(task), TaskExecutor::TaskType::UI, name.c_str(), priorityType);
 }
 
-void ImageUtils::PostToBg(
+bool ImageUtils::PostToBg(
     std::function<void()>&& task, const std::string& name, const int32_t containerId, PriorityType priorityType)
 {
     ContainerScope scope(containerId);
 
-    CHECK_NULL_VOID(task);
-    ImageUtils::PostTask(std::move(task), TaskExecutor::TaskType::BACKGROUND, name.c_str(), priorityType);
+    CHECK_NULL_RETURN(task, false);
+    return ImageUtils::PostTask(std::move(task), TaskExecutor::TaskType::BACKGROUND, name.c_str(), priorityType);
 }
 } // namespace OHOS::Ace::NG
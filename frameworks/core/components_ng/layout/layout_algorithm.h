@@ -113,6 +113,14 @@ public:
         layoutAlgorithm_->Layout(layoutWrapper);
     }
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        if (!layoutAlgorithm_) {
+            return MAIN_TASK;
+        }
+        return layoutAlgorithm_->CanRunOnWhichThread();
+    }
+
     void SetSkipMeasure()
     {
         skipMeasure_ = true;
@@ -121,9 +121,9 @@ private:
         return MallocFlags(size, MALLOC_THROW);
     }
 
-    static inline void* ReallocThrow(void*addr, size_t size)
+    static inline void* ReallocThrow(void* addr, size_t size)
     {
-        return nullptr;
+        return ThrowOnFailure(size, std::realloc(addr, size));
     }
 
     template <typename V, V* P>
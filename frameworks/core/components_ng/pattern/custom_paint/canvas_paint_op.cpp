@@ -378,6 +378,7 @@ void CanvasPaintOp::Reset()
 {
     Map(DTOR_FBS);
     fUsed = 0;
+    ResetStateOps();
 }
 
 template <typename Fn, typename... Args>
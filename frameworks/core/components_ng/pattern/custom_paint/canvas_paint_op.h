@@ -16,9 +16,15 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_CUSTOM_PAINT_CANVAS_PAINT_OP_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_CUSTOM_PAINT_CANVAS_PAINT_OP_H
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <optional>
+#include <type_traits>
 
+#include "base/utils/utils.h"
 #include "core/components/common/properties/paint_state.h"
 #include "core/components_ng/pattern/custom_paint/canvas_paint_mem.h"
 
@@ -44,6 +50,49 @@ struct Op {
 };
 static_assert(sizeof(Op) == 4, "size of canvas op shoule be 4");
 
+// The paint states set by the state ops. Ops setting the same state override each other until a restore, so
+// CanvasPaintOp folds the ones which do not change the state when recording.
+enum class StateSlot : uint8_t {
+    NONE = 0,
+    ALPHA,
+    ANTI_ALIAS,
+    COMPOSITE_TYPE,
+    FILL_RULE_FOR_PATH,
+    FILL_RULE_FOR_PATH_2D,
+    FILL_STYLE,
+    FILTER_PARAM,
+    FONT_SIZE,
+    FONT_STYLE,
+    FONT_WEIGHT,
+    LINE_CAP,
+    LINE_DASH,
+    LINE_DASH_OFFSET,
+    LINE_JOIN,
+    LINE_WIDTH,
+    MITER_LIMIT,
+    SHADOW_BLUR,
+    SHADOW_COLOR,
+    SHADOW_OFFSET_X,
+    SHADOW_OFFSET_Y,
+    SMOOTHING_ENABLED,
+    SMOOTHING_QUALITY,
+    STROKE_STYLE,
+    TEXT_ALIGN,
+    TEXT_BASELINE,
+    TEXT_DIRECTION,
+    COUNT,
+};
+
+template <typename T, typename = void>
+struct StateSlotOf {
+    static constexpr StateSlot value = StateSlot::NONE;
+};
+
+template <typename T>
+struct StateSlotOf<T, std::void_t<decltype(T::kSlot)>> {
+    static constexpr StateSlot value = T::kSlot;
+};
+
 struct SaveOp final : Op {
     static constexpr auto kType = Type::SaveOp;
     void Draw(CanvasPaintMethod* method) const;
@@ -87,43 +136,74 @@ struct SetTransformOp final : Op {
 
 struct SetFillColorOp final : Op {
     static constexpr auto kType = Type::SetFillColorOp;
+    static constexpr auto kSlot = StateSlot::FILL_STYLE;
     explicit SetFillColorOp(const Color& color): color(std::move(color)) {}
     Color color;
+    bool IsSame(const SetFillColorOp& other) const
+    {
+        return color == other.color;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetFillGradientOp final : Op {
     static constexpr auto kType = Type::SetFillGradientOp;
+    static constexpr auto kSlot = StateSlot::FILL_STYLE;
     explicit SetFillGradientOp(const std::shared_ptr<Ace::Gradient>& gradient): gradient(gradient) {}
     std::weak_ptr<Ace::Gradient> gradient;
+    // the gradient or pattern may have changed since it was set.
+    bool IsSame(const SetFillGradientOp& other) const
+    {
+        return false;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetFillPatternNGOp final : Op {
     static constexpr auto kType = Type::SetFillPatternNGOp;
+    static constexpr auto kSlot = StateSlot::FILL_STYLE;
     explicit SetFillPatternNGOp(const std::weak_ptr<Ace::Pattern>& pattern): pattern(pattern) {}
     std::weak_ptr<Ace::Pattern> pattern;
+    bool IsSame(const SetFillPatternNGOp& other) const
+    {
+        return false;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetAlphaOp final : Op {
     static constexpr auto kType = Type::SetAlphaOp;
+    static constexpr auto kSlot = StateSlot::ALPHA;
     explicit SetAlphaOp(double alpha): alpha(alpha) {}
     double alpha;
+    bool IsSame(const SetAlphaOp& other) const
+    {
+        return NearEqual(alpha, other.alpha);
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetFillRuleForPathOp final : Op {
     static constexpr auto kType = Type::SetFillRuleForPathOp;
+    static constexpr auto kSlot = StateSlot::FILL_RULE_FOR_PATH;
     explicit SetFillRuleForPathOp(const CanvasFillRule& rule): rule(std::move(rule)) {}
     CanvasFillRule rule;
+    bool IsSame(const SetFillRuleForPathOp& other) const
+    {
+        return rule == other.rule;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetFillRuleForPath2DOp final : Op {
     static constexpr auto kType = Type::SetFillRuleForPath2DOp;
+    static constexpr auto kSlot = StateSlot::FILL_RULE_FOR_PATH_2D;
     explicit SetFillRuleForPath2DOp(const CanvasFillRule& rule): rule(rule) {}
     CanvasFillRule rule;
+    bool IsSame(const SetFillRuleForPath2DOp& other) const
+    {
+        return rule == other.rule;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
@@ -153,8 +233,13 @@ struct BeginPathOp final : Op {
 
 struct SetFilterParamOp : Op {
     static constexpr auto kType = Type::SetFilterParamOp;
+    static constexpr auto kSlot = StateSlot::FILTER_PARAM;
     explicit SetFilterParamOp(const std::string& filterStr): filterStr(std::move(filterStr)) {}
     std::string filterStr;
+    bool IsSame(const SetFilterParamOp& other) const
+    {
+        return filterStr == other.filterStr;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
@@ -172,22 +257,37 @@ struct ClearRectOp final : Op {
 
 struct SetStrokeColorOp final : Op {
     static constexpr auto kType = Type::SetStrokeColorOp;
+    static constexpr auto kSlot = StateSlot::STROKE_STYLE;
     explicit SetStrokeColorOp(const Color& color): color(std::move(color)) {}
     Color color;
+    bool IsSame(const SetStrokeColorOp& other) const
+    {
+        return color == other.color;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetStrokeGradientOp final : Op {
     static constexpr auto kType = Type::SetStrokeGradientOp;
+    static constexpr auto kSlot = StateSlot::STROKE_STYLE;
     explicit SetStrokeGradientOp(const std::shared_ptr<Ace::Gradient>& gradient): gradient(gradient) {}
     std::weak_ptr<Ace::Gradient> gradient;
+    bool IsSame(const SetStrokeGradientOp& other) const
+    {
+        return false;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetStrokePatternNGOp final : Op {
     static constexpr auto kType = Type::SetStrokePatternNGOp;
+    static constexpr auto kSlot = StateSlot::STROKE_STYLE;
     explicit SetStrokePatternNGOp(const std::weak_ptr<Ace::Pattern>& pattern): pattern(pattern) {}
     std::weak_ptr<Ace::Pattern> pattern;
+    bool IsSame(const SetStrokePatternNGOp& other) const
+    {
+        return false;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
@@ -200,28 +300,48 @@ struct LineToOp final : Op {
 
 struct SetLineJoinOp final : Op {
     static constexpr auto kType = Type::SetLineJoinOp;
+    static constexpr auto kSlot = StateSlot::LINE_JOIN;
     explicit SetLineJoinOp(LineJoinStyle style): style(std::move(style)) {}
     LineJoinStyle style;
+    bool IsSame(const SetLineJoinOp& other) const
+    {
+        return style == other.style;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetLineCapOp final : Op {
     static constexpr auto kType = Type::SetLineCapOp;
+    static constexpr auto kSlot = StateSlot::LINE_CAP;
     explicit SetLineCapOp(LineCapStyle style): style(std::move(style)) {}
     LineCapStyle style;
+    bool IsSame(const SetLineCapOp& other) const
+    {
+        return style == other.style;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 struct SetLineWidthOp final : Op {
     static constexpr auto kType = Type::SetLineWidthOp;
+    static constexpr auto kSlot = StateSlot::LINE_WIDTH;
     explicit SetLineWidthOp(double width): width(width) {}
     double width;
+    bool IsSame(const SetLineWidthOp& other) const
+    {
+        return NearEqual(width, other.width);
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetMiterLimitOp final : Op {
     static constexpr auto kType = Type::SetMiterLimitOp;
+    static constexpr auto kSlot = StateSlot::MITER_LIMIT;
     explicit SetMiterLimitOp(double limit): limit(limit) {}
     double limit;
+    bool IsSame(const SetMiterLimitOp& other) const
+    {
+        return NearEqual(limit, other.limit);
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
@@ -239,8 +359,13 @@ struct Stroke2DOp final : Op {
 
 struct SetCompositeTypeOp final : Op {
     static constexpr auto kType = Type::SetCompositeTypeOp;
+    static constexpr auto kSlot = StateSlot::COMPOSITE_TYPE;
     explicit SetCompositeTypeOp(CompositeOperation operation): operation(std::move(operation)) {}
     CompositeOperation operation;
+    bool IsSame(const SetCompositeTypeOp& other) const
+    {
+        return operation == other.operation;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
@@ -347,106 +472,181 @@ struct RestoreLayerOp final : Op {
 
 struct SetAntiAliasOp final : Op {
     static constexpr auto kType = Type::SetAntiAliasOp;
+    static constexpr auto kSlot = StateSlot::ANTI_ALIAS;
     explicit SetAntiAliasOp(bool isEnabled): isEnabled(isEnabled) {}
     bool isEnabled;
+    bool IsSame(const SetAntiAliasOp& other) const
+    {
+        return isEnabled == other.isEnabled;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetTextDirectionOp final : Op {
     static constexpr auto kType = Type::SetTextDirectionOp;
+    static constexpr auto kSlot = StateSlot::TEXT_DIRECTION;
     explicit SetTextDirectionOp(TextDirection direction): direction(std::move(direction)) {}
     TextDirection direction;
+    bool IsSame(const SetTextDirectionOp& other) const
+    {
+        return direction == other.direction;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetLineDashOffsetOp final : Op {
     static constexpr auto kType = Type::SetLineDashOffsetOp;
+    static constexpr auto kSlot = StateSlot::LINE_DASH_OFFSET;
     explicit SetLineDashOffsetOp(double offset): offset(offset) {}
     double offset;
+    bool IsSame(const SetLineDashOffsetOp& other) const
+    {
+        return NearEqual(offset, other.offset);
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetLineDashOp final : Op {
     static constexpr auto kType = Type::SetLineDashOp;
+    static constexpr auto kSlot = StateSlot::LINE_DASH;
     explicit SetLineDashOp(const std::vector<double>& segments): segments(std::move(segments)) {}
     std::vector<double> segments;
+    bool IsSame(const SetLineDashOp& other) const
+    {
+        return segments == other.segments;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetTextAlignOp final : Op {
     static constexpr auto kType = Type::SetTextAlignOp;
+    static constexpr auto kSlot = StateSlot::TEXT_ALIGN;
     explicit SetTextAlignOp(TextAlign align): align(std::move(align)) {}
     TextAlign align;
+    bool IsSame(const SetTextAlignOp& other) const
+    {
+        return align == other.align;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetTextBaselineOp final : Op {
     static constexpr auto kType = Type::SetTextBaselineOp;
+    static constexpr auto kSlot = StateSlot::TEXT_BASELINE;
     explicit SetTextBaselineOp(TextBaseline baseline): baseline(std::move(baseline)) {}
     TextBaseline baseline;
+    bool IsSame(const SetTextBaselineOp& other) const
+    {
+        return baseline == other.baseline;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetShadowColorOp final : Op {
     static constexpr auto kType = Type::SetShadowColorOp;
+    static constexpr auto kSlot = StateSlot::SHADOW_COLOR;
     explicit SetShadowColorOp(const Color& color): color(std::move(color)) {}
     Color color;
+    bool IsSame(const SetShadowColorOp& other) const
+    {
+        return color == other.color;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetShadowBlurOp final : Op {
     static constexpr auto kType = Type::SetShadowBlurOp;
+    static constexpr auto kSlot = StateSlot::SHADOW_BLUR;
     explicit SetShadowBlurOp(double blur): blur(blur) {}
     double blur;
+    bool IsSame(const SetShadowBlurOp& other) const
+    {
+        return NearEqual(blur, other.blur);
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetShadowOffsetXOp final : Op {
     static constexpr auto kType = Type::SetShadowOffsetXOp;
+    static constexpr auto kSlot = StateSlot::SHADOW_OFFSET_X;
     explicit SetShadowOffsetXOp(double x): x(x) {}
     double x;
+    bool IsSame(const SetShadowOffsetXOp& other) const
+    {
+        return NearEqual(x, other.x);
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetShadowOffsetYOp final : Op {
     static constexpr auto kType = Type::SetShadowOffsetYOp;
+    static constexpr auto kSlot = StateSlot::SHADOW_OFFSET_Y;
     explicit SetShadowOffsetYOp(double y): y(y) {}
     double y;
+    bool IsSame(const SetShadowOffsetYOp& other) const
+    {
+        return NearEqual(y, other.y);
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetSmoothingEnabledOp final : Op {
     static constexpr auto kType = Type::SetSmoothingEnabledOp;
+    static constexpr auto kSlot = StateSlot::SMOOTHING_ENABLED;
     explicit SetSmoothingEnabledOp(bool enabled): enabled(enabled) {}
     bool enabled;
+    bool IsSame(const SetSmoothingEnabledOp& other) const
+    {
+        return enabled == other.enabled;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetSmoothingQualityOp final : Op {
     static constexpr auto kType = Type::SetSmoothingQualityOp;
+    static constexpr auto kSlot = StateSlot::SMOOTHING_QUALITY;
     explicit SetSmoothingQualityOp(const std::string& quality): quality(std::move(quality)) {}
     std::string quality;
+    bool IsSame(const SetSmoothingQualityOp& other) const
+    {
+        return quality == other.quality;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetFontSizeOp final : Op {
     static constexpr auto kType = Type::SetFontSizeOp;
+    static constexpr auto kSlot = StateSlot::FONT_SIZE;
     explicit SetFontSizeOp(const Dimension& size): size(std::move(size)) {}
     Dimension size;
+    bool IsSame(const SetFontSizeOp& other) const
+    {
+        return size == other.size;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetFontStyleOp final : Op {
     static constexpr auto kType = Type::SetFontStyleOp;
+    static constexpr auto kSlot = StateSlot::FONT_STYLE;
     explicit SetFontStyleOp(OHOS::Ace::FontStyle style): style(std::move(style)) {}
     OHOS::Ace::FontStyle style;
+    bool IsSame(const SetFontStyleOp& other) const
+    {
+        return style == other.style;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
 struct SetFontWeightOp final : Op {
     static constexpr auto kType = Type::SetFontWeightOp;
+    static constexpr auto kSlot = StateSlot::FONT_WEIGHT;
     explicit SetFontWeightOp(FontWeight weight): weight(std::move(weight)) {}
     FontWeight weight;
+    bool IsSame(const SetFontWeightOp& other) const
+    {
+        return weight == other.weight;
+    }
     void Draw(CanvasPaintMethod* method) const;
 };
 
@@ -544,7 +744,10 @@ static const VoidFn DTOR_FBS[] = {
 
 class CanvasPaintOp final {
 public:
-    CanvasPaintOp() : mHasText(false) {}
+    CanvasPaintOp() : mHasText(false)
+    {
+        ResetStateOps();
+    }
     ~CanvasPaintOp() { Reset(); }
 
     void Draw(CanvasPaintMethod* method) const;
@@ -592,18 +795,57 @@ public:
             }
         }
         ACE_DCHECK(fUsed + skip <= fReserved);
+        auto offset = fUsed;
         auto op = (T*)(fBytes.get() + fUsed);
         fUsed += skip;
         new (op) T{std::forward<Args>(args)...};
         op->type = (uint32_t)T::kType;
         op->skip = skip;
+        if constexpr (T::kType == Type::RestoreOp || T::kType == Type::ResetCanvasOp) {
+            ResetStateOps();
+        }
+        if constexpr (StateSlotOf<T>::value != StateSlot::NONE) {
+            if (pod == 0) {
+                op = FoldStateOp(op, offset);
+            }
+        }
         return op + 1;
     }
 
 private:
+    // Drops op if the last op setting its state since the last restore set the same value, or replaces that op if
+    // it is the last one recorded. Returns the op holding the state.
+    template <typename T>
+    T* FoldStateOp(T* op, size_t offset)
+    {
+        auto& lastOffset = lastStateOps_[static_cast<size_t>(T::kSlot)];
+        if (lastOffset != NO_STATE_OP) {
+            auto lastOp = (const Op*)(fBytes.get() + lastOffset);
+            if (lastOp->type == (uint32_t)T::kType) {
+                auto prev = (T*)(fBytes.get() + lastOffset);
+                if (prev->IsSame(*op) || lastOffset + prev->skip == offset) {
+                    *prev = std::move(*op);
+                    op->~T();
+                    fUsed = offset;
+                    return prev;
+                }
+            }
+        }
+        lastOffset = offset;
+        return op;
+    }
+
+    void ResetStateOps()
+    {
+        std::fill(std::begin(lastStateOps_), std::end(lastStateOps_), NO_STATE_OP);
+    }
+
     AutoTMalloc<uint8_t> fBytes;
     size_t fUsed = 0;
     size_t fReserved = 0;
+    // offsets of the last ops setting each state since the last restore.
+    static constexpr size_t NO_STATE_OP = std::numeric_limits<size_t>::max();
+    size_t lastStateOps_[static_cast<size_t>(StateSlot::COUNT)];
 
     bool mHasText : 1;
     static constexpr uint8_t SKIPSIZE = 24;
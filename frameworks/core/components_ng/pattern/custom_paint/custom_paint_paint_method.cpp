@@ -315,7 +315,8 @@ std::shared_ptr<RSImage> CustomPaintPaintMethod::GetImage(const std::string& src
     CHECK_NULL_RETURN(context, nullptr);
     auto image = Ace::ImageProvider::GetDrawingImage(src, context);
     CHECK_NULL_RETURN(image, nullptr);
-    imageCache_->CacheImage(src, std::make_shared<Ace::CachedImage>(image));
+    auto cachedImage = std::make_shared<Ace::CachedImage>(image);
+    imageCache_->CacheImage(src, cachedImage, cachedImage->GetMemorySize());
     return image;
 #else
     return nullptr;
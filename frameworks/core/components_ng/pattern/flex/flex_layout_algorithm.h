@@ -62,6 +62,12 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
+    // Only Flex itself is audited for background measure, subclasses stay on the UI thread until they opt in.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return AceType::TypeId(this) == AceType::TypeId<FlexLayoutAlgorithm>() ? BACKGROUND_TASK : MAIN_TASK;
+    }
+
     void SetLinearLayoutFeature()
     {
         isLinearLayoutFeature_ = true;
@@ -595,6 +595,10 @@ void ImagePattern::LoadImage(const ImageSourceInfo& src, const PropertyChangeFla
     if (!((propertyChangeFlag & PROPERTY_UPDATE_MEASURE) == PROPERTY_UPDATE_MEASURE)) {
         loadingCtx_->FinishMearuse();
     }
+    // an inactive node is built ahead of being shown, e.g. a cached list item
+    auto host = GetHost();
+    loadingCtx_->SetLoadPriority(
+        host && !host->IsActive() ? ImageLoadPriority::PREFETCH : ImageLoadPriority::ONSCREEN);
     loadingCtx_->LoadImageData();
 }
 
@@ -604,10 +608,23 @@ void ImagePattern::LoadAltImage(const ImageSourceInfo& altImageSourceInfo)
     if (!altLoadingCtx_ || altLoadingCtx_->GetSourceInfo() != altImageSourceInfo ||
         (altLoadingCtx_ && altImageSourceInfo.IsSvg())) {
         altLoadingCtx_ = AceType::MakeRefPtr<ImageLoadingContext>(altImageSourceInfo, std::move(altLoadNotifier));
+        if (loadingCtx_) {
+            altLoadingCtx_->SetLoadPriority(loadingCtx_->GetLoadPriority());
+        }
         altLoadingCtx_->LoadImageData();
     }
 }
 
+void ImagePattern::SetLoadPriority(ImageLoadPriority priority)
+{
+    if (loadingCtx_) {
+        loadingCtx_->SetLoadPriority(priority);
+    }
+    if (altLoadingCtx_) {
+        altLoadingCtx_->SetLoadPriority(priority);
+    }
+}
+
 void ImagePattern::LoadImageDataIfNeed()
 {
     auto imageLayoutProperty = GetLayoutProperty<ImageLayoutProperty>();
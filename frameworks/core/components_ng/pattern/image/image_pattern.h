@@ -299,10 +299,12 @@ public:
         if (status_ == Animator::Status::RUNNING) {
             animator_->Pause();
         }
+        SetLoadPriority(ImageLoadPriority::OFFSCREEN);
     }
 
     void OnActive() override
     {
+        SetLoadPriority(ImageLoadPriority::ONSCREEN);
         if (status_ == Animator::Status::RUNNING && animator_->GetStatus() != Animator::Status::RUNNING) {
             auto host = GetHost();
             CHECK_NULL_VOID(host);
@@ -447,6 +449,7 @@ private:
     void ClearImageCache();
     void LoadImage(const ImageSourceInfo& src, const PropertyChangeFlag& propertyChangeFlag);
     void LoadAltImage(const ImageSourceInfo& altImageSourceInfo);
+    void SetLoadPriority(ImageLoadPriority priority);
 
     void CreateAnalyzerOverlay();
     void UpdateAnalyzerOverlay();
@@ -36,6 +36,13 @@ public:
     }
     ~LinearLayoutAlgorithm() override = default;
 
+    // Only the plain Row and Column algorithm is audited for background measure. The picker, sheet and toolbar
+    // subclasses override Measure with pattern and pipeline state and stay on the UI thread.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return AceType::TypeId(this) == AceType::TypeId<LinearLayoutAlgorithm>() ? BACKGROUND_TASK : MAIN_TASK;
+    }
+
 private:
     ACE_DISALLOW_COPY_AND_MOVE(LinearLayoutAlgorithm);
 };
@@ -101,23 +101,37 @@ void ListPaintMethod::UpdateContentModifier(PaintWrapper* paintWrapper)
     UpdateDividerList(dividerInfo);
 }
 
-void ListPaintMethod::UpdateDividerList(const DividerInfo& dividerInfo)
+void ListPaintMethod::UpdateOnBackground()
 {
-    listContentModifier_->SetDividerPainter(
-        dividerInfo.constrainStrokeWidth, dividerInfo.isVertical, dividerInfo.color);
-    int32_t lanes = dividerInfo.lanes;
+    if (dividerPlanned_) {
+        return;
+    }
+    dividerPlanned_ = true;
+    dividerSlots_.clear();
+    CHECK_NULL_VOID(!itemPosition_.empty());
+    if (!pressedItem_.empty()) {
+        for (auto& child : itemPosition_) {
+            if (pressedItem_.find(child.second.id) != pressedItem_.end()) {
+                child.second.isPressed = true;
+            }
+        }
+    }
+    int32_t lanes = lanes_ > 1 ? lanes_ : 1;
     int32_t laneIdx = 0;
     bool lastIsItemGroup = false;
     bool isFirstItem = (itemPosition_.begin()->first == 0);
     std::map<int32_t, int32_t> lastLineIndex;
-    ListDividerMap dividerMap;
     bool nextIsPressed = false;
     for (const auto& child : itemPosition_) {
         auto nextId = child.first - lanes;
-        nextIsPressed = nextId < 0 || lastIsItemGroup || child.second.isGroup ?
-            false : itemPosition_[nextId].isPressed;
+        if (nextId < 0 || lastIsItemGroup || child.second.isGroup) {
+            nextIsPressed = false;
+        } else {
+            auto next = itemPosition_.find(nextId);
+            nextIsPressed = next != itemPosition_.end() && next->second.isPressed;
+        }
         if (!isFirstItem && !(child.second.isPressed || nextIsPressed)) {
-            dividerMap[child.second.id] = HandleDividerList(child.first, lastIsItemGroup, laneIdx, dividerInfo);
+            dividerSlots_.push_back({ child.second.id, child.first, laneIdx, lastIsItemGroup, false });
         }
         if (laneIdx == 0 || child.second.isGroup) {
             lastLineIndex.clear();
@@ -127,18 +141,33 @@ void ListPaintMethod::UpdateDividerList(const DividerInfo& dividerInfo)
         laneIdx = (lanes <= 1 || (laneIdx + 1) >= lanes || child.second.isGroup) ? 0 : laneIdx + 1;
         isFirstItem = isFirstItem ? laneIdx > 0 : false;
     }
-    if (!lastLineIndex.empty() && lastLineIndex.rbegin()->first < dividerInfo.totalItemCount - 1) {
+    if (!lastLineIndex.empty() && lastLineIndex.rbegin()->first < totalItemCount_ - 1) {
         int32_t laneIdx = 0;
         for (auto index : lastLineIndex) {
-            if (index.first + lanes >= dividerInfo.totalItemCount) {
+            if (index.first + lanes >= totalItemCount_) {
                 break;
             }
             if (!itemPosition_.at(index.first).isPressed) {
-                dividerMap[-index.second] = HandleLastLineIndex(index.first, laneIdx, dividerInfo);
+                dividerSlots_.push_back({ -index.second, index.first, laneIdx, false, true });
             }
             laneIdx++;
         }
     }
+}
+
+void ListPaintMethod::UpdateDividerList(const DividerInfo& dividerInfo)
+{
+    UpdateOnBackground();
+    listContentModifier_->SetDividerPainter(
+        dividerInfo.constrainStrokeWidth, dividerInfo.isVertical, dividerInfo.color);
+    ListDividerMap dividerMap;
+    for (const auto& slot : dividerSlots_) {
+        if (slot.isLastLine) {
+            dividerMap[slot.key] = HandleLastLineIndex(slot.index, slot.laneIdx, dividerInfo);
+        } else {
+            dividerMap[slot.key] = HandleDividerList(slot.index, slot.lastIsGroup, slot.laneIdx, dividerInfo);
+        }
+    }
     listContentModifier_->SetDividerMap(std::move(dividerMap));
 }
 
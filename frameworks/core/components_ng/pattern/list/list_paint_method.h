@@ -16,6 +16,9 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_LIST_LIST_PAINT_METHOD_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_LIST_LIST_PAINT_METHOD_H
 
+#include <set>
+#include <vector>
+
 #include "core/components_ng/pattern/list/list_content_modifier.h"
 #include "core/components_ng/pattern/scroll/inner/scroll_bar.h"
 #include "core/components_ng/pattern/scroll/scroll_edge_effect.h"
@@ -58,6 +61,14 @@ public:
 
     void UpdateContentModifier(PaintWrapper* paintWrapper) override;
 
+    // Marks the pressed items and plans which items get a divider, from the item positions alone.
+    void UpdateOnBackground() override;
+
+    TaskThread CanRunOnWhichThread() override
+    {
+        return MAIN_TASK | BACKGROUND_TASK;
+    }
+
     void UpdateDividerList(const DividerInfo& dividerInfo);
 
     ListDivider HandleDividerList(int32_t index, bool lastIsGroup, int32_t laneIdx, const DividerInfo& dividerInfo);
@@ -93,13 +104,7 @@ public:
     void SetItemsPosition(const PositionMap& positionMap, const std::set<int32_t>& pressedItem)
     {
         itemPosition_ = positionMap;
-        if (!pressedItem.empty()) {
-            for (auto& child : itemPosition_) {
-                if (pressedItem.find(child.second.id) != pressedItem.end()) {
-                    child.second.isPressed = true;
-                }
-            }
-        }
+        pressedItem_ = pressedItem;
     }
 
     void SetLaneGutter(float laneGutter)
@@ -139,6 +144,15 @@ public:
     void UpdateFadingGradient(const RefPtr<RenderContext>& listRenderContext);
 
 private:
+    // An item which gets a divider, the divider is placed once the frame size is known on the UI thread.
+    struct DividerSlot {
+        int32_t key = 0;
+        int32_t index = 0;
+        int32_t laneIdx = 0;
+        bool lastIsGroup = false;
+        bool isLastLine = false;
+    };
+
     V2::ItemDivider divider_;
     bool vertical_ = false;
     int32_t lanes_ = 1;
@@ -146,6 +160,9 @@ private:
     float space_;
     float laneGutter_ = 0.0f;
     PositionMap itemPosition_;
+    std::set<int32_t> pressedItem_;
+    std::vector<DividerSlot> dividerSlots_;
+    bool dividerPlanned_ = false;
     RefPtr<ListContentModifier> listContentModifier_;
 
     WeakPtr<ScrollBar> scrollBar_;
@@ -159,4 +176,4 @@ private:
     bool isReverse_ = false;
 };
 } // namespace OHOS::Ace::NG
-#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_LIST_LIST_PAINT_METHOD_H
\ No newline at end of file
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_LIST_LIST_PAINT_METHOD_H
\ No newline at end of file
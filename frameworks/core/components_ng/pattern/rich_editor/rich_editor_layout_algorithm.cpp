@@ -26,8 +26,9 @@
 #include "core/components_v2/inspector/inspector_constants.h"
 
 namespace OHOS::Ace::NG {
-RichEditorLayoutAlgorithm::RichEditorLayoutAlgorithm(std::list<RefPtr<SpanItem>> spans, ParagraphManager* paragraphs)
-    : pManager_(paragraphs)
+RichEditorLayoutAlgorithm::RichEditorLayoutAlgorithm(std::list<RefPtr<SpanItem>> spans, ParagraphManager* paragraphs,
+    RichEditorParagraphCache* paragraphCache)
+    : pManager_(paragraphs), paragraphCache_(paragraphCache)
 {
     allSpans_ = spans;
     // split spans into groups by \newline
@@ -183,7 +184,24 @@ bool RichEditorLayoutAlgorithm::CreateParagraph(
     CHECK_NULL_RETURN(pipeline, false);
     // default paragraph style
     auto paraStyle = GetParagraphStyle(textStyle, content, layoutWrapper);
-    return UpdateParagraphBySpan(layoutWrapper, paraStyle, maxWidth);
+    auto result = UpdateParagraphBySpan(layoutWrapper, paraStyle, maxWidth);
+    if (paragraphCache_) {
+        paragraphCache_->Commit();
+    }
+    return result;
+}
+
+RefPtr<Paragraph> RichEditorLayoutAlgorithm::GetReusableParagraph(const std::list<RefPtr<SpanItem>>& group,
+    const ParagraphStyle& paragraphStyle, const RefPtr<FrameNode>& frameNode)
+{
+    CHECK_NULL_RETURN(paragraphCache_, nullptr);
+    return paragraphCache_->Get(group, paragraphStyle, frameNode, isSpanStringMode_);
+}
+
+void RichEditorLayoutAlgorithm::OnParagraphBuilt(const RefPtr<Paragraph>& paragraph)
+{
+    CHECK_NULL_VOID(paragraphCache_);
+    paragraphCache_->Put(paragraph);
 }
 
 void RichEditorLayoutAlgorithm::UpdateRichTextRect(
@@ -16,6 +16,7 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_RICH_EDITOR_LAYOUT_ALGORITHM_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_RICH_EDITOR_LAYOUT_ALGORITHM_H
 
+#include "core/components_ng/pattern/rich_editor/rich_editor_paragraph_cache.h"
 #include "core/components_ng/pattern/text/multiple_paragraph_layout_algorithm.h"
 #include "core/components_ng/pattern/text/text_layout_algorithm.h"
 
@@ -25,7 +26,8 @@ class ACE_EXPORT RichEditorLayoutAlgorithm : public MultipleParagraphLayoutAlgor
 
 public:
     RichEditorLayoutAlgorithm() = delete;
-    RichEditorLayoutAlgorithm(std::list<RefPtr<SpanItem>> spans, ParagraphManager* paragraphs);
+    RichEditorLayoutAlgorithm(std::list<RefPtr<SpanItem>> spans, ParagraphManager* paragraphs,
+        RichEditorParagraphCache* paragraphCache = nullptr);
     ~RichEditorLayoutAlgorithm() override = default;
 
     const OffsetF& GetParentGlobalOffset() const
@@ -54,6 +56,9 @@ private:
     ParagraphStyle GetParagraphStyle(
         const TextStyle& textStyle, const std::string& content, LayoutWrapper* layoutWrapper) const override;
     float GetShadowOffset(const std::list<RefPtr<SpanItem>>& group) override;
+    RefPtr<Paragraph> GetReusableParagraph(const std::list<RefPtr<SpanItem>>& group,
+        const ParagraphStyle& paragraphStyle, const RefPtr<FrameNode>& frameNode) override;
+    void OnParagraphBuilt(const RefPtr<Paragraph>& paragraph) override;
     void UpdateRichTextRect(const SizeF& res, const float& textHeight, LayoutWrapper* layoutWrapper);
 
     void SetPlaceholder(LayoutWrapper* layoutWrapper);
@@ -68,6 +73,7 @@ private:
 
     std::list<RefPtr<SpanItem>> allSpans_;
     ParagraphManager* pManager_;
+    RichEditorParagraphCache* paragraphCache_ = nullptr;
     OffsetF parentGlobalOffset_;
     RectF richTextRect_;
     ACE_DISALLOW_COPY_AND_MOVE(RichEditorLayoutAlgorithm);
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/rich_editor/rich_editor_paragraph_cache.h"
+
+#include "base/utils/system_properties.h"
+#include "base/utils/utils.h"
+#include "core/common/font_manager.h"
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/pattern/text/text_paragraph_cache.h"
+#include "core/components_ng/pattern/text/text_pattern.h"
+#include "core/pipeline_ng/pipeline_context.h"
+
+namespace OHOS::Ace::NG {
+
+RefPtr<Paragraph> RichEditorParagraphCache::Get(const std::list<RefPtr<SpanItem>>& group,
+    const ParagraphStyle& paragraphStyle, const RefPtr<FrameNode>& frameNode, bool isSpanStringMode)
+{
+    pending_.reset();
+    CHECK_NULL_RETURN(SystemProperties::IsTextParagraphCacheEnabled(), nullptr);
+    auto key = CreateKey(group, paragraphStyle, frameNode, isSpanStringMode);
+    CHECK_NULL_RETURN(key, nullptr);
+    auto firstSpan = RawPtr(group.front());
+    auto iter = paragraphs_.find(firstSpan);
+    if (iter == paragraphs_.end() || !IsSameKey(iter->second, key.value())) {
+        pending_ = std::move(key);
+        return nullptr;
+    }
+    auto paragraph = iter->second.paragraph;
+    // the style of a span is set while adding it to a paragraph, the reused paragraph adds none of them.
+    for (const auto& snapshot : iter->second.spans) {
+        snapshot.span->SetTextStyle(snapshot.textStyle);
+    }
+    usedParagraphs_.emplace(firstSpan, std::move(iter->second));
+    paragraphs_.erase(iter);
+    return paragraph;
+}
+
+void RichEditorParagraphCache::Put(const RefPtr<Paragraph>& paragraph)
+{
+    CHECK_NULL_VOID(paragraph);
+    CHECK_NULL_VOID(pending_);
+    auto firstSpan = RawPtr(pending_->spans.front().span);
+    pending_->paragraph = paragraph;
+    usedParagraphs_.insert_or_assign(firstSpan, std::move(pending_.value()));
+    pending_.reset();
+}
+
+void RichEditorParagraphCache::Commit()
+{
+    paragraphs_ = std::move(usedParagraphs_);
+    usedParagraphs_.clear();
+    pending_.reset();
+}
+
+void RichEditorParagraphCache::Clear()
+{
+    paragraphs_.clear();
+    usedParagraphs_.clear();
+    pending_.reset();
+}
+
+std::optional<RichEditorParagraphCache::CachedParagraph> RichEditorParagraphCache::CreateKey(
+    const std::list<RefPtr<SpanItem>>& group, const ParagraphStyle& paragraphStyle,
+    const RefPtr<FrameNode>& frameNode, bool isSpanStringMode)
+{
+    CHECK_NULL_RETURN(frameNode, std::nullopt);
+    auto pattern = frameNode->GetPattern<TextPattern>();
+    CHECK_NULL_RETURN(pattern, std::nullopt);
+    if (group.empty() || (pattern->NeedShowAIDetect() && !pattern->GetAISpanMap().empty())) {
+        return std::nullopt;
+    }
+    auto pipeline = frameNode->GetContext();
+    CHECK_NULL_RETURN(pipeline, std::nullopt);
+    CachedParagraph key;
+    key.spans.reserve(group.size());
+    for (const auto& span : group) {
+        // placeholders, symbols and dragged spans are laid out with more than their style, they are not reused.
+        if (!span || AceType::InstanceOf<PlaceholderSpanItem>(span) || span->unicode != 0 || span->IsDragging()) {
+            return std::nullopt;
+        }
+        auto textStyle = span->CreateParagraphTextStyle(frameNode, isSpanStringMode);
+        if (NearZero(textStyle.GetFontSize().Value())) {
+            return std::nullopt;
+        }
+        key.spans.push_back({ span, span->content, std::move(textStyle), span->needRemoveNewLine });
+    }
+    key.paragraphStyle = paragraphStyle;
+    key.dipScale = pipeline->GetDipScale();
+    key.fontScale = pipeline->GetFontScale();
+    key.fontWeightScale = pipeline->GetFontWeightScale();
+    key.fontGeneration = FontManager::GetFontGeneration();
+    return key;
+}
+
+bool RichEditorParagraphCache::IsSameKey(const CachedParagraph& lhs, const CachedParagraph& rhs)
+{
+    if (lhs.spans.size() != rhs.spans.size() || lhs.fontGeneration != rhs.fontGeneration ||
+        !NearEqual(lhs.dipScale, rhs.dipScale) || !NearEqual(lhs.fontScale, rhs.fontScale) ||
+        !NearEqual(lhs.fontWeightScale, rhs.fontWeightScale) ||
+        !TextParagraphCache::IsSameParagraphStyle(lhs.paragraphStyle, rhs.paragraphStyle)) {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.spans.size(); ++i) {
+        const auto& left = lhs.spans[i];
+        const auto& right = rhs.spans[i];
+        if (left.span != right.span || left.needRemoveNewLine != right.needRemoveNewLine ||
+            left.content != right.content || !TextParagraphCache::IsSameTextStyle(left.textStyle, right.textStyle)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace OHOS::Ace::NG
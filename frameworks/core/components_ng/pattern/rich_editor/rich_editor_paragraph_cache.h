@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_RICH_EDITOR_PARAGRAPH_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_RICH_EDITOR_PARAGRAPH_CACHE_H
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/memory/referenced.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "core/components/common/properties/text_style.h"
+#include "core/components_ng/pattern/text/span_node.h"
+#include "core/components_ng/render/paragraph.h"
+
+namespace OHOS::Ace::NG {
+
+// Keeps the paragraphs of the last layout of a rich editor, so that an edit only shapes the paragraphs whose spans
+// changed instead of the whole document. A paragraph is reused when its spans hold the same content with the same
+// styles, only paragraphs of plain text spans are kept.
+class ACE_EXPORT RichEditorParagraphCache final {
+public:
+    RichEditorParagraphCache() = default;
+    ~RichEditorParagraphCache() = default;
+
+    // Returns the paragraph built before for the spans, or nullptr after remembering the spans for Put.
+    RefPtr<Paragraph> Get(const std::list<RefPtr<SpanItem>>& group, const ParagraphStyle& paragraphStyle,
+        const RefPtr<FrameNode>& frameNode, bool isSpanStringMode);
+    // Keeps the paragraph built for the spans of the last missed Get.
+    void Put(const RefPtr<Paragraph>& paragraph);
+    // Drops the paragraphs not used since the last commit, called after every layout.
+    void Commit();
+    void Clear();
+
+    size_t GetCount() const
+    {
+        return paragraphs_.size();
+    }
+
+private:
+    struct SpanSnapshot {
+        RefPtr<SpanItem> span;
+        std::string content;
+        TextStyle textStyle;
+        bool needRemoveNewLine = false;
+    };
+
+    struct CachedParagraph {
+        std::vector<SpanSnapshot> spans;
+        ParagraphStyle paragraphStyle;
+        double dipScale = 1.0;
+        float fontScale = 1.0f;
+        float fontWeightScale = 1.0f;
+        uint64_t fontGeneration = 0;
+        RefPtr<Paragraph> paragraph;
+    };
+
+    static std::optional<CachedParagraph> CreateKey(const std::list<RefPtr<SpanItem>>& group,
+        const ParagraphStyle& paragraphStyle, const RefPtr<FrameNode>& frameNode, bool isSpanStringMode);
+    static bool IsSameKey(const CachedParagraph& lhs, const CachedParagraph& rhs);
+
+    // keyed by the first span of the paragraph, which the cached paragraph holds so that it is not reused.
+    std::unordered_map<const SpanItem*, CachedParagraph> paragraphs_;
+    std::unordered_map<const SpanItem*, CachedParagraph> usedParagraphs_;
+    std::optional<CachedParagraph> pending_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(RichEditorParagraphCache);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_RICH_EDITOR_PARAGRAPH_CACHE_H
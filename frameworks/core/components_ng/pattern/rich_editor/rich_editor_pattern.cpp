@@ -510,6 +510,7 @@ void RichEditorPattern::BeforeCreateLayoutWrapper()
     ACE_SCOPED_TRACE("RichEditorBeforeCreateLayoutWrapper");
     if (!isSpanStringMode_) {
         TextPattern::PreCreateLayoutWrapper();
+        spanPositionIndex_.Reset();
     } else if (contentMod_) {
         contentMod_->ContentChange();
     }
@@ -1008,6 +1009,7 @@ void RichEditorPattern::RemoveEmptySpanItems()
             ++it;
         }
     }
+    spanPositionIndex_.Reset();
 }
 
 void RichEditorPattern::RemoveEmptySpanNodes()
@@ -1171,30 +1173,73 @@ SpanPositionInfo RichEditorPattern::GetSpanPositionInfo(int32_t position)
     CHECK_NULL_RETURN(!spans_.empty(), spanPositionInfo);
     position = std::clamp(position, 0, GetTextContentLength());
     // find the spanItem where the position is
-    auto it = std::find_if(spans_.begin(), spans_.end(), [position](const RefPtr<SpanItem>& spanItem) {
-        return (spanItem->position - static_cast<int32_t>(StringUtils::ToWstring(spanItem->content).length()) <=
-                   position) &&
-               (position < spanItem->position);
-    });
-    if (it != spans_.end() && (*it)->unicode != 0 && (*it)->position - caretPosition_ + moveLength_ == 1) {
-        it++;
+    int32_t spanIndex = -1;
+    if (!FindSpanIndex(position, spanIndex)) {
+        auto it = std::find_if(spans_.begin(), spans_.end(), [position](const RefPtr<SpanItem>& spanItem) {
+            return (spanItem->position - static_cast<int32_t>(StringUtils::ToWstring(spanItem->content).length()) <=
+                       position) &&
+                   (position < spanItem->position);
+        });
+        spanIndex = static_cast<int32_t>(std::distance(spans_.begin(), it));
+    }
+    auto spanItem = GetSpanItemAtIndex(spanIndex);
+    if (spanItem && spanItem->unicode != 0 && spanItem->position - caretPosition_ + moveLength_ == 1) {
+        spanItem = GetSpanItemAtIndex(++spanIndex);
         moveLength_++;
         position++;
     }
 
     // the position is at the end
-    if (it == spans_.end()) {
-        return spanPositionInfo;
-    }
+    CHECK_NULL_RETURN(spanItem, spanPositionInfo);
 
-    spanPositionInfo.spanIndex_ = std::distance(spans_.begin(), it);
-    auto contentLen = StringUtils::ToWstring((*it)->content).length();
-    spanPositionInfo.spanStart_ = (*it)->position - contentLen;
-    spanPositionInfo.spanEnd_ = (*it)->position;
+    spanPositionInfo.spanIndex_ = spanIndex;
+    auto contentLen = StringUtils::ToWstring(spanItem->content).length();
+    spanPositionInfo.spanStart_ = spanItem->position - contentLen;
+    spanPositionInfo.spanEnd_ = spanItem->position;
     spanPositionInfo.spanOffset_ = position - spanPositionInfo.spanStart_;
     return spanPositionInfo;
 }
 
+bool RichEditorPattern::FindSpanIndex(int32_t position, int32_t& spanIndex)
+{
+    if (!spanPositionIndex_.IsValid(spans_)) {
+        spanPositionIndex_.Build(spans_);
+        CHECK_NULL_RETURN(spanPositionIndex_.IsValid(spans_), false);
+    }
+    spanIndex = spanPositionIndex_.FindSpanIndex(position);
+    auto entry = spanPositionIndex_.GetEntry(spanIndex);
+    if (!entry) {
+        // only the end of the text is in no span.
+        auto lastEntry = spanPositionIndex_.GetEntry(spanPositionIndex_.GetSpanCount() - 1);
+        if (!lastEntry || position >= lastEntry->span->position) {
+            return true;
+        }
+        spanPositionIndex_.Reset();
+        return false;
+    }
+    // the ranges of the spans changed since the index was built, the caller walks the spans instead.
+    const auto& spanItem = entry->span;
+    if (spanItem->rangeStart != entry->start || spanItem->position != entry->end ||
+        spanItem->position - static_cast<int32_t>(StringUtils::ToWstring(spanItem->content).length()) !=
+            entry->start) {
+        spanPositionIndex_.Reset();
+        return false;
+    }
+    return true;
+}
+
+RefPtr<SpanItem> RichEditorPattern::GetSpanItemAtIndex(int32_t spanIndex)
+{
+    if (spanPositionIndex_.IsValid(spans_)) {
+        auto entry = spanPositionIndex_.GetEntry(spanIndex);
+        return entry ? entry->span : nullptr;
+    }
+    if (spanIndex < 0 || spanIndex >= static_cast<int32_t>(spans_.size())) {
+        return nullptr;
+    }
+    return *std::next(spans_.begin(), spanIndex);
+}
+
 void RichEditorPattern::CopyTextSpanStyle(RefPtr<SpanNode>& source, RefPtr<SpanNode>& target, bool needLeadingMargin)
 {
     CHECK_NULL_VOID(source);
@@ -1359,6 +1404,7 @@ int32_t RichEditorPattern::TextSpanSplit(int32_t position, bool needLeadingMargi
     auto spanIter = spans_.begin();
     std::advance(spanIter, spanIndex + 1);
     spans_.insert(spanIter, newSpanItem);
+    spanPositionIndex_.Reset();
 
     return spanIndex + 1;
 }
@@ -3014,9 +3060,7 @@ void RichEditorPattern::AdjustSelector(int32_t& index, HandleType handleType,  S
 
 bool RichEditorPattern::AdjustSelectorForSymbol(int32_t& index, HandleType handleType, SelectorAdjustPolicy policy)
 {
-    auto it = GetSpanIter(index);
-    CHECK_NULL_RETURN((it != spans_.end()), false);
-    auto spanItem = *it;
+    auto spanItem = GetSpanItemByPosition(index);
     CHECK_NULL_RETURN(spanItem, false);
 
     auto spanStart = spanItem->rangeStart;
@@ -3031,9 +3075,7 @@ bool RichEditorPattern::AdjustSelectorForSymbol(int32_t& index, HandleType handl
 
 bool RichEditorPattern::AdjustSelectorForEmoji(int& index, HandleType handleType, SelectorAdjustPolicy policy)
 {
-    auto it = GetSpanIter(index);
-    CHECK_NULL_RETURN((it != spans_.end()), false);
-    auto spanItem = *it;
+    auto spanItem = GetSpanItemByPosition(index);
     CHECK_NULL_RETURN(spanItem, false);
 
     int32_t emojiStartIndex;
@@ -3051,11 +3093,16 @@ bool RichEditorPattern::AdjustSelectorForEmoji(int& index, HandleType handleType
     return false;
 }
 
-std::list<RefPtr<SpanItem>>::iterator RichEditorPattern::GetSpanIter(int32_t index)
+RefPtr<SpanItem> RichEditorPattern::GetSpanItemByPosition(int32_t index)
 {
-    return std::find_if(spans_.begin(), spans_.end(), [index](const RefPtr<SpanItem>& spanItem) {
+    int32_t spanIndex = -1;
+    if (FindSpanIndex(index, spanIndex)) {
+        return GetSpanItemAtIndex(spanIndex);
+    }
+    auto it = std::find_if(spans_.begin(), spans_.end(), [index](const RefPtr<SpanItem>& spanItem) {
         return spanItem->rangeStart <= index && index < spanItem->position;
     });
+    return (it == spans_.end()) ? nullptr : *it;
 }
 
 PositionWithAffinity RichEditorPattern::GetGlyphPositionAtCoordinate(int32_t x, int32_t y)
@@ -5746,6 +5793,7 @@ void RichEditorPattern::RemoveEmptySpan(std::set<int32_t, std::greater<int32_t>>
             spans_.erase(it);
         }
     }
+    spanPositionIndex_.Reset();
 }
 
 RefPtr<GestureEventHub> RichEditorPattern::GetGestureEventHub() {
@@ -41,9 +41,11 @@
 #include "core/components_ng/pattern/rich_editor/rich_editor_layout_property.h"
 #include "core/components_ng/pattern/rich_editor/rich_editor_overlay_modifier.h"
 #include "core/components_ng/pattern/rich_editor/rich_editor_paint_method.h"
+#include "core/components_ng/pattern/rich_editor/rich_editor_paragraph_cache.h"
 #include "core/components_ng/pattern/rich_editor/rich_editor_select_overlay.h"
 #include "core/components_ng/pattern/rich_editor/rich_editor_styled_string_controller.h"
 #include "core/components_ng/pattern/rich_editor/selection_info.h"
+#include "core/components_ng/pattern/rich_editor/span_position_index.h"
 #include "core/components_ng/pattern/scrollable/scrollable_pattern.h"
 #include "core/components_ng/pattern/text_field/text_field_model.h"
 #include "core/components_ng/pattern/select_overlay/magnifier.h"
@@ -225,7 +227,7 @@ public:
 
     RefPtr<LayoutAlgorithm> CreateLayoutAlgorithm() override
     {
-        return MakeRefPtr<RichEditorLayoutAlgorithm>(spans_, &paragraphs_);
+        return MakeRefPtr<RichEditorLayoutAlgorithm>(spans_, &paragraphs_, &paragraphCache_);
     }
 
     FocusPattern GetFocusPattern() const override
@@ -265,10 +267,12 @@ public:
     void UpdateSpanPosition()
     {
         uint32_t spanTextLength = 0;
+        spanPositionIndex_.Reset();
         for (auto& span : spans_) {
             span->rangeStart = static_cast<int32_t>(spanTextLength);
             spanTextLength += StringUtils::ToWstring(span->content).length();
             span->position = static_cast<int32_t>(spanTextLength);
+            spanPositionIndex_.AddSpan(span);
         }
     }
 
@@ -766,7 +770,11 @@ public:
     bool AdjustSelectorForSymbol(int32_t& index, HandleType handleType, SelectorAdjustPolicy policy);
     bool AdjustSelectorForEmoji(int32_t& index, HandleType handleType, SelectorAdjustPolicy policy);
     void UpdateSelector(int32_t start, int32_t end);
-    std::list<RefPtr<SpanItem>>::iterator GetSpanIter(int32_t index);
+    RefPtr<SpanItem> GetSpanItemByPosition(int32_t index);
+    // Finds the index in spans_ of the span containing position by spanPositionIndex_, -1 if there is none. Returns
+    // false if the index does not match the spans, for the caller to walk them instead.
+    bool FindSpanIndex(int32_t position, int32_t& spanIndex);
+    RefPtr<SpanItem> GetSpanItemAtIndex(int32_t spanIndex);
     
     void DumpAdvanceInfo() override {}
 
@@ -1096,6 +1104,8 @@ private:
 
     // still in progress
     ParagraphManager paragraphs_;
+    SpanPositionIndex spanPositionIndex_;
+    RichEditorParagraphCache paragraphCache_;
     RefPtr<Paragraph> presetParagraph_;
     std::vector<MenuOptionsParam> menuOptionItems_;
     std::vector<OperationRecord> operationRecords_;
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/rich_editor/span_position_index.h"
+
+#include <algorithm>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+
+void SpanPositionIndex::Build(const std::list<RefPtr<SpanItem>>& spans)
+{
+    Reset();
+    entries_.reserve(spans.size());
+    for (const auto& span : spans) {
+        AddSpan(span);
+    }
+}
+
+void SpanPositionIndex::AddSpan(const RefPtr<SpanItem>& span)
+{
+    if (entries_.empty()) {
+        isValid_ = true;
+    }
+    if (!span) {
+        isValid_ = false;
+        entries_.push_back({ 0, 0, span });
+        return;
+    }
+    // the binary search needs the ranges in ascending order without overlapping.
+    if (span->rangeStart > span->position || (!entries_.empty() && span->rangeStart < entries_.back().end)) {
+        isValid_ = false;
+    }
+    entries_.push_back({ span->rangeStart, span->position, span });
+}
+
+void SpanPositionIndex::Reset()
+{
+    entries_.clear();
+    isValid_ = false;
+}
+
+int32_t SpanPositionIndex::FindSpanIndex(int32_t position) const
+{
+    CHECK_NULL_RETURN(isValid_, -1);
+    // the first span ending after position is the only one that may contain it.
+    auto it = std::upper_bound(entries_.begin(), entries_.end(), position,
+        [](int32_t value, const SpanEntry& entry) { return value < entry.end; });
+    if (it == entries_.end() || it->start > position) {
+        return -1;
+    }
+    return static_cast<int32_t>(std::distance(entries_.begin(), it));
+}
+
+const SpanPositionIndex::SpanEntry* SpanPositionIndex::GetEntry(int32_t index) const
+{
+    if (index < 0 || index >= static_cast<int32_t>(entries_.size())) {
+        return nullptr;
+    }
+    return &entries_[index];
+}
+
+} // namespace OHOS::Ace::NG
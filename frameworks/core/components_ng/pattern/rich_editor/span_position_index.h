@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_SPAN_POSITION_INDEX_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_SPAN_POSITION_INDEX_H
+
+#include <cstdint>
+#include <list>
+#include <vector>
+
+#include "base/memory/referenced.h"
+#include "core/components_ng/pattern/text/span_node.h"
+
+namespace OHOS::Ace::NG {
+
+// Maps text positions to the spans of a rich editor by binary search over the span ranges, instead of walking the
+// span list. It is built from the rangeStart and position of the spans, and reset whenever the spans change.
+class ACE_EXPORT SpanPositionIndex final {
+public:
+    struct SpanEntry {
+        int32_t start = 0;
+        int32_t end = 0;
+        RefPtr<SpanItem> span;
+    };
+
+    SpanPositionIndex() = default;
+    ~SpanPositionIndex() = default;
+
+    void Build(const std::list<RefPtr<SpanItem>>& spans);
+    // Appends a span after the ones added since the last reset, for filling the index while computing the ranges.
+    void AddSpan(const RefPtr<SpanItem>& span);
+    void Reset();
+
+    // Whether the index was built from the spans as they are, the spans are only checked for their number.
+    bool IsValid(const std::list<RefPtr<SpanItem>>& spans) const
+    {
+        return isValid_ && entries_.size() == spans.size();
+    }
+
+    // Returns the index of the span whose range contains position, or -1 if there is none.
+    int32_t FindSpanIndex(int32_t position) const;
+    const SpanEntry* GetEntry(int32_t index) const;
+
+    int32_t GetSpanCount() const
+    {
+        return static_cast<int32_t>(entries_.size());
+    }
+
+private:
+    std::vector<SpanEntry> entries_;
+    bool isValid_ = false;
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_RICH_EDITOR_SPAN_POSITION_INDEX_H
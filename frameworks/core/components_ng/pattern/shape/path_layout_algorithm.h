@@ -34,6 +34,12 @@ public:
     std::optional<SizeF> MeasureContent(
         const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper) override;
 
+    // MeasureContent writes the properties of the ancestor shape into the paint property.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return MAIN_TASK;
+    }
+
 private:
     RefPtr<ShapePaintProperty> propertiesFromAncestor_;
     ACE_DISALLOW_COPY_AND_MOVE(PathLayoutAlgorithm);
@@ -26,6 +26,11 @@ public:
     ShapeLayoutAlgorithm() = default;
     ~ShapeLayoutAlgorithm() override = default;
 
+    TaskThread CanRunOnWhichThread() override
+    {
+        return BACKGROUND_TASK;
+    }
+
 private:
     ACE_DISALLOW_COPY_AND_MOVE(ShapeLayoutAlgorithm);
 };
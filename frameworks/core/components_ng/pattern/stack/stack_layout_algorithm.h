@@ -30,6 +30,12 @@ public:
 
     void Layout(LayoutWrapper* layoutWrapper) override;
 
+    // Only Stack itself is audited for background measure, subclasses stay on the UI thread until they opt in.
+    TaskThread CanRunOnWhichThread() override
+    {
+        return AceType::TypeId(this) == AceType::TypeId<StackLayoutAlgorithm>() ? BACKGROUND_TASK : MAIN_TASK;
+    }
+
 private:
     // calculate stack alignment
     static NG::OffsetF CalculateStackAlignment(
@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/text/adapt_font_size_search.h"
+
+#include <cmath>
+#include <limits>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t MAX_FONT_SIZE_COUNT = std::numeric_limits<int32_t>::max() - 1;
+
+bool IsValidLimit(float limit)
+{
+    return std::isfinite(limit) && GreatNotEqual(limit, 0.0f);
+}
+} // namespace
+
+AdaptFontSizes AdaptFontSizes::CreateStepDown(double maxFontSize, double minFontSize, double step, bool appendMin)
+{
+    AdaptFontSizes fontSizes;
+    fontSizes.maxFontSize_ = maxFontSize;
+    fontSizes.minFontSize_ = minFontSize;
+    fontSizes.step_ = step;
+    if (!GreatOrEqual(maxFontSize, minFontSize)) {
+        return fontSizes;
+    }
+    if (!GreatNotEqual(step, 0.0) || !std::isfinite(step)) {
+        fontSizes.stepCount_ = 1;
+    } else {
+        auto count = std::floor((maxFontSize - minFontSize) / step) + 1.0;
+        auto stepCount = static_cast<int32_t>(std::min(count, static_cast<double>(MAX_FONT_SIZE_COUNT)));
+        // the sizes before stepCount_ are the ones stepping down from maxFontSize keeps not below minFontSize.
+        while (stepCount < MAX_FONT_SIZE_COUNT && GreatOrEqual(maxFontSize - step * stepCount, minFontSize)) {
+            ++stepCount;
+        }
+        while (stepCount > 1 && !GreatOrEqual(maxFontSize - step * (stepCount - 1), minFontSize)) {
+            --stepCount;
+        }
+        fontSizes.stepCount_ = stepCount;
+    }
+    fontSizes.count_ = fontSizes.stepCount_;
+    if (appendMin && fontSizes.GetSize(fontSizes.stepCount_ - 1) != minFontSize) {
+        ++fontSizes.count_;
+    }
+    return fontSizes;
+}
+
+AdaptFontSizes AdaptFontSizes::CreateStepUp(double maxFontSize, double minFontSize, double step)
+{
+    AdaptFontSizes fontSizes;
+    fontSizes.maxFontSize_ = maxFontSize;
+    fontSizes.minFontSize_ = minFontSize;
+    fontSizes.step_ = step;
+    fontSizes.stepUp_ = true;
+    if (LessNotEqual(maxFontSize, minFontSize)) {
+        return fontSizes;
+    }
+    if (!GreatNotEqual(step, 0.0) || !std::isfinite(step)) {
+        fontSizes.count_ = GreatNotEqual(maxFontSize, minFontSize) ? 2 : 1;
+        fontSizes.step_ = maxFontSize - minFontSize;
+        return fontSizes;
+    }
+    auto tag = static_cast<int32_t>(
+        std::min(std::floor((maxFontSize - minFontSize) / step), static_cast<double>(MAX_FONT_SIZE_COUNT - 1)));
+    fontSizes.count_ = tag + 1 + (GreatNotEqual(maxFontSize, minFontSize + step * tag) ? 1 : 0);
+    return fontSizes;
+}
+
+double AdaptFontSizes::GetSize(int32_t index) const
+{
+    if (stepUp_) {
+        auto ascendingIndex = count_ - 1 - index;
+        return (ascendingIndex == count_ - 1) ? maxFontSize_ : (minFontSize_ + step_ * ascendingIndex);
+    }
+    return (index < stepCount_) ? (maxFontSize_ - step_ * index) : minFontSize_;
+}
+
+int32_t AdaptFontSizes::GetIndexNotAbove(double fontSize) const
+{
+    int32_t low = 0;
+    int32_t high = std::max(count_ - 1, 0);
+    while (low < high) {
+        auto mid = low + (high - low) / 2;
+        if (LessOrEqual(GetSize(mid), fontSize)) {
+            high = mid;
+        } else {
+            low = mid + 1;
+        }
+    }
+    return low;
+}
+
+double AdaptFontSizeSearch::PredictSingleLineFontSize(
+    double fontSize, const AdaptParagraphMetrics& metrics, const SizeF& maxSize)
+{
+    auto ratio = std::numeric_limits<double>::infinity();
+    auto width = std::max(metrics.maxIntrinsicWidth, metrics.longestLine);
+    if (IsValidLimit(width) && std::isfinite(maxSize.Width())) {
+        ratio = std::min(ratio, static_cast<double>(maxSize.Width()) / width);
+    }
+    if (IsValidLimit(metrics.height) && std::isfinite(maxSize.Height())) {
+        ratio = std::min(ratio, static_cast<double>(maxSize.Height()) / metrics.height);
+    }
+    return fontSize * ratio;
+}
+
+double AdaptFontSizeSearch::PredictMultiLineFontSize(
+    double fontSize, const AdaptParagraphMetrics& metrics, const SizeF& maxSize, uint32_t maxLines)
+{
+    // the text of width W at the reference size needs about W * ratio / maxWidth lines of lineHeight * ratio.
+    double ratio = 1.0;
+    auto maxWidth = static_cast<double>(maxSize.Width());
+    auto textWidth = static_cast<double>(metrics.maxIntrinsicWidth);
+    if (IsValidLimit(maxSize.Width()) && IsValidLimit(metrics.maxIntrinsicWidth) &&
+        maxLines != std::numeric_limits<uint32_t>::max() && maxLines > 0) {
+        ratio = std::min(ratio, maxLines * maxWidth / textWidth);
+    }
+    if (IsValidLimit(maxSize.Height()) && IsValidLimit(metrics.height) && metrics.lineCount > 0) {
+        auto lineHeight = static_cast<double>(metrics.height) / metrics.lineCount;
+        auto heightRatio = maxSize.Height() / lineHeight;
+        if (IsValidLimit(maxSize.Width()) && IsValidLimit(metrics.maxIntrinsicWidth) &&
+            GreatNotEqual(heightRatio * textWidth, maxWidth)) {
+            heightRatio = std::sqrt(maxSize.Height() * maxWidth / (textWidth * lineHeight));
+        }
+        ratio = std::min(ratio, heightRatio);
+    }
+    if (IsValidLimit(maxSize.Width()) && GreatNotEqual(metrics.longestLine, maxSize.Width())) {
+        ratio = std::min(ratio, maxWidth / metrics.longestLine);
+    }
+    return fontSize * ratio;
+}
+
+} // namespace OHOS::Ace::NG
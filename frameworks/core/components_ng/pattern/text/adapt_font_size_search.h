@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_ADAPT_FONT_SIZE_SEARCH_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_ADAPT_FONT_SIZE_SEARCH_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "base/geometry/ng/size_t.h"
+#include "base/utils/macros.h"
+
+namespace OHOS::Ace::NG {
+
+// The font sizes adaptive font sizing may choose, from the largest to the smallest.
+class ACE_EXPORT AdaptFontSizes final {
+public:
+    // maxFontSize, maxFontSize - step, ... while not below minFontSize. With appendMin, minFontSize follows if the
+    // steps skip it.
+    static AdaptFontSizes CreateStepDown(double maxFontSize, double minFontSize, double step, bool appendMin);
+    // minFontSize, minFontSize + step, ... below maxFontSize, then maxFontSize.
+    static AdaptFontSizes CreateStepUp(double maxFontSize, double minFontSize, double step);
+
+    int32_t GetCount() const
+    {
+        return count_;
+    }
+
+    double GetSize(int32_t index) const;
+    // Returns the index of the largest size not above fontSize, or the last index if every size is above it.
+    int32_t GetIndexNotAbove(double fontSize) const;
+
+private:
+    AdaptFontSizes() = default;
+
+    double maxFontSize_ = 0.0;
+    double minFontSize_ = 0.0;
+    double step_ = 0.0;
+    int32_t count_ = 0;
+    // sizes of step down: the first stepCount_ sizes are maxFontSize_ - step_ * index, the rest minFontSize_.
+    int32_t stepCount_ = 0;
+    bool stepUp_ = false;
+};
+
+// Metrics of a paragraph laid out at a reference font size.
+struct AdaptParagraphMetrics {
+    float longestLine = 0.0f;
+    float height = 0.0f;
+    // width of the whole text in one line.
+    float maxIntrinsicWidth = 0.0f;
+    size_t lineCount = 0;
+};
+
+// Predicts the font size that fits a constraint from one layout at a reference size, as glyph advances and line
+// heights grow about linearly with the font size, and verifies the prediction with the layouts next to it.
+class ACE_EXPORT AdaptFontSizeSearch final {
+public:
+    // Largest size at which the text still fits maxSize in one line.
+    static double PredictSingleLineFontSize(
+        double fontSize, const AdaptParagraphMetrics& metrics, const SizeF& maxSize);
+    // Largest size at which the wrapped text fits maxLines lines and maxSize.
+    static double PredictMultiLineFontSize(
+        double fontSize, const AdaptParagraphMetrics& metrics, const SizeF& maxSize, uint32_t maxLines);
+
+    // Returns the first index in [begin, end) that fits, or end if none does, for an index that fits when the
+    // indexes after it fit too. fits(index) lays out at the index and returns std::nullopt if the layout failed,
+    // which ends the search with std::nullopt. guess - 1 and guess are tried first, in this order, so a right
+    // guess costs two layouts and the last layout is the one of the result.
+    template<typename Fits>
+    static std::optional<int32_t> FindFirstFit(int32_t begin, int32_t end, int32_t guess, Fits&& fits)
+    {
+        auto low = begin;
+        auto high = end;
+        if (low >= high) {
+            return low;
+        }
+        guess = std::clamp(guess, low, high - 1);
+        if (guess > low) {
+            auto fit = fits(guess - 1);
+            if (!fit) {
+                return std::nullopt;
+            }
+            if (fit.value()) {
+                high = guess - 1;
+            } else {
+                low = guess;
+            }
+        }
+        if (low == guess && low < high) {
+            auto fit = fits(guess);
+            if (!fit) {
+                return std::nullopt;
+            }
+            if (fit.value()) {
+                high = guess;
+            } else {
+                low = guess + 1;
+            }
+        }
+        while (low < high) {
+            auto mid = low + (high - low) / 2;
+            auto fit = fits(mid);
+            if (!fit) {
+                return std::nullopt;
+            }
+            if (fit.value()) {
+                high = mid;
+            } else {
+                low = mid + 1;
+            }
+        }
+        return low;
+    }
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_ADAPT_FONT_SIZE_SEARCH_H
@@ -437,7 +437,11 @@ bool MultipleParagraphLayoutAlgorithm::UpdateParagraphBySpan(LayoutWrapper* layo
             }
             spanParagraphStyle.maxLines = std::max(maxLines, 0);
         }
-        auto&& paragraph = Paragraph::Create(spanParagraphStyle, FontCollection::Current());
+        auto paragraph = GetReusableParagraph(group, spanParagraphStyle, frameNode);
+        auto isReused = paragraph != nullptr;
+        if (!isReused) {
+            paragraph = Paragraph::Create(spanParagraphStyle, FontCollection::Current());
+        }
         CHECK_NULL_RETURN(paragraph, false);
         auto paraStart = spanTextLength;
         paragraphIndex++;
@@ -445,6 +449,13 @@ bool MultipleParagraphLayoutAlgorithm::UpdateParagraphBySpan(LayoutWrapper* layo
             if (!child) {
                 continue;
             }
+            if (isReused) {
+                // only plain text spans are reused, the paragraph already holds their text.
+                child->aiSpanMap = aiSpanMap;
+                spanTextLength += static_cast<int32_t>(StringUtils::ToWstring(child->content).length());
+                child->position = spanTextLength;
+                continue;
+            }
             auto imageSpanItem = AceType::DynamicCast<ImageSpanItem>(child);
             if (imageSpanItem) {
                 if (iterItems == children.end() || !(*iterItems)) {
@@ -483,7 +494,10 @@ bool MultipleParagraphLayoutAlgorithm::UpdateParagraphBySpan(LayoutWrapper* layo
         preParagraphsPlaceholderCount_ += currentParagraphPlaceholderCount_;
         currentParagraphPlaceholderCount_ = 0;
         shadowOffset_ += GetShadowOffset(group);
-        paragraph->Build();
+        if (!isReused) {
+            paragraph->Build();
+            OnParagraphBuilt(paragraph);
+        }
         ApplyIndent(spanParagraphStyle, paragraph, maxWidth);
         UpdateSymbolSpanEffect(frameNode, paragraph, group);
         if (paraStyle.maxLines != UINT32_MAX && !spanStringHasMaxLines_ && isSpanStringMode_) {
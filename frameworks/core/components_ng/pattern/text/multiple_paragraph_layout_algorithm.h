@@ -100,6 +100,13 @@ private:
     {
         return 0.0f;
     }
+    // a paragraph built in an earlier layout for the same spans, so that unchanged paragraphs are not shaped again.
+    virtual RefPtr<Paragraph> GetReusableParagraph(const std::list<RefPtr<SpanItem>>& group,
+        const ParagraphStyle& paragraphStyle, const RefPtr<FrameNode>& frameNode)
+    {
+        return nullptr;
+    }
+    virtual void OnParagraphBuilt(const RefPtr<Paragraph>& paragraph) {}
     static TextDirection GetTextDirection(const std::string& content, LayoutWrapper* layoutWrapper);
 
     void UpdateSymbolSpanEffect(
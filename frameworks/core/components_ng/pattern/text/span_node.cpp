@@ -249,24 +249,17 @@ int32_t SpanItem::UpdateParagraph(const RefPtr<FrameNode>& frameNode, const RefP
     CHECK_NULL_RETURN(builder, -1);
     auto pipelineContext = PipelineContext::GetCurrentContext();
     CHECK_NULL_RETURN(pipelineContext, -1);
-    auto textStyle = InheritParentProperties(frameNode, isSpanStringMode);
-    UseSelfStyle(fontStyle, textLineStyle, textStyle);
-    auto fontManager = pipelineContext->GetFontManager();
-    if (fontManager && !(fontManager->GetAppCustomFont().empty()) && (textStyle.GetFontFamilies().empty())) {
-        textStyle.SetFontFamilies(Framework::ConvertStrToFontFamilies(fontManager->GetAppCustomFont()));
-    }
+    auto textStyle = CreateParagraphTextStyle(frameNode, isSpanStringMode);
     if (frameNode) {
         FontRegisterCallback(frameNode, textStyle);
     }
     if (NearZero(textStyle.GetFontSize().Value())) {
         return -1;
     }
-    textStyle.SetHalfLeading(pipelineContext->GetHalfLeading());
 
     auto spanContent = GetSpanContent(content);
     auto pattern = frameNode->GetPattern<TextPattern>();
     CHECK_NULL_RETURN(pattern, -1);
-    textStyle.SetTextBackgroundStyle(backgroundStyle);
     if (pattern->NeedShowAIDetect() && !aiSpanMap.empty()) {
         UpdateTextStyleForAISpan(spanContent, builder, textStyle);
     } else {
@@ -276,6 +269,21 @@ int32_t SpanItem::UpdateParagraph(const RefPtr<FrameNode>& frameNode, const RefP
     return -1;
 }
 
+TextStyle SpanItem::CreateParagraphTextStyle(const RefPtr<FrameNode>& frameNode, bool isSpanStringMode)
+{
+    auto textStyle = InheritParentProperties(frameNode, isSpanStringMode);
+    UseSelfStyle(fontStyle, textLineStyle, textStyle);
+    auto pipelineContext = PipelineContext::GetCurrentContext();
+    CHECK_NULL_RETURN(pipelineContext, textStyle);
+    auto fontManager = pipelineContext->GetFontManager();
+    if (fontManager && !(fontManager->GetAppCustomFont().empty()) && (textStyle.GetFontFamilies().empty())) {
+        textStyle.SetFontFamilies(Framework::ConvertStrToFontFamilies(fontManager->GetAppCustomFont()));
+    }
+    textStyle.SetHalfLeading(pipelineContext->GetHalfLeading());
+    textStyle.SetTextBackgroundStyle(backgroundStyle);
+    return textStyle;
+}
+
 void SpanItem::UpdateSymbolSpanParagraph(const RefPtr<FrameNode>& frameNode, const RefPtr<Paragraph>& builder)
 {
     CHECK_NULL_VOID(builder);
@@ -51,28 +51,27 @@ bool TextAdaptFontSizer::AdaptMaxFontSize(TextStyle& textStyle, const std::strin
     if (IsAdaptExceedLimit(maxSize)) {
         return true;
     }
-    auto tag = static_cast<int32_t>((maxFontSize - minFontSize) / stepSize);
-    auto length = tag + 1 + (GreatNotEqual(maxFontSize, minFontSize + stepSize * tag) ? 1 : 0);
-    int32_t left = 0;
-    int32_t right = length - 1;
-    float fontSize = 0.0f;
-    while (left <= right) {
-        int32_t mid = left + (right - left) / 2;
-        fontSize = static_cast<float>((mid == length - 1) ? (maxFontSize) : (minFontSize + stepSize * mid));
-        textStyle.SetFontSize(Dimension(fontSize));
-        if (!CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper)) {
-            return false;
-        }
-        if (!IsAdaptExceedLimit(maxSize)) {
-            left = mid + 1;
-        } else {
-            right = mid - 1;
-        }
+    // the sizes from maxFontSize down to minFontSize, the last of which fits as laid out above.
+    auto fontSizes = AdaptFontSizes::CreateStepUp(maxFontSize, minFontSize, stepSize);
+    auto minIndex = fontSizes.GetCount() - 1;
+    auto predictSize =
+        AdaptFontSizeSearch::PredictSingleLineFontSize(minFontSize, GetAdaptParagraphMetrics(), maxSize);
+    auto layoutIndex = minIndex;
+    auto fitIndex = AdaptFontSizeSearch::FindFirstFit(0, minIndex, fontSizes.GetIndexNotAbove(predictSize),
+        [this, &textStyle, &content, &contentConstraint, layoutWrapper, &fontSizes, &maxSize, &layoutIndex](
+            int32_t index) -> std::optional<bool> {
+            layoutIndex = index;
+            textStyle.SetFontSize(Dimension(fontSizes.GetSize(index)));
+            if (!CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper)) {
+                return std::nullopt;
+            }
+            return !IsAdaptExceedLimit(maxSize);
+        });
+    CHECK_NULL_RETURN(fitIndex, false);
+    if (fitIndex.value() == layoutIndex) {
+        return true;
     }
-    fontSize = static_cast<float>((left - 1 == length - 1) ? (maxFontSize) : (minFontSize + stepSize * (left - 1)));
-    fontSize = LessNotEqual(fontSize, minFontSize) ? minFontSize : fontSize;
-    fontSize = GreatNotEqual(fontSize, maxFontSize) ? maxFontSize : fontSize;
-    textStyle.SetFontSize(Dimension(fontSize));
+    textStyle.SetFontSize(Dimension(fontSizes.GetSize(fitIndex.value())));
     return CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper);
 }
 
@@ -93,17 +92,45 @@ bool TextAdaptFontSizer::AdaptMinFontSize(TextStyle& textStyle, const std::strin
     }
     auto maxSize = GetMaxMeasureSize(contentConstraint);
     GetSuitableSize(maxSize, layoutWrapper);
-    while (GreatOrEqual(maxFontSize, minFontSize)) {
-        textStyle.SetFontSize(Dimension(maxFontSize));
+    auto fontSizes = AdaptFontSizes::CreateStepDown(maxFontSize, minFontSize, stepSize, false);
+    return AdaptFontSizeFromMax(textStyle, content, fontSizes, contentConstraint, layoutWrapper, maxSize);
+}
+
+bool TextAdaptFontSizer::AdaptFontSizeFromMax(TextStyle& textStyle, const std::string& content,
+    const AdaptFontSizes& fontSizes, const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper,
+    const SizeF& maxSize)
+{
+    if (fontSizes.GetCount() <= 0) {
+        return true;
+    }
+    // lay out at the largest size, and if it does not fit, predict the size that does from its metrics.
+    auto layoutIndex = 0;
+    auto fits = [this, &textStyle, &content, &contentConstraint, layoutWrapper, &fontSizes, &maxSize, &layoutIndex](
+                    int32_t index) -> std::optional<bool> {
+        layoutIndex = index;
+        textStyle.SetFontSize(Dimension(fontSizes.GetSize(index)));
         if (!CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper)) {
-            return false;
-        }
-        if (!DidExceedMaxLines(maxSize)) {
-            break;
+            return std::nullopt;
         }
-        maxFontSize -= stepSize;
+        return !DidExceedMaxLines(maxSize);
+    };
+    auto maxFit = fits(0);
+    CHECK_NULL_RETURN(maxFit, false);
+    if (maxFit.value()) {
+        return true;
     }
-    return true;
+    auto predictSize = AdaptFontSizeSearch::PredictMultiLineFontSize(
+        fontSizes.GetSize(0), GetAdaptParagraphMetrics(), maxSize, textStyle.GetMaxLines());
+    auto fitIndex =
+        AdaptFontSizeSearch::FindFirstFit(1, fontSizes.GetCount(), fontSizes.GetIndexNotAbove(predictSize), fits);
+    CHECK_NULL_RETURN(fitIndex, false);
+    // nothing fits, the text is laid out at the smallest size.
+    auto index = std::min(fitIndex.value(), fontSizes.GetCount() - 1);
+    if (index == layoutIndex) {
+        return true;
+    }
+    textStyle.SetFontSize(Dimension(fontSizes.GetSize(index)));
+    return CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper);
 }
 
 bool TextAdaptFontSizer::GetAdaptMaxMinFontSize(const TextStyle& textStyle, double& maxFontSize, double& minFontSize,
@@ -164,6 +191,18 @@ bool TextAdaptFontSizer::DidExceedMaxLines(const SizeF& maxSize)
     return didExceedMaxLines;
 }
 
+AdaptParagraphMetrics TextAdaptFontSizer::GetAdaptParagraphMetrics()
+{
+    AdaptParagraphMetrics metrics;
+    auto paragraph = GetParagraph();
+    CHECK_NULL_RETURN(paragraph, metrics);
+    metrics.longestLine = paragraph->GetLongestLine();
+    metrics.height = paragraph->GetHeight();
+    metrics.maxIntrinsicWidth = paragraph->GetMaxIntrinsicWidth();
+    metrics.lineCount = paragraph->GetLineCount();
+    return metrics;
+}
+
 bool TextAdaptFontSizer::IsAdaptExceedLimit(const SizeF& maxSize)
 {
     auto paragraph = GetParagraph();
@@ -21,6 +21,7 @@
 #include "base/geometry/dimension.h"
 #include "base/memory/ace_type.h"
 #include "core/components_ng/layout/layout_wrapper.h"
+#include "core/components_ng/pattern/text/adapt_font_size_search.h"
 #include "core/components_ng/pattern/text/text_styles.h"
 #include "core/components_ng/render/paragraph.h"
 
@@ -55,9 +56,13 @@ public:
 
 protected:
     bool DidExceedMaxLines(const SizeF& maxSize);
+    // Lays out at the largest of fontSizes that does not exceed maxSize, or at the smallest if none fits.
+    bool AdaptFontSizeFromMax(TextStyle& textStyle, const std::string& content, const AdaptFontSizes& fontSizes,
+        const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper, const SizeF& maxSize);
 
 private:
     virtual bool IsAdaptExceedLimit(const SizeF& maxSize);
+    AdaptParagraphMetrics GetAdaptParagraphMetrics();
 };
 } // namespace OHOS::Ace::NG
 
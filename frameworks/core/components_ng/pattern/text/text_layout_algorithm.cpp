@@ -19,7 +19,9 @@
 
 #include "base/geometry/dimension.h"
 #include "base/log/ace_trace.h"
+#include "base/utils/system_properties.h"
 #include "base/utils/utils.h"
+#include "core/common/font_manager.h"
 #include "core/components/common/layout/constants.h"
 #include "core/components/common/properties/alignment.h"
 #include "core/components/common/properties/text_style.h"
@@ -316,10 +318,7 @@ bool TextLayoutAlgorithm::CreateParagraph(
             paraStyle = externalParagraphStyle.value();
         }
     }
-    if (Container::GreatOrEqualAPIVersion(PlatformVersion::VERSION_ELEVEN) || isSpanStringMode_) {
-        paraStyle.fontSize = textStyle.GetFontSize().ConvertToPx();
-    }
-    paraStyle.leadingMarginAlign = Alignment::CENTER;
+    UpdateParagraphStyleByTextStyle(textStyle, paraStyle);
 
     // SymbolGlyph
     if (frameNode->GetTag() == V2::SYMBOL_ETS_TAG) {
@@ -333,6 +332,14 @@ bool TextLayoutAlgorithm::CreateParagraph(
     }
 }
 
+void TextLayoutAlgorithm::UpdateParagraphStyleByTextStyle(const TextStyle& textStyle, ParagraphStyle& paraStyle)
+{
+    if (Container::GreatOrEqualAPIVersion(PlatformVersion::VERSION_ELEVEN) || isSpanStringMode_) {
+        paraStyle.fontSize = textStyle.GetFontSize().ConvertToPx();
+    }
+    paraStyle.leadingMarginAlign = Alignment::CENTER;
+}
+
 bool TextLayoutAlgorithm::UpdateSymbolTextStyle(const TextStyle& textStyle, const ParagraphStyle& paraStyle,
     LayoutWrapper* layoutWrapper, RefPtr<FrameNode>& frameNode)
 {
@@ -447,20 +454,10 @@ bool TextLayoutAlgorithm::AdaptMinTextSize(TextStyle& textStyle, const std::stri
         return false;
     }
     auto maxSize = MultipleParagraphLayoutAlgorithm::GetMaxMeasureSize(contentConstraint);
-    while (GreatOrEqual(maxFontSize, minFontSize)) {
-        textStyle.SetFontSize(Dimension(maxFontSize));
-        if (!CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper)) {
-            TAG_LOGE(AceLogTag::ACE_TEXT, "create paragraph error");
-            return false;
-        }
-        if (!DidExceedMaxLines(maxSize)) {
-            break;
-        }
-        bool isEqual = maxFontSize == minFontSize;
-        maxFontSize -= stepSize;
-        if (LessNotEqual(maxFontSize, minFontSize) && !isEqual) {
-            maxFontSize = minFontSize;
-        }
+    auto fontSizes = AdaptFontSizes::CreateStepDown(maxFontSize, minFontSize, stepSize, true);
+    if (!AdaptFontSizeFromMax(textStyle, content, fontSizes, contentConstraint, layoutWrapper, maxSize)) {
+        TAG_LOGE(AceLogTag::ACE_TEXT, "create paragraph error");
+        return false;
     }
     return true;
 }
@@ -514,19 +511,96 @@ bool TextLayoutAlgorithm::BuildParagraph(TextStyle& textStyle, const RefPtr<Text
     const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper)
 {
     if (!textStyle.GetAdaptTextSize() || !spans_.empty()) {
-        if (!CreateParagraphAndLayout(
-                textStyle, layoutProperty->GetContent().value_or(""), contentConstraint, layoutWrapper)) {
+        auto content = layoutProperty->GetContent().value_or("");
+        auto cacheKey = CreateParagraphCacheKey(textStyle, content, contentConstraint, layoutWrapper);
+        if (cacheKey && UpdateParagraphFromCache(cacheKey.value(), layoutWrapper)) {
+            return true;
+        }
+        // the indent of this paragraph alone is cached, indent_ keeps the largest indent of the measure.
+        auto indent = indent_;
+        indent_ = 0.0f;
+        if (!CreateParagraphAndLayout(textStyle, content, contentConstraint, layoutWrapper)) {
             TAG_LOGE(AceLogTag::ACE_TEXT, "create paragraph error");
+            indent_ = std::max(indent, indent_);
             return false;
         }
-    } else {
-        if (!AdaptMinTextSize(textStyle, layoutProperty->GetContent().value_or(""), contentConstraint, layoutWrapper)) {
+        auto paragraphIndent = indent_;
+        indent_ = std::max(indent, indent_);
+        if (!ParagraphReLayout(contentConstraint)) {
             return false;
         }
+        if (cacheKey && paragraphManager_->GetParagraphs().size() == 1) {
+            const auto& paragraphInfo = paragraphManager_->GetParagraphs().front();
+            TextParagraphCache::GetInstance().Put(
+                cacheKey.value(), paragraphInfo.paragraph, paragraphInfo.paragraphStyle, paragraphIndent);
+        }
+        return true;
+    }
+    if (!AdaptMinTextSize(textStyle, layoutProperty->GetContent().value_or(""), contentConstraint, layoutWrapper)) {
+        return false;
     }
     return ParagraphReLayout(contentConstraint);
 }
 
+std::optional<TextParagraphCacheKey> TextLayoutAlgorithm::CreateParagraphCacheKey(const TextStyle& textStyle,
+    const std::string& content, const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper)
+{
+    // only plain texts are cached, their paragraph depends on nothing but the key.
+    if (!SystemProperties::IsTextParagraphCacheEnabled() || !spans_.empty() ||
+        content.size() > TextParagraphCache::MAX_CONTENT_LENGTH) {
+        return std::nullopt;
+    }
+    auto frameNode = layoutWrapper->GetHostNode();
+    CHECK_NULL_RETURN(frameNode, std::nullopt);
+    if (frameNode->GetTag() == V2::SYMBOL_ETS_TAG) {
+        return std::nullopt;
+    }
+    auto pattern = frameNode->GetPattern<TextPattern>();
+    CHECK_NULL_RETURN(pattern, std::nullopt);
+    if (pattern->GetExternalParagraph() || pattern->NeedShowAIDetect() || pattern->IsDragging() ||
+        pattern->IsSensitiveEnalbe()) {
+        return std::nullopt;
+    }
+    auto pipeline = PipelineContext::GetCurrentContext();
+    CHECK_NULL_RETURN(pipeline, std::nullopt);
+    TextParagraphCacheKey key;
+    key.content = content;
+    key.textStyle = textStyle;
+    key.paragraphStyle = GetParagraphStyle(textStyle, content, layoutWrapper);
+    UpdateParagraphStyleByTextStyle(textStyle, key.paragraphStyle);
+    key.maxMeasureWidth = MultipleParagraphLayoutAlgorithm::GetMaxMeasureSize(contentConstraint).Width();
+    key.minWidth = contentConstraint.minSize.Width();
+    key.maxWidth = contentConstraint.maxSize.Width();
+    key.selfIdealWidth = contentConstraint.selfIdealSize.Width();
+    key.dipScale = pipeline->GetDipScale();
+    key.fontScale = pipeline->GetFontScale();
+    key.fontWeightScale = pipeline->GetFontWeightScale();
+    key.fontGeneration = FontManager::GetFontGeneration();
+    return key;
+}
+
+bool TextLayoutAlgorithm::UpdateParagraphFromCache(const TextParagraphCacheKey& key, LayoutWrapper* layoutWrapper)
+{
+    auto cached = TextParagraphCache::GetInstance().Get(key);
+    CHECK_NULL_RETURN(cached, false);
+    auto frameNode = layoutWrapper->GetHostNode();
+    CHECK_NULL_RETURN(frameNode, false);
+    auto pattern = frameNode->GetPattern<TextPattern>();
+    CHECK_NULL_RETURN(pattern, false);
+    ACE_TEXT_SCOPED_TRACE("TextLayoutAlgorithm::UpdateParagraphFromCache");
+    if (!paragraphManager_) {
+        paragraphManager_ = AceType::MakeRefPtr<ParagraphManager>();
+    }
+    paragraphManager_->Reset();
+    pattern->ClearCustomSpanPlaceholderInfo();
+    paragraphManager_->AddParagraph({ .paragraph = cached->paragraph,
+        .paragraphStyle = cached->paragraphStyle,
+        .start = 0,
+        .end = StringUtils::Str8ToStr16(key.content).length() });
+    indent_ = std::max(indent_, cached->indent);
+    return true;
+}
+
 bool TextLayoutAlgorithm::BuildParagraphAdaptUseMinFontSize(TextStyle& textStyle,
     const RefPtr<TextLayoutProperty>& layoutProperty, const LayoutConstraintF& contentConstraint,
     LayoutWrapper* layoutWrapper)
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/pattern/text/text_paragraph_cache.h"
+
+#include <functional>
+
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr size_t HASH_MIX = 0x9e3779b9;
+constexpr size_t HASH_LEFT_SHIFT = 6;
+constexpr size_t HASH_RIGHT_SHIFT = 2;
+
+template<typename T>
+void HashCombine(size_t& seed, const T& value)
+{
+    seed ^= std::hash<T>()(value) + HASH_MIX + (seed << HASH_LEFT_SHIFT) + (seed >> HASH_RIGHT_SHIFT);
+}
+
+void HashCombine(size_t& seed, const Dimension& value)
+{
+    HashCombine(seed, value.Value());
+    HashCombine(seed, static_cast<int32_t>(value.Unit()));
+}
+
+} // namespace
+
+TextParagraphCache& TextParagraphCache::GetInstance()
+{
+    static TextParagraphCache instance;
+    return instance;
+}
+
+std::shared_ptr<const CachedTextParagraph> TextParagraphCache::Get(const TextParagraphCacheKey& key)
+{
+    if (key.content.size() > MAX_CONTENT_LENGTH) {
+        return nullptr;
+    }
+    auto cached = cache_.Get(GetCacheKey(key));
+    CHECK_NULL_RETURN(cached, nullptr);
+    // the cache key only holds a hash of the styles, a different key of the same hash is a miss.
+    if (!IsSameKey(cached->key, key)) {
+        return nullptr;
+    }
+    return cached;
+}
+
+void TextParagraphCache::Put(const TextParagraphCacheKey& key, const RefPtr<Paragraph>& paragraph,
+    const ParagraphStyle& paragraphStyle, float indent)
+{
+    CHECK_NULL_VOID(paragraph);
+    if (key.content.size() > MAX_CONTENT_LENGTH) {
+        return;
+    }
+    auto cached = std::make_shared<CachedTextParagraph>();
+    cached->key = key;
+    cached->paragraph = paragraph;
+    cached->paragraphStyle = paragraphStyle;
+    cached->indent = indent;
+    cache_.Put(GetCacheKey(key), cached, key.content.size());
+}
+
+void TextParagraphCache::Clear()
+{
+    cache_.Clear();
+}
+
+bool TextParagraphCache::IsSameKey(const TextParagraphCacheKey& lhs, const TextParagraphCacheKey& rhs)
+{
+    return lhs.content == rhs.content && lhs.fontGeneration == rhs.fontGeneration &&
+           NearEqual(lhs.maxMeasureWidth, rhs.maxMeasureWidth) && NearEqual(lhs.minWidth, rhs.minWidth) &&
+           NearEqual(lhs.maxWidth, rhs.maxWidth) && lhs.selfIdealWidth == rhs.selfIdealWidth &&
+           NearEqual(lhs.dipScale, rhs.dipScale) && NearEqual(lhs.fontScale, rhs.fontScale) &&
+           NearEqual(lhs.fontWeightScale, rhs.fontWeightScale) &&
+           IsSameParagraphStyle(lhs.paragraphStyle, rhs.paragraphStyle) &&
+           IsSameTextStyle(lhs.textStyle, rhs.textStyle);
+}
+
+// TextStyle::operator== leaves out some of the fields the paragraph is shaped with.
+bool TextParagraphCache::IsSameTextStyle(const TextStyle& lhs, const TextStyle& rhs)
+{
+    return lhs == rhs && lhs.GetWhiteSpace() == rhs.GetWhiteSpace() && lhs.GetLineSpacing() == rhs.GetLineSpacing() &&
+           lhs.HasHeightOverride() == rhs.HasHeightOverride() && lhs.GetHalfLeading() == rhs.GetHalfLeading() &&
+           NearEqual(lhs.GetMinFontScale(), rhs.GetMinFontScale()) &&
+           NearEqual(lhs.GetMaxFontScale(), rhs.GetMaxFontScale()) &&
+           NearEqual(lhs.GetHeightScale(), rhs.GetHeightScale()) && lhs.GetHeightOnly() == rhs.GetHeightOnly() &&
+           lhs.GetEllipsis() == rhs.GetEllipsis() && lhs.GetLocale() == rhs.GetLocale() &&
+           lhs.GetTextBackgroundStyle() == rhs.GetTextBackgroundStyle() &&
+           lhs.GetRenderStrategy() == rhs.GetRenderStrategy() && lhs.GetEffectStrategy() == rhs.GetEffectStrategy();
+}
+
+// ParagraphStyle::operator== leaves out the line break strategy, line height and leading margin alignment.
+bool TextParagraphCache::IsSameParagraphStyle(const ParagraphStyle& lhs, const ParagraphStyle& rhs)
+{
+    return lhs == rhs && lhs.lineBreakStrategy == rhs.lineBreakStrategy && lhs.lineHeight == rhs.lineHeight &&
+           lhs.leadingMarginAlign == rhs.leadingMarginAlign;
+}
+
+std::string TextParagraphCache::GetCacheKey(const TextParagraphCacheKey& key)
+{
+    // hashes the fields that usually differ between texts of the same content, IsSameKey checks all of them.
+    size_t seed = 0;
+    const auto& textStyle = key.textStyle;
+    for (const auto& fontFamily : textStyle.GetFontFamilies()) {
+        HashCombine(seed, fontFamily);
+    }
+    HashCombine(seed, textStyle.GetFontSize());
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetFontWeight()));
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetFontStyle()));
+    HashCombine(seed, textStyle.GetTextColor().GetValue());
+    HashCombine(seed, textStyle.GetLineHeight());
+    HashCombine(seed, textStyle.GetLetterSpacing());
+    HashCombine(seed, textStyle.GetMaxLines());
+    HashCombine(seed, static_cast<int32_t>(textStyle.GetTextOverflow()));
+    HashCombine(seed, static_cast<int32_t>(key.paragraphStyle.align));
+    HashCombine(seed, static_cast<int32_t>(key.paragraphStyle.direction));
+    HashCombine(seed, key.maxMeasureWidth);
+    HashCombine(seed, key.maxWidth);
+    HashCombine(seed, key.selfIdealWidth.value_or(-1.0f));
+    HashCombine(seed, key.fontGeneration);
+    return std::to_string(seed) + ":" + key.content;
+}
+
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_TEXT_PARAGRAPH_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_TEXT_PARAGRAPH_CACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "base/memory/referenced.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "core/common/lru/sharded_lru_cache.h"
+#include "core/components/common/properties/text_style.h"
+#include "core/components_ng/render/paragraph.h"
+
+namespace OHOS::Ace::NG {
+
+// Everything the layout of a plain text paragraph depends on.
+struct TextParagraphCacheKey {
+    std::string content;
+    TextStyle textStyle;
+    ParagraphStyle paragraphStyle;
+    float maxMeasureWidth = 0.0f;
+    float minWidth = 0.0f;
+    float maxWidth = 0.0f;
+    std::optional<float> selfIdealWidth;
+    double dipScale = 1.0;
+    float fontScale = 1.0f;
+    float fontWeightScale = 1.0f;
+    uint64_t fontGeneration = 0;
+};
+
+struct CachedTextParagraph {
+    TextParagraphCacheKey key;
+    // laid out to its final width, and never changed after being cached.
+    RefPtr<Paragraph> paragraph;
+    ParagraphStyle paragraphStyle;
+    float indent = 0.0f;
+};
+
+// Process wide cache of the laid out paragraphs of plain texts, so that texts showing the same content with the same
+// style and constraint, such as the labels of recycled list items, share one paragraph instead of shaping it again.
+class ACE_EXPORT TextParagraphCache final {
+public:
+    static constexpr size_t COUNT_LIMIT = 512;
+    // long texts are rarely shown twice and cost the most memory, they are not cached.
+    static constexpr size_t MAX_CONTENT_LENGTH = 256;
+
+    static TextParagraphCache& GetInstance();
+
+    std::shared_ptr<const CachedTextParagraph> Get(const TextParagraphCacheKey& key);
+    void Put(const TextParagraphCacheKey& key, const RefPtr<Paragraph>& paragraph,
+        const ParagraphStyle& paragraphStyle, float indent);
+    void Clear();
+
+    size_t GetCount() const
+    {
+        return cache_.Count();
+    }
+
+    static bool IsSameKey(const TextParagraphCacheKey& lhs, const TextParagraphCacheKey& rhs);
+    static bool IsSameTextStyle(const TextStyle& lhs, const TextStyle& rhs);
+    static bool IsSameParagraphStyle(const ParagraphStyle& lhs, const ParagraphStyle& rhs);
+
+private:
+    TextParagraphCache() = default;
+    ~TextParagraphCache() = default;
+
+    static std::string GetCacheKey(const TextParagraphCacheKey& key);
+
+    ShardedLRUCache<std::shared_ptr<const CachedTextParagraph>> cache_ { COUNT_LIMIT,
+        ShardedLRUCache<std::shared_ptr<const CachedTextParagraph>>::NO_LIMIT };
+
+    ACE_DISALLOW_COPY_AND_MOVE(TextParagraphCache);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_PATTERN_TEXT_TEXT_PARAGRAPH_CACHE_H
@@ -34,6 +34,11 @@ public:
 
     void SetParent(const WeakPtr<UINode>& parent) override;
     bool IsOutOfTouchTestRegion(const PointF& parentLocalPoint, int32_t sourceType) override;
+    // hot areas are tested in the parent space without the revert matrix, window nodes are always tested.
+    std::optional<RectF> GetTouchTestBounds(int32_t depth) override
+    {
+        return std::nullopt;
+    }
     std::vector<RectF> GetResponseRegionList(const RectF& rect, int32_t sourceType) override;
 
 private:
@@ -32,11 +32,24 @@ ScaleProperty ScaleProperty::CreateScaleProperty()
     return scaleProperty;
 }
 
+void CalcLength::CompileCalcValue()
+{
+    if (calcValue_.empty()) {
+        compiledExp_.reset();
+        return;
+    }
+    compiledExp_ = StringExpression::CompiledExp::Compile(calcValue_);
+}
+
 bool CalcLength::NormalizeToPx(
     double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const
 {
     // don't use this function for calc.
     if (!calcValue_.empty()) {
+        if (compiledExp_) {
+            result = compiledExp_->Calculate(vpScale, fpScale, lpxScale, parentLength);
+            return result >= 0;
+        }
         result = StringExpression::CalculateExp(
             calcValue_, [vpScale, fpScale, lpxScale, parentLength](const Dimension& dim) -> double {
                 double result = -1.0;
@@ -16,10 +16,16 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 #define FOUNDATION_ACE_FRAMEWORKS_COMPONENTS_NG_PROPERTIES_CALC_LENGTH_H
 
+#include <memory>
+
 #include "base/geometry/dimension.h"
 #include "base/geometry/ng/size_t.h"
 #include "base/utils/utils.h"
 
+namespace OHOS::Ace::StringExpression {
+class CompiledExp;
+} // namespace OHOS::Ace::StringExpression
+
 namespace OHOS::Ace::NG {
 struct ACE_EXPORT ScaleProperty {
     float vpScale = 0.0f;
@@ -53,6 +59,7 @@ public:
     explicit CalcLength(const std::string& value) : calcValue_(value)
     {
         dimension_.SetUnit(DimensionUnit::CALC);
+        CompileCalcValue();
     }
     ~CalcLength() = default;
 
@@ -62,6 +69,7 @@ public:
     void Reset()
     {
         calcValue_ = "";
+        compiledExp_.reset();
         dimension_.Reset();
     }
 
@@ -73,6 +81,7 @@ public:
     void SetCalcValue(const std::string& value)
     {
         calcValue_ = value;
+        CompileCalcValue();
     }
 
     bool NormalizeToPx(double vpScale, double fpScale, double lpxScale, double parentLength, double& result) const;
@@ -125,7 +134,12 @@ public:
     }
 
 private:
+    // Parses calcValue_ once here rather than in every NormalizeToPx.
+    void CompileCalcValue();
+
     std::string calcValue_;
+    // shared by the copies of the length, it is not changed after the compiling.
+    std::shared_ptr<const StringExpression::CompiledExp> compiledExp_;
     Dimension dimension_;
 };
 } // namespace OHOS::Ace::NG
@@ -281,7 +281,7 @@ void AnimatedRSImage::CacheFrame(const std::string& key)
         std::scoped_lock<std::mutex> lock(frameMtx_);
         cacheNode = std::make_shared<CachedImage>(currentFrame_);
     }
-    cache->CacheImage(key, cacheNode);
+    cache->CacheImage(key, cacheNode, cacheNode->GetMemorySize());
 }
 
 #ifndef USE_ROSEN_DRAWING
@@ -200,7 +200,7 @@ void DrawingImage::Cache(const std::string& key)
 
     auto cached = std::make_shared<CachedImage>(GetImage());
     cached->uniqueId = GetUniqueID();
-    pipelineCtx->GetImageCache()->CacheImage(key, cached);
+    cache->CacheImage(key, cached, cached->GetMemorySize());
 }
 
 RefPtr<CanvasImage> DrawingImage::QueryFromCache(const std::string& key)
@@ -3397,7 +3397,7 @@ void RosenRenderContext::SetPositionToRSNode()
     if (!rect.GetSize().IsPositive()) {
         return;
     }
-    paintRect_ = rect;
+    UpdatePaintRectInner(rect);
     if (AnimationUtils::IsImplicitAnimationOpen()) {
         auto preBounds = rsNode_->GetStagingProperties().GetBounds();
         if (!NearEqual(preBounds[0], rect.GetX()) || !NearEqual(preBounds[1], rect.GetY())) {
@@ -4613,6 +4613,10 @@ void RosenRenderContext::OnClipEdgeUpdate(bool isClip)
         rsNode_->SetClipToBounds(false);
         rsNode_->SetClipToFrame(false);
     }
+    auto host = GetHost();
+    if (host) {
+        host->NotifyGeometryChanged();
+    }
     RequestNextFrame();
 }
 
@@ -5015,7 +5019,7 @@ void RosenRenderContext::ClearChildren()
 void RosenRenderContext::SetBounds(float positionX, float positionY, float width, float height)
 {
     CHECK_NULL_VOID(rsNode_);
-    paintRect_ = RectF(positionX, positionY, width, height);
+    UpdatePaintRectInner(RectF(positionX, positionY, width, height));
     rsNode_->SetBounds(positionX, positionY, width, height);
 }
 
@@ -6154,7 +6158,7 @@ void RosenRenderContext::SavePaintRect(bool isRound, uint8_t flag)
             RoundToPixelGrid(isRound, flag);
         }
     }
-    paintRect_ = RectF(geometryNode->GetPixelGridRoundOffset(), geometryNode->GetPixelGridRoundSize());
+    UpdatePaintRectInner(RectF(geometryNode->GetPixelGridRoundOffset(), geometryNode->GetPixelGridRoundSize()));
     if (SystemProperties::GetSyncDebugTraceEnabled()) {
         ACE_LAYOUT_SCOPED_TRACE("SavePaintRect[%s][self:%d] rs SavePaintRect %s",
             host->GetTag().c_str(), host->GetId(), paintRect_.ToString().c_str());
@@ -6163,7 +6167,18 @@ void RosenRenderContext::SavePaintRect(bool isRound, uint8_t flag)
 
 void RosenRenderContext::UpdatePaintRect(const RectF& paintRect)
 {
+    UpdatePaintRectInner(paintRect);
+}
+
+void RosenRenderContext::UpdatePaintRectInner(const RectF& paintRect)
+{
+    if (paintRect_ == paintRect) {
+        return;
+    }
     paintRect_ = paintRect;
+    auto host = GetHost();
+    CHECK_NULL_VOID(host);
+    host->NotifyGeometryChanged();
 }
 
 void RosenRenderContext::SyncPartialRsProperties()
@@ -597,6 +597,8 @@ private:
     // Use rect to update the drawRegion rect at index.
     void UpdateDrawRegion(uint32_t index, const std::shared_ptr<Rosen::RectF>& rect);
     void NotifyHostTransformUpdated();
+    // Sets paintRect_ and tells the host when it moved or resized.
+    void UpdatePaintRectInner(const RectF& paintRect);
 
     void InitAccessibilityFocusModidifer(const RoundRect&, const Color&, float);
 
@@ -148,7 +148,7 @@ void SkiaImage::Cache(const std::string& key)
 
     auto cached = std::make_shared<CachedImage>(GetImage());
     cached->uniqueId = GetUniqueID();
-    pipelineCtx->GetImageCache()->CacheImage(key, cached);
+    cache->CacheImage(key, cached, cached->GetMemorySize());
 }
 
 RefPtr<CanvasImage> SkiaImage::QueryFromCache(const std::string& key)
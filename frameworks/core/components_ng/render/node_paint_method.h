@@ -63,6 +63,16 @@ public:
     virtual void UpdateForegroundModifier(PaintWrapper* paintWrapper) {}
 
     virtual void UpdateOverlayModifier(PaintWrapper* paintWrapper) {}
+
+    // Pure computation the Update*Modifier methods depend on, called before them. It runs on a render worker when
+    // CanRunOnWhichThread includes BACKGROUND_TASK, so it must only use members of the paint method, set when the
+    // pattern created it, and never read properties or touch modifiers, the render context or the pattern.
+    virtual void UpdateOnBackground() {}
+
+    virtual TaskThread CanRunOnWhichThread()
+    {
+        return MAIN_TASK;
+    }
 };
 } // namespace OHOS::Ace::NG
 
@@ -82,10 +82,27 @@ void PaintWrapper::FlushContentModifier()
     renderContext->FlushContentModifier(contentModifier);
 }
 
+void PaintWrapper::FlushBackground()
+{
+    backgroundFlushed_ = true;
+    CHECK_NULL_VOID(nodePaintImpl_);
+    nodePaintImpl_->UpdateOnBackground();
+}
+
+bool PaintWrapper::CanFlushOnBackground() const
+{
+    // extension handlers call into the frontend, which is bound to the UI thread.
+    CHECK_NULL_RETURN(nodePaintImpl_ && !extensionHandler_, false);
+    return (nodePaintImpl_->CanRunOnWhichThread() & BACKGROUND_TASK) == BACKGROUND_TASK;
+}
+
 void PaintWrapper::FlushRender()
 {
     auto renderContext = renderContext_.Upgrade();
     CHECK_NULL_VOID(renderContext);
+    if (!backgroundFlushed_) {
+        FlushBackground();
+    }
 
     auto contentModifier =
         DynamicCast<ContentModifier>(nodePaintImpl_ ? nodePaintImpl_->GetContentModifier(this) : nullptr);
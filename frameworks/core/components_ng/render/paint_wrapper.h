@@ -43,21 +43,18 @@ public:
 
     void SetNodePaintMethod(const RefPtr<NodePaintMethod>& nodePaintImpl);
 
-    void SetTaskThread(TaskThread taskThread)
-    {
-        taskThread_ = taskThread;
-    }
-
     void FlushRender();
 
-    TaskThread CanRunOnWhichThread() const
-    {
-        return taskThread_;
-    }
+    // Runs NodePaintMethod::UpdateOnBackground. FlushRender runs it first if it has not run yet.
+    void FlushBackground();
 
-    bool CheckShouldRunOnMain() const
+    // Whether FlushBackground may run on a render worker, before FlushRender runs on the UI thread.
+    bool CanFlushOnBackground() const;
+
+    // FlushRender always runs on the UI thread, BACKGROUND_TASK is added when FlushBackground may run on a worker.
+    TaskThread CanRunOnWhichThread() const
     {
-        return (CanRunOnWhichThread() & MAIN_TASK) == MAIN_TASK;
+        return CanFlushOnBackground() ? (MAIN_TASK | BACKGROUND_TASK) : MAIN_TASK;
     }
 
     const RefPtr<PaintProperty>& GetPaintProperty() const
@@ -115,7 +112,7 @@ private:
     RefPtr<PaintProperty> paintProperty_;
     RefPtr<NodePaintMethod> nodePaintImpl_;
     RefPtr<ExtensionHandler> extensionHandler_;
-    TaskThread taskThread_ = MAIN_TASK;
+    bool backgroundFlushed_ = false;
 };
 } // namespace OHOS::Ace::NG
 
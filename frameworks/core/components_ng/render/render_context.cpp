@@ -40,6 +40,10 @@ void RenderContext::SetRequestFrame(const std::function<void()>& requestFrame)
 
 void RenderContext::RequestNextFrame() const
 {
+    if (requestFrameSuspendCount_ > 0) {
+        hasSuspendedRequest_ = true;
+        return;
+    }
     if (requestFrame_) {
         requestFrame_();
         auto node = GetHost();
@@ -52,6 +56,22 @@ void RenderContext::RequestNextFrame() const
     }
 }
 
+void RenderContext::SuspendRequestFrame()
+{
+    ++requestFrameSuspendCount_;
+}
+
+void RenderContext::ResumeRequestFrame()
+{
+    if (requestFrameSuspendCount_ == 0 || --requestFrameSuspendCount_ > 0) {
+        return;
+    }
+    if (hasSuspendedRequest_) {
+        hasSuspendedRequest_ = false;
+        RequestNextFrame();
+    }
+}
+
 void RenderContext::SetHostNode(const WeakPtr<FrameNode>& host)
 {
     host_ = host;
@@ -94,6 +94,10 @@ public:
 
     void SetRequestFrame(const std::function<void()>& requestFrame);
     void RequestNextFrame() const;
+    // Holds the frame requests back until the matching ResumeRequestFrame, which makes a single request for all of
+    // them, for the attribute updates applied in a batch.
+    void SuspendRequestFrame();
+    void ResumeRequestFrame();
 
     virtual void SetHostNode(const WeakPtr<FrameNode>& host);
     RefPtr<FrameNode> GetHost() const;
@@ -792,6 +796,8 @@ protected:
 private:
     friend class ViewAbstract;
     std::function<void()> requestFrame_;
+    int32_t requestFrameSuspendCount_ = 0;
+    mutable bool hasSuspendedRequest_ = false;
     WeakPtr<FrameNode> host_;
     RefPtr<OneCenterTransitionOptionType> oneCenterTransition_;
     ACE_DISALLOW_COPY_AND_MOVE(RenderContext);
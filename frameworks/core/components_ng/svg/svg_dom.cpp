@@ -15,6 +15,8 @@
 
 #include "frameworks/core/components_ng/svg/svg_dom.h"
 
+#include <cmath>
+
 #include "include/core/SkClipOp.h"
 
 #include "base/utils/utils.h"
@@ -52,6 +54,7 @@ namespace {
 
 const char DOM_SVG_STYLE[] = "style";
 const char DOM_SVG_CLASS[] = "class";
+constexpr size_t RASTER_BYTES_PER_PIXEL = 4;
 
 } // namespace
 
@@ -116,13 +119,47 @@ RefPtr<SvgDom> SvgDom::CreateSvgDom(SkStream& svgStream, const ImageSourceInfo&
 
 bool SvgDom::ParseSvg(SkStream& svgStream)
 {
-    SkDOM xmlDom;
     CHECK_NULL_RETURN(svgContext_, false);
-    if (!xmlDom.build(svgStream)) {
-        LOGE("Failed to parse xml file.");
-        return false;
+    auto cacheKey = SvgDomCache::GetCacheKey(path_, svgStream);
+    if (cacheKey.empty()) {
+        // nothing is shared, the nodes are built straight from the xml.
+        SkDOM xmlDom;
+        if (!xmlDom.build(svgStream)) {
+            LOGE("Failed to parse xml file.");
+            return false;
+        }
+        root_ = TranslateSvgNode(xmlDom, xmlDom.getRootNode(), nullptr);
+        return InitRoot();
+    }
+    // the fill color is written into the nodes when they are parsed.
+    treeKey_ = cacheKey + ":" + (fillColor_ ? std::to_string(fillColor_->GetValue()) : "");
+    auto& domCache = SvgDomCache::GetInstance();
+    auto tree = domCache.GetTree(treeKey_);
+    if (tree) {
+        ShareTree(tree);
+        return true;
+    }
+    auto svgTemplate = domCache.GetTemplate(cacheKey, svgStream);
+    CHECK_NULL_RETURN(svgTemplate, false);
+    root_ = TranslateSvgNode(*svgTemplate, nullptr);
+    CHECK_NULL_RETURN(InitRoot(), false);
+    if (svgTemplate->animated || !IsStatic()) {
+        // the animators run for the image they are created for, such nodes are not shared.
+        treeKey_.clear();
+        return true;
     }
-    root_ = TranslateSvgNode(xmlDom, xmlDom.getRootNode(), nullptr);
+    tree = std::make_shared<SvgDomTree>();
+    tree->context = svgContext_;
+    tree->root = root_;
+    tree->svgSize = svgSize_;
+    tree->viewBox = viewBox_;
+    domCache.PutTree(treeKey_, tree, *svgTemplate);
+    ShareTree(tree);
+    return true;
+}
+
+bool SvgDom::InitRoot()
+{
     CHECK_NULL_RETURN(root_, false);
     auto svg = AceType::DynamicCast<SvgSvg>(root_);
     CHECK_NULL_RETURN(svg, false);
@@ -133,8 +170,18 @@ bool SvgDom::ParseSvg(SkStream& svgStream)
     return true;
 }
 
+void SvgDom::ShareTree(const std::shared_ptr<SvgDomTree>& tree)
+{
+    sharedTree_ = tree;
+    svgContext_ = tree->context;
+    root_ = tree->root;
+    svgSize_ = tree->svgSize;
+    viewBox_ = tree->viewBox;
+}
+
 RefPtr<SvgNode> SvgDom::TranslateSvgNode(const SkDOM& dom, const SkDOM::Node* xmlNode, const RefPtr<SvgNode>& parent)
 {
+    CHECK_NULL_RETURN(xmlNode, nullptr);
     const char* element = dom.getName(xmlNode);
     if (dom.getType(xmlNode) == SkDOM::kText_Type) {
         CHECK_NULL_RETURN(parent, nullptr);
@@ -161,6 +208,34 @@ RefPtr<SvgNode> SvgDom::TranslateSvgNode(const SkDOM& dom, const SkDOM::Node* xm
     return node;
 }
 
+RefPtr<SvgNode> SvgDom::TranslateSvgNode(const SvgTemplateNode& templateNode, const RefPtr<SvgNode>& parent)
+{
+    const auto& element = templateNode.name;
+    if (templateNode.isText) {
+        CHECK_NULL_RETURN(parent, nullptr);
+        if (AceType::InstanceOf<SvgStyle>(parent)) {
+            SvgStyle::ParseCssStyle(element, attrCallback_);
+        }
+    }
+
+    auto elementIter = BinarySearchFindIndex(TAG_FACTORIES, ArraySize(TAG_FACTORIES), element.c_str());
+    if (elementIter == -1) {
+        return nullptr;
+    }
+    RefPtr<SvgNode> node = TAG_FACTORIES[elementIter].value();
+    CHECK_NULL_RETURN(node, nullptr);
+    node->SetContext(svgContext_);
+    node->SetImagePath(path_);
+    ParseAttrs(templateNode, node);
+    for (const auto& child : templateNode.children) {
+        const auto& childNode = TranslateSvgNode(child, node);
+        if (childNode) {
+            node->AppendChild(childNode);
+        }
+    }
+    return node;
+}
+
 void SvgDom::ParseAttrs(const SkDOM& xmlDom, const SkDOM::Node* xmlNode, const RefPtr<SvgNode>& svgNode)
 {
     const char* name = nullptr;
@@ -171,6 +246,13 @@ void SvgDom::ParseAttrs(const SkDOM& xmlDom, const SkDOM::Node* xmlNode, const R
     }
 }
 
+void SvgDom::ParseAttrs(const SvgTemplateNode& templateNode, const RefPtr<SvgNode>& svgNode)
+{
+    for (const auto& [name, value] : templateNode.attrs) {
+        SetAttrValue(name, value, svgNode);
+    }
+}
+
 void SvgDom::ParseIdAttr(const WeakPtr<SvgNode>& weakSvgNode, const std::string& value)
 {
     auto svgNode = weakSvgNode.Upgrade();
@@ -251,12 +333,21 @@ void SvgDom::SetAttrValue(const std::string& name, const std::string& value, con
 
 void SvgDom::SetFuncNormalizeToPx(FuncNormalizeToPx&& funcNormalizeToPx)
 {
+    if (sharedTree_) {
+        // the context is shared, the function of this image is set on it when the image is drawn.
+        funcNormalizeToPx_ = std::move(funcNormalizeToPx);
+        return;
+    }
     CHECK_NULL_VOID(svgContext_);
     svgContext_->SetFuncNormalizeToPx(funcNormalizeToPx);
 }
 
 void SvgDom::SetAnimationCallback(FuncAnimateFlush&& funcAnimateFlush, const WeakPtr<CanvasImage>& imagePtr)
 {
+    // shared nodes never animate, the context of them would only collect the callbacks of every image.
+    if (sharedTree_) {
+        return;
+    }
     CHECK_NULL_VOID(svgContext_);
     svgContext_->SetFuncAnimateFlush(std::move(funcAnimateFlush), imagePtr);
 }
@@ -295,9 +386,20 @@ void SvgDom::DrawImage(
     RSCanvas& canvas, const ImageFit& imageFit, const Size& layout)
 {
     CHECK_NULL_VOID(root_);
+    if (!sharedTree_) {
+        DrawTree(canvas, imageFit, layout, true);
+        return;
+    }
+    if (!DrawRaster(canvas, imageFit, layout)) {
+        DrawSharedTree(canvas, imageFit, layout, true);
+    }
+}
+
+void SvgDom::DrawTree(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout, bool clipRadius)
+{
     canvas.Save();
     // viewBox scale and imageFit scale
-    FitImage(canvas, imageFit, layout);
+    FitImage(canvas, imageFit, layout, clipRadius);
     FitViewPort(layout);
     // draw svg tree
     if (GreatNotEqual(smoothEdge_, 0.0f)) {
@@ -308,7 +410,68 @@ void SvgDom::DrawImage(
     canvas.Restore();
 }
 
-void SvgDom::FitImage(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout)
+void SvgDom::DrawSharedTree(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout, bool clipRadius)
+{
+    // the viewport and the paint state of this image are set on the shared nodes for the time of the draw.
+    std::lock_guard<std::mutex> lock(sharedTree_->drawMutex);
+    if (funcNormalizeToPx_) {
+        svgContext_->SetFuncNormalizeToPx(funcNormalizeToPx_);
+    }
+    root_->SetSmoothEdge(smoothEdge_);
+    DrawTree(canvas, imageFit, layout, clipRadius);
+}
+
+bool SvgDom::DrawRaster(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout)
+{
+    // the color filter and the smooth edge are applied on the paths, such images are drawn from the nodes.
+    if (colorFilter_ || GreatNotEqual(smoothEdge_, 0.0f) || layout.IsEmpty() || layout.IsInfinite()) {
+        return false;
+    }
+    auto width = static_cast<int32_t>(std::ceil(layout.Width()));
+    auto height = static_cast<int32_t>(std::ceil(layout.Height()));
+    auto size = static_cast<size_t>(width) * static_cast<size_t>(height) * RASTER_BYTES_PER_PIXEL;
+    if (size > SvgDomCache::MAX_RASTER_SIZE) {
+        return false;
+    }
+    auto& domCache = SvgDomCache::GetInstance();
+    auto rasterKey = GetRasterKey(imageFit, layout);
+    auto raster = domCache.GetRaster(rasterKey);
+    if (!raster) {
+        RSBitmap bitmap;
+        RSBitmapFormat format { RSColorType::COLORTYPE_RGBA_8888, RSAlphaType::ALPHATYPE_PREMUL };
+        bitmap.Build(width, height, format);
+        bitmap.ClearWithColor(RSColor::COLOR_TRANSPARENT);
+        RSCanvas rasterCanvas;
+        rasterCanvas.Bind(bitmap);
+        // the raster is shared by images of different radii, the corners are clipped on the canvas of each of them.
+        DrawSharedTree(rasterCanvas, imageFit, layout, false);
+        raster = std::make_shared<RSImage>();
+        CHECK_NULL_RETURN(raster->BuildFromBitmap(bitmap), false);
+        domCache.PutRaster(rasterKey, raster, size);
+    }
+    layout_ = layout;
+    canvas.Save();
+    RSRect clipRect(0.0f, 0.0f, layout.Width(), layout.Height());
+    if (radius_) {
+        ImagePainterUtils::ClipRRect(canvas, clipRect, *radius_);
+    } else {
+        canvas.ClipRect(clipRect, RSClipOp::INTERSECT);
+    }
+    canvas.DrawImage(*raster, 0.0f, 0.0f, RSSamplingOptions());
+    canvas.Restore();
+    return true;
+}
+
+std::string SvgDom::GetRasterKey(const ImageFit& imageFit, const Size& layout) const
+{
+    // lengths in vp are drawn at the density of the pipeline of the image.
+    auto density = funcNormalizeToPx_ ? funcNormalizeToPx_(Dimension(1.0, DimensionUnit::VP)) : 1.0;
+    return treeKey_ + ":" + (fillColor_ ? std::to_string(fillColor_->GetValue()) : "") + ":" +
+           std::to_string(static_cast<int32_t>(imageFit)) + ":" + std::to_string(layout.Width()) + "x" +
+           std::to_string(layout.Height()) + ":" + std::to_string(density);
+}
+
+void SvgDom::FitImage(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout, bool clipRadius)
 {
     // scale svg to layout_ with ImageFit applied
     double scaleX = 1.0;
@@ -354,7 +517,7 @@ void SvgDom::FitImage(RSCanvas& canvas, const ImageFit& imageFit, const Size& la
         }
     }
     RSRect clipRect(0.0f, 0.0f, layout_.Width(), layout_.Height());
-    if (radius_) {
+    if (radius_ && clipRadius) {
         ImagePainterUtils::ClipRRect(canvas, clipRect, *radius_);
     } else {
         canvas.ClipRect(clipRect, RSClipOp::INTERSECT);
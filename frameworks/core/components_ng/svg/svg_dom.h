@@ -18,9 +18,8 @@
 
 #include <memory>
 
+#include "include/core/SkStream.h"
 #include "src/xml/SkDOM.h"
-#include "src/xml/SkXMLParser.h"
-#include "src/xml/SkXMLWriter.h"
 
 #include "base/memory/ace_type.h"
 #include "core/components_ng/image_provider/svg_dom_base.h"
@@ -28,6 +27,7 @@
 #include "core/components_ng/svg/parse/svg_node.h"
 #include "core/components_ng/svg/parse/svg_style.h"
 #include "core/components_ng/svg/svg_context.h"
+#include "core/components_ng/svg/svg_dom_cache.h"
 
 namespace OHOS::Ace::NG {
 class SvgDom : public SvgDomBase {
@@ -60,12 +60,20 @@ public:
     void PushAnimatorOnFinishCallback(const RefPtr<SvgNode>& root, std::function<void()> onFinishCallback);
 
 protected:
-    void FitImage(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout);
+    void FitImage(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout, bool clipRadius = true);
     void FitViewPort(const Size& layout);
 
 private:
+    bool InitRoot();
+    void ShareTree(const std::shared_ptr<SvgDomTree>& tree);
+    void DrawTree(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout, bool clipRadius);
+    void DrawSharedTree(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout, bool clipRadius);
+    bool DrawRaster(RSCanvas& canvas, const ImageFit& imageFit, const Size& layout);
+    std::string GetRasterKey(const ImageFit& imageFit, const Size& layout) const;
     RefPtr<SvgNode> TranslateSvgNode(const SkDOM& dom, const SkDOM::Node* xmlNode, const RefPtr<SvgNode>& parent);
+    RefPtr<SvgNode> TranslateSvgNode(const SvgTemplateNode& templateNode, const RefPtr<SvgNode>& parent);
     void ParseAttrs(const SkDOM& xmlDom, const SkDOM::Node* xmlNode, const RefPtr<SvgNode>& svgNode);
+    void ParseAttrs(const SvgTemplateNode& templateNode, const RefPtr<SvgNode>& svgNode);
     void SetAttrValue(const std::string& name, const std::string& value, const RefPtr<SvgNode>& svgNode);
     void ParseIdAttr(const WeakPtr<SvgNode>& weakSvgNode, const std::string& value);
     void ParseFillAttr(const WeakPtr<SvgNode>& weakSvgNode, const std::string& value);
@@ -82,6 +90,10 @@ private:
     float smoothEdge_ = 0.0f;
     std::optional<ImageColorFilter> colorFilter_;
     std::function<void()> onFinishCallback_;
+    // set when the nodes are shared with the other images of a static source, see SvgDomCache.
+    std::shared_ptr<SvgDomTree> sharedTree_;
+    std::string treeKey_;
+    FuncNormalizeToPx funcNormalizeToPx_;
 };
 } // namespace OHOS::Ace::NG
 
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/svg/svg_dom_cache.h"
+
+#include <functional>
+#include <string_view>
+
+#include "src/xml/SkDOM.h"
+
+#include "base/log/log.h"
+#include "base/utils/string_utils.h"
+#include "base/utils/system_properties.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+
+constexpr char ANIMATION_TAG_PREFIX[] = "animate";
+
+void TranslateXmlNode(const SkDOM& dom, const SkDOM::Node* xmlNode, SvgTemplateNode& templateNode)
+{
+    const char* name = dom.getName(xmlNode);
+    templateNode.name = name ? name : "";
+    templateNode.isText = dom.getType(xmlNode) == SkDOM::kText_Type;
+    templateNode.animated = !templateNode.isText && StringUtils::StartWith(templateNode.name, ANIMATION_TAG_PREFIX);
+    const char* attrName = nullptr;
+    const char* attrValue = nullptr;
+    SkDOM::AttrIter attrIter(dom, xmlNode);
+    while ((attrName = attrIter.next(&attrValue))) {
+        templateNode.attrs.emplace_back(attrName, attrValue ? attrValue : "");
+    }
+    for (auto* child = dom.getFirstChild(xmlNode, nullptr); child; child = dom.getNextSibling(child)) {
+        auto& childNode = templateNode.children.emplace_back();
+        TranslateXmlNode(dom, child, childNode);
+        templateNode.animated = templateNode.animated || childNode.animated;
+    }
+}
+
+size_t GetHeapSize(const SvgTemplateNode& templateNode)
+{
+    auto size = templateNode.name.capacity() +
+                templateNode.attrs.capacity() * sizeof(decltype(templateNode.attrs)::value_type) +
+                templateNode.children.capacity() * sizeof(SvgTemplateNode);
+    for (const auto& [name, value] : templateNode.attrs) {
+        size += name.capacity() + value.capacity();
+    }
+    for (const auto& child : templateNode.children) {
+        size += GetHeapSize(child);
+    }
+    return size;
+}
+
+size_t GetElementCount(const SvgTemplateNode& templateNode)
+{
+    size_t count = templateNode.isText ? 0 : 1;
+    for (const auto& child : templateNode.children) {
+        count += GetElementCount(child);
+    }
+    return count;
+}
+
+} // namespace
+
+SvgDomCache& SvgDomCache::GetInstance()
+{
+    static SvgDomCache instance;
+    return instance;
+}
+
+std::string SvgDomCache::GetCacheKey(const std::string& src, SkStream& svgStream)
+{
+    // only a stream in memory can be hashed without being consumed.
+    const auto* data = static_cast<const char*>(svgStream.getMemoryBase());
+    auto size = svgStream.hasLength() ? svgStream.getLength() : 0;
+    if (!SystemProperties::IsSvgDomCacheEnabled() || !data || size == 0 || size > MAX_CONTENT_SIZE) {
+        return "";
+    }
+    // the content is hashed as well, as a file may be replaced under the same source.
+    auto contentHash = std::hash<std::string_view>()(std::string_view(data, size));
+    return std::to_string(contentHash) + ":" + std::to_string(size) + ":" + src;
+}
+
+std::shared_ptr<const SvgTemplateNode> SvgDomCache::GetTemplate(const std::string& cacheKey, SkStream& svgStream)
+{
+    if (cacheKey.empty()) {
+        return Parse(svgStream);
+    }
+    auto cached = cache_.Get(cacheKey);
+    if (cached) {
+        return cached;
+    }
+    auto svgTemplate = Parse(svgStream);
+    CHECK_NULL_RETURN(svgTemplate, nullptr);
+    cache_.Put(cacheKey, svgTemplate, GetMemorySize(*svgTemplate));
+    return svgTemplate;
+}
+
+void SvgDomCache::PutTree(
+    const std::string& treeKey, const std::shared_ptr<SvgDomTree>& tree, const SvgTemplateNode& source)
+{
+    CHECK_NULL_VOID(tree);
+    // the attributes of the nodes are parsed from the strings of the template, each node adds its base attributes.
+    trees_.Put(treeKey, tree, GetMemorySize(source) + GetElementCount(source) * sizeof(SvgNode));
+}
+
+void SvgDomCache::Clear()
+{
+    cache_.Clear();
+    trees_.Clear();
+    rasters_.Clear();
+}
+
+std::shared_ptr<const SvgTemplateNode> SvgDomCache::Parse(SkStream& svgStream)
+{
+    SkDOM xmlDom;
+    if (!xmlDom.build(svgStream)) {
+        LOGE("Failed to parse xml file.");
+        return nullptr;
+    }
+    const auto* rootNode = xmlDom.getRootNode();
+    CHECK_NULL_RETURN(rootNode, nullptr);
+    auto svgTemplate = std::make_shared<SvgTemplateNode>();
+    TranslateXmlNode(xmlDom, rootNode, *svgTemplate);
+    return svgTemplate;
+}
+
+size_t SvgDomCache::GetMemorySize(const SvgTemplateNode& svgTemplate)
+{
+    return sizeof(SvgTemplateNode) + GetHeapSize(svgTemplate);
+}
+
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SVG_SVG_DOM_CACHE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SVG_SVG_DOM_CACHE_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "include/core/SkStream.h"
+
+#include "base/geometry/rect.h"
+#include "base/geometry/size.h"
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+#include "core/common/lru/sharded_lru_cache.h"
+#include "core/components_ng/render/drawing.h"
+#include "core/components_ng/svg/parse/svg_node.h"
+#include "core/components_ng/svg/svg_context.h"
+
+namespace OHOS::Ace::NG {
+
+// One element or text of a parsed svg source. It only holds what is written in the source, the fill color, the
+// context and the animators of an image are set on the svg nodes built from it.
+struct SvgTemplateNode {
+    // the tag of an element, or the content of a text.
+    std::string name;
+    bool isText = false;
+    // whether the node or one of its descendants is an animation.
+    bool animated = false;
+    std::vector<std::pair<std::string, std::string>> attrs;
+    std::vector<SvgTemplateNode> children;
+};
+
+// The svg nodes built from a static source for a fill color. As they hold no animator, the images showing the same
+// icon draw the same nodes, one at a time, as the viewport and the paint state of an image are set on them when it is
+// drawn.
+struct SvgDomTree {
+    RefPtr<SvgContext> context;
+    RefPtr<SvgNode> root;
+    Size svgSize;
+    Rect viewBox;
+    std::mutex drawMutex;
+};
+
+// Process wide cache of the parsed svg sources, keyed by the source and a hash of its content, so that the images
+// showing the same icon, such as the items of a list or a menu, tokenize its xml only once. The node trees built from
+// the static sources are shared as well, and so are their rasters at the sizes they are drawn at.
+class ACE_EXPORT SvgDomCache final {
+public:
+    static constexpr size_t COUNT_LIMIT = 128;
+    static constexpr size_t SIZE_LIMIT = 4 * 1024 * 1024;
+    // large sources are rarely shown twice, they are parsed without being cached.
+    static constexpr size_t MAX_CONTENT_SIZE = 64 * 1024;
+    static constexpr size_t RASTER_COUNT_LIMIT = 64;
+    static constexpr size_t RASTER_SIZE_LIMIT = 8 * 1024 * 1024;
+    // larger images are drawn from the nodes, a raster of them would evict the icons it is meant for.
+    static constexpr size_t MAX_RASTER_SIZE = 1024 * 1024;
+
+    static SvgDomCache& GetInstance();
+
+    // Returns the key of the stream in the cache, or an empty key when the stream is not to be cached.
+    static std::string GetCacheKey(const std::string& src, SkStream& svgStream);
+
+    // Returns the parsed template of the stream, from the cache when the same source was parsed before.
+    std::shared_ptr<const SvgTemplateNode> GetTemplate(const std::string& cacheKey, SkStream& svgStream);
+
+    std::shared_ptr<SvgDomTree> GetTree(const std::string& treeKey)
+    {
+        return trees_.Get(treeKey);
+    }
+    void PutTree(const std::string& treeKey, const std::shared_ptr<SvgDomTree>& tree, const SvgTemplateNode& source);
+
+    std::shared_ptr<RSImage> GetRaster(const std::string& rasterKey)
+    {
+        return rasters_.Get(rasterKey);
+    }
+    void PutRaster(const std::string& rasterKey, const std::shared_ptr<RSImage>& raster, size_t size)
+    {
+        rasters_.Put(rasterKey, raster, size);
+    }
+
+    void Clear();
+
+    size_t GetCount() const
+    {
+        return cache_.Count();
+    }
+
+    size_t GetTreeCount() const
+    {
+        return trees_.Count();
+    }
+
+    size_t GetRasterCount() const
+    {
+        return rasters_.Count();
+    }
+
+    static std::shared_ptr<const SvgTemplateNode> Parse(SkStream& svgStream);
+    // Estimates the memory held by a template, the size of its source says little as the markup is dropped.
+    static size_t GetMemorySize(const SvgTemplateNode& svgTemplate);
+
+private:
+    SvgDomCache() = default;
+    ~SvgDomCache() = default;
+
+    ShardedLRUCache<std::shared_ptr<const SvgTemplateNode>> cache_ { COUNT_LIMIT, SIZE_LIMIT };
+    ShardedLRUCache<std::shared_ptr<SvgDomTree>> trees_ { COUNT_LIMIT, SIZE_LIMIT };
+    ShardedLRUCache<std::shared_ptr<RSImage>> rasters_ { RASTER_COUNT_LIMIT, RASTER_SIZE_LIMIT };
+
+    ACE_DISALLOW_COPY_AND_MOVE(SvgDomCache);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SVG_SVG_DOM_CACHE_H
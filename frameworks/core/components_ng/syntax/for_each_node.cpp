@@ -15,6 +15,8 @@
 
 #include "core/components_ng/syntax/for_each_node.h"
 
+#include <algorithm>
+
 #include "base/log/ace_trace.h"
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/pattern/list/list_item_pattern.h"
@@ -23,10 +25,20 @@
 
 namespace OHOS::Ace::NG {
 namespace {
-void MakeNodeMapById(const std::list<RefPtr<UINode>>& nodes, const std::list<std::string>& ids,
-    std::map<std::string, RefPtr<UINode>>& result)
+// keys of removed items stay interned until the table outgrows the items of the last two renders this much.
+constexpr size_t KEY_TABLE_PRUNE_FACTOR = 2;
+constexpr size_t KEY_TABLE_MIN_SIZE = 64;
+
+std::unordered_set<uint32_t> MakeIdSet(const std::vector<uint32_t>& ids)
+{
+    return std::unordered_set<uint32_t>(ids.begin(), ids.end());
+}
+
+void MakeNodeMapById(const std::list<RefPtr<UINode>>& nodes, const std::vector<uint32_t>& ids,
+    std::unordered_map<uint32_t, RefPtr<UINode>>& result)
 {
     ACE_DCHECK(ids.size() == nodes.size());
+    result.reserve(ids.size());
     auto idsIter = ids.begin();
     auto nodeIter = nodes.begin();
     while (idsIter != ids.end() && nodeIter != nodes.end()) {
@@ -60,6 +72,7 @@ RefPtr<ForEachNode> ForEachNode::GetOrCreateRepeatNode(int32_t nodeId)
 void ForEachNode::CreateTempItems()
 {
     std::swap(ids_, tempIds_);
+    std::swap(keyIds_, tempKeyIds_);
     std::swap(ModifyChildren(), tempChildren_);
 
     // RepeatNode only
@@ -68,6 +81,28 @@ void ForEachNode::CreateTempItems()
     }
 }
 
+void ForEachNode::SetIds(std::list<std::string>&& ids)
+{
+    ids_ = std::move(ids);
+    if (keyTable_.size() > KEY_TABLE_PRUNE_FACTOR * (ids_.size() + tempIds_.size()) + KEY_TABLE_MIN_SIZE) {
+        // the previous render is interned again, the diff compares the new ids with its ids.
+        keyTable_.clear();
+        tempKeyIds_ = InternKeys(tempIds_);
+    }
+    keyIds_ = InternKeys(ids_);
+}
+
+std::vector<uint32_t> ForEachNode::InternKeys(const std::list<std::string>& ids)
+{
+    std::vector<uint32_t> keyIds;
+    keyIds.reserve(ids.size());
+    for (const auto& id : ids) {
+        auto nextKeyId = static_cast<uint32_t>(keyTable_.size());
+        keyIds.emplace_back(keyTable_.try_emplace(id, nextKeyId).first->second);
+    }
+    return keyIds;
+}
+
 // same as foundation/arkui/ace_engine/frameworks/core/components_part_upd/foreach/foreach_element.cpp.
 void ForEachNode::CompareAndUpdateChildren()
 {
@@ -75,14 +110,10 @@ void ForEachNode::CompareAndUpdateChildren()
         return;
     }
 
-    // result of id gen function of most re-recent render
-    // create a map for quicker find/search
-    std::unordered_set<std::string> newIdsSet(ids_.begin(), ids_.end());
-
     // result of id gen function of previous render/re-render
     // create a map for quicker find/search
-    std::unordered_set<std::string> oldIdsSet(tempIds_.begin(), tempIds_.end());
-    std::unordered_set<std::string> tempOldIdsSet(tempIds_.begin(), tempIds_.end());
+    std::unordered_set<uint32_t> oldIdsSet = MakeIdSet(tempKeyIds_);
+    std::unordered_set<uint32_t> tempOldIdsSet = oldIdsSet;
 
     // ForEachNode only includes children for newly created_ array items
     // it does not include children of array items that were rendered on a previous
@@ -92,16 +123,13 @@ void ForEachNode::CompareAndUpdateChildren()
 
     // create map id -> Node
     // old children
-    std::map<std::string, RefPtr<UINode>> oldNodeByIdMap;
-    MakeNodeMapById(tempChildren_, tempIds_, oldNodeByIdMap);
+    std::unordered_map<uint32_t, RefPtr<UINode>> oldNodeByIdMap;
+    MakeNodeMapById(tempChildren_, tempKeyIds_, oldNodeByIdMap);
     // swap new children to tempChildren, old children back to children
     std::swap(children, tempChildren_);
 
-    for (const auto& newId : ids_) {
-        auto oldIdIt = tempOldIdsSet.find(newId);
-        if (oldIdIt != tempOldIdsSet.end()) {
-            tempOldIdsSet.erase(oldIdIt);
-        }
+    for (const auto& newId : keyIds_) {
+        tempOldIdsSet.erase(newId);
     }
 
     for (const auto& oldId : tempOldIdsSet) {
@@ -133,22 +161,22 @@ void ForEachNode::CompareAndUpdateChildren()
     }
 }
 
-void ForEachNode::MappingChildWithId(std::unordered_set<std::string>& oldIdsSet,
-    std::list<RefPtr<UINode>>& additionalChildComps, std::map<std::string, RefPtr<UINode>>& oldNodeByIdMap)
+void ForEachNode::MappingChildWithId(std::unordered_set<uint32_t>& oldIdsSet,
+    std::list<RefPtr<UINode>>& additionalChildComps, std::unordered_map<uint32_t, RefPtr<UINode>>& oldNodeByIdMap)
 {
-    int32_t additionalChildIndex = 0;
-    for (const auto& newId : ids_) {
+    // new children are consumed in order, walk them once instead of advancing from begin for each new id.
+    auto newCompsIter = additionalChildComps.begin();
+    for (const auto& newId : keyIds_) {
         auto oldIdIt = oldIdsSet.find(newId);
         if (oldIdIt == oldIdsSet.end()) {
             // found a newly added ID
             // insert new child item.
-            auto newCompsIter = additionalChildComps.begin();
-            std::advance(newCompsIter, additionalChildIndex++);
             if (newCompsIter != additionalChildComps.end()) {
                 // Call AddChild to execute AttachToMainTree of new child.
                 // Allow adding default transition.
                 AddChild(*newCompsIter, DEFAULT_NODE_SLOT, false, true);
                 InitDragManager(*newCompsIter);
+                ++newCompsIter;
             }
         } else {
             auto iter = oldNodeByIdMap.find(newId);
@@ -162,11 +190,13 @@ void ForEachNode::MappingChildWithId(std::unordered_set<std::string>& oldIdsSet,
 
 void ForEachNode::FlushUpdateAndMarkDirty()
 {
-    if (ids_ == tempIds_ && !isThisRepeatNode_) {
+    if (keyIds_ == tempKeyIds_ && !isThisRepeatNode_) {
         tempIds_.clear();
+        tempKeyIds_.clear();
         return;
     }
     tempIds_.clear();
+    tempKeyIds_.clear();
     // mark parent dirty to flush measure.
     MarkNeedSyncRenderTree(true);
     MarkNeedFrameFlushDirty(PROPERTY_UPDATE_MEASURE_SELF_AND_PARENT | PROPERTY_UPDATE_BY_CHILD_REQUEST);
@@ -260,11 +290,16 @@ void ForEachNode::MoveData(int32_t from, int32_t to)
 
     auto idIter = ids_.begin();
     std::advance(idIter, from);
-    auto id = *idIter;
+    auto id = std::move(*idIter);
     ids_.erase(idIter);
     idIter = ids_.begin();
     std::advance(idIter, to);
-    ids_.insert(idIter, id);
+    ids_.insert(idIter, std::move(id));
+    if (from >= 0 && to >= 0 && static_cast<size_t>(std::max(from, to)) < keyIds_.size()) {
+        auto keyId = keyIds_[from];
+        keyIds_.erase(keyIds_.begin() + from);
+        keyIds_.insert(keyIds_.begin() + to, keyId);
+    }
 
     auto& children = ModifyChildren();
     auto fromIter = children.begin();
@@ -20,6 +20,9 @@
 #include <list>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "base/utils/macros.h"
 #include "core/components_ng/base/ui_node.h"
@@ -61,25 +64,30 @@ public:
         return tempIds_;
     }
 
-    void SetIds(std::list<std::string>&& ids)
-    {
-        ids_ = std::move(ids);
-    }
+    void SetIds(std::list<std::string>&& ids);
 
     void SetOnMove(std::function<void(int32_t, int32_t)>&& onMove);
     void MoveData(int32_t from, int32_t to) override;
     RefPtr<FrameNode> GetFrameNode(int32_t index) override;
     void InitDragManager(const RefPtr<UINode>& childNode);
     void InitAllChildrenDragManager(bool init);
-    void MappingChildWithId(std::unordered_set<std::string>& oldIdsSet, std::list<RefPtr<UINode>>& additionalChildComps,
-        std::map<std::string, RefPtr<UINode>>& oldNodeByIdMap);
+    void MappingChildWithId(std::unordered_set<uint32_t>& oldIdsSet, std::list<RefPtr<UINode>>& additionalChildComps,
+        std::unordered_map<uint32_t, RefPtr<UINode>>& oldNodeByIdMap);
 private:
+    std::vector<uint32_t> InternKeys(const std::list<std::string>& ids);
+
     std::list<std::string> ids_;
+    // ids_ interned in keyTable_, in the same order, so the diff compares and hashes integers instead of key strings.
+    std::vector<uint32_t> keyIds_;
 
     // temp items use to compare each update.
     std::list<std::string> tempIds_;
+    std::vector<uint32_t> tempKeyIds_;
     std::list<RefPtr<UINode>> tempChildren_;
 
+    // the keys are interned per node, on the UI thread the node is updated on, so no lock is taken.
+    std::unordered_map<std::string, uint32_t> keyTable_;
+
     // RepeatNode only
     std::vector<RefPtr<UINode>> tempChildrenOfRepeat_;
 
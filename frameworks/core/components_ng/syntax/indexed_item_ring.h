@@ -0,0 +1,463 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_INDEXED_ITEM_RING_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_INDEXED_ITEM_RING_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace OHOS::Ace::NG {
+
+// Index ordered item store for the window of built items of a lazy container. Items are kept sorted by index in a
+// circular buffer, so adding or dropping items at either end of the window costs O(1) and scrolling the window by
+// delta items costs O(delta). An index inside a gap-free window is found in O(1), otherwise by binary search.
+// The interface follows the part of std::map<int32_t, T> the lazy builders use; unlike std::map, inserting or erasing
+// an item invalidates iterators to other items.
+template<typename T>
+class IndexedItemRing final {
+public:
+    using key_type = int32_t;
+    using mapped_type = T;
+    using value_type = std::pair<int32_t, T>;
+    using size_type = size_t;
+
+    template<bool IS_CONST>
+    class Iterator {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = IndexedItemRing::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<IS_CONST, const value_type*, value_type*>;
+        using reference = std::conditional_t<IS_CONST, const value_type&, value_type&>;
+        using Owner = std::conditional_t<IS_CONST, const IndexedItemRing*, IndexedItemRing*>;
+
+        Iterator() = default;
+        Iterator(Owner owner, size_t pos) : owner_(owner), pos_(pos) {}
+        // non-const to const conversion.
+        template<bool OTHER_CONST, typename = std::enable_if_t<IS_CONST && !OTHER_CONST>>
+        Iterator(const Iterator<OTHER_CONST>& other) : owner_(other.owner_), pos_(other.pos_)
+        {}
+
+        reference operator*() const
+        {
+            return owner_->At(pos_);
+        }
+
+        pointer operator->() const
+        {
+            return &owner_->At(pos_);
+        }
+
+        Iterator& operator++()
+        {
+            ++pos_;
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator iter = *this;
+            ++pos_;
+            return iter;
+        }
+
+        Iterator& operator--()
+        {
+            --pos_;
+            return *this;
+        }
+
+        Iterator operator--(int)
+        {
+            Iterator iter = *this;
+            --pos_;
+            return iter;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return owner_ == other.owner_ && pos_ == other.pos_;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        Owner owner_ = nullptr;
+        size_t pos_ = 0;
+
+        friend class IndexedItemRing;
+        friend class Iterator<!IS_CONST>;
+    };
+
+    using iterator = Iterator<false>;
+    using const_iterator = Iterator<true>;
+    using reverse_iterator = std::reverse_iterator<iterator>;
+    using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+    IndexedItemRing() = default;
+    ~IndexedItemRing() = default;
+
+    IndexedItemRing(const IndexedItemRing& other)
+    {
+        CopyFrom(other);
+    }
+
+    IndexedItemRing& operator=(const IndexedItemRing& other)
+    {
+        if (this != &other) {
+            clear();
+            CopyFrom(other);
+        }
+        return *this;
+    }
+
+    IndexedItemRing(IndexedItemRing&& other) noexcept
+        : buffer_(std::move(other.buffer_)), head_(other.head_), size_(other.size_)
+    {
+        other.buffer_.clear();
+        other.head_ = 0;
+        other.size_ = 0;
+    }
+
+    IndexedItemRing& operator=(IndexedItemRing&& other) noexcept
+    {
+        if (this != &other) {
+            buffer_ = std::move(other.buffer_);
+            head_ = other.head_;
+            size_ = other.size_;
+            other.buffer_.clear();
+            other.head_ = 0;
+            other.size_ = 0;
+        }
+        return *this;
+    }
+
+    iterator begin()
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end()
+    {
+        return iterator(this, size_);
+    }
+
+    const_iterator begin() const
+    {
+        return const_iterator(this, 0);
+    }
+
+    const_iterator end() const
+    {
+        return const_iterator(this, size_);
+    }
+
+    reverse_iterator rbegin()
+    {
+        return reverse_iterator(end());
+    }
+
+    reverse_iterator rend()
+    {
+        return reverse_iterator(begin());
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+        return const_reverse_iterator(end());
+    }
+
+    const_reverse_iterator rend() const
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    iterator find(int32_t index)
+    {
+        auto pos = LowerBound(index);
+        return (pos < size_ && At(pos).first == index) ? iterator(this, pos) : end();
+    }
+
+    const_iterator find(int32_t index) const
+    {
+        auto pos = LowerBound(index);
+        return (pos < size_ && At(pos).first == index) ? const_iterator(this, pos) : end();
+    }
+
+    size_t count(int32_t index) const
+    {
+        return find(index) == end() ? 0 : 1;
+    }
+
+    // Keeps the existing item if index is already present, as std::map::try_emplace does.
+    template<typename... Args>
+    std::pair<iterator, bool> try_emplace(int32_t index, Args&&... args)
+    {
+        auto pos = LowerBound(index);
+        if (pos < size_ && At(pos).first == index) {
+            return { iterator(this, pos), false };
+        }
+        InsertAt(pos, value_type(std::piecewise_construct, std::forward_as_tuple(index),
+            std::forward_as_tuple(std::forward<Args>(args)...)));
+        return { iterator(this, pos), true };
+    }
+
+    template<typename V>
+    std::pair<iterator, bool> emplace(int32_t index, V&& value)
+    {
+        return try_emplace(index, std::forward<V>(value));
+    }
+
+    T& operator[](int32_t index)
+    {
+        return try_emplace(index).first->second;
+    }
+
+    // Returns the iterator to the item after the erased one.
+    iterator erase(const_iterator iter)
+    {
+        auto pos = iter.pos_;
+        auto mask = buffer_.size() - 1;
+        if (pos < size_ - 1 - pos) {
+            // shift the items in front of pos one slot towards the back.
+            for (size_t i = pos; i > 0; --i) {
+                buffer_[(head_ + i) & mask] = std::move(buffer_[(head_ + i - 1) & mask]);
+            }
+            buffer_[head_] = value_type();
+            head_ = (head_ + 1) & mask;
+        } else {
+            for (size_t i = pos; i + 1 < size_; ++i) {
+                buffer_[(head_ + i) & mask] = std::move(buffer_[(head_ + i + 1) & mask]);
+            }
+            buffer_[(head_ + size_ - 1) & mask] = value_type();
+        }
+        --size_;
+        return iterator(this, pos);
+    }
+
+    iterator erase(iterator iter)
+    {
+        return erase(const_iterator(iter));
+    }
+
+    size_t erase(int32_t index)
+    {
+        auto iter = find(index);
+        if (iter == end()) {
+            return 0;
+        }
+        erase(iter);
+        return 1;
+    }
+
+    // Erases the items pred returns true for in one pass, which costs O(size) however many items are erased. pred
+    // is called once per item in index order and may move the item out before returning true.
+    template<typename Pred>
+    size_t RemoveIf(Pred&& pred)
+    {
+        size_t kept = 0;
+        for (size_t pos = 0; pos < size_; ++pos) {
+            if (pred(At(pos))) {
+                continue;
+            }
+            if (kept != pos) {
+                At(kept) = std::move(At(pos));
+            }
+            ++kept;
+        }
+        auto removed = size_ - kept;
+        for (size_t pos = kept; pos < size_; ++pos) {
+            At(pos) = value_type();
+        }
+        size_ = kept;
+        return removed;
+    }
+
+    // Moves the items at or after index by delta positions in place. The caller makes sure the moved items do not
+    // pass the items before index.
+    void ShiftIndexes(int32_t index, int32_t delta)
+    {
+        for (auto pos = LowerBound(index); pos < size_; ++pos) {
+            At(pos).first += delta;
+        }
+    }
+
+    // Moves the item at from to to in place, and the items between them by one position to fill the gap, as moving
+    // an item of the data source does. Costs O(distance) whether the item at from is present or not.
+    void MoveIndex(int32_t from, int32_t to)
+    {
+        if (from == to) {
+            return;
+        }
+        auto fromPos = LowerBound(from);
+        bool hasFrom = fromPos < size_ && At(fromPos).first == from;
+        if (from < to) {
+            auto endPos = LowerBound(to + 1);
+            for (auto pos = hasFrom ? fromPos + 1 : fromPos; pos < endPos; ++pos) {
+                --At(pos).first;
+            }
+            if (hasFrom) {
+                At(fromPos).first = to;
+                for (auto pos = fromPos; pos + 1 < endPos; ++pos) {
+                    std::swap(At(pos), At(pos + 1));
+                }
+            }
+            return;
+        }
+        auto startPos = LowerBound(to);
+        for (auto pos = startPos; pos < fromPos; ++pos) {
+            ++At(pos).first;
+        }
+        if (hasFrom) {
+            At(fromPos).first = to;
+            for (auto pos = fromPos; pos > startPos; --pos) {
+                std::swap(At(pos), At(pos - 1));
+            }
+        }
+    }
+
+    // Drops the items but keeps the buffer for the next window.
+    void clear()
+    {
+        auto mask = buffer_.size() - 1;
+        for (size_t i = 0; i < size_; ++i) {
+            buffer_[(head_ + i) & mask] = value_type();
+        }
+        head_ = 0;
+        size_ = 0;
+    }
+
+private:
+    static constexpr size_t MIN_CAPACITY = 8;
+
+    value_type& At(size_t pos)
+    {
+        return buffer_[(head_ + pos) & (buffer_.size() - 1)];
+    }
+
+    const value_type& At(size_t pos) const
+    {
+        return buffer_[(head_ + pos) & (buffer_.size() - 1)];
+    }
+
+    // Position of the first item whose index is not less than index.
+    size_t LowerBound(int32_t index) const
+    {
+        if (size_ == 0) {
+            return 0;
+        }
+        auto front = At(0).first;
+        if (index <= front) {
+            return 0;
+        }
+        if (index > At(size_ - 1).first) {
+            return size_;
+        }
+        // a window without gaps holds index at index - front.
+        auto offset = static_cast<size_t>(static_cast<int64_t>(index) - front);
+        if (offset < size_ && At(offset).first == index) {
+            return offset;
+        }
+        size_t low = 1;
+        size_t high = size_ - 1;
+        while (low < high) {
+            auto mid = low + (high - low) / 2;
+            if (At(mid).first < index) {
+                low = mid + 1;
+            } else {
+                high = mid;
+            }
+        }
+        return low;
+    }
+
+    void InsertAt(size_t pos, value_type&& value)
+    {
+        if (size_ == buffer_.size()) {
+            Grow();
+        }
+        auto mask = buffer_.size() - 1;
+        if (pos < size_ - pos) {
+            // open the slot by moving the items in front of pos one slot towards the front.
+            head_ = (head_ + mask) & mask;
+            for (size_t i = 0; i < pos; ++i) {
+                buffer_[(head_ + i) & mask] = std::move(buffer_[(head_ + i + 1) & mask]);
+            }
+        } else {
+            for (size_t i = size_; i > pos; --i) {
+                buffer_[(head_ + i) & mask] = std::move(buffer_[(head_ + i - 1) & mask]);
+            }
+        }
+        buffer_[(head_ + pos) & mask] = std::move(value);
+        ++size_;
+    }
+
+    void Grow()
+    {
+        std::vector<value_type> buffer(buffer_.empty() ? MIN_CAPACITY : buffer_.size() * 2);
+        for (size_t i = 0; i < size_; ++i) {
+            buffer[i] = std::move(At(i));
+        }
+        buffer_.swap(buffer);
+        head_ = 0;
+    }
+
+    void CopyFrom(const IndexedItemRing& other)
+    {
+        if (other.size_ == 0) {
+            return;
+        }
+        if (buffer_.size() < other.size_) {
+            size_t capacity = MIN_CAPACITY;
+            while (capacity < other.size_) {
+                capacity *= 2;
+            }
+            buffer_.assign(capacity, value_type());
+        }
+        for (size_t i = 0; i < other.size_; ++i) {
+            buffer_[i] = other.At(i);
+        }
+        head_ = 0;
+        size_ = other.size_;
+    }
+
+    // capacity is zero or a power of two, so positions wrap with a mask.
+    std::vector<value_type> buffer_;
+    size_t head_ = 0;
+    size_t size_ = 0;
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_INDEXED_ITEM_RING_H
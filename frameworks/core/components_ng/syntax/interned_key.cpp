@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/components_ng/syntax/interned_key.h"
+
+#include <cstdlib>
+
+#include "base/log/log_wrapper.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+const std::string EMPTY_KEY;
+} // namespace
+
+KeyInternTable& KeyInternTable::GetInstance()
+{
+    // never destroyed, keys held by static objects may be released at exit.
+    static KeyInternTable* instance = new KeyInternTable();
+    return *instance;
+}
+
+InternedKeyId KeyInternTable::Acquire(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto iter = index_.find(std::string_view(key));
+    if (iter != index_.end()) {
+        // may revive a key whose last reference is being released, Remove checks the count again under the lock.
+        GetEntry(iter->second).refCount.fetch_add(1, std::memory_order_relaxed);
+        return iter->second;
+    }
+    auto id = AllocateId();
+    auto& entry = GetEntry(id);
+    entry.key = key;
+    entry.refCount.store(1, std::memory_order_relaxed);
+    entry.inUse = true;
+    index_.emplace(std::string_view(entry.key), id);
+    return id;
+}
+
+void KeyInternTable::Remove(InternedKeyId id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = GetEntry(id);
+    // the key was acquired again, or another release already removed it.
+    if (!entry.inUse || entry.refCount.load(std::memory_order_acquire) > 0) {
+        return;
+    }
+    entry.inUse = false;
+    index_.erase(std::string_view(entry.key));
+    std::string().swap(entry.key);
+    freeIds_.emplace_back(id);
+}
+
+const std::string& KeyInternTable::GetKey(InternedKeyId id) const
+{
+    if (id == INVALID_INTERNED_KEY_ID) {
+        return EMPTY_KEY;
+    }
+    return GetEntry(id).key;
+}
+
+size_t KeyInternTable::Size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return index_.size();
+}
+
+InternedKeyId KeyInternTable::AllocateId()
+{
+    if (!freeIds_.empty()) {
+        auto id = freeIds_.back();
+        freeIds_.pop_back();
+        return id;
+    }
+    auto chunkIndex = nextId_ >> CHUNK_BITS;
+    if (chunkIndex >= MAX_CHUNKS) {
+        // handing out a shared id would make distinct keys equal in every diff and cache.
+        LOGF("key intern table is full, %{public}zu keys are referenced", index_.size());
+        abort();
+    }
+    if (!chunks_[chunkIndex]) {
+        chunks_[chunkIndex] = std::make_unique<Chunk>();
+    }
+    return nextId_++;
+}
+
+const std::string& InternedKey::GetKey() const
+{
+    return KeyInternTable::GetInstance().GetKey(id_);
+}
+
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_INTERNED_KEY_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_INTERNED_KEY_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <unordered_map>
+#include <vector>
+
+#include "base/utils/macros.h"
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace::NG {
+
+using InternedKeyId = uint32_t;
+constexpr InternedKeyId INVALID_INTERNED_KEY_ID = 0;
+
+// Engine wide table of the item keys generated by Repeat. Every distinct key string is stored once and gets a 32-bit
+// id which stays valid while the key is referenced; ids of released keys are reused. Running out of ids aborts, two
+// keys never share an id. Prefer InternedKey, which holds the reference, over the raw Acquire and Release calls.
+class ACE_EXPORT KeyInternTable final {
+public:
+    static KeyInternTable& GetInstance();
+
+    // Returns the id of key and takes a reference to it, adding key to the table if needed.
+    InternedKeyId Acquire(const std::string& key);
+
+    // The caller holds a reference to id, so copying a key only touches its counter.
+    void AddRef(InternedKeyId id)
+    {
+        GetEntry(id).refCount.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Only the release of the last reference locks the table.
+    void Release(InternedKeyId id)
+    {
+        if (GetEntry(id).refCount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            Remove(id);
+        }
+    }
+
+    // The returned string stays valid while the caller holds a reference to id.
+    const std::string& GetKey(InternedKeyId id) const;
+
+    size_t Size() const;
+
+private:
+    KeyInternTable() = default;
+    ~KeyInternTable() = default;
+
+    struct Entry {
+        std::string key;
+        std::atomic<uint32_t> refCount { 0 };
+        // guarded by mutex_, false once the id is back in freeIds_.
+        bool inUse = false;
+    };
+
+    static constexpr uint32_t CHUNK_BITS = 12;
+    static constexpr uint32_t CHUNK_SIZE = 1 << CHUNK_BITS;
+    static constexpr uint32_t MAX_CHUNKS = 1 << 12;
+    using Chunk = std::array<Entry, CHUNK_SIZE>;
+
+    Entry& GetEntry(InternedKeyId id) const
+    {
+        return (*chunks_[id >> CHUNK_BITS])[id & (CHUNK_SIZE - 1)];
+    }
+
+    InternedKeyId AllocateId();
+    void Remove(InternedKeyId id);
+
+    mutable std::mutex mutex_;
+    // entries never move, so keys are read without the lock and the index can view them.
+    std::array<std::unique_ptr<Chunk>, MAX_CHUNKS> chunks_;
+    std::unordered_map<std::string_view, InternedKeyId> index_;
+    std::vector<InternedKeyId> freeIds_;
+    // id 0 is INVALID_INTERNED_KEY_ID.
+    InternedKeyId nextId_ = 1;
+
+    ACE_DISALLOW_COPY_AND_MOVE(KeyInternTable);
+};
+
+// Reference to a key in KeyInternTable. Keys compare and hash by id in O(1).
+class ACE_EXPORT InternedKey final {
+public:
+    InternedKey() = default;
+    explicit InternedKey(const std::string& key) : id_(KeyInternTable::GetInstance().Acquire(key)) {}
+
+    ~InternedKey()
+    {
+        if (id_ != INVALID_INTERNED_KEY_ID) {
+            KeyInternTable::GetInstance().Release(id_);
+        }
+    }
+
+    InternedKey(const InternedKey& other) : id_(other.id_)
+    {
+        if (id_ != INVALID_INTERNED_KEY_ID) {
+            KeyInternTable::GetInstance().AddRef(id_);
+        }
+    }
+
+    InternedKey(InternedKey&& other) noexcept : id_(other.id_)
+    {
+        other.id_ = INVALID_INTERNED_KEY_ID;
+    }
+
+    InternedKey& operator=(const InternedKey& other)
+    {
+        InternedKey copy(other);
+        std::swap(id_, copy.id_);
+        return *this;
+    }
+
+    InternedKey& operator=(InternedKey&& other) noexcept
+    {
+        std::swap(id_, other.id_);
+        return *this;
+    }
+
+    InternedKeyId GetId() const
+    {
+        return id_;
+    }
+
+    bool IsValid() const
+    {
+        return id_ != INVALID_INTERNED_KEY_ID;
+    }
+
+    const std::string& GetKey() const;
+
+    bool operator==(const InternedKey& other) const
+    {
+        return id_ == other.id_;
+    }
+
+    bool operator!=(const InternedKey& other) const
+    {
+        return id_ != other.id_;
+    }
+
+private:
+    InternedKeyId id_ = INVALID_INTERNED_KEY_ID;
+};
+
+struct InternedKeyHash {
+    size_t operator()(const InternedKey& key) const
+    {
+        return key.GetId();
+    }
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_COMPONENTS_NG_SYNTAX_INTERNED_KEY_H
@@ -74,14 +74,7 @@ namespace OHOS::Ace::NG {
     bool LazyForEachBuilder::OnDataAdded(size_t index)
     {
         NotifyDataAdded(index);
-        if (!cachedItems_.empty() && index <= static_cast<size_t>(cachedItems_.rbegin()->first)) {
-            decltype(cachedItems_) temp(std::move(cachedItems_));
-
-            for (auto& [oldindex, id] : temp) {
-                cachedItems_.try_emplace(
-                    index > static_cast<size_t>(oldindex) ? oldindex : oldindex + 1, std::move(id));
-            }
-        }
+        cachedItems_.ShiftIndexes(static_cast<int32_t>(index), 1);
         for (auto& [key, node] : expiringItem_) {
             if (static_cast<size_t>(node.first) >= index && node.first != -1) {
                 node.first++;
@@ -93,14 +86,7 @@ namespace OHOS::Ace::NG {
 
     bool LazyForEachBuilder::OnDataBulkAdded(size_t index, size_t count)
     {
-        if (!cachedItems_.empty() && index <= static_cast<size_t>(cachedItems_.rbegin()->first)) {
-            decltype(cachedItems_) temp(std::move(cachedItems_));
-
-            for (auto& [oldindex, id] : temp) {
-                cachedItems_.try_emplace(
-                    index > static_cast<size_t>(oldindex) ? oldindex : oldindex + count, std::move(id));
-            }
-        }
+        cachedItems_.ShiftIndexes(static_cast<int32_t>(index), static_cast<int32_t>(count));
         for (auto& [key, node] : expiringItem_) {
             if (static_cast<size_t>(node.first) >= index && node.first != -1) {
                 node.first = node.first + static_cast<int32_t>(count);
@@ -116,19 +102,13 @@ namespace OHOS::Ace::NG {
         if (cachedItems_.empty()) {
             return node;
         }
-        if (index <= static_cast<size_t>(cachedItems_.rbegin()->first)) {
-            decltype(cachedItems_) temp(std::move(cachedItems_));
-
-            for (auto& [oldindex, child] : temp) {
-                if (static_cast<size_t>(oldindex) == index) {
-                    node = child.second;
-                    KeepRemovedItemInCache(child, expiringItem_);
-                } else {
-                    cachedItems_.try_emplace(
-                        index > static_cast<size_t>(oldindex) ? oldindex : oldindex - 1, std::move(child));
-                }
-            }
+        auto iter = cachedItems_.find(static_cast<int32_t>(index));
+        if (iter != cachedItems_.end()) {
+            node = iter->second.second;
+            KeepRemovedItemInCache(iter->second, expiringItem_);
+            cachedItems_.erase(iter);
         }
+        cachedItems_.ShiftIndexes(static_cast<int32_t>(index), -1);
         NotifyDataDeleted(node, index, false);
         for (auto& [key, child] : expiringItem_) {
             if (static_cast<size_t>(child.first) > index) {
@@ -149,18 +129,14 @@ namespace OHOS::Ace::NG {
         if (cachedItems_.empty()) {
             return nodeList_;
         }
-        if (index <= static_cast<size_t>(cachedItems_.rbegin()->first)) {
-            decltype(cachedItems_) temp(std::move(cachedItems_));
-
-            for (auto& [oldindex, child] : temp) {
-                if (static_cast<size_t>(oldindex) >= index && static_cast<size_t>(oldindex) < index + count) {
-                    nodeList_.emplace_back(child.first, child.second);
-                } else {
-                    cachedItems_.try_emplace(
-                        index > static_cast<size_t>(oldindex) ? oldindex : oldindex - count, std::move(child));
-                }
+        cachedItems_.RemoveIf([this, index, count](const auto& item) {
+            if (static_cast<size_t>(item.first) < index || static_cast<size_t>(item.first) >= index + count) {
+                return false;
             }
-        }
+            nodeList_.emplace_back(item.second.first, item.second.second);
+            return true;
+        });
+        cachedItems_.ShiftIndexes(static_cast<int32_t>(index), -static_cast<int32_t>(count));
         for (auto& [key, child] : expiringItem_) {
             if (static_cast<size_t>(child.first) >= index + count) {
                 child.first -= static_cast<int32_t>(count);
@@ -224,30 +200,7 @@ namespace OHOS::Ace::NG {
         if (from == to) {
             return;
         }
-        decltype(cachedItems_) temp(std::move(cachedItems_));
-        if (from < to) {
-            for (const auto& [itemIndex, child] : temp) {
-                auto position = static_cast<size_t>(itemIndex);
-                if (position > from && position <= to && position >= 1) {
-                    cachedItems_.emplace(position - 1, child);
-                } else if (position == from) {
-                    cachedItems_.emplace(to, child);
-                } else {
-                    cachedItems_.emplace(itemIndex, child);
-                }
-            }
-        } else {
-            for (const auto& [itemIndex, child] : temp) {
-                auto position = static_cast<size_t>(itemIndex);
-                if (position >= to && position < from) {
-                    cachedItems_.emplace(position + 1, child);
-                } else if (position == from) {
-                    cachedItems_.emplace(to, child);
-                } else {
-                    cachedItems_.emplace(itemIndex, child);
-                }
-            }
-        }
+        cachedItems_.MoveIndex(static_cast<int32_t>(from), static_cast<int32_t>(to));
     }
 
     bool LazyForEachBuilder::OnDataMoved(size_t from, size_t to)
@@ -289,16 +242,17 @@ namespace OHOS::Ace::NG {
     {
         totalCountForDataset_ = GetTotalCount();
         int32_t initialIndex = totalCountForDataset_;
-        std::map<int32_t, LazyForEachChild> expiringTempItem_;
-        std::list<std::string> expiringKeys;
-        for (auto& [key, cacheChild] : expiringItem_) {
-            if (cacheChild.first > -1) {
-                expiringTempItem_.try_emplace(cacheChild.first, LazyForEachChild(key, cacheChild.second));
-                expiringKeys.emplace_back(key);
+        LazyForEachCachedItems expiringTempItem_;
+        // extract the nodes so their keys move into expiringTempItem_ instead of being copied twice.
+        for (auto iter = expiringItem_.begin(); iter != expiringItem_.end();) {
+            if (iter->second.first <= -1) {
+                ++iter;
+                continue;
             }
-        }
-        for (auto& key : expiringKeys) {
-            expiringItem_.erase(key);
+            auto cacheNode = expiringItem_.extract(iter++);
+            auto& cacheChild = cacheNode.mapped();
+            expiringTempItem_.try_emplace(
+                cacheChild.first, LazyForEachChild(std::move(cacheNode.key()), std::move(cacheChild.second)));
         }
         decltype(expiringTempItem_) expiringTemp(std::move(expiringTempItem_));
         std::list<RefPtr<UINode>> nodeList;
@@ -318,14 +272,14 @@ namespace OHOS::Ace::NG {
         RepairDatasetItems(cachedTemp, cachedItems_, indexChangedMap);
         RepairDatasetItems(expiringTemp, expiringTempItem_, indexChangedMap);
         for (auto& [index, node] : expiringTempItem_) {
-            expiringItem_.emplace(node.first, LazyForEachCacheChild(index, node.second));
+            expiringItem_.emplace(std::move(node.first), LazyForEachCacheChild(index, std::move(node.second)));
         }
         operationList_.clear();
         return std::pair(initialIndex, std::move(nodeList));
     }
 
-    void LazyForEachBuilder::RepairDatasetItems(std::map<int32_t, LazyForEachChild>& cachedTemp,
-        std::map<int32_t, LazyForEachChild>& expiringTempItem_, std::map<int32_t, int32_t>& indexChangedMap)
+    void LazyForEachBuilder::RepairDatasetItems(LazyForEachCachedItems& cachedTemp,
+        LazyForEachCachedItems& expiringTempItem_, std::map<int32_t, int32_t>& indexChangedMap)
     {
         int32_t changedIndex = 0;
         for (auto& [index, child] : cachedTemp) {
@@ -380,7 +334,7 @@ namespace OHOS::Ace::NG {
     }
 
     bool LazyForEachBuilder::ClassifyOperation(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp)
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp)
     {
         const int ADDOP = 1;
         const int DELETEOP = 2;
@@ -463,7 +417,7 @@ namespace OHOS::Ace::NG {
     }
 
     void LazyForEachBuilder::OperateChange(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp)
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp)
     {
         OperationInfo itemInfo;
         if (operation.index >= totalCountForDataset_) {
@@ -493,7 +447,7 @@ namespace OHOS::Ace::NG {
     }
 
     void LazyForEachBuilder::OperateMove(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp)
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp)
     {
         OperationInfo fromInfo;
         OperationInfo toInfo;
@@ -537,7 +491,7 @@ namespace OHOS::Ace::NG {
     }
 
     void LazyForEachBuilder::OperateExchange(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp)
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp)
     {
         OperationInfo startInfo;
         OperationInfo endInfo;
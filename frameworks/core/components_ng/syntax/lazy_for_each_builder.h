@@ -33,6 +33,7 @@
 #include "core/components_ng/base/inspector.h"
 #include "core/components_ng/base/ui_node.h"
 #include "core/components_ng/pattern/list/list_item_pattern.h"
+#include "core/components_ng/syntax/indexed_item_ring.h"
 #include "core/components_v2/foreach/lazy_foreach_component.h"
 #include "core/pipeline_ng/pipeline_context.h"
 
@@ -51,6 +52,8 @@ typedef struct OperationInfo {
 
 using LazyForEachChild = std::pair<std::string, RefPtr<UINode>>;
 using LazyForEachCacheChild = std::pair<int32_t, RefPtr<UINode>>;
+// built items by index, the window of visible and cached items moves with scrolling.
+using LazyForEachCachedItems = IndexedItemRing<LazyForEachChild>;
 
 class ACE_EXPORT LazyForEachBuilder : public virtual AceType {
     DECLARE_ACE_TYPE(NG::LazyForEachBuilder, AceType)
@@ -90,26 +93,26 @@ public:
 
     std::pair<int32_t, std::list<RefPtr<UINode>>> OnDatasetChange(std::list<V2::Operation> DataOperations);
 
-    void RepairDatasetItems(std::map<int32_t, LazyForEachChild>& cachedTemp,
-        std::map<int32_t, LazyForEachChild>& expiringTempItem_, std::map<int32_t, int32_t>& indexChangedMap);
+    void RepairDatasetItems(LazyForEachCachedItems& cachedTemp,
+        LazyForEachCachedItems& expiringTempItem_, std::map<int32_t, int32_t>& indexChangedMap);
 
     void CollectIndexChangedCount(std::map<int32_t, int32_t>& indexChangedMap);
 
     bool ClassifyOperation(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp);
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp);
 
     void OperateAdd(V2::Operation& operation, int32_t& initialIndex);
 
     void OperateDelete(V2::Operation& operation, int32_t& initialIndex);
 
     void OperateMove(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp);
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp);
 
     void OperateChange(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp);
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp);
 
     void OperateExchange(V2::Operation& operation, int32_t& initialIndex,
-        std::map<int32_t, LazyForEachChild>& cachedTemp, std::map<int32_t, LazyForEachChild>& expiringTemp);
+        LazyForEachCachedItems& cachedTemp, LazyForEachCachedItems& expiringTemp);
 
     void OperateReload(V2::Operation& operation, int32_t& initialIndex);
 
@@ -132,34 +135,33 @@ public:
         return nullptr;
     }
 
-    std::map<int32_t, LazyForEachChild>& GetItems(std::list<std::pair<std::string, RefPtr<UINode>>>& childList)
+    LazyForEachCachedItems& GetItems(std::list<std::pair<std::string, RefPtr<UINode>>>& childList)
     {
         startIndex_ = -1;
         endIndex_ = -1;
         int32_t lastIndex = -1;
         bool isCertained = false;
 
-        decltype(cachedItems_) items(std::move(cachedItems_));
-
-        for (auto& [index, node] : items) {
+        // inactive items move to expiringItem_ and the window is compacted in the same pass.
+        cachedItems_.RemoveIf([this, &lastIndex, &isCertained](auto& item) {
+            auto index = item.first;
+            auto& node = item.second;
             if (!node.second) {
-                cachedItems_.try_emplace(index, std::move(node));
-                continue;
+                return false;
             }
 
             auto frameNode = AceType::DynamicCast<FrameNode>(node.second->GetFrameChildByIndex(0, true));
             if (frameNode && !frameNode->IsActive()) {
                 frameNode->SetJSViewActive(false, true);
                 expiringItem_.try_emplace(node.first, LazyForEachCacheChild(index, std::move(node.second)));
-                continue;
+                return true;
             }
-            cachedItems_.try_emplace(index, std::move(node));
             if (startIndex_ == -1) {
                 startIndex_ = index;
             }
             if (isLoop_) {
                 if (isCertained) {
-                    continue;
+                    return false;
                 }
                 if (lastIndex > -1 && index - lastIndex > 1) {
                     startIndex_ = index;
@@ -172,7 +174,8 @@ public:
                 endIndex_ = std::max(endIndex_, index);
             }
             lastIndex = index;
-        }
+            return false;
+        });
 
         if (needTransition) {
             for (auto& [key, node] : expiringItem_) {
@@ -483,7 +486,7 @@ public:
         return expiringItem_;
     }
 
-    const std::map<int32_t, LazyForEachChild>& GetAllChildren()
+    const LazyForEachCachedItems& GetAllChildren()
     {
         if (!cachedItems_.empty()) {
             startIndex_ = cachedItems_.begin()->first;
@@ -545,7 +548,7 @@ protected:
         int32_t index, std::unordered_map<std::string, LazyForEachCacheChild>& cachedItems) = 0;
     
     virtual LazyForEachChild OnGetChildByIndexNew(int32_t index,
-        std::map<int32_t, LazyForEachChild>& cachedItems,
+        LazyForEachCachedItems& cachedItems,
         std::unordered_map<std::string, LazyForEachCacheChild>& expiringItems) = 0;
 
     virtual void OnExpandChildrenOnInitialInNG() = 0;
@@ -565,7 +568,7 @@ private:
     void RecycleItemsOutOfBoundary();
     void RecycleChildByIndex(int32_t index);
 
-    std::map<int32_t, LazyForEachChild> cachedItems_;
+    LazyForEachCachedItems cachedItems_;
     std::unordered_map<std::string, LazyForEachCacheChild> expiringItem_;
     std::list<std::pair<std::string, RefPtr<UINode>>> nodeList_;
     std::map<int32_t, OperationInfo> operationList_;
@@ -75,7 +75,7 @@ void LazyForEachNode::BuildAllChildren()
         GetFrameChildByIndex(i, true);
     }
     children_.clear();
-    auto items = builder_->GetAllChildren();
+    const auto& items = builder_->GetAllChildren();
     for (auto& [index, item] : items) {
         if (item.second) {
             children_.push_back(item.second);
@@ -91,23 +91,25 @@ void LazyForEachNode::PostIdleTask()
     needPredict_ = true;
     auto context = GetContext();
     CHECK_NULL_VOID(context);
-    context->AddPredictTask([weak = AceType::WeakClaim(this)](int64_t deadline, bool canUseLongPredictTask) {
-        ACE_SCOPED_TRACE("LazyForEach predict");
-        auto node = weak.Upgrade();
-        CHECK_NULL_VOID(node);
-        node->needPredict_ = false;
-        auto canRunLongPredictTask = node->requestLongPredict_ && canUseLongPredictTask;
-        if (node->builder_) {
-            node->GetChildren();
-            auto preBuildResult = node->builder_->PreBuild(deadline, node->itemConstraint_, canRunLongPredictTask);
-            if (!preBuildResult) {
-                node->PostIdleTask();
-            } else {
+    // pre-building items of the visible list runs before other idle work and resumes until all items are built.
+    context->AddIdleTask(
+        [weak = AceType::WeakClaim(this)](int64_t deadline, bool canUseLongPredictTask) {
+            ACE_SCOPED_TRACE("LazyForEach predict");
+            auto node = weak.Upgrade();
+            CHECK_NULL_RETURN(node, true);
+            auto canRunLongPredictTask = node->requestLongPredict_ && canUseLongPredictTask;
+            if (node->builder_) {
+                node->GetChildren();
+                if (!node->builder_->PreBuild(deadline, node->itemConstraint_, canRunLongPredictTask)) {
+                    return false;
+                }
                 node->requestLongPredict_ = false;
                 node->itemConstraint_.reset();
             }
-        }
-    });
+            node->needPredict_ = false;
+            return true;
+        },
+        IdleTaskPriority::HIGH, "LazyForEach", GetId());
 }
 
 void LazyForEachNode::OnDataReloaded()
@@ -352,7 +354,7 @@ int32_t LazyForEachNode::GetIndexByUINode(const RefPtr<UINode>& uiNode) const
     if (!builder_) {
         return -1;
     }
-    auto items = builder_->GetAllChildren();
+    const auto& items = builder_->GetAllChildren();
     for (auto& [index, item] : items) {
         if (item.second == uiNode) {
             return index;
@@ -15,6 +15,7 @@
 
 #include "core/components_ng/syntax/repeat_virtual_scroll_caches.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <optional>
 #include <unordered_map>
@@ -28,26 +29,36 @@
 
 namespace OHOS::Ace::NG {
 
-bool KeySorterClass::operator()(const std::string& left, const std::string& right) const
-{
-    return virtualScroll_->CompareKeyByIndexDistance(left, right);
-}
-
 RepeatVirtualScrollCaches::RepeatVirtualScrollCaches(const std::map<std::string, uint32_t>& cacheCountL24ttype,
     const std::function<void(uint32_t)>& onCreateNode,
     const std::function<void(const std::string&, uint32_t)>& onUpdateNode,
-    const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetKeys4Range,
-    const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetTypes4Range)
-    : // each ttype incl default has own L2 cache size
-      cacheCountL24ttype_(cacheCountL24ttype),
-      // request TS to create new sub-tree for given index or update existing
+    const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetKeys4Range,
+    const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetTypes4Range)
+    : // request TS to create new sub-tree for given index or update existing
       // update subtree cached for (old) index
       // API might need to change to tell which old item to update
       onCreateNode_(onCreateNode), onUpdateNode_(onUpdateNode), onGetTypes4Range_(onGetTypes4Range),
       onGetKeys4Range_(onGetKeys4Range)
-{}
+{
+    // each ttype incl default has own L2 cache size
+    for (const auto& [ttype, cacheCount] : cacheCountL24ttype) {
+        ttypes_[GetTTypeId(ttype)].cacheCount = cacheCount;
+    }
+}
 
-std::optional<std::string> RepeatVirtualScrollCaches::GetKey4Index(uint32_t index)
+uint32_t RepeatVirtualScrollCaches::GetTTypeId(const std::string& ttype)
+{
+    auto it = ttypeIds_.find(ttype);
+    if (it != ttypeIds_.end()) {
+        return it->second;
+    }
+    auto ttypeId = static_cast<uint32_t>(ttypes_.size());
+    ttypes_.push_back({ .ttype = ttype });
+    ttypeIds_.emplace(ttype, ttypeId);
+    return ttypeId;
+}
+
+std::optional<InternedKey> RepeatVirtualScrollCaches::GetKey4Index(uint32_t index)
 {
     auto it = key4index_.find(index);
     if (it == key4index_.end()) {
@@ -55,8 +66,12 @@ std::optional<std::string> RepeatVirtualScrollCaches::GetKey4Index(uint32_t inde
         if (!FetchMoreKeysTTypes(index, index)) {
             return std::nullopt;
         }
+        it = key4index_.find(index);
+        if (it == key4index_.end()) {
+            return std::nullopt;
+        }
     }
-    return key4index_[index];
+    return it->second;
 }
 
 /**
@@ -66,38 +81,64 @@ bool RepeatVirtualScrollCaches::FetchMoreKeysTTypes(uint32_t from, uint32_t to)
 {
     // always request the same range for keys and ttype
     // optimism by merging the two calls into one
-    std::list<std::string> keysFrom = onGetKeys4Range_(from, to);
-    std::list<std::string> ttypesFrom = onGetTypes4Range_(from, to);
+    onGetKeys4Range_(from, to, keysBuffer_);
+    onGetTypes4Range_(from, to, ttypesBuffer_);
     auto requestCount = to - from + 1;
-    auto keySize = keysFrom.size();
+    auto keySize = keysBuffer_.size();
     if (keySize != requestCount) {
-        TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to fetch keys: requst %{public}d, fetch %{public}d",
-            static_cast<int32_t>(keySize), requestCount);
+        TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to fetch keys: request %{public}d, fetch %{public}d",
+            static_cast<int32_t>(requestCount), static_cast<int32_t>(keySize));
         return false;
     }
-    auto ttypeSize = ttypesFrom.size();
+    auto ttypeSize = ttypesBuffer_.size();
     if (ttypeSize != requestCount) {
-        TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to fetch keys: requst %{public}d, fetch %{public}d",
-            static_cast<int32_t>(keySize), requestCount);
+        TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to fetch ttypes: request %{public}d, fetch %{public}d",
+            static_cast<int32_t>(requestCount), static_cast<int32_t>(ttypeSize));
         return false;
     }
 
     // fill-in index maps
-    auto from1 = from;
-    for (const auto& key : keysFrom) {
-        key4index_[from1] = key;
-        index4Key_[key] = from1;
-        from1++;
-    }
-    from1 = from;
-    for (const auto& ttype : ttypesFrom) {
-        ttype4index_[from1] = ttype;
-        index4ttype_[ttype] = from1;
-        from1++;
+    uint32_t ttypeId = 0;
+    for (uint32_t i = 0; i < requestCount; i++) {
+        SetKey4Index(from + i, keysBuffer_[i]);
+        // neighbouring items mostly share their ttype, skip the lookup for these
+        if (i == 0 || ttypesBuffer_[i] != ttypesBuffer_[i - 1]) {
+            ttypeId = GetTTypeId(ttypesBuffer_[i]);
+        }
+        ttype4index_[from + i] = ttypeId;
     }
     return true;
 }
 
+void RepeatVirtualScrollCaches::SetKey4Index(uint32_t index, const std::string& key)
+{
+    auto keyIter = key4index_.find(index);
+    if (keyIter != key4index_.end()) {
+        if (keyIter->second.GetKey() == key) {
+            return;
+        }
+        // the key previously at index is no longer known to be used
+        const auto oldKey = keyIter->second.GetId();
+        auto indexIter = index4Key_.find(oldKey);
+        if (indexIter != index4Key_.end() && indexIter->second == index) {
+            index4Key_.erase(indexIter);
+        }
+        auto nodeIter = node4key_.find(oldKey);
+        if (nodeIter != node4key_.end()) {
+            ttypes_[nodeIter->second.ttypeId].needSort = true;
+        }
+    }
+
+    InternedKey internedKey(key);
+    const auto keyId = internedKey.GetId();
+    index4Key_[keyId] = index;
+    key4index_.insert_or_assign(index, std::move(internedKey));
+    auto nodeIter = node4key_.find(keyId);
+    if (nodeIter != node4key_.end()) {
+        ttypes_[nodeIter->second.ttypeId].needSort = true;
+    }
+}
+
 // get UINode for given index without create.
 RefPtr<UINode> RepeatVirtualScrollCaches::GetNode4Index(uint32_t index)
 {
@@ -107,17 +148,24 @@ RefPtr<UINode> RepeatVirtualScrollCaches::GetNode4Index(uint32_t index)
         return nullptr;
     }
 
-    const std::string& key4Index = it->second;
-    const auto nodeIter = node4key_.find(key4Index);
+    // TS might change the keys while updating the UINode, keep the key alive
+    const InternedKey key4Index = it->second;
+    const auto nodeIter = node4key_.find(key4Index.GetId());
     if (nodeIter == node4key_.end()) {
         TAG_LOGD(AceLogTag::ACE_REPEAT, "no UINode for index %{public}d and key %{public}s",
-            static_cast<int32_t>(index), key4Index.c_str());
+            static_cast<int32_t>(index), key4Index.GetKey().c_str());
         return nullptr;
     }
     // if the cache is mark invalid, need update first.
     if (!nodeIter->second.isValid) {
-        UpdateSameKeyItem(key4Index, index);
-        nodeIter->second.isValid = true;
+        auto node = nodeIter->second.item;
+        UpdateSameKeyItem(key4Index.GetKey(), index);
+        auto updatedIter = node4key_.find(key4Index.GetId());
+        if (updatedIter == node4key_.end()) {
+            return node;
+        }
+        updatedIter->second.isValid = true;
+        return updatedIter->second.item;
     }
     return nodeIter->second.item;
 }
@@ -138,11 +186,17 @@ void RepeatVirtualScrollCaches::InvalidateKeyAndTTypeCaches()
     key4index_.clear();
     index4Key_.clear();
     ttype4index_.clear();
-    index4ttype_.clear();
     // mark the item need to update.
     for (auto& [key, item] : node4key_) {
         item.isValid = false;
     }
+    // no L2 key has an index until fetched again
+    for (auto& ttypeCache : ttypes_) {
+        for (auto& l2Key : ttypeCache.l2Keys) {
+            l2Key.index = INVALID_INDEX;
+        }
+        ttypeCache.needSort = false;
+    }
 
     // request new index -> key and index -> ttype
     // only fetch keys for the active range
@@ -167,26 +221,32 @@ RefPtr<UINode> RepeatVirtualScrollCaches::UpdateFromL2(uint32_t forIndex)
         TAG_LOGD(AceLogTag::ACE_REPEAT, "no ttype for index %{public}d", forIndex);
         return nullptr;
     }
-    const auto& ttype = iterTType->second;
+    const auto ttypeId = iterTType->second;
     const auto iterNewKey = key4index_.find(forIndex);
     if (iterNewKey == key4index_.end()) {
         TAG_LOGD(AceLogTag::ACE_REPEAT, "no key for index %{public}d", forIndex);
         return nullptr;
     }
-    const std::string& forKey = iterNewKey->second;
+    // TS might change the keys while updating the UINode, keep the keys alive
+    const InternedKey forKey = iterNewKey->second;
 
-    const auto& oldKey = GetL2KeyToUpdate(ttype);
-    if (!oldKey) {
+    const auto oldKeyId = GetL2KeyToUpdate(ttypeId);
+    if (!oldKeyId) {
         // no key for this ttype available to update
         TAG_LOGD(AceLogTag::ACE_REPEAT, "for index %{public}d, ttype %{public}s, no UINode found to update", forIndex,
-            ttype.c_str());
+            ttypes_[ttypeId].ttype.c_str());
         return nullptr;
     }
+    const auto oldNodeIter = node4key_.find(oldKeyId.value());
+    if (oldNodeIter == node4key_.end()) {
+        return nullptr;
+    }
+    const InternedKey oldKey = oldNodeIter->second.key;
 
     // call TS to do the RepeatItem update
-    onUpdateNode_(oldKey.value(), forIndex);
+    onUpdateNode_(oldKey.GetKey(), forIndex);
 
-    return HasUINodeBeenUpdated(ttype, oldKey.value(), forKey);
+    return HasUINodeBeenUpdated(ttypeId, oldKey.GetId(), forKey);
 }
 
 void RepeatVirtualScrollCaches::UpdateSameKeyItem(const std::string& key, uint32_t index)
@@ -203,10 +263,11 @@ RefPtr<UINode> RepeatVirtualScrollCaches::CreateNewNode(uint32_t forIndex)
         TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to create node of %{public}d", forIndex);
         return nullptr;
     }
-    const auto& forKey = iter->second;
+    // TS might change the keys while creating the UINode, keep the key alive
+    const InternedKey forKey = iter->second;
 
     // see if node already created, just for safety
-    const auto nodeIter = node4key_.find(forKey);
+    const auto nodeIter = node4key_.find(forKey.GetId());
     if (nodeIter != node4key_.end()) {
         // have a node for this key already, just return
         return nodeIter->second.item;
@@ -220,7 +281,7 @@ RefPtr<UINode> RepeatVirtualScrollCaches::CreateNewNode(uint32_t forIndex)
         TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to create %{public}d node due to type is missing", forIndex);
         return nullptr;
     }
-    const auto& ttype = ttypeIter->second;
+    const auto ttypeId = ttypeIter->second;
 
     // swap the ViewStackProcessor instance for secondary while we run the item builder function
     // so that its results can easily be obtained from it, does not disturb main ViewStackProcessor
@@ -236,22 +297,13 @@ RefPtr<UINode> RepeatVirtualScrollCaches::CreateNewNode(uint32_t forIndex)
         TAG_LOGE(AceLogTag::ACE_REPEAT,
             "New Node create: For index %{public}d -> key %{public}s -> ttype %{public}s item builder FAILED to gen "
             "FrameNode. ERROR",
-            forIndex, forKey.c_str(), ttype.c_str());
+            forIndex, forKey.GetKey().c_str(), ttypes_[ttypeId].ttype.c_str());
         return nullptr;
     }
 
-    // add node to node4key4ttype_
-    const auto node4KeyIter = node4key4ttype_.find(ttype);
-    if (node4KeyIter != node4key4ttype_.end()) {
-        node4KeyIter->second.emplace(forKey, node4Index);
-    } else {
-        std::unordered_map<std::string, RefPtr<UINode>> node4Key;
-        node4Key[forKey] = node4Index;
-        node4key4ttype_.emplace(ttype, std::move(node4Key));
-    }
-
-    // add node to node4key_
-    node4key_.emplace(forKey, CacheItem { true, node4Index });
+    // add node to node4key_, the new node is in L2 until added to L1
+    node4key_.emplace(forKey.GetId(), CacheItem { true, node4Index, ttypeId, forKey });
+    AddKeyToL2(forKey.GetId());
     return node4Index;
 }
 
@@ -259,21 +311,36 @@ void RepeatVirtualScrollCaches::ForEachL1IndexUINode(
     const std::function<void(uint32_t index, const RefPtr<UINode>& node)>& cbFunc)
 {
     for (const auto& key : activeNodeKeysInL1_) {
-        const auto& cacheItem = node4key_[key];
+        const auto nodeIter = node4key_.find(key);
+        if (nodeIter == node4key_.end()) {
+            continue;
+        }
         const auto& indexIter = index4Key_.find(key);
         if (indexIter == index4Key_.end()) {
-            TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to get index for %{public}s key", key.c_str());
+            TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to get index for %{public}s key",
+                nodeIter->second.key.GetKey().c_str());
             continue;
         }
-        cbFunc(indexIter->second, cacheItem.item);
+        cbFunc(indexIter->second, nodeIter->second.item);
     }
 }
 
 void RepeatVirtualScrollCaches::RecycleItemsByIndex(int32_t index)
 {
     auto keyIter = key4index_.find(index);
-    if (keyIter != key4index_.end()) {
-        activeNodeKeysInL1_.erase(keyIter->second);
+    if (keyIter != key4index_.end() && activeNodeKeysInL1_.erase(keyIter->second.GetId()) > 0) {
+        AddKeyToL2(keyIter->second.GetId());
+    }
+}
+
+void RepeatVirtualScrollCaches::AddKeyToL1(InternedKeyId key)
+{
+    if (node4key_.find(key) == node4key_.end()) {
+        TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to add key without UINode to L1");
+        return;
+    }
+    if (activeNodeKeysInL1_.emplace(key).second) {
+        RemoveKeyFromL2(key);
     }
 }
 
@@ -285,19 +352,27 @@ void RepeatVirtualScrollCaches::RecycleItemsByIndex(int32_t index)
  */
 bool RepeatVirtualScrollCaches::RebuildL1(const std::function<bool(int32_t index, const RefPtr<UINode>& node)>& cbFunc)
 {
-    std::unordered_set<std::string> l1Copy;
+    std::unordered_set<InternedKeyId> l1Copy;
     std::swap(l1Copy, activeNodeKeysInL1_);
     bool modified = false;
     for (const auto& key : l1Copy) {
+        const auto nodeIter = node4key_.find(key);
+        if (nodeIter == node4key_.end()) {
+            continue;
+        }
         const auto& indexIter = index4Key_.find(key);
         if (indexIter == index4Key_.end()) {
+            // key is no longer used, its UINode waits in L2 for an update
+            AddKeyToL2(key);
             continue;
         }
-        const auto& cacheItem = node4key_[key];
+        // cbFunc may call TS, keep the UINode alive
+        auto node = nodeIter->second.item;
         int32_t index = indexIter->second;
-        if (cbFunc(index, cacheItem.item)) {
+        if (cbFunc(index, node)) {
             activeNodeKeysInL1_.emplace(key);
         } else {
+            AddKeyToL2(key);
             modified = true;
         }
     }
@@ -308,6 +383,7 @@ void RepeatVirtualScrollCaches::SetLastActiveRange(uint32_t from, uint32_t to)
 {
     lastActiveRanges_[1] = lastActiveRanges_[0];
     lastActiveRanges_[0] = { from, to };
+    // the distance order of the L2 keys follows their index order, new ranges do not need a resort
 }
 
 /**
@@ -341,21 +417,24 @@ int32_t RepeatVirtualScrollCaches::GetFrameNodeIndex(const RefPtr<FrameNode>& fr
  * return a key whose UINode can be updated
  * the key must not be in L1, i.e. activeNodeKeysInL1_
  * the given ttype must match the template type the UINode for this key
- * has been rendered for (this info is available from node4key4ttype_)
+ * has been rendered for
+ *
+ * the distance from the active range first falls and then rises with the index,
+ * the furthest L2 key is either the first or the last one in index order.
  */
-std::optional<std::string> RepeatVirtualScrollCaches::GetL2KeyToUpdate(const std::string& ttype) const
+std::optional<InternedKeyId> RepeatVirtualScrollCaches::GetL2KeyToUpdate(uint32_t ttypeId)
 {
-    const auto itNodes = node4key4ttype_.find(ttype);
-    if (itNodes == node4key4ttype_.end()) {
+    if (ttypeId >= ttypes_.size()) {
         return std::nullopt;
     }
-    const auto& keys2UINode = itNodes->second;
-    std::set<std::string, KeySorterClass> l2Keys = GetSortedL2KeysForTType(keys2UINode);
-    auto keyIter = l2Keys.rbegin();
-    if (keyIter == l2Keys.rend()) {
+    auto& ttypeCache = ttypes_[ttypeId];
+    if (ttypeCache.l2Keys.empty()) {
         return std::nullopt;
     }
-    return *keyIter;
+    SortL2Keys(ttypeCache);
+    const auto& front = ttypeCache.l2Keys.front();
+    const auto& back = ttypeCache.l2Keys.back();
+    return GetDistanceFromRange(front.index) > GetDistanceFromRange(back.index) ? front.key : back.key;
 }
 
 /**
@@ -368,19 +447,15 @@ std::optional<std::string> RepeatVirtualScrollCaches::GetL2KeyToUpdate(const std
  * (previously updated following invalidation) key -> index map and
  *
  */
-std::optional<std::string> RepeatVirtualScrollCaches::GetL1KeyToUpdate(const std::string& ttype) const
+std::optional<InternedKeyId> RepeatVirtualScrollCaches::GetL1KeyToUpdate(uint32_t ttypeId) const
 {
-    for (const auto& keyIter : activeNodeKeysInL1_) {
-        const std::string& key = keyIter;
+    for (const auto& key : activeNodeKeysInL1_) {
         if (index4Key_.find(key) == index4Key_.end()) {
             // key is no longer used
             // check if key rendered the expected ttype
-            const auto ttypeIter = node4key4ttype_.find(ttype);
-            if (ttypeIter != node4key4ttype_.end()) {
-                const std::unordered_map<std::string, RefPtr<UINode>>& node4Key = ttypeIter->second;
-                if (node4Key.find(key) != node4Key.end()) {
-                    return key;
-                }
+            const auto nodeIter = node4key_.find(key);
+            if (nodeIter != node4key_.end() && nodeIter->second.ttypeId == ttypeId) {
+                return key;
             }
         }
     }
@@ -390,92 +465,66 @@ std::optional<std::string> RepeatVirtualScrollCaches::GetL1KeyToUpdate(const std
 /**
  * scenario: UINode of fromKey has been updated to render data for 'forKey'
  *     the template type (ttype) remains unchanged
- *     update node4key4ttype_ and node4key_ entries to use new key point to same UINode
+ *     update node4key_ entry to use new key point to same UINode
  */
 RefPtr<UINode> RepeatVirtualScrollCaches::HasUINodeBeenUpdated(
-    const std::string& ttype, const std::string& fromKey, const std::string& forKey)
-{
-    // 1. update fromKey -> forKey in node4key4ttype_
-    const auto nodesIter = node4key4ttype_.find(ttype);
-    if (nodesIter != node4key4ttype_.end()) {
-        auto& node4key = nodesIter->second;
-        auto iter = node4key.find(fromKey);
-        if (iter != node4key.end()) {
-            auto node = iter->second;
-            node4key.erase(iter);
-            node4key.emplace(forKey, node);
-        }
-    }
-
-    // 2. update the key: fromKey to forKey in node4key_
+    uint32_t ttypeId, InternedKeyId fromKey, const InternedKey& forKey)
+{
     auto iter = node4key_.find(fromKey);
     if (iter != node4key_.end()) {
-        auto cachedItem = iter->second;
+        RemoveKeyFromL2(fromKey);
+        auto cachedItem = std::move(iter->second);
         cachedItem.isValid = true;
+        cachedItem.key = forKey;
+        auto node = cachedItem.item;
         node4key_.erase(iter);
-        node4key_.emplace(forKey, cachedItem);
-        return cachedItem.item;
+        node4key_.emplace(forKey.GetId(), std::move(cachedItem));
+        AddKeyToL2(forKey.GetId());
+        return node;
     }
-    TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to update L2 : %{public}s, %{public}s, %{public}s, ", ttype.c_str(),
-        fromKey.c_str(), forKey.c_str());
+    TAG_LOGE(AceLogTag::ACE_REPEAT, "fail to update L2 : %{public}s, %{public}s, ", ttypes_[ttypeId].ttype.c_str(),
+        forKey.GetKey().c_str());
     return nullptr;
 }
 
-/** scenario: keys cache has been updated
- *
- * find which keys in key -> UINode map are no longer used
- * returned set entries are pairs:
- *   pair.first: is this key a L1 item,
- *   pair.second: key
- */
-void RepeatVirtualScrollCaches::FindUnusedKeys(std::set<std::pair<bool, std::string>>& result) const
-{
-    for (const auto& iter : node4key_) {
-        const std::string key = iter.first;
-        const auto indexIter = index4Key_.find(key);
-        if (indexIter == index4Key_.end()) {
-            // key is no longer used
-            // is it in L1 ?
-            const bool keyInL1 = (index4Key_.find(key) != index4Key_.end());
-            result.emplace(keyInL1, key);
-        }
-    }
-}
-
 /**
  * scenario: in idle process , following GetChildren()
  * execute purge()
  *
  * enforce L2 cacheCount for each ttype
- * logical L2 cache is map key->UINode map filtered out L1 keys
  * purge by by deleting UINodes, delete their entry from
- *   node4key4ttype_ and node4key_
- *
+ *   the L2 keys of their ttype and node4key_
+ * the cacheCount L2 keys nearest to the active range are kept,
+ *   the others are dropped from both ends of the index order.
  */
 bool RepeatVirtualScrollCaches::Purge()
 {
     bool didMakeChanges = false;
-    for (auto& itTType : node4key4ttype_) {
-        const auto& ttype = itTType.first;
-        auto& uiNode4Key = itTType.second;
-        const uint32_t cacheCount = cacheCountL24ttype_[ttype];
-        std::set<std::string, KeySorterClass> l2Keys = GetSortedL2KeysForTType(uiNode4Key);
-
-        // l2_keys is sorted by increasing distance from lastActiveRange
-        // will drop those keys and their UINodes with largest distance
+    for (auto& ttypeCache : ttypes_) {
+        auto& l2Keys = ttypeCache.l2Keys;
+        if (l2Keys.size() <= ttypeCache.cacheCount) {
+            continue;
+        }
+        SortL2Keys(ttypeCache);
         // improvement idea: in addition to distance from range use the
         // scroll direction for selecting these keys
-        auto safeDist = std::min(cacheCount, static_cast<uint32_t>(l2Keys.size()));
-        auto itL2Key = std::next(l2Keys.begin(), safeDist);
-
-        while (itL2Key != l2Keys.end()) {
-            // delete remaining keys
-            uiNode4Key.erase(*itL2Key);
-            node4key_.erase(*itL2Key);
-            // check out transition case.
-            itL2Key++;
-            didMakeChanges = true;
+        size_t first = 0;
+        size_t last = l2Keys.size();
+        while (last - first > ttypeCache.cacheCount) {
+            if (GetDistanceFromRange(l2Keys[first].index) > GetDistanceFromRange(l2Keys[last - 1].index)) {
+                first++;
+            } else {
+                last--;
+            }
+        }
+        for (size_t i = 0; i < l2Keys.size(); i++) {
+            if (i < first || i >= last) {
+                node4key_.erase(l2Keys[i].key);
+            }
         }
+        l2Keys.erase(l2Keys.begin() + last, l2Keys.end());
+        l2Keys.erase(l2Keys.begin(), l2Keys.begin() + first);
+        didMakeChanges = true;
     }
     return didMakeChanges;
 }
@@ -484,19 +533,18 @@ bool RepeatVirtualScrollCaches::Purge()
  * given key return the index position (reverse lookup)
  * invalidated keys (after Repeat rerender/ data change)
  * are keys for which no index exists anymore,
- * method returns int max value for these.
- * int max value causes that distance from active range is max
+ * method returns INVALID_INDEX for these.
+ * INVALID_INDEX causes that distance from active range is max
  * these keys will be selected for update first.
  */
-uint32_t RepeatVirtualScrollCaches::GetIndex4Key(const std::string& key) const
+uint32_t RepeatVirtualScrollCaches::GetIndex4Key(InternedKeyId key) const
 {
     auto it = index4Key_.find(key);
     if (it != index4Key_.end()) {
         return it->second;
     }
     // key is no longer used
-    // return max uint32_t value
-    return std::numeric_limits<uint32_t>::max();
+    return INVALID_INDEX;
 }
 
 /**
@@ -512,6 +560,9 @@ uint32_t RepeatVirtualScrollCaches::GetIndex4Key(const std::string& key) const
  */
 int32_t RepeatVirtualScrollCaches::GetDistanceFromRange(uint32_t index) const
 {
+    if (index == INVALID_INDEX) {
+        return std::numeric_limits<int32_t>::max();
+    }
     int32_t last[2] = { lastActiveRanges_[0].first, lastActiveRanges_[0].second };
     int32_t prev[2] = { lastActiveRanges_[1].first, lastActiveRanges_[1].second };
 
@@ -545,42 +596,53 @@ int32_t RepeatVirtualScrollCaches::GetDistanceFromRange(uint32_t index) const
     return 0;
 }
 
-/**
- * scenario: find L1 key that should be updated
- * choose the key whose index is the furthest away from active range
- * given two keys compare their distFromRange
- */
-bool RepeatVirtualScrollCaches::CompareKeyByIndexDistance(const std::string& key1, const std::string& key2) const
+void RepeatVirtualScrollCaches::AddKeyToL2(InternedKeyId key)
 {
-    return GetDistanceFromRange(GetIndex4Key(key1)) < GetDistanceFromRange(GetIndex4Key(key2));
+    const auto nodeIter = node4key_.find(key);
+    if (nodeIter == node4key_.end()) {
+        return;
+    }
+    auto& ttypeCache = ttypes_[nodeIter->second.ttypeId];
+    L2Key l2Key { GetIndex4Key(key), key };
+    if (ttypeCache.needSort) {
+        ttypeCache.l2Keys.push_back(l2Key);
+        return;
+    }
+    auto pos = std::upper_bound(ttypeCache.l2Keys.begin(), ttypeCache.l2Keys.end(), l2Key.index,
+        [](uint32_t index, const L2Key& other) { return index < other.index; });
+    ttypeCache.l2Keys.insert(pos, l2Key);
 }
 
-/**
- * scenario: find L1 key(s) that should be updated
- *
- * return a sorted set of L2 keys, sorted by increasing distance from active range
- */
-std::set<std::string, KeySorterClass> RepeatVirtualScrollCaches::GetSortedL2KeysForTType(
-    const std::unordered_map<std::string, RefPtr<UINode>>& uiNode4Key) const
-{
-    KeySorterClass sorter(this);
-    std::set<std::string, KeySorterClass> l2Keys(sorter);
-    for (const auto& itUINode : uiNode4Key) {
-        const auto& key = itUINode.first;
-        if (activeNodeKeysInL1_.find(key) == activeNodeKeysInL1_.end()) {
-            // key is not in L1
-            // add to l2Keys
-            l2Keys.emplace(key);
-        }
+void RepeatVirtualScrollCaches::RemoveKeyFromL2(InternedKeyId key)
+{
+    const auto nodeIter = node4key_.find(key);
+    if (nodeIter == node4key_.end()) {
+        return;
+    }
+    auto& l2Keys = ttypes_[nodeIter->second.ttypeId].l2Keys;
+    auto it = std::find_if(l2Keys.begin(), l2Keys.end(), [key](const L2Key& l2Key) { return l2Key.key == key; });
+    if (it != l2Keys.end()) {
+        l2Keys.erase(it);
     }
-    return l2Keys;
+}
+
+void RepeatVirtualScrollCaches::SortL2Keys(TTypeCache& ttypeCache)
+{
+    if (!ttypeCache.needSort) {
+        return;
+    }
+    for (auto& l2Key : ttypeCache.l2Keys) {
+        l2Key.index = GetIndex4Key(l2Key.key);
+    }
+    std::sort(ttypeCache.l2Keys.begin(), ttypeCache.l2Keys.end(),
+        [](const L2Key& left, const L2Key& right) { return left.index < right.index; });
+    ttypeCache.needSort = false;
 }
 
 std::string RepeatVirtualScrollCaches::DumpL1() const
 {
     std::string result = "activeNodeKeysInL1_: size=" + std::to_string(activeNodeKeysInL1_.size()) + "--------------\n";
-    for (const auto& it : activeNodeKeysInL1_) {
-        const std::string& key = it;
+    for (const auto& key : activeNodeKeysInL1_) {
         result += "\", node: " + DumpUINodeWithKey(key) + "\n";
     }
     return result;
@@ -588,16 +650,16 @@ std::string RepeatVirtualScrollCaches::DumpL1() const
 
 std::string RepeatVirtualScrollCaches::DumpL2() const
 {
-    std::unordered_map<std::string, RefPtr<UINode>> allCaches;
-    for (const auto& [item, cacheItem] : node4key_) {
-        allCaches.try_emplace(item, cacheItem.item);
-    }
-    std::set<std::string, KeySorterClass> l2KeyResult = GetSortedL2KeysForTType(allCaches);
-
-    std::string result =
-        "l2_keys (sorted by distance): size=" + std::to_string(l2KeyResult.size()) + "--------------\n";
-    for (const auto& it : l2KeyResult) {
-        result += "   \"" + it + "\", node: " + DumpUINodeWithKey(it) + "\n";
+    std::string result;
+    for (const auto& ttypeCache : ttypes_) {
+        result += "l2Keys of ttype " + ttypeCache.ttype + " (sorted by index" +
+                  (ttypeCache.needSort ? ", needs resort" : "") +
+                  "): size=" + std::to_string(ttypeCache.l2Keys.size()) + "--------------\n";
+        for (const auto& l2Key : ttypeCache.l2Keys) {
+            const auto nodeIter = node4key_.find(l2Key.key);
+            const std::string key = (nodeIter == node4key_.end()) ? "" : nodeIter->second.key.GetKey();
+            result += "   \"" + key + "\", node: " + DumpUINodeWithKey(l2Key.key) + "\n";
+        }
     }
     return result;
 }
@@ -606,12 +668,14 @@ std::string RepeatVirtualScrollCaches::DumpKey4Index() const
 {
     std::string result = "key4index_: size=" + std::to_string(key4index_.size()) + "--------------\n";
     for (const auto& it : key4index_) {
-        result += "   " + std::to_string(it.first) + " -> \"" + it.second +
-                  "\", node: " + DumpUINodeWithKey(it.second) + "\n";
+        result += "   " + std::to_string(it.first) + " -> \"" + it.second.GetKey() +
+                  "\", node: " + DumpUINodeWithKey(it.second.GetId()) + "\n";
     }
     result += "index4Key_: size=" + std::to_string(index4Key_.size()) + "--------------\n";
     for (const auto& it : index4Key_) {
-        result += "   \"" + it.first + "\" -> " + std::to_string(it.second) + "\n";
+        const auto keyIter = key4index_.find(it.second);
+        const std::string key = (keyIter == key4index_.end()) ? "" : keyIter->second.GetKey();
+        result += "   \"" + key + "\" -> " + std::to_string(it.second) + "\n";
     }
     return result;
 }
@@ -620,11 +684,7 @@ std::string RepeatVirtualScrollCaches::DumpTType4Index() const
 {
     std::string result = "ttype4index_: size=" + std::to_string(ttype4index_.size()) + "--------------\n";
     for (const auto& it : ttype4index_) {
-        result += "   " + std::to_string(it.first) + " -> \"" + it.second + "\n";
-    }
-    result += "index4ttype_: size=" + std::to_string(index4ttype_.size()) + "--------------\n";
-    for (const auto& it : index4ttype_) {
-        result += "   \"" + it.first + "\" -> " + std::to_string(it.second) + "\n";
+        result += "   " + std::to_string(it.first) + " -> \"" + ttypes_[it.second].ttype + "\n";
     }
     return result;
 }
@@ -633,7 +693,7 @@ std::string RepeatVirtualScrollCaches::DumpUINode4Key4TType() const
 {
     std::string result = "node4key_: size=" + std::to_string(node4key_.size()) + "--------------\n";
     for (const auto& it : node4key_) {
-        result += "   \"" + it.first + "\" -> node: " + it.second.item->GetTag() + "(" +
+        result += "   \"" + it.second.key.GetKey() + "\" -> node: " + it.second.item->GetTag() + "(" +
                   std::to_string(it.second.item->GetId()) + ") \n";
     }
     return result;
@@ -641,20 +701,25 @@ std::string RepeatVirtualScrollCaches::DumpUINode4Key4TType() const
 
 std::string RepeatVirtualScrollCaches::DumpUINode4Key() const
 {
-    std::string result = "node4key4ttype_: size=" + std::to_string(node4key4ttype_.size()) + "--------------\n";
-    for (const auto& ttypeIter : node4key4ttype_) {
-        const auto& ttype = ttypeIter.first;
-        const auto& node4key = ttypeIter.second;
-        result += "ttype " + ttype + ": node4key: size=" + std::to_string(node4key.size()) + "--------------\n";
-        for (const auto& it : node4key) {
-            result += "   \"" + it.first + "\" -> node: " + it.second->GetTag() + "(" +
-                      std::to_string(it.second->GetId()) + ") \n";
+    std::string result = "node4key per ttype: size=" + std::to_string(ttypes_.size()) + "--------------\n";
+    for (uint32_t ttypeId = 0; ttypeId < ttypes_.size(); ttypeId++) {
+        std::string nodes;
+        size_t size = 0;
+        for (const auto& it : node4key_) {
+            if (it.second.ttypeId != ttypeId) {
+                continue;
+            }
+            nodes += "   \"" + it.second.key.GetKey() + "\" -> node: " + it.second.item->GetTag() + "(" +
+                     std::to_string(it.second.item->GetId()) + ") \n";
+            size++;
         }
+        result += "ttype " + ttypes_[ttypeId].ttype + ": node4key: size=" + std::to_string(size) +
+                  "--------------\n" + nodes;
     }
     return result;
 }
 
-std::string RepeatVirtualScrollCaches::DumpUINodeWithKey(const std::string& key) const
+std::string RepeatVirtualScrollCaches::DumpUINodeWithKey(InternedKeyId key) const
 {
     const auto it = node4key_.find(key);
     return (it == node4key_.end()) ? "no UINode on file"
@@ -18,42 +18,36 @@
 
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <map>
 #include <optional>
-#include <set>
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "base/memory/referenced.h"
 #include "core/components_ng/base/ui_node.h"
+#include "core/components_ng/syntax/interned_key.h"
 
 namespace OHOS::Ace::NG {
 
-// custom sorting for std::set only works with struct
-// with operator() inside
-class RepeatVirtualScrollCaches;
-struct KeySorterClass {
-    const RepeatVirtualScrollCaches* virtualScroll_;
-
-    explicit KeySorterClass(const RepeatVirtualScrollCaches* virtualScroll) : virtualScroll_(virtualScroll) {}
-    bool operator()(const std::string& left, const std::string& right) const;
-};
-
 struct CacheItem {
     bool isValid = false;
     RefPtr<UINode> item;
+    // id of the template type the UINode has been rendered for
+    uint32_t ttypeId = 0;
+    // holds the key of the UINode, keys in L1 and L2 are only referenced by their UINodes
+    InternedKey key;
 };
 
 class RepeatVirtualScrollCaches {
-    friend struct KeySorterClass;
-
 public:
     RepeatVirtualScrollCaches(const std::map<std::string, uint32_t>& cacheCountL24ttype,
         const std::function<void(uint32_t)>& onCreateNode,
         const std::function<void(const std::string&, uint32_t)>& onUpdateNode,
-        const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetKeys4Range,
-        const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetTypes4Range);
+        const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetKeys4Range,
+        const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetTypes4Range);
 
     /** scenario:
      *         Repeat gets updated due to data change.
@@ -93,7 +87,7 @@ public:
      * fetch from TS if not in cache
      * return false if index out of range
      */
-    std::optional<std::string> GetKey4Index(uint32_t index);
+    std::optional<InternedKey> GetKey4Index(uint32_t index);
 
     /**
      * iterate over all entries of L1 and call function for each entry
@@ -110,7 +104,7 @@ public:
      *
      * enforce L2 cacheCount for each ttype
      * by deleting UINodes, delete their entry from
-     * node4key4ttype_ and node4key_
+     * the L2 keys of their ttype and node4key_
      * any other processing steps needed before UINode
      * tree can be deleted
      */
@@ -124,17 +118,15 @@ public:
      */
     RefPtr<UINode> GetNode4Index(uint32_t forIndex);
 
-    void AddKeyToL1(const std::string& key)
-    {
-        activeNodeKeysInL1_.emplace(key);
-    }
+    // the key must have a UINode, keys move between L1 and L2 together with their UINodes
+    void AddKeyToL1(InternedKeyId key);
 
-    bool IsInL1Cache(const std::string& key) const
+    bool IsInL1Cache(InternedKeyId key) const
     {
         return activeNodeKeysInL1_.find(key) != activeNodeKeysInL1_.end();
     }
 
-    const std::unordered_map<std::string, CacheItem>& GetAllNodes() const
+    const std::unordered_map<InternedKeyId, CacheItem>& GetAllNodes() const
     {
         return node4key_;
     }
@@ -153,10 +145,32 @@ public:
     std::string DumpUINode4Key4TType() const;
     std::string DumpUINode4Key() const;
 
-    std::string DumpUINodeWithKey(const std::string& key) const;
+    std::string DumpUINodeWithKey(InternedKeyId key) const;
     std::string DumpUINode(const RefPtr<UINode>& node) const;
 
 private:
+    // index of keys no longer used after invalidation
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    struct L2Key {
+        // index of the key when it was last sorted, INVALID_INDEX if the key is no longer used
+        uint32_t index = INVALID_INDEX;
+        InternedKeyId key = INVALID_INTERNED_KEY_ID;
+    };
+
+    struct TTypeCache {
+        std::string ttype;
+        // L2 cache size of the ttype
+        uint32_t cacheCount = 0;
+        // keys of the UINodes of this ttype not in L1, sorted by increasing index, keys no longer used last
+        std::vector<L2Key> l2Keys;
+        // the index of a key in l2Keys changed since it was sorted
+        bool needSort = false;
+    };
+
+    // returns the id of the ttype, adding the ttype with L2 cache size 0 if needed
+    uint32_t GetTTypeId(const std::string& ttype);
+
     /**
      * intended scenario: scroll
      * servicing GetFrameChild, search for key that can be updated.
@@ -164,9 +178,9 @@ private:
      * return a key whose UINode can be updated
      * the key must not be in L1, i.e. activeNodeKeysInL1_
      * the given ttype must match the template type the UINode for this key
-     * has been rendered for (this info is available from node4key4ttype_)
+     * has been rendered for
      */
-    std::optional<std::string> GetL2KeyToUpdate(const std::string& ttype) const;
+    std::optional<InternedKeyId> GetL2KeyToUpdate(uint32_t ttypeId);
 
     /**
      * scenario: UI rebuild following key invalidation by TS side
@@ -178,34 +192,24 @@ private:
      * (previously updated following invalidation) key -> index map and
      *
      */
-    std::optional<std::string> GetL1KeyToUpdate(const std::string& ttype) const;
+    std::optional<InternedKeyId> GetL1KeyToUpdate(uint32_t ttypeId) const;
 
     /**
      * scenario: UINode of fromKey has been updated to render data for 'forKey'
      *     the template type (ttype) remains unchanged
-     *     update node4key4ttype_ and node4key_ entries to use new key point to same UINode
+     *     update node4key_ entry to use new key point to same UINode
      */
-    RefPtr<UINode> HasUINodeBeenUpdated(
-        const std::string& ttype, const std::string& fromKey, const std::string& forKey);
-
-    /** scenario: keys cache has been updated
-     *
-     * find which keys in key -> UINode map are no longer used
-     * returned set entries are pairs:
-     *   pair.first: is this key a L1 item,
-     *   pair.second: key
-     */
-    void FindUnusedKeys(std::set<std::pair<bool, std::string>>& result) const;
+    RefPtr<UINode> HasUINodeBeenUpdated(uint32_t ttypeId, InternedKeyId fromKey, const InternedKey& forKey);
 
     /**
      * given key return the index position (reverse lookup)
      * invalidated keys (after Repeat rerender/ data change)
      * are keys for which no index exists anymore,
-     * method returns int max value for these.
-     * int max value causes that distance from active range is max
+     * method returns INVALID_INDEX for these.
+     * INVALID_INDEX causes that distance from active range is max
      * these keys will be selected for update first.
      */
-    uint32_t GetIndex4Key(const std::string& key) const;
+    uint32_t GetIndex4Key(InternedKeyId key) const;
 
     /**
      *  for given index return distance from active range,
@@ -213,23 +217,23 @@ private:
      *  distance is int max for invalidated keys
      */
     int32_t GetDistanceFromRange(uint32_t index) const;
-    /**
-     * scenario: find L1 key that should be updated
-     * choose the key whose index is the furthest away from active range
-     * given two keys compare their distFromRange
-     */
-    bool CompareKeyByIndexDistance(const std::string& key1, const std::string& key2) const;
 
-    std::set<std::string, KeySorterClass> GetSortedL2KeysForTType(
-        const std::unordered_map<std::string, RefPtr<UINode>>& uiNode4Key) const;
+    // the L2 keys of a ttype follow the UINodes of the ttype not in L1
+    void AddKeyToL2(InternedKeyId key);
+    void RemoveKeyFromL2(InternedKeyId key);
+    void SortL2Keys(TTypeCache& ttypeCache);
+
+    void SetKey4Index(uint32_t index, const std::string& key);
 
     /**
      * get more index -> key and index -> ttype from TS side
      */
     bool FetchMoreKeysTTypes(uint32_t from, uint32_t to);
 
-    // Map ttype -> cacheSize. Each ttype incl default has own L2 size
-    std::map<std::string, uint32_t> cacheCountL24ttype_;
+    // ttype -> ttype id, ids index ttypes_
+    std::unordered_map<std::string, uint32_t> ttypeIds_;
+    // each ttype incl default has own L2 size and L2 keys
+    std::vector<TTypeCache> ttypes_;
 
     // request TS to create new sub-tree for given index or update existing
     // update subtree cached for (old) index
@@ -237,13 +241,17 @@ private:
     std::function<void(uint32_t)> onCreateNode_;
     std::function<void(const std::string&, uint32_t)> onUpdateNode_;
 
-    // get index -> key for given range
-    // resulting list starts with 'from' but might end before 'to' if Array shorter
-    std::function<std::list<std::string>(uint32_t, uint32_t)> onGetTypes4Range_;
+    // get index -> ttype for given range into the given buffer
+    // result starts with 'from' but might end before 'to' if Array shorter
+    std::function<void(uint32_t, uint32_t, std::vector<std::string>&)> onGetTypes4Range_;
+
+    // get index -> key for given range into the given buffer
+    // result starts with 'from' but might end before 'to' if Array shorter
+    std::function<void(uint32_t, uint32_t, std::vector<std::string>&)> onGetKeys4Range_;
 
-    // get index -> ttype for given range
-    // resulting list starts with 'from' but might end before 'to' if Array shorter
-    std::function<std::list<std::string>(uint32_t, uint32_t)> onGetKeys4Range_;
+    // buffers reused by every fetch from TS
+    std::vector<std::string> keysBuffer_;
+    std::vector<std::string> ttypesBuffer_;
 
     // memorize active ranges of past 2 (last, prev)
     // SetActiveRange calls and use to calc scroll direction
@@ -252,24 +260,20 @@ private:
     // keys of active nodes, UINodes must be on the UI tree,
     // this list is also known as L1
     // all keys not in this set are in "L2"
-    std::unordered_set<std::string> activeNodeKeysInL1_;
+    std::unordered_set<InternedKeyId> activeNodeKeysInL1_;
 
     // L1
     // index -> key and reverse
     // lazy request from TS side can be invalidated
-    std::unordered_map<uint32_t, std::string> key4index_;
-    std::unordered_map<std::string, uint32_t> index4Key_;
+    std::unordered_map<uint32_t, InternedKey> key4index_;
+    std::unordered_map<InternedKeyId, uint32_t> index4Key_;
 
-    // index -> ttype
+    // index -> ttype id
     // lazy request from TS side can be invalidated
-    std::unordered_map<uint32_t, std::string> ttype4index_;
-    std::unordered_map<std::string, uint32_t> index4ttype_;
-
-    // Map ttype -> Map key -> UINode
-    std::unordered_map<std::string, std::unordered_map<std::string, RefPtr<UINode>>> node4key4ttype_;
+    std::unordered_map<uint32_t, uint32_t> ttype4index_;
 
-    // Map Map key -> UINode
-    std::unordered_map<std::string, CacheItem> node4key_;
+    // Map key -> UINode
+    std::unordered_map<InternedKeyId, CacheItem> node4key_;
 }; // class NodeCache
 
 } // namespace OHOS::Ace::NG
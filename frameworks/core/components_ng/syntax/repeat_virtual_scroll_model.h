@@ -22,6 +22,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "base/utils/macros.h"
 
@@ -38,8 +39,8 @@ public:
         const std::map<std::string, uint32_t>& templateCachedCountMap,
         const std::function<void(uint32_t forIndex)>& onCreateNode,
         const std::function<void(const std::string& fromKey, uint32_t forIndex)>& onUpdateNode,
-        const std::function<std::list<std::string>(uint32_t from, uint32_t to)>& onGetKeys4Range,
-        const std::function<std::list<std::string>(uint32_t from, uint32_t to)>& onGetTypes4Range) = 0;
+        const std::function<void(uint32_t from, uint32_t to, std::vector<std::string>& result)>& onGetKeys4Range,
+        const std::function<void(uint32_t from, uint32_t to, std::vector<std::string>& result)>& onGetTypes4Range) = 0;
     virtual void InvalidateKeyCache(uint32_t totalCount) = 0;
 
 private:
@@ -34,8 +34,9 @@ public:
         const std::map<std::string, uint32_t>& templateCachedCountMap,
         const std::function<void(uint32_t forIndex)>& onCreateNode,
         const std::function<void(const std::string& fromKey, uint32_t forIndex)>& onUpdateNode,
-        const std::function<std::list<std::string>(uint32_t from, uint32_t to)>& onGetKeys4Range,
-        const std::function<std::list<std::string>(uint32_t from, uint32_t to)>& onGetTypes4Range) override;
+        const std::function<void(uint32_t from, uint32_t to, std::vector<std::string>& result)>& onGetKeys4Range,
+        const std::function<void(uint32_t from, uint32_t to, std::vector<std::string>& result)>& onGetTypes4Range)
+        override;
 
     void InvalidateKeyCache(uint32_t totalCount) override;
 };
@@ -31,8 +31,8 @@ namespace OHOS::Ace::NG {
 RefPtr<RepeatVirtualScrollNode> RepeatVirtualScrollNode::GetOrCreateRepeatNode(int32_t nodeId, uint32_t totalCount,
     const std::map<std::string, uint32_t>& templateCachedCountMap, const std::function<void(uint32_t)>& onCreateNode,
     const std::function<void(const std::string&, uint32_t)>& onUpdateNode,
-    const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetKeys4Range,
-    const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetTypes4Range)
+    const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetKeys4Range,
+    const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetTypes4Range)
 {
     auto node = ElementRegister::GetInstance()->GetSpecificItemById<RepeatVirtualScrollNode>(nodeId);
     if (node) {
@@ -49,8 +49,8 @@ RefPtr<RepeatVirtualScrollNode> RepeatVirtualScrollNode::GetOrCreateRepeatNode(i
 RepeatVirtualScrollNode::RepeatVirtualScrollNode(int32_t nodeId, int32_t totalCount,
     const std::map<std::string, uint32_t>& templateCachedCountMap, const std::function<void(uint32_t)>& onCreateNode,
     const std::function<void(const std::string&, uint32_t)>& onUpdateNode,
-    const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetKeys4Range,
-    const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetTypes4Range)
+    const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetKeys4Range,
+    const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetTypes4Range)
     : ForEachBaseNode(V2::JS_REPEAT_ETS_TAG, nodeId), totalCount_(totalCount),
       caches_(templateCachedCountMap, onCreateNode, onUpdateNode, onGetKeys4Range, onGetTypes4Range),
       postUpdateTaskHasBeenScheduled_(false)
@@ -168,7 +168,7 @@ void RepeatVirtualScrollNode::InvalidateKeyCache()
  * Ask TS to update a Node, if possible
  * If no suitable node, request to crete a new node
  */
-RefPtr<UINode> RepeatVirtualScrollNode::CreateOrUpdateFrameChild4Index(uint32_t forIndex, const std::string& forKey)
+RefPtr<UINode> RepeatVirtualScrollNode::CreateOrUpdateFrameChild4Index(uint32_t forIndex, const InternedKey& forKey)
 {
     RefPtr<UINode> node4Index = caches_.UpdateFromL2(forIndex);
     if (node4Index) {
@@ -223,12 +223,12 @@ RefPtr<UINode> RepeatVirtualScrollNode::GetFrameChildByIndex(
         node4Index->SetActive(true);
     }
 
-    if (caches_.IsInL1Cache(key.value())) {
+    if (caches_.IsInL1Cache(key->GetId())) {
         return node4Index->GetFrameChildByIndex(0, needBuild);
     }
 
     // if the item was in L2 cache, move item to L1 cache.
-    caches_.AddKeyToL1(key.value());
+    caches_.AddKeyToL1(key->GetId());
     if (node4Index->GetDepth() != GetDepth() + 1) {
         node4Index->SetDepth(GetDepth() + 1);
     }
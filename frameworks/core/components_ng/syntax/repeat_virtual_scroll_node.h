@@ -19,6 +19,7 @@
 #include <cstdint>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
@@ -40,14 +41,14 @@ public:
         const std::map<std::string, uint32_t>& templateCachedCountMap,
         const std::function<void(uint32_t)>& onCreateNode,
         const std::function<void(const std::string&, uint32_t)>& onUpdateNode,
-        const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetKeys4Range,
-        const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetTypes4Range);
+        const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetKeys4Range,
+        const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetTypes4Range);
 
     RepeatVirtualScrollNode(int32_t nodeId, int32_t totalCount,
         const std::map<std::string, uint32_t>& templateCacheCountMap, const std::function<void(uint32_t)>& onCreateNode,
         const std::function<void(const std::string&, uint32_t)>& onUpdateNode,
-        const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetKeys4Range,
-        const std::function<std::list<std::string>(uint32_t, uint32_t)>& onGetTypes4Range);
+        const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetKeys4Range,
+        const std::function<void(uint32_t, uint32_t, std::vector<std::string>&)>& onGetTypes4Range);
 
     ~RepeatVirtualScrollNode() override = default;
 
@@ -156,7 +157,7 @@ private:
     // index is not in L1 or L2 cache, need to make it
     // either by TS rendering new children or by TS updating
     // a L2 cache item from old to new index
-    RefPtr<UINode> CreateOrUpdateFrameChild4Index(uint32_t index, const std::string& forKey);
+    RefPtr<UINode> CreateOrUpdateFrameChild4Index(uint32_t index, const InternedKey& forKey);
 
     // get farthest (from L1 indexes) index in L2 cache or -1
     int32_t GetFarthestL2CacheIndex();
@@ -16,38 +16,47 @@
 #include "core/gestures/velocity_tracker.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
 #include <optional>
 
 namespace OHOS::Ace {
 namespace {
-void CheckExtremePoint(const LeastSquareImpl& axis, double extremX, uint32_t valSize)
+// the impulse velocity only takes the points of the last 100ms.
+constexpr double IMPULSE_HORIZON = 0.1;
+// the highest touch sampling rate, in Hz.
+constexpr double MAX_SAMPLING_RATE = 240.0;
+static_assert(LeastSquareImpl::MAX_COUNT_NUM > IMPULSE_HORIZON * MAX_SAMPLING_RATE,
+    "the axes must keep every point of the impulse horizon");
+
+void CheckExtremePoint(const LeastSquareImpl& axis, double extremX, int32_t valSize)
 {
-    const auto& x = axis.GetXVals();
-    const auto& y = axis.GetYVals();
-    auto count = axis.GetTrackNum();
+    auto count = axis.GetPointNum();
 
     // filter quiver
-    if (LessNotEqual(std::fabs(y[count - 1] - y[count - 2]), 100)) { // 2: const, 100: quiver threshold
+    auto lastDelta = axis.GetYVal(count - 1) - axis.GetYVal(count - 2); // 2: const
+    if (LessNotEqual(std::fabs(lastDelta), 100)) { // 100: quiver threshold
         return;
     }
     // check if extrem point exists between axis's points.
-    if (GreatNotEqual(extremX, x[x.size() - valSize]) && LessNotEqual(extremX, x.back())) {
+    if (GreatNotEqual(extremX, axis.GetXVal(count - valSize)) && LessNotEqual(extremX, axis.GetXVal(count - 1))) {
         LOGI("Extrem point %{public}f exists between tracker points.", extremX);
     }
     // dump points
-    int32_t i = static_cast<int32_t>(x.size());
+    int32_t i = count;
     for (int32_t cnt = VelocityTracker::POINT_NUMBER; i > 0 && cnt > 0; --cnt) {
         --i;
-        LOGI("Last tracker points[%{public}d] x=%{public}f y=%{public}f", cnt, x[i], y[i]);
+        LOGI("Last tracker points[%{public}d] x=%{public}f y=%{public}f", cnt, axis.GetXVal(i), axis.GetYVal(i));
     }
 }
 
 // true for increasing, false for decreasing, nullopt for nonmonotonic
-std::optional<bool> GetMononicity(const std::vector<double>& vals, uint32_t valSize)
+std::optional<bool> GetMononicity(const LeastSquareImpl& axis, int32_t valSize)
 {
+    auto count = axis.GetPointNum();
     std::optional<bool> compareResult;
-    for (uint32_t i = vals.size() - valSize + 1; i < vals.size(); ++i) {
-        double delta = vals[i] - vals[i - 1];
+    for (int32_t i = count - valSize + 1; i < count; ++i) {
+        double delta = axis.GetYVal(i) - axis.GetYVal(i - 1);
         if (NearZero(delta)) {
             continue;
         }
@@ -62,17 +71,15 @@ std::optional<bool> GetMononicity(const std::vector<double>& vals, uint32_t valS
 
 inline double GetLinearSlope(const LeastSquareImpl& axis)
 {
-    const auto& x = axis.GetXVals();
-    const auto& y = axis.GetYVals();
-    auto count = axis.GetTrackNum();
-    return (y[count - 1] - y[count - 2]) / (x[count - 1] - x[count - 2]); // 2: const
+    auto count = axis.GetPointNum();
+    return (axis.GetYVal(count - 1) - axis.GetYVal(count - 2)) / // 2: const
+           (axis.GetXVal(count - 1) - axis.GetXVal(count - 2));  // 2: const
 }
 
 void CorrectMonotonicAxisVelocity(const LeastSquareImpl& axis, double& v, double extremX)
 {
-    const auto& yVals = axis.GetYVals();
-    uint32_t valSize = std::min(static_cast<int32_t>(yVals.size()), VelocityTracker::POINT_NUMBER);
-    auto mononicity = GetMononicity(yVals, valSize);
+    auto valSize = std::min(axis.GetPointNum(), VelocityTracker::POINT_NUMBER);
+    auto mononicity = GetMononicity(axis, valSize);
     if (!mononicity.has_value()) {
         return;
     }
@@ -89,8 +96,8 @@ void CorrectMonotonicAxisVelocity(const LeastSquareImpl& axis, double& v, double
 
 double UpdateAxisVelocity(LeastSquareImpl& axis)
 {
-    std::vector<double> param(VelocityTracker::LEAST_SQUARE_PARAM_NUM, 0);
-    auto x = axis.GetXVals().back();
+    std::array<double, LeastSquareImpl::MAX_PARAMS_NUM> param {};
+    auto x = axis.GetXVal(axis.GetPointNum() - 1);
     // curve is param[0] * x^2 + param[1] * x + param[2]
     // the velocity is 2 * param[0] * x + param[1];
     double velocity = 0.0;
@@ -103,6 +110,41 @@ double UpdateAxisVelocity(LeastSquareImpl& axis)
     }
     return velocity;
 }
+
+inline double KineticEnergyToVelocity(double work)
+{
+    // the kinetic energy of a unit mass is v^2 / 2.
+    return std::copysign(std::sqrt(2.0 * std::fabs(work)), work); // 2: const of formula
+}
+
+// Takes the velocity of the kinetic energy which the moves between the points have given to a unit mass, it follows
+// the last moves more closely than a curve fitted through all of them.
+double GetImpulseVelocity(const LeastSquareImpl& axis)
+{
+    auto count = axis.GetPointNum();
+    auto lastX = axis.GetXVal(count - 1);
+    auto start = count - 1;
+    while (start > 0 && LessOrEqual(lastX - axis.GetXVal(start - 1), IMPULSE_HORIZON)) {
+        --start;
+    }
+    double work = 0.0;
+    bool isFirstMove = true;
+    for (auto i = start + 1; i < count; ++i) {
+        auto duration = axis.GetXVal(i) - axis.GetXVal(i - 1);
+        if (duration <= 0.0) {
+            continue;
+        }
+        auto lastVelocity = KineticEnergyToVelocity(work);
+        auto velocity = (axis.GetYVal(i) - axis.GetYVal(i - 1)) / duration;
+        work += (velocity - lastVelocity) * std::fabs(velocity);
+        if (isFirstMove) {
+            // the mass starts at rest, the first move only gives half of its work.
+            work *= 0.5; // 0.5: const of formula
+            isFirstMove = false;
+        }
+    }
+    return KineticEnergyToVelocity(work);
+}
 } // namespace
 
 void VelocityTracker::UpdateTouchPoint(const TouchEvent& event, bool end)
@@ -177,8 +219,9 @@ void VelocityTracker::UpdateVelocity()
         return;
     }
 
-    double xVelocity = UpdateAxisVelocity(xAxis_);
-    double yVelocity = UpdateAxisVelocity(yAxis_);
+    bool isImpulse = strategy_ == VelocityStrategy::IMPULSE;
+    double xVelocity = isImpulse ? GetImpulseVelocity(xAxis_) : UpdateAxisVelocity(xAxis_);
+    double yVelocity = isImpulse ? GetImpulseVelocity(yAxis_) : UpdateAxisVelocity(yAxis_);
     velocity_.SetOffsetPerSecond({ xVelocity, yVelocity });
     isVelocityDone_ = true;
 }
@@ -24,6 +24,13 @@
 
 namespace OHOS::Ace {
 
+enum class VelocityStrategy {
+    // the slope at the last point of a quadratic fitted through the last points.
+    LEAST_SQUARE = 0,
+    // the velocity of the kinetic energy given by the moves of the last 100ms.
+    IMPULSE,
+};
+
 class VelocityTracker final {
 public:
     VelocityTracker() = default;
@@ -78,6 +85,12 @@ public:
         mainAxis_ = axis;
     }
 
+    void SetStrategy(VelocityStrategy strategy)
+    {
+        strategy_ = strategy;
+        isVelocityDone_ = false;
+    }
+
     double GetMainAxisPos() const
     {
         switch (mainAxis_) {
@@ -125,6 +138,7 @@ private:
     void UpdateVelocity();
 
     Axis mainAxis_ { Axis::FREE };
+    VelocityStrategy strategy_ { VelocityStrategy::LEAST_SQUARE };
     TouchEvent firstTrackPoint_;
     TouchEvent currentTrackPoint_;
     Offset lastPosition_;
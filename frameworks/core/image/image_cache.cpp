@@ -15,16 +15,31 @@
 
 #include "core/image/image_cache.h"
 
+#include <algorithm>
 #include <string>
 
 #include "base/log/dump_log.h"
+#include "base/utils/system_properties.h"
+#include "base/utils/utils.h"
 #include "core/components_ng/image_provider/image_object.h"
 #include "core/image/image_object.h"
 
 namespace OHOS::Ace {
+namespace {
+constexpr size_t MB_TO_BYTES = 1024 * 1024;
+
+size_t GetSizeLimit(int32_t sizeInMB)
+{
+    return static_cast<size_t>(std::max(sizeInMB, 0)) * MB_TO_BYTES;
+}
+} // namespace
+
 RefPtr<ImageCache> ImageCache::Create()
 {
-    return MakeRefPtr<ImageCache>();
+    auto imageCache = MakeRefPtr<ImageCache>();
+    imageCache->SetDecodedImageSizeLimit(GetSizeLimit(SystemProperties::GetImageDecodedCacheSize()));
+    imageCache->SetImgObjSizeLimit(GetSizeLimit(SystemProperties::GetImageObjectCacheSize()));
+    return imageCache;
 }
 
 // TODO: Create a real ImageCache later
@@ -45,52 +60,88 @@ RefPtr<ImageCache> ImageCache::Create()
 void ImageCache::Purge() {}
 #endif
 
-void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image)
+namespace {
+template<typename T>
+void DumpCacheStats(const std::string& name, const ShardedLRUCache<T>& cache)
+{
+    LRUShardStats total;
+    for (const auto& shard : cache.GetStats()) {
+        total.hits += shard.hits;
+        total.misses += shard.misses;
+        total.evictions += shard.evictions;
+    }
+    DumpLog::GetInstance().Print(name + " count: " + std::to_string(cache.Count()) +
+                                 ", size: " + std::to_string(cache.Bytes()) + "(B), hits: " +
+                                 std::to_string(total.hits) + ", misses: " + std::to_string(total.misses) +
+                                 ", evictions: " + std::to_string(total.evictions));
+}
+
+size_t GetImgObjSize(const RefPtr<NG::ImageObject>& imgObj)
+{
+    CHECK_NULL_RETURN(imgObj, 0);
+    const auto& data = imgObj->GetData();
+    return sizeof(NG::ImageObject) + (data ? data->GetSize() : 0);
+}
+
+size_t GetImgObjSize(const RefPtr<ImageObject>& imgObj)
+{
+    CHECK_NULL_RETURN(imgObj, 0);
+    // the legacy image object keeps its decoded frames, estimate them from the image size.
+    constexpr double BYTES_PER_PIXEL = 4.0;
+    auto imageSize = imgObj->GetImageSize();
+    auto pixelSize = std::max(imageSize.Width(), 0.0) * std::max(imageSize.Height(), 0.0) * BYTES_PER_PIXEL;
+    return sizeof(ImageObject) + static_cast<size_t>(pixelSize);
+}
+} // namespace
+
+void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image, size_t imageSize)
 {
     if (key.empty() || capacity_ == 0) {
         return;
     }
-    std::scoped_lock lock(imageCacheMutex_);
-    CountLimitLRU::CacheWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, image, cacheList_, imageCache_, capacity_);
+    if (!imageCache_.Put(key, image, imageSize)) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "decoded image %{private}s of %{public}zu bytes is over the limit %{public}zu",
+            key.c_str(), imageSize, imageCache_.GetSizeLimit());
+    }
 }
 
 std::shared_ptr<CachedImage> ImageCache::GetCacheImage(const std::string& key)
 {
-    std::scoped_lock lock(imageCacheMutex_);
-    return CountLimitLRU::GetCacheObjWithCountLimitLRU<std::shared_ptr<CachedImage>>(key, cacheList_, imageCache_);
+    return imageCache_.Get(key);
 }
 
 void ImageCache::CacheImgObjNG(const std::string& key, const RefPtr<NG::ImageObject>& imgObj)
 {
-    if (key.empty() || imgObjCapacity_ == 0) {
+    if (key.empty()) {
         return;
     }
-    std::scoped_lock lock(imgObjMutex_);
-    CountLimitLRU::CacheWithCountLimitLRU<RefPtr<NG::ImageObject>>(
-        key, imgObj, cacheImgObjListNG_, imgObjCacheNG_, imgObjCapacity_);
+    auto imgObjSize = GetImgObjSize(imgObj);
+    if (!imgObjCacheNG_.Put(key, imgObj, imgObjSize)) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "image object %{private}s of %{public}zu bytes is over the limit %{public}zu",
+            key.c_str(), imgObjSize, imgObjCacheNG_.GetSizeLimit());
+    }
 }
 
 RefPtr<NG::ImageObject> ImageCache::GetCacheImgObjNG(const std::string& key)
 {
-    std::scoped_lock lock(imgObjMutex_);
-    return CountLimitLRU::GetCacheObjWithCountLimitLRU<RefPtr<NG::ImageObject>>(
-        key, cacheImgObjListNG_, imgObjCacheNG_);
+    return imgObjCacheNG_.Get(key);
 }
 
 void ImageCache::CacheImgObj(const std::string& key, const RefPtr<ImageObject>& imgObj)
 {
-    if (key.empty() || imgObjCapacity_ == 0) {
+    if (key.empty()) {
         return;
     }
-    std::scoped_lock lock(imgObjMutex_);
-    CountLimitLRU::CacheWithCountLimitLRU<RefPtr<ImageObject>>(
-        key, imgObj, cacheImgObjList_, imgObjCache_, imgObjCapacity_);
+    auto imgObjSize = GetImgObjSize(imgObj);
+    if (!imgObjCache_.Put(key, imgObj, imgObjSize)) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "image object %{private}s of %{public}zu bytes is over the limit %{public}zu",
+            key.c_str(), imgObjSize, imgObjCache_.GetSizeLimit());
+    }
 }
 
 RefPtr<ImageObject> ImageCache::GetCacheImgObj(const std::string& key)
 {
-    std::scoped_lock lock(imgObjMutex_);
-    return CountLimitLRU::GetCacheObjWithCountLimitLRU<RefPtr<ImageObject>>(key, cacheImgObjList_, imgObjCache_);
+    return imgObjCache_.Get(key);
 }
 
 void ImageCache::CacheImageData(const std::string& key, const RefPtr<NG::ImageData>& imageData)
@@ -99,138 +150,70 @@ void ImageCache::CacheImageData(const std::string& key, const RefPtr<NG::ImageDa
         return;
     }
     ACE_SCOPED_TRACE("CacheImageData key:%s", key.c_str());
-    std::scoped_lock lock(dataCacheMutex_);
     auto dataSize = imageData->GetSize();
-    auto iter = imageDataCache_.find(key);
-    bool inCache = (iter != imageDataCache_.end());
-    bool largerHalfSize = dataSize > (dataSizeLimit_ >> 1);
-    size_t oldSize = !inCache ? 0 : iter->second->cacheObj->GetSize();
-    if (largerHalfSize && inCache) {
+    if (dataSize > (dataSizeLimit_ >> 1)) {
         // if data is longer than half limit, do not cache it.
         // and if the key is in Cache, erase it.
-        curDataSize_ -= oldSize;
-        dataCacheList_.erase(iter->second);
-        imageDataCache_.erase(key);
-        TAG_LOGW(AceLogTag::ACE_IMAGE, "data is %{public}d, bigger than half limit %{public}d, do not cache it",
-            static_cast<int32_t>(dataSize), static_cast<int32_t>(dataSizeLimit_ >> 1));
-    } else if (!largerHalfSize && !inCache && ProcessImageDataCacheInner(dataSize)) {
-        dataCacheList_.emplace_front(key, imageData);
-        imageDataCache_.emplace(key, dataCacheList_.begin());
-    } else if (!largerHalfSize && inCache && oldSize >= dataSize) {
-        // if the image is in the cache, and dataSize <= oldSize, we can replace the imageData in cache.
-        curDataSize_ = curDataSize_ + dataSize - oldSize;
-        iter->second->cacheObj = imageData;
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-    } else if (!largerHalfSize && inCache && oldSize < dataSize) {
-        // if the image is in the cache, and dataSize > oldSize, we erase the old one, the try to cache the new image.
-        curDataSize_ -= oldSize;
-        dataCacheList_.erase(iter->second);
-        imageDataCache_.erase(key);
-        if (ProcessImageDataCacheInner(dataSize)) {
-            dataCacheList_.emplace_front(key, imageData);
-            imageDataCache_.emplace(key, dataCacheList_.begin());
+        if (dataCache_.Erase(key)) {
+            TAG_LOGW(AceLogTag::ACE_IMAGE, "data is %{public}d, bigger than half limit %{public}d, do not cache it",
+                static_cast<int32_t>(dataSize), static_cast<int32_t>(dataSizeLimit_ >> 1));
         }
+        return;
     }
-}
-
-bool ImageCache::ProcessImageDataCacheInner(size_t dataSize)
-{
-    while (dataSize + curDataSize_ > dataSizeLimit_ && !dataCacheList_.empty()) {
-        curDataSize_ -= dataCacheList_.back().cacheObj->GetSize();
-        imageDataCache_.erase(dataCacheList_.back().cacheKey);
-        dataCacheList_.pop_back();
-    }
-    if (dataSize + curDataSize_ > dataSizeLimit_) {
-        return false;
-    }
-    curDataSize_ += dataSize;
-    return true;
+    // least recently used data of any shard is evicted until the new data fits.
+    dataCache_.Put(key, imageData, dataSize);
 }
 
 RefPtr<NG::ImageData> ImageCache::GetCacheImageData(const std::string& key)
 {
     ACE_SCOPED_TRACE("GetCacheImageData key:%s", key.c_str());
-    std::scoped_lock lock(dataCacheMutex_);
-    auto iter = imageDataCache_.find(key);
-    if (iter != imageDataCache_.end()) {
-        dataCacheList_.splice(dataCacheList_.begin(), dataCacheList_, iter->second);
-        iter->second = dataCacheList_.begin();
-        return iter->second->cacheObj;
-    }
-    return nullptr;
+    return dataCache_.Get(key);
 }
 
 void ImageCache::ClearCacheImage(const std::string& key)
 {
     ACE_SCOPED_TRACE("ClearCacheImage key:%s", key.c_str());
-    {
-        std::scoped_lock lock(imageCacheMutex_);
-        auto iter = imageCache_.find(key);
-        if (iter != imageCache_.end()) {
-            cacheList_.erase(iter->second);
-            imageCache_.erase(iter);
-        }
-    }
-
-    {
-        std::scoped_lock lock(dataCacheMutex_);
-        auto iter = imageDataCache_.find(key);
-        if (iter != imageDataCache_.end()) {
-            dataCacheList_.erase(iter->second);
-            imageDataCache_.erase(iter);
-        }
-    }
+    imageCache_.Erase(key);
+    dataCache_.Erase(key);
 }
 
 void ImageCache::Clear()
 {
     ACE_SCOPED_TRACE("ImageCache Clear");
-    {
-        std::scoped_lock lock(imageCacheMutex_);
-        cacheList_.clear();
-        imageCache_.clear();
-    }
-    {
-        std::scoped_lock lock(dataCacheMutex_);
-        dataCacheList_.clear();
-        imageDataCache_.clear();
-    }
-    {
-        std::scoped_lock lock(imgObjMutex_);
-        cacheImgObjListNG_.clear();
-        imgObjCacheNG_.clear();
-        cacheImgObjList_.clear();
-        imgObjCache_.clear();
-    }
+    imageCache_.Clear();
+    dataCache_.Clear();
+    imgObjCacheNG_.Clear();
+    imgObjCache_.Clear();
 }
 
 void ImageCache::DumpCacheInfo()
 {
-    auto cacheSize = dataCacheList_.size();
+    auto cacheSize = dataCache_.Count();
     auto capacity = static_cast<int32_t>(capacity_);
     auto dataSizeLimit = static_cast<int32_t>(dataSizeLimit_);
     DumpLog::GetInstance().Print("------------ImageCacheInfo------------");
     DumpLog::GetInstance().Print("User set ImageRawDataCacheSize : " + std::to_string(dataSizeLimit) + "(B)" +
                                  ", ImageCacheCount :" + std::to_string(capacity) + "(number)");
+    DumpLog::GetInstance().Print("Decoded image size limit : " + std::to_string(imageCache_.GetSizeLimit()) + "(B)" +
+                                 ", Image object size limit : " + std::to_string(imgObjCacheNG_.GetSizeLimit()) +
+                                 "(B)");
+    DumpCacheStats("Decoded image cache", imageCache_);
+    DumpCacheStats("Image data cache", dataCache_);
+    DumpCacheStats("Image object cache", imgObjCacheNG_);
     DumpLog::GetInstance().Print("Cache count: " + std::to_string(cacheSize));
     if (cacheSize == 0) {
         return;
     }
-    auto totalCount = 0;
-    for (const auto& item : dataCacheList_) {
-        auto imageObj = item.cacheObj;
-        auto key = item.cacheKey;
+    size_t totalCount = 0;
+    dataCache_.ForEach([this, &totalCount](const std::string& key, const RefPtr<NG::ImageData>& imageData, size_t) {
         std::string srcStr = "NA";
-        for (const auto& cacheImageObj : cacheImgObjListNG_) {
-            if (cacheImageObj.cacheKey == key) {
-                srcStr = cacheImageObj.cacheObj->GetSourceInfo().ToString();
-                break;
-            }
+        auto cacheImageObj = imgObjCacheNG_.Peek(key);
+        if (cacheImageObj) {
+            srcStr = cacheImageObj->GetSourceInfo().ToString();
         }
-        totalCount += static_cast<int32_t>(imageObj->GetSize());
-        DumpLog::GetInstance().Print("Cache Obj of key: " + key + ", src:" + srcStr + "," + imageObj->ToString());
-    }
+        totalCount += imageData->GetSize();
+        DumpLog::GetInstance().Print("Cache Obj of key: " + key + ", src:" + srcStr + "," + imageData->ToString());
+    });
     DumpLog::GetInstance().Print("Cache total size: " + std::to_string(totalCount));
 }
 } // namespace OHOS::Ace
@@ -17,9 +17,12 @@
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_CACHE_H
 
 #include <algorithm>
+#include <atomic>
 #include <list>
+#include <memory>
 #include <mutex>
 #include <shared_mutex>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -27,7 +30,7 @@
 #include "base/memory/ace_type.h"
 #include "base/utils/macros.h"
 #include "base/utils/noncopyable.h"
-#include "core/common/lru/count_limit_lru.h"
+#include "core/common/lru/sharded_lru_cache.h"
 
 namespace OHOS::Ace {
 
@@ -47,7 +50,8 @@ public:
     ImageCache() = default;
     ~ImageCache() override = default;
 
-    void CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image);
+    // imageSize is the memory taken by the decoded image, see CachedImage::GetMemorySize.
+    void CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image, size_t imageSize);
     std::shared_ptr<CachedImage> GetCacheImage(const std::string& key);
 
     void CacheImageData(const std::string& key, const RefPtr<NG::ImageData>& imageData);
@@ -63,12 +67,27 @@ public:
     {
         TAG_LOGI(AceLogTag::ACE_IMAGE, "User Set Capacity : %{public}d", static_cast<int32_t>(capacity));
         capacity_ = capacity;
+        imageCache_.SetCountLimit(capacity);
     }
 
     void SetDataCacheLimit(size_t sizeLimit)
     {
         TAG_LOGI(AceLogTag::ACE_IMAGE, "User Set data size cache limit : %{public}d", static_cast<int32_t>(sizeLimit));
         dataSizeLimit_ = sizeLimit;
+        dataCache_.SetSizeLimit(sizeLimit);
+    }
+
+    void SetDecodedImageSizeLimit(size_t sizeLimit)
+    {
+        TAG_LOGI(AceLogTag::ACE_IMAGE, "Set decoded image size limit : %{public}zu", sizeLimit);
+        imageCache_.SetSizeLimit(sizeLimit);
+    }
+
+    void SetImgObjSizeLimit(size_t sizeLimit)
+    {
+        TAG_LOGI(AceLogTag::ACE_IMAGE, "Set image object size limit : %{public}zu", sizeLimit);
+        imgObjCacheNG_.SetSizeLimit(sizeLimit);
+        imgObjCache_.SetSizeLimit(sizeLimit);
     }
 
     size_t GetCapacity() const
@@ -78,8 +97,7 @@ public:
 
     size_t GetCachedImageCount() const
     {
-        std::lock_guard<std::mutex> lock(imageCacheMutex_);
-        return cacheList_.size();
+        return imageCache_.Count();
     }
 
     void Clear();
@@ -89,27 +107,21 @@ public:
     void DumpCacheInfo();
 
 private:
-    bool ProcessImageDataCacheInner(size_t dataSize);
+    // decoded images and image objects are limited by count and by their estimated memory size, Create applies the
+    // size limits of the device over these defaults.
+    static constexpr size_t DECODED_IMAGE_SIZE_LIMIT = 100 * 1024 * 1024;
+    static constexpr size_t IMG_OBJ_COUNT_LIMIT = 2000; // imgObj is cached after clear image data.
+    static constexpr size_t IMG_OBJ_SIZE_LIMIT = 100 * 1024 * 1024;
 
     std::atomic<size_t> capacity_ = 0; // by default memory cache can store 0 images.
-    mutable std::mutex imageCacheMutex_;
-    std::list<CacheNode<std::shared_ptr<CachedImage>>> cacheList_;
-    std::unordered_map<std::string, std::list<CacheNode<std::shared_ptr<CachedImage>>>::iterator> imageCache_;
-
-    std::mutex dataCacheMutex_;
-    std::list<CacheNode<RefPtr<NG::ImageData>>> dataCacheList_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<NG::ImageData>>>::iterator> imageDataCache_;
-
-    std::atomic<size_t> dataSizeLimit_ = 0; // by default, image data before decoded cache is 0 MB.;
-    std::atomic<size_t> curDataSize_ = 0;
+    ShardedLRUCache<std::shared_ptr<CachedImage>> imageCache_ { 0, DECODED_IMAGE_SIZE_LIMIT };
 
-    std::mutex imgObjMutex_;
-    std::atomic<size_t> imgObjCapacity_ = 2000; // imgObj is cached after clear image data.
+    std::atomic<size_t> dataSizeLimit_ = 0; // by default, image data before decoded cache is 0 MB.
+    // image data is only limited by size.
+    ShardedLRUCache<RefPtr<NG::ImageData>> dataCache_ { ShardedLRUCache<RefPtr<NG::ImageData>>::NO_LIMIT, 0 };
 
-    std::list<CacheNode<RefPtr<NG::ImageObject>>> cacheImgObjListNG_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<NG::ImageObject>>>::iterator> imgObjCacheNG_;
-    std::list<CacheNode<RefPtr<ImageObject>>> cacheImgObjList_;
-    std::unordered_map<std::string, std::list<CacheNode<RefPtr<ImageObject>>>::iterator> imgObjCache_;
+    ShardedLRUCache<RefPtr<NG::ImageObject>> imgObjCacheNG_ { IMG_OBJ_COUNT_LIMIT, IMG_OBJ_SIZE_LIMIT };
+    ShardedLRUCache<RefPtr<ImageObject>> imgObjCache_ { IMG_OBJ_COUNT_LIMIT, IMG_OBJ_SIZE_LIMIT };
 
     ACE_DISALLOW_COPY_AND_MOVE(ImageCache);
 };
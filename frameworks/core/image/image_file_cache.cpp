@@ -28,7 +28,9 @@
 #include "core/image/image_loader.h"
 #include "core/image/image_source_info.h"
 
-#ifdef USE_ROSEN_DRAWING
+#ifndef USE_ROSEN_DRAWING
+#include "include/core/SkData.h"
+#else
 #include "core/components_ng/image_provider/adapter/rosen/drawing_image_data.h"
 #endif
 
@@ -39,6 +41,9 @@ ImageFileCache::~ImageFileCache() = default;
 namespace {
 const std::string ASTC_SUFFIX = ".astc";
 const std::string CONVERT_ASTC_FORMAT = "image/astc/4*4";
+constexpr int32_t ASTC_BLOCK_SIDE = 4;
+constexpr uint64_t ASTC_BLOCK_SIZE = 16;
+constexpr uint64_t ASTC_HEADER_SIZE = 16;
 const std::string SLASH = "/";
 const std::string BACKSLASH = "\\";
 const mode_t CHOWN_RW_UG = 0660;
@@ -52,6 +57,10 @@ bool IsAstcFile(const char fileName[])
     auto fileNameStr = std::string(fileName);
     return (fileNameStr.length() >= ASTC_SUFFIX.length()) && EndsWith(fileNameStr, ASTC_SUFFIX);
 }
+void PackMappingReleaseProc(const void* /* data */, void* context)
+{
+    delete reinterpret_cast<std::shared_ptr<const ImagePackMapping>*>(context);
+}
 }
 
 void ImageFileCache::SetImageCacheFilePath(const std::string& cacheFilePath)
@@ -140,6 +149,9 @@ void ImageFileCache::SetClearCacheFileRatio(float clearRatio)
 
 RefPtr<NG::ImageData> ImageFileCache::GetDataFromCacheFile(const std::string& url, const std::string& suffix)
 {
+    if (usePackFileStore_) {
+        return GetDataFromPackFileStore(url, suffix);
+    }
     std::lock_guard<std::mutex> lock(cacheFileInfoMutex_);
     auto filePath = GetCacheFilePathInner(url, suffix);
     if (filePath == "") {
@@ -154,6 +166,36 @@ RefPtr<NG::ImageData> ImageFileCache::GetDataFromCacheFile(const std::string& ur
 #endif
 }
 
+RefPtr<NG::ImageData> ImageFileCache::GetDataFromPackFileStore(const std::string& url, const std::string& suffix)
+{
+    ImagePackRecord record;
+    if (!packFileStore_.Get(url, suffix, record)) {
+        return nullptr;
+    }
+    if (SystemProperties::IsImageFileCacheConvertAstcEnabled() && record.suffix != ASTC_SUFFIX &&
+        record.accessCount == static_cast<uint32_t>(SystemProperties::GetImageFileCacheConvertAstcThreshold())) {
+        // the task holds the mapping, so the data stays readable until it runs.
+        BackgroundTaskExecutor::GetInstance().PostTask(
+            [this, url, mapping = record.mapping, data = record.data, size = record.size]() {
+                ConvertToAstcAndWriteToPackFileStore(url, data, size);
+            },
+            BgTaskPriority::LOW);
+    }
+    // the image data views the mapped pack file, the mapping is released with the data.
+    auto* mapping = new std::shared_ptr<const ImagePackMapping>(std::move(record.mapping));
+#ifndef USE_ROSEN_DRAWING
+    auto skData = SkData::MakeWithProc(record.data, record.size, PackMappingReleaseProc, mapping);
+    return NG::ImageData::MakeFromDataWrapper(&skData);
+#else
+    auto rsData = std::make_shared<RSData>();
+    if (!rsData->BuildWithProc(record.data, record.size, PackMappingReleaseProc, mapping)) {
+        delete mapping;
+        return nullptr;
+    }
+    return AceType::MakeRefPtr<NG::DrawingImageData>(rsData);
+#endif
+}
+
 void ImageFileCache::SaveCacheInner(const std::string& cacheKey, const std::string& suffix, size_t cacheSize,
     std::vector<std::string>& removeVector)
 {
@@ -195,6 +237,10 @@ void ImageFileCache::SaveCacheInner(const std::string& cacheKey, const std::stri
 
 void ImageFileCache::EraseCacheFile(const std::string &url)
 {
+    if (usePackFileStore_) {
+        packFileStore_.Erase(url);
+        return;
+    }
     auto fileCacheKey = std::to_string(std::hash<std::string> {}(url));
     {
         std::scoped_lock<std::mutex> lock(cacheFileInfoMutex_);
@@ -222,6 +268,10 @@ void ImageFileCache::WriteCacheFile(
             static_cast<int32_t>(size), static_cast<int32_t>(fileLimit_));
         return;
     }
+    if (usePackFileStore_) {
+        WritePackFileStore(url, data, size, suffix);
+        return;
+    }
     auto fileCacheKey = std::to_string(std::hash<std::string> {}(url));
     {
         std::scoped_lock<std::mutex> lock(cacheFileInfoMutex_);
@@ -253,6 +303,25 @@ void ImageFileCache::WriteCacheFile(
     ClearCacheFile(removeVector);
 }
 
+void ImageFileCache::WritePackFileStore(
+    const std::string& url, const void* data, size_t size, const std::string& suffix)
+{
+    if (packFileStore_.Contains(url, suffix)) {
+        TAG_LOGI(AceLogTag::ACE_IMAGE, "image has been wrote to pack file: %{public}s", url.c_str());
+        return;
+    }
+    if (!packFileStore_.Put(url, suffix, data, size)) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "write image to pack file failed: %{public}s", url.c_str());
+        return;
+    }
+    TAG_LOGI(AceLogTag::ACE_IMAGE, "write image cache to pack file: %{public}s", url.c_str());
+    // check if cache files too big.
+    size_t fileLimit = fileLimit_;
+    if (packFileStore_.GetLiveSize() > fileLimit) {
+        packFileStore_.Trim(static_cast<size_t>(fileLimit * (1.0f - clearCacheFileRatio_)));
+    }
+}
+
 void ImageFileCache::ConvertToAstcAndWriteToFile(const std::string& fileCacheKey, const std::string& filePath,
     const std::string& url)
 {
@@ -310,6 +379,45 @@ void ImageFileCache::ConvertToAstcAndWriteToFile(const std::string& fileCacheKey
     TAG_LOGI(AceLogTag::ACE_IMAGE, "write image astc cache: %{public}s %{private}s", url.c_str(), astcFilePath.c_str());
 }
 
+void ImageFileCache::ConvertToAstcAndWriteToPackFileStore(const std::string& url, const uint8_t* data, size_t size)
+{
+    ACE_FUNCTION_TRACE();
+    RefPtr<ImageSource> imageSource = ImageSource::Create(data, static_cast<uint32_t>(size));
+    if (!imageSource || imageSource->GetFrameCount() != 1) {
+        TAG_LOGI(AceLogTag::ACE_IMAGE, "Image frame count is not 1, will not convert to astc. %{public}s", url.c_str());
+        return;
+    }
+    if (imageSource->GetEncodedFormat() == SVG_FORMAT) {
+        TAG_LOGI(AceLogTag::ACE_IMAGE, "Image is svg, will not convert to astc. %{public}s", url.c_str());
+        return;
+    }
+    auto pixelMap = imageSource->CreatePixelMap({-1, -1});
+    if (pixelMap == nullptr) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "Get pixel map failed, will not convert to astc. %{public}s", url.c_str());
+        return;
+    }
+    // the record replaces the one of the original image, so it is packed into memory instead of a file.
+    auto blockCount = static_cast<uint64_t>((pixelMap->GetWidth() + ASTC_BLOCK_SIDE - 1) / ASTC_BLOCK_SIDE) *
+                      static_cast<uint64_t>((pixelMap->GetHeight() + ASTC_BLOCK_SIDE - 1) / ASTC_BLOCK_SIDE);
+    auto maxSize = blockCount * ASTC_BLOCK_SIZE + ASTC_HEADER_SIZE;
+    if (blockCount == 0 || maxSize > fileLimit_) {
+        TAG_LOGI(AceLogTag::ACE_IMAGE, "Image size is out of range, will not convert to astc. %{public}s", url.c_str());
+        return;
+    }
+    std::vector<uint8_t> astcData(static_cast<size_t>(maxSize));
+    RefPtr<ImagePacker> imagePacker = ImagePacker::Create();
+    PackOption option;
+    option.format = CONVERT_ASTC_FORMAT;
+    imagePacker->StartPacking(astcData.data(), static_cast<uint32_t>(maxSize), option);
+    imagePacker->AddImage(*pixelMap);
+    int64_t packedSize = 0;
+    if (imagePacker->FinalizePacking(packedSize) || packedSize <= 0 || static_cast<uint64_t>(packedSize) > maxSize) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "convert to astc failed. %{public}s", url.c_str());
+        return;
+    }
+    WritePackFileStore(url, astcData.data(), static_cast<size_t>(packedSize), ASTC_SUFFIX);
+}
+
 void ImageFileCache::ClearCacheFile(const std::vector<std::string>& removeFiles)
 {
 #ifndef ACE_UNITTEST
@@ -324,6 +432,10 @@ void ImageFileCache::ClearCacheFile(const std::vector<std::string>& removeFiles)
 
 std::string ImageFileCache::GetCacheFilePath(const std::string& url)
 {
+    // images in the pack file have no file path, read them with GetDataFromCacheFile.
+    if (usePackFileStore_) {
+        return "";
+    }
     std::scoped_lock<std::mutex> lock(cacheFileInfoMutex_);
     return GetCacheFilePathInner(url, "");
 }
@@ -360,6 +472,15 @@ void ImageFileCache::SetCacheFileInfo()
         return;
     }
     std::string cacheFilePath = GetImageCacheFilePath();
+    if (SystemProperties::IsImageFileCachePackEnabled()) {
+        // the pack file store maps its index instead of scanning the cache directory.
+        if (packFileStore_.Open(cacheFilePath)) {
+            usePackFileStore_ = true;
+            hasSetCacheFileInfo_ = true;
+            return;
+        }
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "open image pack file failed, use cache files instead.");
+    }
     std::unique_ptr<DIR, decltype(&closedir)> dir(opendir(cacheFilePath.c_str()), closedir);
     if (dir == nullptr) {
         TAG_LOGW(AceLogTag::ACE_IMAGE, "cache file path wrong! maybe it is not set.");
@@ -391,6 +512,10 @@ void ImageFileCache::SetCacheFileInfo()
 
 void ImageFileCache::DumpCacheInfo()
 {
+    if (usePackFileStore_) {
+        DumpPackFileStoreInfo();
+        return;
+    }
     auto cacheFileInfoSize = cacheFileInfo_.size();
     auto fileLimit = static_cast<int32_t>(fileLimit_);
     auto cacheFileSize = static_cast<int32_t>(cacheFileSize_);
@@ -411,4 +536,19 @@ void ImageFileCache::DumpCacheInfo()
     }
     DumpLog::GetInstance().Print("FileCache total size: " + std::to_string(totalCount) + "(B)");
 }
+
+void ImageFileCache::DumpPackFileStoreInfo()
+{
+    DumpLog::GetInstance().Print("------------ImageCacheInfo------------");
+    DumpLog::GetInstance().Print("User set ImageFileCacheSize : " + std::to_string(fileLimit_.load()) + "(B)");
+    DumpLog::GetInstance().Print("cacheFileSize: " + std::to_string(packFileStore_.GetLiveSize()) + "(B)" +
+                                 ", packFileSize: " + std::to_string(packFileStore_.GetPackSize()) + "(B)" +
+                                 ", count: " + std::to_string(packFileStore_.GetRecordCount()));
+    packFileStore_.ForEach([](uint64_t keyHash, size_t size, time_t accessTime, uint32_t accessCount) {
+        DumpLog::GetInstance().Print("fileCache Obj of key: " + std::to_string(keyHash) +
+                                     ", fileSize: " + std::to_string(size) + "(B)" +
+                                     ", accessTime: " + std::to_string(accessTime) +
+                                     ", accessCount: " + std::to_string(accessCount));
+    });
+}
 } // namespace OHOS::Ace
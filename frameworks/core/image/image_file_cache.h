@@ -15,6 +15,7 @@
 
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_FILE_CACHE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_FILE_CACHE_H
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <shared_mutex>
@@ -24,6 +25,7 @@
 
 #include "base/utils/singleton.h"
 #include "core/components_ng/image_provider/image_data.h"
+#include "core/image/image_pack_file_store.h"
 
 namespace OHOS::Ace {
 struct FileInfo {
@@ -64,12 +66,23 @@ public:
     void ClearCacheFile(const std::vector<std::string>& removeFiles);
     std::string ConstructCacheFilePath(const std::string& fileName);
     void DumpCacheInfo();
+
+    // Whether cached images live in one pack file instead of a file per image, see ImagePackFileStore.
+    bool UsePackFileStore() const
+    {
+        return usePackFileStore_;
+    }
+
 private:
+    RefPtr<NG::ImageData> GetDataFromPackFileStore(const std::string& url, const std::string& suffix);
+    void WritePackFileStore(const std::string& url, const void* data, size_t size, const std::string& suffix);
+    void DumpPackFileStoreInfo();
     void SaveCacheInner(const std::string& cacheKey, const std::string& suffix, size_t cacheSize,
         std::vector<std::string>& removeVector);
     std::string GetCacheFilePathInner(const std::string& url, const std::string& suffix);
     void ConvertToAstcAndWriteToFile(const std::string& fileCacheKey, const std::string& filePath,
         const std::string& url);
+    void ConvertToAstcAndWriteToPackFileStore(const std::string& url, const uint8_t* data, size_t size);
     bool WriteFile(const std::string& url, const void* const data, size_t size,
         const std::string& fileCacheKey, const std::string& suffix);
 
@@ -89,6 +102,9 @@ private:
     std::unordered_map<std::string, std::list<FileInfo>::iterator> fileNameToFileInfoPos_;
 
     bool hasSetCacheFileInfo_ = false;
+
+    ImagePackFileStore packFileStore_;
+    std::atomic<bool> usePackFileStore_ = false;
 };
 } // namespace OHOS::Ace
 #endif // FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_FILE_CACHE_H
\ No newline at end of file
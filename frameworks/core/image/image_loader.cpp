@@ -171,6 +171,20 @@ sk_sp<SkData> ImageLoader::LoadDataFromCachedFile(const std::string& uri)
 std::shared_ptr<RSData> ImageLoader::LoadDataFromCachedFile(const std::string& uri)
 #endif
 {
+    if (ImageFileCache::GetInstance().UsePackFileStore()) {
+        // the data views the mapped pack file instead of reading a copy of the cache file.
+        auto imageData = ImageFileCache::GetInstance().GetDataFromCacheFile(uri, "");
+        CHECK_NULL_RETURN(imageData, nullptr);
+#ifndef USE_ROSEN_DRAWING
+        const auto* skData = reinterpret_cast<const sk_sp<SkData>*>(imageData->GetDataWrapper());
+        CHECK_NULL_RETURN(skData, nullptr);
+        return *skData;
+#else
+        auto drawingImageData = AceType::DynamicCast<NG::DrawingImageData>(imageData);
+        CHECK_NULL_RETURN(drawingImageData, nullptr);
+        return drawingImageData->GetRSData();
+#endif
+    }
     std::string cacheFilePath = ImageFileCache::GetInstance().GetImageCacheFilePath(uri);
     if (cacheFilePath.length() > PATH_MAX) {
         TAG_LOGW(
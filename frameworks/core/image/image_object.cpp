@@ -244,10 +244,11 @@ void StaticImageObject::UploadToGpuForRender(const WeakPtr<PipelineBase>& contex
 
             if (imageCache) {
 #ifndef USE_ROSEN_DRAWING
-                imageCache->CacheImage(key, std::make_shared<CachedImage>(skImage));
+                auto cachedImage = std::make_shared<CachedImage>(skImage);
 #else
-                imageCache->CacheImage(key, std::make_shared<CachedImage>(rsImage));
+                auto cachedImage = std::make_shared<CachedImage>(rsImage);
 #endif
+                imageCache->CacheImage(key, cachedImage, cachedImage->GetMemorySize());
             }
             ImageProvider::ProccessUploadResult(taskExecutor, imageSource, imageSize, canvasImage);
         };
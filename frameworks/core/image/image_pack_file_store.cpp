@@ -0,0 +1,709 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "core/image/image_pack_file_store.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+#ifndef WINDOWS_PLATFORM
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "base/log/ace_trace.h"
+#include "base/log/log_wrapper.h"
+
+namespace OHOS::Ace {
+namespace {
+const std::string PACK_FILE_NAME = "image_file_cache.pack";
+const std::string INDEX_FILE_NAME = "image_file_cache.idx";
+const std::string TEMP_SUFFIX = ".tmp";
+constexpr uint32_t INDEX_MAGIC = 0x58444950; // "PIDX"
+constexpr uint32_t RECORD_MAGIC = 0x4B434150; // "PACK"
+constexpr uint32_t INDEX_VERSION = 1;
+constexpr uint32_t INITIAL_CAPACITY = 1024;
+constexpr uint32_t MAX_CAPACITY = 1 << 24;
+// the table grows when more than 3/4 of the slots are used or deleted.
+constexpr uint32_t LOAD_NUMERATOR = 3;
+constexpr uint32_t LOAD_DENOMINATOR = 4;
+constexpr uint64_t EMPTY_HASH = 0;
+constexpr uint64_t DELETED_HASH = 1;
+constexpr uint64_t FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ULL;
+// a multiple of every page size, so that chunks start on a page boundary.
+constexpr uint64_t PACK_CHUNK_SIZE = 4 << 20;
+constexpr mode_t CHOWN_RW_UG = 0660;
+
+struct RecordHeader {
+    uint32_t magic = RECORD_MAGIC;
+    uint16_t keyLength = 0;
+    uint16_t suffixLength = 0;
+    uint64_t dataSize = 0;
+};
+
+// stable across processes, unlike std::hash. 0 and 1 mark empty and deleted slots.
+uint64_t HashKey(const std::string& key)
+{
+    uint64_t hash = FNV_OFFSET_BASIS;
+    for (auto c : key) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= FNV_PRIME;
+    }
+    return hash <= DELETED_HASH ? hash + DELETED_HASH + 1 : hash;
+}
+
+#ifndef WINDOWS_PLATFORM
+bool WriteAll(int32_t fd, const void* data, size_t size, uint64_t offset)
+{
+    auto bytes = static_cast<const uint8_t*>(data);
+    while (size > 0) {
+        auto written = pwrite(fd, bytes, size, static_cast<off_t>(offset));
+        if (written <= 0) {
+            return false;
+        }
+        bytes += written;
+        size -= static_cast<size_t>(written);
+        offset += static_cast<uint64_t>(written);
+    }
+    return true;
+}
+#endif
+} // namespace
+
+struct ImagePackFileStore::IndexHeader {
+    uint32_t magic = INDEX_MAGIC;
+    uint32_t version = INDEX_VERSION;
+    uint32_t capacity = 0;
+    uint32_t count = 0;
+    uint32_t deleted = 0;
+    // incremented on every access, orders the records from the least to the most recently used.
+    uint32_t accessClock = 0;
+    // bytes of the pack file covered by the index, anything after it is a torn append.
+    uint64_t packSize = 0;
+    uint64_t liveSize = 0;
+};
+
+struct ImagePackFileStore::IndexSlot {
+    uint64_t keyHash = EMPTY_HASH;
+    uint64_t offset = 0;
+    uint64_t recordSize = 0;
+    int64_t accessTime = 0;
+    uint32_t accessCount = 0;
+    uint32_t accessTick = 0;
+};
+
+#ifndef WINDOWS_PLATFORM
+ImagePackMapping::~ImagePackMapping()
+{
+    if (address_ != nullptr) {
+        munmap(address_, size_);
+    }
+}
+
+ImagePackFileStore::~ImagePackFileStore()
+{
+    Close();
+}
+
+bool ImagePackFileStore::Open(const std::string& dirPath)
+{
+    ACE_FUNCTION_TRACE();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ != nullptr) {
+        return true;
+    }
+    if (dirPath.empty()) {
+        return false;
+    }
+    if (!OpenFiles(dirPath)) {
+        if (packFd_ >= 0) {
+            close(packFd_);
+            packFd_ = -1;
+        }
+        if (indexFd_ >= 0) {
+            close(indexFd_);
+            indexFd_ = -1;
+        }
+        UnmapIndex();
+        return false;
+    }
+    return true;
+}
+
+bool ImagePackFileStore::OpenFiles(const std::string& dirPath)
+{
+    packPath_ = dirPath + "/" + PACK_FILE_NAME;
+    indexPath_ = dirPath + "/" + INDEX_FILE_NAME;
+    packFd_ = open(packPath_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, CHOWN_RW_UG);
+    indexFd_ = open(indexPath_.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, CHOWN_RW_UG);
+    if (packFd_ < 0 || indexFd_ < 0) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "open image pack file failed: %{public}s", strerror(errno));
+        return false;
+    }
+    struct stat indexStatus;
+    struct stat packStatus;
+    if (fstat(indexFd_, &indexStatus) != 0 || fstat(packFd_, &packStatus) != 0) {
+        return false;
+    }
+    IndexHeader header;
+    bool valid = static_cast<size_t>(indexStatus.st_size) >= sizeof(IndexHeader) &&
+                 pread(indexFd_, &header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+                 header.magic == INDEX_MAGIC && header.version == INDEX_VERSION && header.capacity >= INITIAL_CAPACITY &&
+                 header.capacity <= MAX_CAPACITY && (header.capacity & (header.capacity - 1)) == 0 &&
+                 static_cast<size_t>(indexStatus.st_size) ==
+                     sizeof(IndexHeader) + sizeof(IndexSlot) * static_cast<size_t>(header.capacity) &&
+                 static_cast<uint64_t>(packStatus.st_size) >= header.packSize;
+    if (!valid) {
+        return ResetFiles();
+    }
+    // drop a record whose append was interrupted before the index was updated.
+    if (static_cast<uint64_t>(packStatus.st_size) > header.packSize &&
+        ftruncate(packFd_, static_cast<off_t>(header.packSize)) != 0) {
+        return false;
+    }
+    return MapIndex(header.capacity);
+}
+
+bool ImagePackFileStore::ResetFiles()
+{
+    UnmapIndex();
+    packChunks_.clear();
+    IndexHeader header;
+    header.capacity = INITIAL_CAPACITY;
+    auto indexSize = sizeof(IndexHeader) + sizeof(IndexSlot) * static_cast<size_t>(INITIAL_CAPACITY);
+    // records handed out may still map the pack file, truncating it would make reading them raise SIGBUS. Empty files
+    // replace both files instead, like Compact does, and the new slots read as zero.
+    if (!ReplaceFile(packPath_, packFd_) || !ReplaceFile(indexPath_, indexFd_) ||
+        ftruncate(indexFd_, static_cast<off_t>(indexSize)) != 0 || !WriteAll(indexFd_, &header, sizeof(header), 0)) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "reset image pack file failed: %{public}s", strerror(errno));
+        return false;
+    }
+    return MapIndex(INITIAL_CAPACITY);
+}
+
+bool ImagePackFileStore::ReplaceFile(const std::string& path, int32_t& fd)
+{
+    auto tempPath = path + TEMP_SUFFIX;
+    auto tempFd = open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, CHOWN_RW_UG);
+    if (tempFd < 0) {
+        return false;
+    }
+    if (rename(tempPath.c_str(), path.c_str()) != 0) {
+        close(tempFd);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    close(fd);
+    fd = tempFd;
+    return true;
+}
+
+bool ImagePackFileStore::MapIndex(uint32_t capacity)
+{
+    auto size = sizeof(IndexHeader) + sizeof(IndexSlot) * static_cast<size_t>(capacity);
+    auto address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, indexFd_, 0);
+    if (address == MAP_FAILED) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "map image pack index failed: %{public}s", strerror(errno));
+        return false;
+    }
+    indexMapSize_ = size;
+    header_ = static_cast<IndexHeader*>(address);
+    slots_ = reinterpret_cast<IndexSlot*>(static_cast<uint8_t*>(address) + sizeof(IndexHeader));
+    return true;
+}
+
+void ImagePackFileStore::UnmapIndex()
+{
+    if (header_ != nullptr) {
+        munmap(header_, indexMapSize_);
+    }
+    header_ = nullptr;
+    slots_ = nullptr;
+    indexMapSize_ = 0;
+}
+
+void ImagePackFileStore::Close()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    UnmapIndex();
+    packChunks_.clear();
+    if (packFd_ >= 0) {
+        close(packFd_);
+        packFd_ = -1;
+    }
+    if (indexFd_ >= 0) {
+        close(indexFd_);
+        indexFd_ = -1;
+    }
+}
+
+bool ImagePackFileStore::IsOpen() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return header_ != nullptr;
+}
+
+ImagePackFileStore::IndexSlot* ImagePackFileStore::FindSlot(const std::string& key) const
+{
+    auto keyHash = HashKey(key);
+    auto mask = header_->capacity - 1;
+    for (uint32_t i = 0, pos = static_cast<uint32_t>(keyHash) & mask; i < header_->capacity;
+         ++i, pos = (pos + 1) & mask) {
+        auto& slot = slots_[pos];
+        if (slot.keyHash == keyHash && IsRecordOfKey(slot, key)) {
+            return &slot;
+        }
+        if (slot.keyHash == EMPTY_HASH) {
+            return nullptr;
+        }
+    }
+    return nullptr;
+}
+
+bool ImagePackFileStore::IsRecordOfKey(const IndexSlot& slot, const std::string& key) const
+{
+    if (slot.recordSize < sizeof(RecordHeader) + key.size()) {
+        return false;
+    }
+    std::string buffer(sizeof(RecordHeader) + key.size(), '\0');
+    if (pread(packFd_, buffer.data(), buffer.size(), static_cast<off_t>(slot.offset)) !=
+        static_cast<ssize_t>(buffer.size())) {
+        return false;
+    }
+    RecordHeader header;
+    memcpy(&header, buffer.data(), sizeof(header));
+    return header.magic == RECORD_MAGIC && header.keyLength == key.size() &&
+           memcmp(buffer.data() + sizeof(RecordHeader), key.data(), key.size()) == 0;
+}
+
+ImagePackFileStore::IndexSlot* ImagePackFileStore::InsertSlot(uint64_t keyHash)
+{
+    if ((header_->count + header_->deleted + 1) * LOAD_DENOMINATOR > header_->capacity * LOAD_NUMERATOR &&
+        !GrowIndex()) {
+        return nullptr;
+    }
+    auto mask = header_->capacity - 1;
+    for (uint32_t pos = static_cast<uint32_t>(keyHash) & mask;; pos = (pos + 1) & mask) {
+        auto& slot = slots_[pos];
+        if (slot.keyHash == EMPTY_HASH || slot.keyHash == DELETED_HASH) {
+            if (slot.keyHash == DELETED_HASH) {
+                --header_->deleted;
+            }
+            slot = IndexSlot();
+            slot.keyHash = keyHash;
+            ++header_->count;
+            return &slot;
+        }
+    }
+}
+
+void ImagePackFileStore::RemoveSlot(IndexSlot* slot)
+{
+    header_->liveSize -= slot->recordSize;
+    --header_->count;
+    ++header_->deleted;
+    *slot = IndexSlot();
+    slot->keyHash = DELETED_HASH;
+}
+
+bool ImagePackFileStore::GrowIndex()
+{
+    // rehashing also drops the deleted slots, only grow when the live slots need it.
+    auto capacity = header_->capacity;
+    if ((header_->count + 1) * LOAD_DENOMINATOR * 2 > capacity * LOAD_NUMERATOR) {
+        capacity *= 2;
+    }
+    if (capacity > MAX_CAPACITY) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "image pack index is full.");
+        return false;
+    }
+    // the new table is built in a temporary file which then replaces the index, a failure keeps the old index.
+    auto tempPath = indexPath_ + TEMP_SUFFIX;
+    auto tempFd = open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, CHOWN_RW_UG);
+    if (tempFd < 0) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "grow image pack index failed: %{public}s", strerror(errno));
+        return false;
+    }
+    auto indexSize = sizeof(IndexHeader) + sizeof(IndexSlot) * static_cast<size_t>(capacity);
+    auto address = ftruncate(tempFd, static_cast<off_t>(indexSize)) == 0
+                       ? mmap(nullptr, indexSize, PROT_READ | PROT_WRITE, MAP_SHARED, tempFd, 0)
+                       : MAP_FAILED;
+    if (address == MAP_FAILED) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "grow image pack index failed: %{public}s", strerror(errno));
+        close(tempFd);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    auto header = static_cast<IndexHeader*>(address);
+    auto slots = reinterpret_cast<IndexSlot*>(static_cast<uint8_t*>(address) + sizeof(IndexHeader));
+    *header = *header_;
+    header->capacity = capacity;
+    header->count = 0;
+    header->deleted = 0;
+    // the new file reads as zero, which is an empty slot.
+    auto mask = capacity - 1;
+    for (uint32_t i = 0; i < header_->capacity; ++i) {
+        if (slots_[i].keyHash <= DELETED_HASH) {
+            continue;
+        }
+        auto pos = static_cast<uint32_t>(slots_[i].keyHash) & mask;
+        while (slots[pos].keyHash != EMPTY_HASH) {
+            pos = (pos + 1) & mask;
+        }
+        slots[pos] = slots_[i];
+        ++header->count;
+    }
+    if (msync(address, indexSize, MS_SYNC) != 0 || rename(tempPath.c_str(), indexPath_.c_str()) != 0) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "grow image pack index failed: %{public}s", strerror(errno));
+        munmap(address, indexSize);
+        close(tempFd);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    UnmapIndex();
+    close(indexFd_);
+    indexFd_ = tempFd;
+    indexMapSize_ = indexSize;
+    header_ = header;
+    slots_ = slots;
+    return true;
+}
+
+std::shared_ptr<const ImagePackMapping> ImagePackFileStore::MapPackRange(uint64_t offset, size_t size)
+{
+    auto address = mmap(nullptr, size, PROT_READ, MAP_SHARED, packFd_, static_cast<off_t>(offset));
+    if (address == MAP_FAILED) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "map image pack file failed: %{public}s", strerror(errno));
+        return nullptr;
+    }
+    return std::make_shared<ImagePackMapping>(address, size);
+}
+
+const uint8_t* ImagePackFileStore::MapRecord(const IndexSlot& slot, std::shared_ptr<const ImagePackMapping>& mapping)
+{
+    auto end = slot.offset + slot.recordSize;
+    if (slot.recordSize < sizeof(RecordHeader) || end > header_->packSize) {
+        return nullptr;
+    }
+    auto chunk = static_cast<size_t>(slot.offset / PACK_CHUNK_SIZE);
+    if ((end - 1) / PACK_CHUNK_SIZE == chunk) {
+        if (chunk >= packChunks_.size()) {
+            packChunks_.resize(chunk + 1);
+        }
+        // a chunk may reach past the end of the file, records appended later show up in the shared mapping.
+        if (!packChunks_[chunk]) {
+            packChunks_[chunk] = MapPackRange(chunk * PACK_CHUNK_SIZE, static_cast<size_t>(PACK_CHUNK_SIZE));
+        }
+        mapping = packChunks_[chunk];
+        return mapping ? mapping->GetData() + (slot.offset - chunk * PACK_CHUNK_SIZE) : nullptr;
+    }
+    // a record across chunks gets a mapping of its own.
+    auto pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    auto start = slot.offset / pageSize * pageSize;
+    mapping = MapPackRange(start, static_cast<size_t>(end - start));
+    return mapping ? mapping->GetData() + (slot.offset - start) : nullptr;
+}
+
+bool ImagePackFileStore::Get(const std::string& key, const std::string& suffix, ImagePackRecord& record)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ == nullptr) {
+        return false;
+    }
+    auto slot = FindSlot(key);
+    if (slot == nullptr) {
+        return false;
+    }
+    std::shared_ptr<const ImagePackMapping> mapping;
+    auto address = MapRecord(*slot, mapping);
+    if (address == nullptr) {
+        return false;
+    }
+    RecordHeader header;
+    memcpy(&header, address, sizeof(header));
+    if (header.magic != RECORD_MAGIC ||
+        sizeof(RecordHeader) + header.keyLength + header.suffixLength + header.dataSize != slot->recordSize) {
+        return false;
+    }
+    auto suffixAddress = reinterpret_cast<const char*>(address + sizeof(RecordHeader) + header.keyLength);
+    std::string recordSuffix(suffixAddress, header.suffixLength);
+    if (!suffix.empty() && suffix != recordSuffix) {
+        return false;
+    }
+    slot->accessTime = static_cast<int64_t>(time(nullptr));
+    slot->accessTick = ++header_->accessClock;
+    ++slot->accessCount;
+    record.mapping = std::move(mapping);
+    record.data = address + sizeof(RecordHeader) + header.keyLength + header.suffixLength;
+    record.size = static_cast<size_t>(header.dataSize);
+    record.suffix = std::move(recordSuffix);
+    record.accessCount = slot->accessCount;
+    return true;
+}
+
+bool ImagePackFileStore::Contains(const std::string& key, const std::string& suffix) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ == nullptr) {
+        return false;
+    }
+    auto slot = FindSlot(key);
+    if (slot == nullptr) {
+        return false;
+    }
+    if (suffix.empty()) {
+        return true;
+    }
+    RecordHeader header;
+    if (pread(packFd_, &header, sizeof(header), static_cast<off_t>(slot->offset)) !=
+            static_cast<ssize_t>(sizeof(header)) || header.suffixLength != suffix.size()) {
+        return false;
+    }
+    std::string recordSuffix(header.suffixLength, '\0');
+    auto suffixOffset = slot->offset + sizeof(RecordHeader) + header.keyLength;
+    return pread(packFd_, recordSuffix.data(), recordSuffix.size(), static_cast<off_t>(suffixOffset)) ==
+               static_cast<ssize_t>(recordSuffix.size()) && recordSuffix == suffix;
+}
+
+bool ImagePackFileStore::Put(const std::string& key, const std::string& suffix, const void* data, size_t size)
+{
+    ACE_FUNCTION_TRACE();
+    if (key.size() > UINT16_MAX || suffix.size() > UINT16_MAX || (data == nullptr && size > 0)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ == nullptr) {
+        return false;
+    }
+    RecordHeader recordHeader;
+    recordHeader.keyLength = static_cast<uint16_t>(key.size());
+    recordHeader.suffixLength = static_cast<uint16_t>(suffix.size());
+    recordHeader.dataSize = size;
+    std::vector<uint8_t> prefix(sizeof(RecordHeader) + key.size() + suffix.size());
+    memcpy(prefix.data(), &recordHeader, sizeof(recordHeader));
+    memcpy(prefix.data() + sizeof(RecordHeader), key.data(), key.size());
+    memcpy(prefix.data() + sizeof(RecordHeader) + key.size(), suffix.data(), suffix.size());
+    // the record is written and synced before the index points to it, so after a crash the index never points to
+    // a torn record. A record which is not published stays a torn tail, which the next append overwrites.
+    auto offset = header_->packSize;
+    if (!WriteAll(packFd_, prefix.data(), prefix.size(), offset) ||
+        !WriteAll(packFd_, data, size, offset + prefix.size()) || fdatasync(packFd_) != 0) {
+        TAG_LOGW(AceLogTag::ACE_IMAGE, "append image pack file failed: %{public}s", strerror(errno));
+        return false;
+    }
+    auto slot = FindSlot(key);
+    if (slot == nullptr) {
+        slot = InsertSlot(HashKey(key));
+        if (slot == nullptr) {
+            return false;
+        }
+    }
+    header_->liveSize -= slot->recordSize;
+    auto recordSize = static_cast<uint64_t>(prefix.size() + size);
+    slot->offset = offset;
+    slot->recordSize = recordSize;
+    slot->accessTime = static_cast<int64_t>(time(nullptr));
+    slot->accessTick = ++header_->accessClock;
+    slot->accessCount = 1;
+    header_->packSize = offset + recordSize;
+    header_->liveSize += recordSize;
+    return true;
+}
+
+bool ImagePackFileStore::Erase(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ == nullptr) {
+        return false;
+    }
+    auto slot = FindSlot(key);
+    if (slot == nullptr) {
+        return false;
+    }
+    RemoveSlot(slot);
+    return true;
+}
+
+void ImagePackFileStore::Trim(size_t targetSize)
+{
+    ACE_FUNCTION_TRACE();
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ == nullptr) {
+        return;
+    }
+    if (header_->liveSize > targetSize) {
+        std::vector<IndexSlot*> liveSlots;
+        liveSlots.reserve(header_->count);
+        for (uint32_t i = 0; i < header_->capacity; ++i) {
+            if (slots_[i].keyHash > DELETED_HASH) {
+                liveSlots.emplace_back(&slots_[i]);
+            }
+        }
+        std::sort(liveSlots.begin(), liveSlots.end(),
+            [](const IndexSlot* left, const IndexSlot* right) { return left->accessTick < right->accessTick; });
+        for (auto slot : liveSlots) {
+            if (header_->liveSize <= targetSize) {
+                break;
+            }
+            RemoveSlot(slot);
+        }
+    }
+    if (header_->packSize - header_->liveSize > header_->liveSize) {
+        Compact();
+    }
+}
+
+bool ImagePackFileStore::Compact()
+{
+    ACE_FUNCTION_TRACE();
+    std::vector<IndexSlot*> liveSlots;
+    liveSlots.reserve(header_->count);
+    for (uint32_t i = 0; i < header_->capacity; ++i) {
+        if (slots_[i].keyHash > DELETED_HASH) {
+            liveSlots.emplace_back(&slots_[i]);
+        }
+    }
+    std::sort(liveSlots.begin(), liveSlots.end(),
+        [](const IndexSlot* left, const IndexSlot* right) { return left->offset < right->offset; });
+
+    auto tempPath = packPath_ + TEMP_SUFFIX;
+    auto tempFd = open(tempPath.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, CHOWN_RW_UG);
+    if (tempFd < 0) {
+        return false;
+    }
+    std::vector<uint64_t> newOffsets;
+    newOffsets.reserve(liveSlots.size());
+    uint64_t packSize = 0;
+    for (auto slot : liveSlots) {
+        std::shared_ptr<const ImagePackMapping> mapping;
+        auto address = MapRecord(*slot, mapping);
+        if (address == nullptr || !WriteAll(tempFd, address, slot->recordSize, packSize)) {
+            close(tempFd);
+            unlink(tempPath.c_str());
+            return false;
+        }
+        newOffsets.emplace_back(packSize);
+        packSize += slot->recordSize;
+    }
+    if (fsync(tempFd) != 0 || rename(tempPath.c_str(), packPath_.c_str()) != 0) {
+        close(tempFd);
+        unlink(tempPath.c_str());
+        return false;
+    }
+    close(packFd_);
+    packFd_ = tempFd;
+    for (size_t i = 0; i < liveSlots.size(); ++i) {
+        liveSlots[i]->offset = newOffsets[i];
+    }
+    header_->packSize = packSize;
+    header_->liveSize = packSize;
+    // images still holding the old chunks keep reading the unlinked file.
+    packChunks_.clear();
+    return true;
+}
+
+size_t ImagePackFileStore::GetRecordCount() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return header_ == nullptr ? 0 : header_->count;
+}
+
+size_t ImagePackFileStore::GetLiveSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return header_ == nullptr ? 0 : static_cast<size_t>(header_->liveSize);
+}
+
+size_t ImagePackFileStore::GetPackSize() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return header_ == nullptr ? 0 : static_cast<size_t>(header_->packSize);
+}
+
+void ImagePackFileStore::ForEach(const std::function<void(uint64_t, size_t, time_t, uint32_t)>& func) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (header_ == nullptr) {
+        return;
+    }
+    for (uint32_t i = 0; i < header_->capacity; ++i) {
+        const auto& slot = slots_[i];
+        if (slot.keyHash > DELETED_HASH) {
+            func(slot.keyHash, static_cast<size_t>(slot.recordSize), static_cast<time_t>(slot.accessTime),
+                slot.accessCount);
+        }
+    }
+}
+#else
+// the preview on windows keeps the one file per image cache.
+ImagePackMapping::~ImagePackMapping() = default;
+ImagePackFileStore::~ImagePackFileStore() = default;
+
+bool ImagePackFileStore::Open(const std::string& dirPath)
+{
+    return false;
+}
+
+void ImagePackFileStore::Close() {}
+
+bool ImagePackFileStore::IsOpen() const
+{
+    return false;
+}
+
+bool ImagePackFileStore::Get(const std::string& key, const std::string& suffix, ImagePackRecord& record)
+{
+    return false;
+}
+
+bool ImagePackFileStore::Contains(const std::string& key, const std::string& suffix) const
+{
+    return false;
+}
+
+bool ImagePackFileStore::Put(const std::string& key, const std::string& suffix, const void* data, size_t size)
+{
+    return false;
+}
+
+bool ImagePackFileStore::Erase(const std::string& key)
+{
+    return false;
+}
+
+void ImagePackFileStore::Trim(size_t targetSize) {}
+
+size_t ImagePackFileStore::GetRecordCount() const
+{
+    return 0;
+}
+
+size_t ImagePackFileStore::GetLiveSize() const
+{
+    return 0;
+}
+
+size_t ImagePackFileStore::GetPackSize() const
+{
+    return 0;
+}
+
+void ImagePackFileStore::ForEach(const std::function<void(uint64_t, size_t, time_t, uint32_t)>& func) const {}
+#endif
+} // namespace OHOS::Ace
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_PACK_FILE_STORE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_PACK_FILE_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "base/utils/noncopyable.h"
+
+namespace OHOS::Ace {
+
+// Read only mapping of a chunk of the pack file. Data handed out by the store keeps it alive, so the store can
+// compact the pack file while images still use the old mapping.
+class ImagePackMapping final {
+public:
+    ImagePackMapping(void* address, size_t size) : address_(address), size_(size) {}
+    ~ImagePackMapping();
+
+    const uint8_t* GetData() const
+    {
+        return static_cast<const uint8_t*>(address_);
+    }
+
+    size_t GetSize() const
+    {
+        return size_;
+    }
+
+private:
+    void* address_ = nullptr;
+    size_t size_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ImagePackMapping);
+};
+
+struct ImagePackRecord {
+    std::shared_ptr<const ImagePackMapping> mapping;
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    std::string suffix;
+    uint32_t accessCount = 0;
+};
+
+// File cache of encoded images in two files of the cache directory: an append only pack file holding the records
+// and an index file, mapped into memory, holding an open addressing table from key hash to record offset, size
+// and access time. Opening the store maps the index instead of scanning the directory, and a lookup returns a view
+// into the mapped pack file instead of reading a file per image. The pack file is mapped in fixed size chunks, so
+// appending a record does not remap what is already mapped. Dropped records stay in the pack file until Trim
+// compacts it.
+class ImagePackFileStore final {
+public:
+    ImagePackFileStore() = default;
+    ~ImagePackFileStore();
+
+    // Opens or creates the store in dirPath. A store whose files do not match is recreated empty.
+    bool Open(const std::string& dirPath);
+    void Close();
+    bool IsOpen() const;
+
+    // An empty suffix matches a record of any suffix.
+    bool Get(const std::string& key, const std::string& suffix, ImagePackRecord& record);
+    bool Contains(const std::string& key, const std::string& suffix) const;
+    // Replaces the record of key.
+    bool Put(const std::string& key, const std::string& suffix, const void* data, size_t size);
+    bool Erase(const std::string& key);
+    // Drops the least recently used records until the live records take at most targetSize bytes, then compacts
+    // the pack file if most of it is dead.
+    void Trim(size_t targetSize);
+
+    size_t GetRecordCount() const;
+    // bytes of the records that are still referenced by the index.
+    size_t GetLiveSize() const;
+    size_t GetPackSize() const;
+    // Visits the records in index order with their size, access time and access count.
+    void ForEach(const std::function<void(uint64_t, size_t, time_t, uint32_t)>& func) const;
+
+private:
+    struct IndexHeader;
+    struct IndexSlot;
+
+    bool OpenFiles(const std::string& dirPath);
+    bool ResetFiles();
+    // Replaces the file at path with an empty one, mappings of the old file stay readable.
+    bool ReplaceFile(const std::string& path, int32_t& fd);
+    bool MapIndex(uint32_t capacity);
+    void UnmapIndex();
+    bool GrowIndex();
+    // Finds the slot of key, the hash may collide so the key of the record is compared as well.
+    IndexSlot* FindSlot(const std::string& key) const;
+    bool IsRecordOfKey(const IndexSlot& slot, const std::string& key) const;
+    IndexSlot* InsertSlot(uint64_t keyHash);
+    void RemoveSlot(IndexSlot* slot);
+    std::shared_ptr<const ImagePackMapping> MapPackRange(uint64_t offset, size_t size);
+    // Returns the address of the record of slot, mapping keeps it readable.
+    const uint8_t* MapRecord(const IndexSlot& slot, std::shared_ptr<const ImagePackMapping>& mapping);
+    bool Compact();
+
+    mutable std::mutex mutex_;
+    std::string packPath_;
+    std::string indexPath_;
+    int32_t packFd_ = -1;
+    int32_t indexFd_ = -1;
+    IndexHeader* header_ = nullptr;
+    IndexSlot* slots_ = nullptr;
+    size_t indexMapSize_ = 0;
+    // mappings of the pack file by chunk, a chunk is mapped the first time one of its records is read.
+    std::vector<std::shared_ptr<const ImagePackMapping>> packChunks_;
+
+    ACE_DISALLOW_COPY_AND_MOVE(ImagePackFileStore);
+};
+
+} // namespace OHOS::Ace
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_IMAGE_PACK_FILE_STORE_H
@@ -16,10 +16,12 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_SK_IMAGE_CACHE_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_IMAGE_SK_IMAGE_CACHE_H
 
+#include <cstddef>
 #include <utility>
 
 #include "include/core/SkImage.h"
 
+#include "base/utils/utils.h"
 #include "core/image/image_cache.h"
 
 namespace OHOS::Ace {
@@ -33,6 +35,19 @@ struct CachedImage {
     std::shared_ptr<RSImage> imagePtr;
 #endif
     uint32_t uniqueId = 0;
+
+    // memory taken by the decoded pixels, used as the cost of the image in ImageCache.
+    size_t GetMemorySize() const
+    {
+        CHECK_NULL_RETURN(imagePtr, 0);
+#ifndef USE_ROSEN_DRAWING
+        return imagePtr->imageInfo().computeMinByteSize();
+#else
+        constexpr size_t BYTES_PER_PIXEL = 4;
+        return static_cast<size_t>(imagePtr->GetWidth()) * static_cast<size_t>(imagePtr->GetHeight()) *
+               BYTES_PER_PIXEL;
+#endif
+    }
 };
 
 } // namespace OHOS::Ace
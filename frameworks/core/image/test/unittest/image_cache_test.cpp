@@ -45,22 +45,25 @@ HWTEST_F(ImageCacheTest, MemoryCache001, TestSize.Level1)
 {
     /**
      * @tc.steps: step1. cache images one by one.
-     * @tc.expected: new item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.expected: every image is cached once.
      */
+    imageCache->SetCapacity(CACHE_FILES.size());
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
-        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(nullptr));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
-        ASSERT_EQ(frontKey, FILE_KEYS[i]);
-        ASSERT_EQ(frontKey, imageCache->imageCache_[FILE_KEYS[i]]->cacheKey);
+        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(nullptr), 0);
+        ASSERT_NE(imageCache->imageCache_.Peek(FILE_KEYS[i]), nullptr);
     }
+    ASSERT_EQ(imageCache->GetCachedImageCount(), CACHE_FILES.size());
 
     /**
-     * @tc.steps: step2. cache a image already in cache for example FILE_KEYS[3] e.t. "key4".
-     * @tc.expected: the cached item should at begin of cacheList_ and imagCache has right iters.
+     * @tc.steps: step2. cache a image already in cache for example FILE_KEYS[0] e.t. "key1", then a new image.
+     * @tc.expected: the cached image becomes the most recently used, so "key2" is evicted instead.
      */
-    imageCache->CacheImage(FILE_KEYS[3], std::make_shared<CachedImage>(nullptr));
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[3]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[3]]->cacheKey, FILE_KEYS[3]);
+    imageCache->CacheImage(FILE_KEYS[0], std::make_shared<CachedImage>(nullptr), 0);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), CACHE_FILES.size());
+    imageCache->CacheImage(KEY_6, std::make_shared<CachedImage>(nullptr), 0);
+    ASSERT_EQ(imageCache->GetCachedImageCount(), CACHE_FILES.size());
+    ASSERT_NE(imageCache->imageCache_.Peek(FILE_KEYS[0]), nullptr);
+    ASSERT_EQ(imageCache->imageCache_.Peek(FILE_KEYS[1]), nullptr);
 }
 
 /**
@@ -73,20 +76,19 @@ HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
     /**
      * @tc.steps: step1. cache images one by one.
      */
+    imageCache->SetCapacity(CACHE_FILES.size());
     for (size_t i = 0; i < CACHE_FILES.size(); i++) {
-        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(nullptr));
-        std::string frontKey = (imageCache->cacheList_).front().cacheKey;
+        imageCache->CacheImage(FILE_KEYS[i], std::make_shared<CachedImage>(nullptr), 0);
     }
+
     /**
-     * @tc.steps: step2. find a image already in cache for example FILE_KEYS[2] e.t. "key3".
-     * @tc.expected: the cached iterator should not at end() of cacheList_ and imagCache.
-     *              after GetImageCache(), the item should at begin() of cacheList_.
+     * @tc.steps: step2. find a image already in cache for example FILE_KEYS[2] e.t. "key3", then cache a new image.
+     * @tc.expected: the image is found and becomes the most recently used, so "key1" is evicted instead.
      */
-    auto iter = (imageCache->imageCache_).find(FILE_KEYS[2]);
-    ASSERT_NE(iter, imageCache->imageCache_.end());
-    imageCache->GetCacheImage(FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->cacheList_.front().cacheKey, FILE_KEYS[2]);
-    ASSERT_EQ(imageCache->imageCache_[FILE_KEYS[2]]->cacheKey, FILE_KEYS[2]);
+    ASSERT_NE(imageCache->GetCacheImage(FILE_KEYS[2]), nullptr);
+    imageCache->CacheImage(KEY_6, std::make_shared<CachedImage>(nullptr), 0);
+    ASSERT_NE(imageCache->GetCacheImage(FILE_KEYS[2]), nullptr);
+    ASSERT_EQ(imageCache->GetCacheImage(FILE_KEYS[0]), nullptr);
 
     /**
      * @tc.steps: step3. find a image not in cache for example "key8".
@@ -98,7 +100,7 @@ HWTEST_F(ImageCacheTest, MemoryCache002, TestSize.Level1)
 
 /**
  * @tc.name: MemoryCache003
- * @tc.desc: Set memory cache capacity success.
+ * @tc.desc: Set memory cache capacity and size limits success.
  * @tc.type: FUNC
  */
 HWTEST_F(ImageCacheTest, MemoryCache003, TestSize.Level1)
@@ -109,6 +111,19 @@ HWTEST_F(ImageCacheTest, MemoryCache003, TestSize.Level1)
      */
     imageCache->SetCapacity(1000);
     ASSERT_EQ(static_cast<int32_t>(imageCache->capacity_), 1000);
+
+    /**
+     * @tc.steps: step2. set the size limits, then cache an image over them and an image within them.
+     * @tc.expected: the limits are set and only the image within them is cached.
+     */
+    imageCache->SetDecodedImageSizeLimit(FILE_SIZE);
+    imageCache->SetImgObjSizeLimit(FILE_SIZE);
+    ASSERT_EQ(imageCache->imageCache_.GetSizeLimit(), static_cast<size_t>(FILE_SIZE));
+    ASSERT_EQ(imageCache->imgObjCacheNG_.GetSizeLimit(), static_cast<size_t>(FILE_SIZE));
+    imageCache->CacheImage(KEY_1, std::make_shared<CachedImage>(nullptr), FILE_SIZE + 1);
+    ASSERT_EQ(imageCache->GetCacheImage(KEY_1), nullptr);
+    imageCache->CacheImage(KEY_2, std::make_shared<CachedImage>(nullptr), FILE_SIZE);
+    ASSERT_NE(imageCache->GetCacheImage(KEY_2), nullptr);
 }
 
 /**
@@ -122,28 +137,28 @@ HWTEST_F(ImageCacheTest, MemoryCache004, TestSize.Level1)
      * @tc.steps: step1. set data limit to 10 bytes, cache some data.check result
      * @tc.expected: result is right.
      */
-    imageCache->dataSizeLimit_ = 10;
+    imageCache->SetDataCacheLimit(10);
 
     // create 3 bytes data, cache it, current size is 3
     const uint8_t data1[] = {'a', 'b', 'c' };
     sk_sp<SkData> skData1 = SkData::MakeWithCopy(data1, 3);
     auto cachedData1 = AceType::MakeRefPtr<NG::SkiaImageData>(skData1);
     imageCache->CacheImageData(KEY_1, cachedData1);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 3u);
 
     // create 2 bytes data, cache it, current size is 5. {abc} {de}
     const uint8_t data2[] = {'d', 'e' };
     sk_sp<SkData> skData2 = SkData::MakeWithCopy(data2, 2);
     auto cachedData2 = AceType::MakeRefPtr<NG::SkiaImageData>(skData2);
     imageCache->CacheImageData(KEY_2, cachedData2);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 5u);
 
     // create 7 bytes data, cache it, current size is 5. new data not cached.
     const uint8_t data3[] = { 'f', 'g', 'h', 'i', 'j', 'k', 'l' };
     sk_sp<SkData> skData3 = SkData::MakeWithCopy(data3, 7);
     auto cachedData3 = AceType::MakeRefPtr<NG::SkiaImageData>(skData3);
     imageCache->CacheImageData(KEY_3, cachedData3);
-    ASSERT_EQ(imageCache->curDataSize_, 5u);
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 5u);
     auto data = imageCache->GetCacheImageData(KEY_3);
     ASSERT_EQ(data, nullptr);
 
@@ -152,49 +167,47 @@ HWTEST_F(ImageCacheTest, MemoryCache004, TestSize.Level1)
     sk_sp<SkData> skData4 = SkData::MakeWithCopy(data4, 5);
     auto cachedData4 = AceType::MakeRefPtr<NG::SkiaImageData>(skData4);
     imageCache->CacheImageData(KEY_4, cachedData4);
-    ASSERT_EQ(imageCache->curDataSize_, 10u);
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 10u);
 
     // create 2 bytes data, cache it, current size is 9 {de}{mnopq}{rs}
     const uint8_t data5[] = { 'r', 's' };
     sk_sp<SkData> skData5 = SkData::MakeWithCopy(data5, 2);
     auto cachedData5 = AceType::MakeRefPtr<NG::SkiaImageData>(skData5);
     imageCache->CacheImageData(KEY_5, cachedData5);
-    ASSERT_EQ(imageCache->curDataSize_, 9u);
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 9u);
 
     // create 5 bytes, cache it, current size is 7 {rs}{tuvwx}
     const uint8_t data6[] = { 't', 'u', 'v', 'w', 'x' };
     sk_sp<SkData> skData6 = SkData::MakeWithCopy(data6, 5);
     auto cachedData6 = AceType::MakeRefPtr<NG::SkiaImageData>(skData6);
     imageCache->CacheImageData(KEY_6, cachedData6);
-    ASSERT_EQ(imageCache->curDataSize_, 7u);
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 7u);
 
     // cache data witch is already cached. {rs}{y}
     const uint8_t data7[] = { 'y' };
     sk_sp<SkData> skData7 = SkData::MakeWithCopy(data7, 1);
     auto cachedData7 = AceType::MakeRefPtr<NG::SkiaImageData>(skData7);
     imageCache->CacheImageData(KEY_6, cachedData7);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 3u);
 
     // cache data witch is already cached. {y}{fg}
     const uint8_t data8[] = { 'f', 'g' };
     sk_sp<SkData> skData8 = SkData::MakeWithCopy(data8, 2);
     auto cachedData8 = AceType::MakeRefPtr<NG::SkiaImageData>(skData8);
     imageCache->CacheImageData(KEY_5, cachedData8);
-    ASSERT_EQ(imageCache->curDataSize_, 3u);
-    auto dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
+    ASSERT_EQ(imageCache->dataCache_.Bytes(), 3u);
+    auto dataKey5 = imageCache->GetCacheImageData(KEY_5);
+    ASSERT_NE(dataKey5, nullptr);
+    auto dataRaw5 = static_cast<const uint8_t*>(dataKey5->GetData());
     for (int i = 0; i < 2; ++i) {
-        ASSERT_EQ(dataFront[i], data8[i]);
+        ASSERT_EQ(dataRaw5[i], data8[i]);
     }
-    auto dataKey5 = imageCache->GetCacheImageData(KEY_5);
-    auto dataRaw5 = dataKey5->GetData();
-    ASSERT_EQ(dataFront, dataRaw5);
 
     // Get key6
     auto dataKey6 = imageCache->GetCacheImageData(KEY_6);
-    auto dataRaw6 = dataKey6->GetData();
+    ASSERT_NE(dataKey6, nullptr);
+    auto dataRaw6 = static_cast<const uint8_t*>(dataKey6->GetData());
     ASSERT_EQ(dataRaw6[0], 'y');
-    dataFront = imageCache->dataCacheList_.front().imageDataPtr->GetData();
-    ASSERT_EQ(dataFront, dataRaw6);
 }
 
 /**
@@ -34,7 +34,7 @@ extern "C" {
 #define ARKUI_BASIC_API_VERSION 8
 #define ARKUI_EXTENDED_API_VERSION 7
 #define ARKUI_NODE_GRAPHICS_API_VERSION 5
-#define ARKUI_NODE_MODIFIERS_API_VERSION 7
+#define ARKUI_NODE_MODIFIERS_API_VERSION 8
 #define ARKUI_AUTO_GENERATE_NODE_ID (-2)
 #define ARKUI_MAX_ANCHOR_ID_SIZE 50
 enum ArkUIAPIVariantKind {
@@ -1214,6 +1214,26 @@ struct ArkUIDragInteractionOptions {
     ArkUI_Bool defaultAnimationBeforeLifting;
 };
 
+/**
+ * The attributes of a command buffer for applyAttributeBatch of the common modifier. A command is the attribute, the
+ * count of its arguments and the arguments, a count of 0 resets the attribute.
+ */
+enum ArkUIAttributeBatchOp {
+    ARKUI_ATTRIBUTE_BATCH_BACKGROUND_COLOR = 0, // color
+    ARKUI_ATTRIBUTE_BATCH_WIDTH,                // value, unit
+    ARKUI_ATTRIBUTE_BATCH_HEIGHT,               // value, unit
+    ARKUI_ATTRIBUTE_BATCH_OPACITY,              // opacity
+    ARKUI_ATTRIBUTE_BATCH_Z_INDEX,              // zIndex
+    ARKUI_ATTRIBUTE_BATCH_VISIBILITY,           // visibility
+    ARKUI_ATTRIBUTE_BATCH_ENABLED,              // 1 or 0
+    ARKUI_ATTRIBUTE_BATCH_FLEX_GROW,            // flexGrow
+    ARKUI_ATTRIBUTE_BATCH_FLEX_SHRINK,          // flexShrink
+    ARKUI_ATTRIBUTE_BATCH_ALIGN_SELF,           // alignSelf
+    ARKUI_ATTRIBUTE_BATCH_ASPECT_RATIO,         // aspectRatio
+    ARKUI_ATTRIBUTE_BATCH_DISPLAY_PRIORITY,     // displayPriority
+    ARKUI_ATTRIBUTE_BATCH_OP_COUNT,
+};
+
 struct ArkUICommonModifier {
     void (*setBackgroundColor)(ArkUINodeHandle node, ArkUI_Uint32 color);
     void (*resetBackgroundColor)(ArkUINodeHandle node);
@@ -1647,6 +1667,7 @@ struct ArkUICommonModifier {
     void (*resetPixelRound)(ArkUINodeHandle node);
     void (*setBorderDashParams)(ArkUINodeHandle node, const ArkUI_Float32* values, ArkUI_Int32 valuesSize);
     void (*getExpandSafeArea)(ArkUINodeHandle node, ArkUI_Uint32 (*values)[2]);
+    ArkUI_Int32 (*applyAttributeBatch)(ArkUINodeHandle node, const ArkUI_Float64* commands, ArkUI_Int32 length);
 };
 
 struct ArkUICommonShapeModifier {
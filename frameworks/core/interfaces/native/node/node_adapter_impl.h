@@ -128,7 +128,7 @@ protected:
     void OnItemDeleted(UINode* node, const std::string& key) override;
 
     // used in ArkTS side for tabs.
-    LazyForEachChild OnGetChildByIndexNew(int32_t index, std::map<int32_t, LazyForEachChild>& cachedItems,
+    LazyForEachChild OnGetChildByIndexNew(int32_t index, LazyForEachCachedItems& cachedItems,
         std::unordered_map<std::string, LazyForEachCacheChild>& expiringItems) override
     {
         return {};
@@ -14,6 +14,7 @@
  */
 #include "core/interfaces/native/node/node_common_modifier.h"
 
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -5914,6 +5915,158 @@ void SetBorderDashParams(ArkUINodeHandle node, const ArkUI_Float32* values, ArkU
         ViewAbstract::SetDashWidth(frameNode, borderDashWidth);
     }
 }
+
+// a command is the attribute and the count of its arguments, followed by the arguments.
+constexpr ArkUI_Int32 ATTRIBUTE_BATCH_HEADER_SIZE = 2;
+constexpr ArkUI_Float64 UINT32_RANGE = 4294967296.0;
+
+struct AttributeBatchEntry {
+    ArkUI_Int32 argCount;
+    void (*set)(ArkUINodeHandle node, const ArkUI_Float64* args);
+    void (*reset)(ArkUINodeHandle node);
+    PropertyChangeFlag changeFlag;
+};
+
+// the ToUint32 of ECMAScript, which the bridge applies with Uint32Value to a number passed to a setter.
+uint32_t BatchToUint32(ArkUI_Float64 value)
+{
+    if (!std::isfinite(value)) {
+        return 0;
+    }
+    auto modulo = std::fmod(std::trunc(value), UINT32_RANGE);
+    if (modulo < 0) {
+        modulo += UINT32_RANGE;
+    }
+    return static_cast<uint32_t>(modulo);
+}
+
+// the ToInt32 of ECMAScript, which the bridge applies with Int32Value to a number passed to a setter.
+ArkUI_Int32 BatchToInt32(ArkUI_Float64 value)
+{
+    return static_cast<ArkUI_Int32>(BatchToUint32(value));
+}
+
+void BatchSetBackgroundColor(ArkUINodeHandle node, const ArkUI_Float64* args)
+{
+    // a number without alpha is an opaque color, as ArkTSUtils::ColorAlphaAdapt makes it for the setter.
+    auto color = BatchToUint32(args[NUM_0]);
+    if ((color & COLOR_ALPHA_MASK) == 0) {
+        color |= COLOR_ALPHA_MASK;
+    }
+    SetBackgroundColor(node, color);
+}
+
+// a negative length resets the attribute since API version 12 and is 0 before, as the setters of the bridge do.
+template<void (*SET)(ArkUINodeHandle, ArkUI_Float32, ArkUI_Int32, ArkUI_CharPtr), void (*RESET)(ArkUINodeHandle)>
+void BatchSetLength(ArkUINodeHandle node, const ArkUI_Float64* args)
+{
+    auto value = args[NUM_0];
+    if (LessNotEqual(value, 0.0)) {
+        if (AceApplicationInfo::GetInstance().GreatOrEqualTargetAPIVersion(PlatformVersion::VERSION_TWELVE)) {
+            RESET(node);
+            return;
+        }
+        value = 0.0;
+    }
+    SET(node, value, BatchToInt32(args[NUM_1]), nullptr);
+}
+
+void BatchSetVisibility(ArkUINodeHandle node, const ArkUI_Float64* args)
+{
+    auto value = BatchToInt32(args[NUM_0]);
+    if (value < static_cast<ArkUI_Int32>(VisibleType::VISIBLE) || value > static_cast<ArkUI_Int32>(VisibleType::GONE)) {
+        value = static_cast<ArkUI_Int32>(DEFAULT_VISIBILITY);
+    }
+    SetVisibility(node, value);
+}
+
+void BatchSetAlignSelf(ArkUINodeHandle node, const ArkUI_Float64* args)
+{
+    // the range is checked on the number, so a value out of the range of an int is never converted.
+    if (!(args[NUM_0] >= 0 && args[NUM_0] <= MAX_ALIGN_VALUE)) {
+        ResetAlignSelf(node);
+        return;
+    }
+    SetAlignSelf(node, BatchToInt32(args[NUM_0]));
+}
+
+/**
+ * Indexed by ArkUIAttributeBatchOp. The frontend packs the numbers as they were set, the entries check them the way
+ * the setters of CommonBridge do, so a value applies the same through a batch and through a setter.
+ */
+const AttributeBatchEntry ATTRIBUTE_BATCH_ENTRIES[] = {
+    { 1, BatchSetBackgroundColor, ResetBackgroundColor, PROPERTY_UPDATE_RENDER },
+    { 2, BatchSetLength<SetWidth, ResetWidth>, ResetWidth, PROPERTY_UPDATE_MEASURE },
+    { 2, BatchSetLength<SetHeight, ResetHeight>, ResetHeight, PROPERTY_UPDATE_MEASURE },
+    { 1, [](ArkUINodeHandle node, const ArkUI_Float64* args) { SetOpacity(node, args[NUM_0]); }, ResetOpacity,
+        PROPERTY_UPDATE_RENDER },
+    { 1, [](ArkUINodeHandle node, const ArkUI_Float64* args) { SetZIndex(node, BatchToInt32(args[NUM_0])); },
+        ResetZIndex, PROPERTY_UPDATE_RENDER },
+    { 1, BatchSetVisibility, ResetVisibility, PROPERTY_UPDATE_MEASURE },
+    { 1, [](ArkUINodeHandle node, const ArkUI_Float64* args) { SetEnabled(node, !NearZero(args[NUM_0])); },
+        ResetEnabled, PROPERTY_UPDATE_RENDER },
+    { 1, [](ArkUINodeHandle node, const ArkUI_Float64* args) { SetFlexGrow(node, args[NUM_0]); }, ResetFlexGrow,
+        PROPERTY_UPDATE_MEASURE },
+    { 1, [](ArkUINodeHandle node, const ArkUI_Float64* args) { SetFlexShrink(node, args[NUM_0]); },
+        ResetFlexShrink, PROPERTY_UPDATE_MEASURE },
+    { 1, BatchSetAlignSelf, ResetAlignSelf, PROPERTY_UPDATE_MEASURE },
+    { 1, [](ArkUINodeHandle node, const ArkUI_Float64* args) { SetAspectRatio(node, args[NUM_0]); },
+        ResetAspectRatio, PROPERTY_UPDATE_MEASURE },
+    { 1, [](ArkUINodeHandle node, const ArkUI_Float64* args) { SetDisplayPriority(node, args[NUM_0]); },
+        ResetDisplayPriority, PROPERTY_UPDATE_MEASURE },
+};
+static_assert(sizeof(ATTRIBUTE_BATCH_ENTRIES) / sizeof(ATTRIBUTE_BATCH_ENTRIES[0]) == ARKUI_ATTRIBUTE_BATCH_OP_COUNT,
+    "every ArkUIAttributeBatchOp needs an entry");
+
+/**
+ * Applies the commands of an ArkUIAttributeBatchOp buffer in order and returns the count applied. The setters do not
+ * request a frame each, the node is marked dirty once for all of them. A command of an unknown attribute or with a
+ * wrong count of arguments is skipped, a command running past the end of the buffer stops the batch.
+ */
+ArkUI_Int32 ApplyAttributeBatch(ArkUINodeHandle node, const ArkUI_Float64* commands, ArkUI_Int32 length)
+{
+    auto* frameNode = reinterpret_cast<FrameNode*>(node);
+    CHECK_NULL_RETURN(frameNode, 0);
+    CHECK_NULL_RETURN(commands, 0);
+    const auto& renderContext = frameNode->GetRenderContext();
+    if (renderContext) {
+        renderContext->SuspendRequestFrame();
+    }
+    ArkUI_Int32 applied = 0;
+    PropertyChangeFlag changeFlag = PROPERTY_UPDATE_NORMAL;
+    ArkUI_Int32 index = 0;
+    while (index + ATTRIBUTE_BATCH_HEADER_SIZE <= length) {
+        // the header is checked as doubles, a value out of the range of an int is never cast.
+        auto op = commands[index];
+        auto argCountValue = commands[index + 1];
+        index += ATTRIBUTE_BATCH_HEADER_SIZE;
+        if (!(argCountValue >= 0 && argCountValue <= length - index)) {
+            TAG_LOGW(AceLogTag::ACE_NATIVE_NODE, "attribute batch is truncated at %{public}d", index);
+            break;
+        }
+        auto argCount = static_cast<ArkUI_Int32>(argCountValue);
+        if (op >= 0 && op < ARKUI_ATTRIBUTE_BATCH_OP_COUNT) {
+            const auto& entry = ATTRIBUTE_BATCH_ENTRIES[static_cast<ArkUI_Int32>(op)];
+            if (argCount == 0) {
+                entry.reset(node);
+                changeFlag |= entry.changeFlag;
+                ++applied;
+            } else if (argCount == entry.argCount) {
+                entry.set(node, commands + index);
+                changeFlag |= entry.changeFlag;
+                ++applied;
+            }
+        }
+        index += argCount;
+    }
+    if (renderContext) {
+        renderContext->ResumeRequestFrame();
+    }
+    if (changeFlag != PROPERTY_UPDATE_NORMAL) {
+        frameNode->MarkDirtyNode(changeFlag);
+    }
+    return applied;
+}
 } // namespace
 
 namespace NodeModifier {
@@ -5988,7 +6141,7 @@ const ArkUICommonModifier* GetCommonModifier()
         SetAccessibilityValue, GetAccessibilityValue, ResetAccessibilityValue, SetAccessibilityActions,
         ResetAccessibilityActions, GetAccessibilityActions, SetAccessibilityRole, ResetAccessibilityRole,
         GetAccessibilityRole, SetFocusScopeId, ResetFocusScopeId, SetFocusScopePriority, ResetFocusScopePriority,
-        SetPixelRound, ResetPixelRound, SetBorderDashParams, GetExpandSafeArea };
+        SetPixelRound, ResetPixelRound, SetBorderDashParams, GetExpandSafeArea, ApplyAttributeBatch };
 
     return &modifier;
 }
@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_NG_DIRTY_NODE_QUEUE_H
+#define FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_NG_DIRTY_NODE_QUEUE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include "base/memory/referenced.h"
+#include "base/utils/noncopyable.h"
+#include "base/utils/utils.h"
+
+namespace OHOS::Ace::NG {
+
+enum DirtyQueueType : uint8_t {
+    DIRTY_LAYOUT_QUEUE = 0,
+    DIRTY_RENDER_QUEUE,
+    DIRTY_QUEUE_TYPE_COUNT,
+};
+
+enum class DirtyNodeOrder {
+    // layout priority, page id, depth: the order of UITaskScheduler::NodeCompare.
+    PRIORITY_FIRST,
+    // page id, layout priority, depth: the order of a page keyed map of NodeCompare sets.
+    PAGE_FIRST,
+};
+
+// Dirty node container reused across frames. Nodes are kept in buckets of equal (layout priority, page id, depth),
+// the bucket index is kept sorted in flush order, and a per-node owner slot replaces the set lookup for
+// deduplication, so no memory is allocated once the buckets have grown to the working size. The owner slot records
+// which queue holds the node, so the queues of different pipelines do not drop each other's nodes.
+// NodeType must provide GetLayoutPriority, GetPageId, GetDepth, GetDirtyQueueOwner and SetDirtyQueueOwner.
+template<typename NodeType>
+class DirtyNodeQueue final {
+public:
+    DirtyNodeQueue(DirtyQueueType queueType, DirtyNodeOrder order) : queueType_(queueType), order_(order) {}
+    ~DirtyNodeQueue()
+    {
+        Clear();
+    }
+
+    // Returns false if the node is already in the queue.
+    bool Add(const RefPtr<NodeType>& node)
+    {
+        if (node) {
+            const void* owner = node->GetDirtyQueueOwner(queueType_);
+            if (owner == this) {
+                return false;
+            }
+            // a node held by the queue of another pipeline is queued here too, duplicates are dropped when taking.
+            if (!owner) {
+                node->SetDirtyQueueOwner(queueType_, this);
+            }
+        }
+        FindOrCreateBucket(GetKey(node)).nodes.emplace_back(node);
+        ++size_;
+        return true;
+    }
+
+    bool Empty() const
+    {
+        return size_ == 0;
+    }
+
+    size_t Size() const
+    {
+        return size_;
+    }
+
+    // Visits the nodes in the order of the keys they had when they were added, without removing them.
+    template<typename Func>
+    void ForEach(Func&& func) const
+    {
+        for (auto index : sortedBuckets_) {
+            for (const auto& node : buckets_[index].nodes) {
+                func(node);
+            }
+        }
+    }
+
+    // Moves all nodes into out in flush order and empties the queue. Nodes added while out is being processed go
+    // to the queue again, the same way they did with the std::list based queues.
+    void TakeOrdered(std::vector<RefPtr<NodeType>>& out)
+    {
+        RefreshKeys();
+        out.clear();
+        out.reserve(size_);
+        for (auto index : sortedBuckets_) {
+            auto& nodes = buckets_[index].nodes;
+            std::sort(nodes.begin(), nodes.end(),
+                [](const RefPtr<NodeType>& left, const RefPtr<NodeType>& right) { return left < right; });
+            for (auto& node : nodes) {
+                ReleaseNode(node);
+                if (node && !out.empty() && out.back() == node) {
+                    continue;
+                }
+                out.emplace_back(std::move(node));
+            }
+            nodes.clear();
+        }
+        sortedBuckets_.clear();
+        size_ = 0;
+    }
+
+    void Clear()
+    {
+        for (auto index : sortedBuckets_) {
+            auto& nodes = buckets_[index].nodes;
+            for (const auto& node : nodes) {
+                ReleaseNode(node);
+            }
+            nodes.clear();
+        }
+        sortedBuckets_.clear();
+        size_ = 0;
+    }
+
+private:
+    struct BucketKey {
+        int32_t layoutPriority = 0;
+        uint32_t pageId = 0;
+        int32_t depth = 0;
+    };
+
+    struct Bucket {
+        BucketKey key;
+        std::vector<RefPtr<NodeType>> nodes;
+    };
+
+    static BucketKey GetKey(const RefPtr<NodeType>& node)
+    {
+        CHECK_NULL_RETURN(node, BucketKey());
+        return { node->GetLayoutPriority(), static_cast<uint32_t>(node->GetPageId()), node->GetDepth() };
+    }
+
+    void ReleaseNode(const RefPtr<NodeType>& node) const
+    {
+        if (node && node->GetDirtyQueueOwner(queueType_) == this) {
+            node->SetDirtyQueueOwner(queueType_, nullptr);
+        }
+    }
+
+    // The key of a node is taken when it is added. A node added before it was mounted, or moved to another page or
+    // depth since, is put into the bucket of its current key before flushing.
+    void RefreshKeys()
+    {
+        for (auto index : sortedBuckets_) {
+            auto& bucket = buckets_[index];
+            size_t kept = 0;
+            for (auto& node : bucket.nodes) {
+                if (KeyEqual(GetKey(node), bucket.key)) {
+                    if (&bucket.nodes[kept] != &node) {
+                        bucket.nodes[kept] = std::move(node);
+                    }
+                    ++kept;
+                } else {
+                    staleNodes_.emplace_back(std::move(node));
+                }
+            }
+            bucket.nodes.resize(kept);
+        }
+        for (auto& node : staleNodes_) {
+            auto key = GetKey(node);
+            FindOrCreateBucket(key).nodes.emplace_back(std::move(node));
+        }
+        staleNodes_.clear();
+    }
+
+    bool KeyLess(const BucketKey& left, const BucketKey& right) const
+    {
+        if (order_ == DirtyNodeOrder::PAGE_FIRST && left.pageId != right.pageId) {
+            return left.pageId < right.pageId;
+        }
+        if (left.layoutPriority != right.layoutPriority) {
+            return left.layoutPriority > right.layoutPriority;
+        }
+        if (left.pageId != right.pageId) {
+            return left.pageId < right.pageId;
+        }
+        return left.depth < right.depth;
+    }
+
+    static bool KeyEqual(const BucketKey& left, const BucketKey& right)
+    {
+        return left.layoutPriority == right.layoutPriority && left.pageId == right.pageId && left.depth == right.depth;
+    }
+
+    Bucket& FindOrCreateBucket(const BucketKey& key)
+    {
+        // consecutive marks usually hit the same depth, check the last bucket before searching.
+        if (lastBucket_ < sortedBuckets_.size() && KeyEqual(buckets_[lastBucket_].key, key)) {
+            return buckets_[lastBucket_];
+        }
+        auto iter = std::lower_bound(sortedBuckets_.begin(), sortedBuckets_.end(), key,
+            [this](uint32_t index, const BucketKey& target) { return KeyLess(buckets_[index].key, target); });
+        if (iter != sortedBuckets_.end() && KeyEqual(buckets_[*iter].key, key)) {
+            lastBucket_ = *iter;
+            return buckets_[lastBucket_];
+        }
+        // buckets at or after sortedBuckets_.size() are empty and keep their capacity for reuse.
+        auto index = static_cast<uint32_t>(sortedBuckets_.size());
+        if (index == buckets_.size()) {
+            buckets_.emplace_back();
+        }
+        buckets_[index].key = key;
+        sortedBuckets_.insert(iter, index);
+        lastBucket_ = index;
+        return buckets_[index];
+    }
+
+    DirtyQueueType queueType_;
+    DirtyNodeOrder order_;
+    std::vector<Bucket> buckets_;
+    std::vector<uint32_t> sortedBuckets_;
+    std::vector<RefPtr<NodeType>> staleNodes_;
+    uint32_t lastBucket_ = 0;
+    size_t size_ = 0;
+
+    ACE_DISALLOW_COPY_AND_MOVE(DirtyNodeQueue);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_FRAMEWORKS_CORE_PIPELINE_NG_DIRTY_NODE_QUEUE_H
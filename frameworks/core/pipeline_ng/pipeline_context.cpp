@@ -2384,6 +2384,10 @@ void PipelineContext::DumpPipelineInfo() const
             for (const auto& layout : info.renderInfos_) {
                 DumpLog::GetInstance().Print(2, layout.ToString());
             }
+            DumpLog::GetInstance().Print(1, "IdleTask: " + info.GetIdleInfo());
+            for (const auto& idle : info.idleInfos_) {
+                DumpLog::GetInstance().Print(2, idle.ToString());
+            }
             DumpLog::GetInstance().Print(
                 "==================================FrameTask==================================");
         }
@@ -3029,6 +3033,14 @@ void PipelineContext::SetAppIcon(const RefPtr<PixelMap>& icon)
 
 void PipelineContext::FlushReload(const ConfigurationChange& configurationChange, bool fullUpdate)
 {
+    // the values the theme constants resolved by name may belong to the configuration before the change.
+    auto themeManager = GetThemeManager();
+    if (themeManager) {
+        auto themeConstants = themeManager->GetThemeConstants();
+        if (themeConstants) {
+            themeConstants->ClearResolvedValues();
+        }
+    }
     AnimationOption option;
     const int32_t duration = 400;
     option.SetDuration(duration);
@@ -3275,6 +3287,12 @@ void PipelineContext::AddPredictTask(PredictTask&& task)
     RequestFrame();
 }
 
+void PipelineContext::AddIdleTask(IdleTask&& task, IdleTaskPriority priority, const std::string& tag, int32_t id)
+{
+    taskScheduler_->AddIdleTask(std::move(task), priority, tag, id);
+    RequestFrame();
+}
+
 void PipelineContext::OnIdle(int64_t deadline)
 {
     if (deadline == 0  && lastVsyncEndTimestamp_ > 0 && GetSysTimestamp() > lastVsyncEndTimestamp_
@@ -3296,8 +3314,14 @@ void PipelineContext::OnIdle(int64_t deadline)
     }
     CHECK_RUN_ON(UI);
     ACE_SCOPED_TRACE("OnIdle, targettime:%" PRId64 "", deadline);
+    // idle work is accounted to the frame it follows.
+    taskScheduler_->StartRecordFrameInfo(dumpFrameInfos_.empty() ? nullptr : &dumpFrameInfos_.back());
     taskScheduler_->FlushPredictTask(deadline - TIME_THRESHOLD, canUseLongPredictTask_);
+    taskScheduler_->FinishRecordFrameInfo();
     canUseLongPredictTask_ = false;
+    if (taskScheduler_->HasPendingIdleTask()) {
+        RequestFrame();
+    }
     if (GetSysTimestamp() < deadline) {
         ElementRegister::GetInstance()->CallJSCleanUpIdleTaskFunc();
     }
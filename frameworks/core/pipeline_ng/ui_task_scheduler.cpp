@@ -15,15 +15,25 @@
 
 #include "core/pipeline_ng/ui_task_scheduler.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
 #include <unistd.h>
+#include <unordered_set>
+#include <vector>
 
 #include "base/log/frame_report.h"
 #ifdef FFRT_EXISTS
 #include "base/longframe/long_frame_report.h"
 #endif
 #include "base/memory/referenced.h"
+#include "base/thread/background_task_executor.h"
+#include "base/utils/system_properties.h"
 #include "base/utils/time_util.h"
 #include "base/utils/utils.h"
+#include "core/common/container_scope.h"
 #include "core/common/thread_checker.h"
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/pattern/custom/custom_node.h"
@@ -33,11 +43,74 @@
 namespace OHOS::Ace::NG {
 namespace {
 constexpr char LIBFFRT_LIB64_PATH[] = "/system/lib64/ndk/libffrt.z.so";
+constexpr size_t MIN_PARALLEL_MEASURE_ROOTS = 2;
+constexpr size_t MAX_PARALLEL_THREADS = 4;
+
+struct ParallelTaskState {
+    std::function<void(size_t)> task;
+    size_t count = 0;
+    std::atomic<size_t> next { 0 };
+    size_t finished = 0;
+    std::mutex mutex;
+    std::condition_variable condition;
+};
+
+void RunParallelTasks(const std::shared_ptr<ParallelTaskState>& state, int32_t instanceId)
+{
+    ContainerScope scope(instanceId);
+    size_t index = state->next.fetch_add(1);
+    while (index < state->count) {
+        state->task(index);
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            if (++state->finished == state->count) {
+                state->condition.notify_all();
+            }
+        }
+        index = state->next.fetch_add(1);
+    }
+}
+
+// Runs task(0) to task(count - 1) on the background executor and returns when all of them are done. The UI thread
+// runs tasks as well, helpers which start late find no work left and return at once.
+void ParallelRun(size_t count, std::function<void(size_t)>&& task)
+{
+    if (count == 0) {
+        return;
+    }
+    auto state = std::make_shared<ParallelTaskState>();
+    state->task = std::move(task);
+    state->count = count;
+    auto instanceId = ContainerScope::CurrentId();
+    size_t helperCount =
+        std::min(count - 1, std::min(static_cast<size_t>(std::thread::hardware_concurrency()), MAX_PARALLEL_THREADS));
+    for (size_t i = 0; i < helperCount; ++i) {
+        BackgroundTaskExecutor::GetInstance().PostTask([state, instanceId]() { RunParallelTasks(state, instanceId); });
+    }
+    RunParallelTasks(state, instanceId);
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->condition.wait(lock, [&state]() { return state->finished == state->count; });
 }
+
+bool HasDirtyAncestor(const RefPtr<FrameNode>& node, const std::unordered_set<FrameNode*>& dirtyNodes)
+{
+    auto parent = node->GetAncestorNodeOfFrame();
+    while (parent) {
+        if (dirtyNodes.count(AceType::RawPtr(parent)) > 0) {
+            return true;
+        }
+        parent = parent->GetAncestorNodeOfFrame();
+    }
+    return false;
+}
+} // namespace
 uint64_t UITaskScheduler::frameId_ = 0;
 
 UITaskScheduler::UITaskScheduler()
+    : dirtyLayoutNodes_(DIRTY_LAYOUT_QUEUE, DirtyNodeOrder::PRIORITY_FIRST),
+      dirtyRenderNodes_(DIRTY_RENDER_QUEUE, DirtyNodeOrder::PAGE_FIRST)
 {
+    parallelLayoutEnabled_ = SystemProperties::GetParallelLayoutEnabled();
     if (access(LIBFFRT_LIB64_PATH, F_OK) == -1) {
         return ;
     }
@@ -53,7 +126,7 @@ void UITaskScheduler::AddDirtyLayoutNode(const RefPtr<FrameNode>& dirty)
 {
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(dirty);
-    dirtyLayoutNodes_.emplace_back(dirty);
+    dirtyLayoutNodes_.Add(dirty);
 }
 
 void UITaskScheduler::AddLayoutNode(const RefPtr<FrameNode>& layoutNode)
@@ -92,8 +165,7 @@ void UITaskScheduler::AddDirtyRenderNode(const RefPtr<FrameNode>& dirty)
 {
     CHECK_RUN_ON(UI);
     CHECK_NULL_VOID(dirty);
-    auto result = dirtyRenderNodes_[dirty->GetPageId()].emplace(dirty);
-    if (!result.second) {
+    if (!dirtyRenderNodes_.Add(dirty)) {
         LOGW("Fail to emplace %{public}s render node", dirty->GetTag().c_str());
     }
 }
@@ -124,7 +196,7 @@ void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
 {
     CHECK_RUN_ON(UI);
     ACE_FUNCTION_TRACE();
-    if (dirtyLayoutNodes_.empty()) {
+    if (dirtyLayoutNodes_.Empty()) {
         return;
     }
     if (isLayouting_) {
@@ -141,12 +213,27 @@ void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
 #endif
 
     isLayouting_ = true;
-    auto dirtyLayoutNodes = std::move(dirtyLayoutNodes_);
-    PageDirtySet dirtyLayoutNodesSet(dirtyLayoutNodes.begin(), dirtyLayoutNodes.end());
+    auto dirtyLayoutNodes = std::move(layoutFlushNodes_);
+    dirtyLayoutNodes_.TakeOrdered(dirtyLayoutNodes);
+    if (parallelLayoutEnabled_ && !forceUseMainThread) {
+        FlushParallelMeasureTask(dirtyLayoutNodes);
+    }
 
     // Priority task creation
     int64_t time = 0;
-    for (auto&& node : dirtyLayoutNodesSet) {
+    size_t nextParallelRoot = 0;
+    for (size_t i = 0; i < dirtyLayoutNodes.size(); ++i) {
+        const auto& node = dirtyLayoutNodes[i];
+        // roots measured in parallel finish their layout at their place in the dirty order.
+        if (nextParallelRoot < parallelRoots_.size() && parallelRoots_[nextParallelRoot] == i) {
+            time = GetSysTimestamp();
+            node->FinishLayoutTask();
+            time = GetSysTimestamp() - time + parallelCosts_[nextParallelRoot++];
+            if (frameInfo_ != nullptr) {
+                frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::LAYOUT);
+            }
+            continue;
+        }
         // need to check the node is destroying or not before CreateLayoutTask
         if (!node || node->IsInDestroying()) {
             continue;
@@ -158,6 +245,9 @@ void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
             frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::LAYOUT);
         }
     }
+    dirtyLayoutNodes.clear();
+    parallelRoots_.clear();
+    layoutFlushNodes_ = std::move(dirtyLayoutNodes);
     FlushSyncGeometryNodeTasks();
 #ifdef FFRT_EXISTS
     if (is64BitSystem_) {
@@ -168,35 +258,109 @@ void UITaskScheduler::FlushLayoutTask(bool forceUseMainThread)
     isLayouting_ = false;
 }
 
+void UITaskScheduler::FlushParallelMeasureTask(const std::vector<RefPtr<FrameNode>>& dirtyNodes)
+{
+    parallelRoots_.clear();
+    parallelDirtyNodes_.clear();
+    for (const auto& node : dirtyNodes) {
+        if (node) {
+            parallelDirtyNodes_.emplace(AceType::RawPtr(node));
+        }
+    }
+    for (size_t i = 0; i < dirtyNodes.size(); ++i) {
+        const auto& node = dirtyNodes[i];
+        if (!node || node->IsInDestroying() || HasDirtyAncestor(node, parallelDirtyNodes_)) {
+            continue;
+        }
+        if (node->CanMeasureOnBackground()) {
+            parallelRoots_.emplace_back(i);
+        }
+    }
+    if (parallelRoots_.size() < MIN_PARALLEL_MEASURE_ROOTS) {
+        parallelRoots_.clear();
+        return;
+    }
+    ACE_SCOPED_TRACE("FlushParallelMeasureTask %zu", parallelRoots_.size());
+    // a root which is not layout dirty any more needs no task, FlushLayoutTask skips it as CreateLayoutTask would.
+    auto prepared = std::remove_if(parallelRoots_.begin(), parallelRoots_.end(),
+        [&dirtyNodes](size_t index) { return !dirtyNodes[index]->PrepareLayoutTask(); });
+    parallelRoots_.erase(prepared, parallelRoots_.end());
+    parallelCosts_.assign(parallelRoots_.size(), 0);
+    ParallelRun(parallelRoots_.size(), [this, &dirtyNodes](size_t i) {
+        int64_t time = GetSysTimestamp();
+        dirtyNodes[parallelRoots_[i]]->MeasureLayoutTask();
+        parallelCosts_[i] = GetSysTimestamp() - time;
+    });
+}
+
 void UITaskScheduler::FlushRenderTask(bool forceUseMainThread)
 {
     CHECK_RUN_ON(UI);
     if (FrameReport::GetInstance().GetEnable()) {
         FrameReport::GetInstance().BeginFlushRender();
     }
-    auto dirtyRenderNodes = std::move(dirtyRenderNodes_);
+    auto dirtyRenderNodes = std::move(renderFlushNodes_);
+    dirtyRenderNodes_.TakeOrdered(dirtyRenderNodes);
+    ACE_SCOPED_TRACE("FlushRenderTask %zu", dirtyRenderNodes.size());
     // Priority task creation
     int64_t time = 0;
-    for (auto&& pageNodes : dirtyRenderNodes) {
-        ACE_SCOPED_TRACE("FlushRenderTask %zu", pageNodes.second.size());
-        for (auto&& node : pageNodes.second) {
-            if (!node) {
-                continue;
-            }
-            if (node->IsInDestroying()) {
-                continue;
-            }
-            time = GetSysTimestamp();
-            auto task = node->CreateRenderTask(forceUseMainThread);
-            if (task) {
-                if (forceUseMainThread || (task->GetTaskThreadType() == MAIN_TASK)) {
-                    (*task)();
-                    time = GetSysTimestamp() - time;
-                    if (frameInfo_ != nullptr) {
-                        frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::RENDER);
-                    }
-                }
-            }
+    // once a task has a background part, it and every later task are deferred, so that all of them still run in
+    // dirty order after the background parts are done.
+    for (auto&& node : dirtyRenderNodes) {
+        if (!node) {
+            continue;
+        }
+        if (node->IsInDestroying()) {
+            continue;
+        }
+        time = GetSysTimestamp();
+        auto task = node->CreateRenderTask(forceUseMainThread);
+        if (!task) {
+            continue;
+        }
+        if (!deferredRenderTasks_.empty() || (task->GetTaskThreadType() & BACKGROUND_TASK) == BACKGROUND_TASK) {
+            deferredRenderTasks_.emplace_back(node, std::move(task.value()));
+            continue;
+        }
+        (*task)();
+        time = GetSysTimestamp() - time;
+        if (frameInfo_ != nullptr) {
+            frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::RENDER);
+        }
+    }
+    FlushDeferredRenderTask(deferredRenderTasks_);
+    deferredRenderTasks_.clear();
+    dirtyRenderNodes.clear();
+    renderFlushNodes_ = std::move(dirtyRenderNodes);
+}
+
+void UITaskScheduler::FlushDeferredRenderTask(std::vector<std::pair<RefPtr<FrameNode>, UITask>>& tasks)
+{
+    if (tasks.empty()) {
+        return;
+    }
+    ACE_SCOPED_TRACE("FlushDeferredRenderTask %zu", tasks.size());
+    deferredRenderCosts_.assign(tasks.size(), 0);
+    deferredBackgroundTasks_.clear();
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (tasks[i].second.GetBackgroundTask()) {
+            deferredBackgroundTasks_.emplace_back(i);
+        }
+    }
+    // the background parts only compute, modifiers and properties are written by the tasks on the UI thread.
+    ParallelRun(deferredBackgroundTasks_.size(), [this, &tasks](size_t i) {
+        auto index = deferredBackgroundTasks_[i];
+        int64_t time = GetSysTimestamp();
+        tasks[index].second.GetBackgroundTask()();
+        deferredRenderCosts_[index] = GetSysTimestamp() - time;
+    });
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        const auto& node = tasks[i].first;
+        int64_t time = GetSysTimestamp();
+        tasks[i].second();
+        time = GetSysTimestamp() - time + deferredRenderCosts_[i];
+        if (frameInfo_ != nullptr) {
+            frameInfo_->AddTaskInfo(node->GetTag(), node->GetId(), time, FrameInfo::TaskType::RENDER);
         }
     }
 }
@@ -206,22 +370,15 @@ bool UITaskScheduler::NeedAdditionalLayout()
     bool ret = false;
     ElementRegister::GetInstance()->ReSyncGeometryTransition();
 
-    RootDirtyMap dirtyLayoutNodesMap;
-    for (auto&& dirty : dirtyLayoutNodes_) {
-        dirtyLayoutNodesMap[dirty->GetPageId()].emplace(dirty);
-    }
-
-    for (auto&& pageNodes : dirtyLayoutNodesMap) {
-        for (auto&& node : pageNodes.second) {
-            if (!node || node->IsInDestroying() || !node->GetLayoutProperty()) {
-                continue;
-            }
-            const auto& geometryTransition = node->GetLayoutProperty()->GetGeometryTransition();
-            if (geometryTransition != nullptr) {
-                ret |= geometryTransition->OnAdditionalLayout(node);
-            }
+    dirtyLayoutNodes_.ForEach([&ret](const RefPtr<FrameNode>& node) {
+        if (!node || node->IsInDestroying() || !node->GetLayoutProperty()) {
+            return;
         }
-    }
+        const auto& geometryTransition = node->GetLayoutProperty()->GetGeometryTransition();
+        if (geometryTransition != nullptr) {
+            ret |= geometryTransition->OnAdditionalLayout(node);
+        }
+    });
     return ret;
 }
 
@@ -245,28 +402,74 @@ void UITaskScheduler::FlushTask(bool triggeredByImplicitAnimation)
 
 void UITaskScheduler::AddPredictTask(PredictTask&& task)
 {
-    predictTask_.push_back(std::move(task));
+    CHECK_NULL_VOID(task);
+    AddIdleTask(
+        [task = std::move(task)](int64_t deadline, bool canUseLongPredictTask) {
+            task(deadline, canUseLongPredictTask);
+            return true;
+        },
+        IdleTaskPriority::NORMAL, "PredictTask");
+}
+
+void UITaskScheduler::AddIdleTask(IdleTask&& task, IdleTaskPriority priority, const std::string& tag, int32_t id)
+{
+    CHECK_NULL_VOID(task);
+    idleTasks_[static_cast<size_t>(priority)].push_back({ std::move(task), tag, id });
 }
 
 void UITaskScheduler::FlushPredictTask(int64_t deadline, bool canUseLongPredictTask)
 {
-    decltype(predictTask_) tasks(std::move(predictTask_));
-    for (const auto& task : tasks) {
-        if (task) {
-            task(deadline, canUseLongPredictTask);
+    int64_t startTime = GetSysTimestamp();
+    bool hasRun = false;
+    for (auto& pendingTasks : idleTasks_) {
+        // tasks added or resumed while flushing go to pendingTasks and wait for the next idle period.
+        decltype(idleTasks_)::value_type tasks;
+        tasks.swap(pendingTasks);
+        auto iter = tasks.begin();
+        while (iter != tasks.end()) {
+            int64_t time = GetSysTimestamp();
+            if (hasRun && time >= deadline) {
+                break;
+            }
+            hasRun = true;
+            bool finished = iter->task(deadline, canUseLongPredictTask);
+            if (frameInfo_ != nullptr) {
+                frameInfo_->AddTaskInfo(iter->tag, iter->id, GetSysTimestamp() - time, FrameInfo::TaskType::IDLE);
+            }
+            if (finished) {
+                iter = tasks.erase(iter);
+            } else {
+                pendingTasks.splice(pendingTasks.end(), tasks, iter++);
+            }
         }
+        // tasks out of budget keep their place ahead of the ones added meanwhile.
+        pendingTasks.splice(pendingTasks.begin(), tasks);
     }
+    if (frameInfo_ != nullptr) {
+        size_t pendingCount = 0;
+        for (const auto& pendingTasks : idleTasks_) {
+            pendingCount += pendingTasks.size();
+        }
+        frameInfo_->AddIdleInfo(std::max<int64_t>(deadline - startTime, 0), GetSysTimestamp() - startTime,
+            pendingCount);
+    }
+}
+
+bool UITaskScheduler::HasPendingIdleTask() const
+{
+    return std::any_of(idleTasks_.begin(), idleTasks_.end(),
+        [](const std::list<PendingIdleTask>& tasks) { return !tasks.empty(); });
 }
 
 void UITaskScheduler::CleanUp()
 {
-    dirtyLayoutNodes_.clear();
-    dirtyRenderNodes_.clear();
+    dirtyLayoutNodes_.Clear();
+    dirtyRenderNodes_.Clear();
 }
 
 bool UITaskScheduler::isEmpty()
 {
-    return dirtyLayoutNodes_.empty() && dirtyRenderNodes_.empty();
+    return dirtyLayoutNodes_.Empty() && dirtyRenderNodes_.Empty();
 }
 
 void UITaskScheduler::AddAfterLayoutTask(std::function<void()>&& task, bool isFlushInImplicitAnimationTask)
@@ -16,15 +16,21 @@
 #ifndef FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_UI_TASK_SCHEDULER_H
 #define FOUNDATION_ACE_FRAMEWORKS_CORE_COMMON_PIPELINE_NG_UI_TASK_SCHEDULER_H
 
+#include <array>
 #include <cstdint>
 #include <functional>
 #include <list>
 #include <map>
 #include <set>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 #include "base/log/frame_info.h"
 #include "base/memory/referenced.h"
 #include "base/utils/macros.h"
+#include "core/pipeline_ng/dirty_node_queue.h"
 
 namespace OHOS::Ace::NG {
 
@@ -37,6 +43,15 @@ constexpr TaskThread MAIN_TASK = 1;
 constexpr TaskThread BACKGROUND_TASK = 1 << 1;
 constexpr TaskThread UNDEFINED_TASK = 1 << 2;
 
+// Idle tasks run in this order while the idle budget lasts, tasks of the same priority run in the order they were
+// added.
+enum class IdleTaskPriority : uint8_t {
+    HIGH = 0,
+    NORMAL,
+    LOW,
+    COUNT,
+};
+
 class UITask {
 public:
     explicit UITask(std::function<void()>&& task) : task_(std::move(task)) {}
@@ -62,14 +77,28 @@ public:
         }
     }
 
+    // Pure computation of the task, which may run on a render worker before the task runs on the UI thread.
+    void SetBackgroundTask(std::function<void()>&& backgroundTask)
+    {
+        backgroundTask_ = std::move(backgroundTask);
+    }
+
+    const std::function<void()>& GetBackgroundTask() const
+    {
+        return backgroundTask_;
+    }
+
 private:
     std::function<void()> task_;
+    std::function<void()> backgroundTask_;
     TaskThread taskThread_ = MAIN_TASK;
 };
 
 class ACE_EXPORT UITaskScheduler final {
 public:
     using PredictTask = std::function<void(int64_t, bool)>;
+    // Resumable unit of idle work, returns true when it is finished or false to run again in the next idle period.
+    using IdleTask = std::function<bool(int64_t, bool)>;
     UITaskScheduler();
     ~UITaskScheduler();
 
@@ -78,6 +107,8 @@ public:
     void AddLayoutNode(const RefPtr<FrameNode>& layoutNode);
     void AddDirtyRenderNode(const RefPtr<FrameNode>& dirty);
     void AddPredictTask(PredictTask&& task);
+    void AddIdleTask(IdleTask&& task, IdleTaskPriority priority = IdleTaskPriority::NORMAL,
+        const std::string& tag = "IdleTask", int32_t id = -1);
     void AddAfterLayoutTask(std::function<void()>&& task, bool isFlushInImplicitAnimationTask = false);
     void AddAfterRenderTask(std::function<void()>&& task);
     void AddPersistAfterLayoutTask(std::function<void()>&& task);
@@ -85,7 +116,10 @@ public:
     void FlushLayoutTask(bool forceUseMainThread = false);
     void FlushRenderTask(bool forceUseMainThread = false);
     void FlushTask(bool triggeredByImplicitAnimation = false);
+    // Runs idle tasks by priority until the deadline, the first task always runs so that queued work makes
+    // progress. Tasks left over are kept for the next idle period.
     void FlushPredictTask(int64_t deadline, bool canUseLongPredictTask = false);
+    bool HasPendingIdleTask() const;
     void FlushAfterLayoutTask();
     void FlushAfterLayoutCallbackInImplicitAnimationTask();
     void FlushAfterRenderTask();
@@ -127,7 +161,7 @@ public:
 
     bool IsDirtyLayoutNodesEmpty()
     {
-        return dirtyLayoutNodes_.empty();
+        return dirtyLayoutNodes_.Empty();
     }
 
     void AddSyncGeometryNodeTask(std::function<void()>&& task)
@@ -167,14 +201,36 @@ private:
         }
     };
 
-    using PageDirtySet = std::set<RefPtr<FrameNode>, NodeCompare<RefPtr<FrameNode>>>;
     using LayoutNodesSet = std::set<RefPtr<FrameNode>, NodeCompare<RefPtr<FrameNode>>>;
-    using RootDirtyMap = std::map<uint32_t, PageDirtySet>;
 
-    std::list<RefPtr<FrameNode>> dirtyLayoutNodes_;
+    // Measure dirty roots which share no ancestor on background threads. Their indexes in dirtyNodes are kept in
+    // parallelRoots_, FlushLayoutTask finishes their layout on the UI thread in dirty order.
+    void FlushParallelMeasureTask(const std::vector<RefPtr<FrameNode>>& dirtyNodes);
+    // Run the background parts of the render tasks on render workers, then the tasks on the UI thread in order.
+    void FlushDeferredRenderTask(std::vector<std::pair<RefPtr<FrameNode>, UITask>>& tasks);
+
+    // constructed in the source file, where FrameNode is complete.
+    DirtyNodeQueue<FrameNode> dirtyLayoutNodes_;
     std::list<RefPtr<FrameNode>> layoutNodes_;
-    RootDirtyMap dirtyRenderNodes_;
-    std::list<PredictTask> predictTask_;
+    DirtyNodeQueue<FrameNode> dirtyRenderNodes_;
+    // flush buffers of the dirty queues, kept to reuse their capacity.
+    std::vector<RefPtr<FrameNode>> layoutFlushNodes_;
+    std::vector<RefPtr<FrameNode>> renderFlushNodes_;
+    // roots measured in parallel in this flush, and the time their measure took.
+    std::vector<size_t> parallelRoots_;
+    std::vector<int64_t> parallelCosts_;
+    std::unordered_set<FrameNode*> parallelDirtyNodes_;
+    // render tasks which wait for the background parts of this flush, the ones with a background part, and the time
+    // their background parts took.
+    std::vector<std::pair<RefPtr<FrameNode>, UITask>> deferredRenderTasks_;
+    std::vector<size_t> deferredBackgroundTasks_;
+    std::vector<int64_t> deferredRenderCosts_;
+    struct PendingIdleTask {
+        IdleTask task;
+        std::string tag;
+        int32_t id = -1;
+    };
+    std::array<std::list<PendingIdleTask>, static_cast<size_t>(IdleTaskPriority::COUNT)> idleTasks_;
     std::list<std::function<void()>> afterLayoutTasks_;
     std::list<std::function<void()>> afterLayoutCallbacksInImplicitAnimationTask_;
     std::list<std::function<void()>> afterRenderTasks_;
@@ -184,6 +240,7 @@ private:
     uint32_t currentPageId_ = 0;
     bool is64BitSystem_ = false;
     bool isLayouting_ = false;
+    bool parallelLayoutEnabled_ = false;
 
     FrameInfo* frameInfo_ = nullptr;
 
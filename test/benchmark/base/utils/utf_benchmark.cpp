@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <codecvt>
+#include <cstdint>
+#include <locale>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "base/utils/utf.h"
+
+namespace OHOS::Ace {
+namespace {
+// the size of a long text in a text input or rich editor.
+constexpr size_t CORPUS_SIZE = 4096;
+constexpr int32_t CORPUS_COUNT = 3;
+
+struct Corpus {
+    std::string name;
+    std::string utf8;
+    std::u16string utf16;
+};
+
+Corpus CreateCorpus(const std::string& name, const std::string& sample)
+{
+    Corpus corpus { name, "", u"" };
+    while (corpus.utf8.size() < CORPUS_SIZE) {
+        corpus.utf8 += sample;
+    }
+    Utf8ToUtf16(corpus.utf8, corpus.utf16);
+    return corpus;
+}
+
+const std::vector<Corpus>& GetCorpora()
+{
+    static const std::vector<Corpus> corpora = {
+        CreateCorpus("ASCII", "The quick brown fox jumps over the lazy dog, 0123456789 times. "),
+        CreateCorpus("CJK", "文本输入框和富文本编辑器中的文字，以及段落的测量。"),
+        CreateCorpus("EMOJI", "Good morning 😀👍🏽 see you 🎉🎉 at 8 ❤️ "),
+    };
+    return corpora;
+}
+
+// the conversion StringUtils used before, kept here as the baseline.
+std::u16string Utf8ToUtf16ByCodecvt(const std::string& utf8)
+{
+    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert("error", u"error");
+    return convert.from_bytes(utf8);
+}
+
+std::string Utf16ToUtf8ByCodecvt(const std::u16string& utf16)
+{
+    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert("error");
+    return convert.to_bytes(utf16);
+}
+
+void ReportRun(benchmark::State& state, const Corpus& corpus)
+{
+    state.SetLabel(corpus.name);
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(corpus.utf8.size()));
+}
+
+void BM_Utf8ToUtf16Codecvt(benchmark::State& state)
+{
+    const auto& corpus = GetCorpora()[state.range(0)];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Utf8ToUtf16ByCodecvt(corpus.utf8));
+    }
+    ReportRun(state, corpus);
+}
+BENCHMARK(BM_Utf8ToUtf16Codecvt)->DenseRange(0, CORPUS_COUNT - 1);
+
+void BM_Utf8ToUtf16(benchmark::State& state)
+{
+    const auto& corpus = GetCorpora()[state.range(0)];
+    for (auto _ : state) {
+        std::u16string utf16;
+        Utf8ToUtf16(corpus.utf8, utf16);
+        benchmark::DoNotOptimize(utf16);
+    }
+    ReportRun(state, corpus);
+}
+BENCHMARK(BM_Utf8ToUtf16)->DenseRange(0, CORPUS_COUNT - 1);
+
+void BM_ConvertUtf8ToUtf16(benchmark::State& state)
+{
+    const auto& corpus = GetCorpora()[state.range(0)];
+    std::vector<char16_t> buffer(corpus.utf16.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            ConvertUtf8ToUtf16(corpus.utf8.data(), corpus.utf8.size(), buffer.data(), buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    ReportRun(state, corpus);
+}
+BENCHMARK(BM_ConvertUtf8ToUtf16)->DenseRange(0, CORPUS_COUNT - 1);
+
+void BM_Utf16ToUtf8Codecvt(benchmark::State& state)
+{
+    const auto& corpus = GetCorpora()[state.range(0)];
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(Utf16ToUtf8ByCodecvt(corpus.utf16));
+    }
+    ReportRun(state, corpus);
+}
+BENCHMARK(BM_Utf16ToUtf8Codecvt)->DenseRange(0, CORPUS_COUNT - 1);
+
+void BM_Utf16ToUtf8(benchmark::State& state)
+{
+    const auto& corpus = GetCorpora()[state.range(0)];
+    for (auto _ : state) {
+        std::string utf8;
+        Utf16ToUtf8(corpus.utf16, utf8);
+        benchmark::DoNotOptimize(utf8);
+    }
+    ReportRun(state, corpus);
+}
+BENCHMARK(BM_Utf16ToUtf8)->DenseRange(0, CORPUS_COUNT - 1);
+
+void BM_ConvertUtf16ToUtf8(benchmark::State& state)
+{
+    const auto& corpus = GetCorpora()[state.range(0)];
+    std::vector<char> buffer(corpus.utf8.size());
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            ConvertUtf16ToUtf8(corpus.utf16.data(), corpus.utf16.size(), buffer.data(), buffer.size()));
+        benchmark::ClobberMemory();
+    }
+    ReportRun(state, corpus);
+}
+BENCHMARK(BM_ConvertUtf16ToUtf8)->DenseRange(0, CORPUS_COUNT - 1);
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
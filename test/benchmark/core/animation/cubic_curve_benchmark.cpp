@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/animation/curves.h"
+
+namespace OHOS::Ace {
+namespace {
+// the fractions of the properties an interpolator drives in one frame.
+constexpr int32_t FRACTION_COUNT = 1024;
+constexpr float LEGACY_ERROR_BOUND = 0.001f;
+constexpr int32_t REFERENCE_ITERATIONS = 64;
+// the cubic presets come first in the list.
+constexpr int32_t CUBIC_PRESET_COUNT = 13;
+constexpr int32_t PRESET_COUNT = 18;
+
+struct CurvePreset {
+    std::string name;
+    RefPtr<Curve> curve;
+};
+
+const std::vector<CurvePreset>& GetPresets()
+{
+    static const std::vector<CurvePreset> presets = {
+        { "EASE", Curves::EASE },
+        { "EASE_IN", Curves::EASE_IN },
+        { "EASE_OUT", Curves::EASE_OUT },
+        { "EASE_IN_OUT", Curves::EASE_IN_OUT },
+        { "FAST_OUT_SLOW_IN", Curves::FAST_OUT_SLOW_IN },
+        { "LINEAR_OUT_SLOW_IN", Curves::LINEAR_OUT_SLOW_IN },
+        { "FAST_OUT_LINEAR_IN", Curves::FAST_OUT_LINEAR_IN },
+        { "FRICTION", Curves::FRICTION },
+        { "EXTREME_DECELERATION", Curves::EXTREME_DECELERATION },
+        { "SHARP", Curves::SHARP },
+        { "RHYTHM", Curves::RHYTHM },
+        { "SMOOTH", Curves::SMOOTH },
+        { "MAGNETIC", Curves::MAGNETIC },
+        { "DECELE", Curves::DECELE },
+        { "LINEAR", Curves::LINEAR },
+        { "SINE", Curves::SINE },
+        { "ANTICIPATE", Curves::ANTICIPATE },
+        { "ELASTICS", Curves::ELASTICS },
+    };
+    return presets;
+}
+
+std::vector<float> CreateFractions()
+{
+    std::vector<float> fractions(FRACTION_COUNT);
+    for (int32_t index = 0; index < FRACTION_COUNT; ++index) {
+        fractions[index] = (static_cast<float>(index) + 0.5f) / FRACTION_COUNT;
+    }
+    return fractions;
+}
+
+float CalculateCubic(float a, float b, float m)
+{
+    return 3.0f * a * (1.0f - m) * (1.0f - m) * m + 3.0f * b * (1.0f - m) * m * m + m * m * m;
+}
+
+// the solver CubicCurve had before the sample table, kept here as the baseline.
+float MoveByBisection(const CubicCurve& curve, float time)
+{
+    float start = 0.0f;
+    float end = 1.0f;
+    while (true) {
+        float midpoint = (start + end) / 2;
+        float estimate = CalculateCubic(curve.GetX0(), curve.GetX1(), midpoint);
+        if (NearEqual(time, estimate, LEGACY_ERROR_BOUND)) {
+            return CalculateCubic(curve.GetY0(), curve.GetY1(), midpoint);
+        }
+        if (estimate < time) {
+            start = midpoint;
+        } else {
+            end = midpoint;
+        }
+    }
+}
+
+double MoveByReference(const CubicCurve& curve, double time)
+{
+    auto cubic = [](double a, double b, double m) {
+        return 3.0 * a * (1.0 - m) * (1.0 - m) * m + 3.0 * b * (1.0 - m) * m * m + m * m * m;
+    };
+    double start = 0.0;
+    double end = 1.0;
+    for (int32_t iteration = 0; iteration < REFERENCE_ITERATIONS; ++iteration) {
+        double midpoint = (start + end) / 2;
+        if (cubic(curve.GetX0(), curve.GetX1(), midpoint) < time) {
+            start = midpoint;
+        } else {
+            end = midpoint;
+        }
+    }
+    return cubic(curve.GetY0(), curve.GetY1(), (start + end) / 2);
+}
+
+// Labels the run with the preset and, for a cubic curve, reports the largest distance of the values from a solve in
+// double precision.
+void ReportRun(benchmark::State& state, const CurvePreset& preset, const std::vector<float>& fractions,
+    const std::vector<float>& values)
+{
+    state.SetLabel(preset.name);
+    state.SetItemsProcessed(state.iterations() * FRACTION_COUNT);
+    auto cubicCurve = AceType::DynamicCast<CubicCurve>(preset.curve);
+    if (!cubicCurve) {
+        return;
+    }
+    double maxError = 0.0;
+    for (int32_t index = 0; index < FRACTION_COUNT; ++index) {
+        maxError = std::max(maxError, std::fabs(MoveByReference(*cubicCurve, fractions[index]) - values[index]));
+    }
+    state.counters["max_error"] = maxError;
+}
+
+void BM_CubicCurveBisection(benchmark::State& state)
+{
+    const auto& preset = GetPresets()[state.range(0)];
+    auto cubicCurve = AceType::DynamicCast<CubicCurve>(preset.curve);
+    if (!cubicCurve) {
+        state.SkipWithError("the bisection only solves cubic curves");
+        return;
+    }
+    auto fractions = CreateFractions();
+    std::vector<float> values(FRACTION_COUNT);
+    for (auto _ : state) {
+        for (int32_t index = 0; index < FRACTION_COUNT; ++index) {
+            values[index] = MoveByBisection(*cubicCurve, fractions[index]);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    ReportRun(state, preset, fractions, values);
+}
+BENCHMARK(BM_CubicCurveBisection)->DenseRange(0, CUBIC_PRESET_COUNT - 1);
+
+void BM_CurveMove(benchmark::State& state)
+{
+    const auto& preset = GetPresets()[state.range(0)];
+    auto fractions = CreateFractions();
+    std::vector<float> values(FRACTION_COUNT);
+    for (auto _ : state) {
+        for (int32_t index = 0; index < FRACTION_COUNT; ++index) {
+            values[index] = preset.curve->Move(fractions[index]);
+        }
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    ReportRun(state, preset, fractions, values);
+}
+BENCHMARK(BM_CurveMove)->DenseRange(0, PRESET_COUNT - 1);
+
+void BM_CurveMoveBatch(benchmark::State& state)
+{
+    const auto& preset = GetPresets()[state.range(0)];
+    auto fractions = CreateFractions();
+    std::vector<float> values(FRACTION_COUNT);
+    for (auto _ : state) {
+        preset.curve->MoveBatch(fractions.data(), values.data(), FRACTION_COUNT);
+        benchmark::DoNotOptimize(values.data());
+        benchmark::ClobberMemory();
+    }
+    ReportRun(state, preset, fractions, values);
+}
+BENCHMARK(BM_CurveMoveBatch)->DenseRange(0, PRESET_COUNT - 1);
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/common/lru/count_limit_lru.h"
+#include "core/common/lru/sharded_lru_cache.h"
+
+namespace OHOS::Ace {
+namespace {
+constexpr size_t CACHE_COUNT = 2000;
+constexpr size_t IMAGE_SIZE = 64 * 1024;
+constexpr int32_t KEY_COUNT = 2500;
+constexpr uint32_t RANDOM_MULTIPLIER = 1664525;
+constexpr uint32_t RANDOM_INCREMENT = 1013904223;
+constexpr uint32_t RANDOM_SHIFT = 16;
+constexpr int32_t MAX_THREADS = 8;
+
+struct BenchmarkImage {
+    int32_t id = 0;
+};
+
+const std::vector<std::string>& GetKeys()
+{
+    static const std::vector<std::string> keys = []() {
+        std::vector<std::string> result;
+        for (int32_t i = 0; i < KEY_COUNT; ++i) {
+            result.emplace_back("file://data/storage/el2/base/thumbnails/" + std::to_string(i) + ".jpg");
+        }
+        return result;
+    }();
+    return keys;
+}
+
+// the single mutex count limited LRU ImageCache used before ShardedLRUCache.
+class SingleLockCache {
+public:
+    void Put(const std::string& key, const std::shared_ptr<BenchmarkImage>& image)
+    {
+        std::scoped_lock lock(mutex_);
+        CountLimitLRU::CacheWithCountLimitLRU<std::shared_ptr<BenchmarkImage>>(key, image, list_, map_, capacity_);
+    }
+
+    std::shared_ptr<BenchmarkImage> Get(const std::string& key)
+    {
+        std::scoped_lock lock(mutex_);
+        return CountLimitLRU::GetCacheObjWithCountLimitLRU<std::shared_ptr<BenchmarkImage>>(key, list_, map_);
+    }
+
+private:
+    std::mutex mutex_;
+    std::atomic<size_t> capacity_ = CACHE_COUNT;
+    std::list<CacheNode<std::shared_ptr<BenchmarkImage>>> list_;
+    std::unordered_map<std::string, std::list<CacheNode<std::shared_ptr<BenchmarkImage>>>::iterator> map_;
+};
+
+// every thread looks up random keys of a working set a bit larger than the cache and inserts the missed images.
+template<typename Cache, typename PutFunc>
+void RunLookups(benchmark::State& state, Cache& cache, PutFunc&& put)
+{
+    const auto& keys = GetKeys();
+    auto seed = static_cast<uint32_t>(state.thread_index() + 1);
+    int64_t hits = 0;
+    for (auto _ : state) {
+        seed = seed * RANDOM_MULTIPLIER + RANDOM_INCREMENT;
+        auto index = static_cast<int32_t>((seed >> RANDOM_SHIFT) % KEY_COUNT);
+        const auto& key = keys[index];
+        auto image = cache.Get(key);
+        if (image) {
+            ++hits;
+        } else {
+            put(cache, key, std::make_shared<BenchmarkImage>(BenchmarkImage { index }));
+        }
+        benchmark::DoNotOptimize(image);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["hitRate"] = benchmark::Counter(static_cast<double>(hits), benchmark::Counter::kAvgIterations);
+}
+
+void BM_SingleLockImageCache(benchmark::State& state)
+{
+    static SingleLockCache cache;
+    RunLookups(state, cache, [](SingleLockCache& target, const std::string& key,
+                                 const std::shared_ptr<BenchmarkImage>& image) { target.Put(key, image); });
+}
+BENCHMARK(BM_SingleLockImageCache)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+void BM_ShardedImageCache(benchmark::State& state)
+{
+    static ShardedLRUCache<std::shared_ptr<BenchmarkImage>> cache(CACHE_COUNT, CACHE_COUNT * IMAGE_SIZE);
+    RunLookups(state, cache,
+        [](ShardedLRUCache<std::shared_ptr<BenchmarkImage>>& target, const std::string& key,
+            const std::shared_ptr<BenchmarkImage>& image) { target.Put(key, image, IMAGE_SIZE); });
+}
+BENCHMARK(BM_ShardedImageCache)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+
+// a working set that fits in the cache, so the lookups measure the hit path only.
+void BM_ShardedImageCacheHit(benchmark::State& state)
+{
+    static ShardedLRUCache<std::shared_ptr<BenchmarkImage>> cache(KEY_COUNT, ShardedLRUCache<int>::NO_LIMIT);
+    RunLookups(state, cache,
+        [](ShardedLRUCache<std::shared_ptr<BenchmarkImage>>& target, const std::string& key,
+            const std::shared_ptr<BenchmarkImage>& image) { target.Put(key, image, IMAGE_SIZE); });
+}
+BENCHMARK(BM_ShardedImageCacheHit)->ThreadRange(1, MAX_THREADS)->UseRealTime();
+} // namespace
+} // namespace OHOS::Ace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "test/benchmark/core/layout/layout_benchmark_env.h"
+
+#include "base/utils/string_expression.h"
+#include "core/components_ng/base/view_abstract.h"
+#include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/linear_layout/column_model_ng.h"
+#include "core/components_ng/property/calc_length.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr double VP_SCALE = 3.25;
+constexpr double FP_SCALE = 1.0;
+constexpr double LPX_SCALE = 1.0;
+constexpr double PARENT_LENGTH = 1260.0;
+constexpr int32_t EXPRESSION_COUNT = 3;
+constexpr float CONTAINER_WIDTH = 480.0f;
+constexpr float CONTAINER_HEIGHT = 800.0f;
+constexpr float CHILD_HEIGHT = 40.0f;
+constexpr int32_t MIN_NODE_COUNT = 64;
+constexpr int32_t MAX_NODE_COUNT = 4096;
+constexpr int32_t NODE_COUNT_MULTIPLIER = 4;
+const std::string CHILD_WIDTH = "calc(100% - 2 * 16vp)";
+
+const std::vector<std::string>& GetExpressions()
+{
+    static const std::vector<std::string> expressions = {
+        "calc(100% - 16vp)",
+        "calc((100% - 3 * 12vp) / 4)",
+        "calc(50% + (100% - 2 * 24vp) / 3 - 8px)",
+    };
+    return expressions;
+}
+
+void ReportAllocations(benchmark::State& state, uint64_t allocations)
+{
+    state.SetLabel(GetExpressions()[state.range(0)]);
+    state.counters["allocs"] = benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+// what NormalizeToPx did for a calc length before the expression was compiled, kept here as the baseline.
+void BM_CalcLengthByString(benchmark::State& state)
+{
+    const auto& expression = GetExpressions()[state.range(0)];
+    uint64_t before = LayoutBenchmarkEnv::GetAllocationCount();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(StringExpression::CalculateExp(expression, [](const Dimension& dim) -> double {
+            double result = -1.0;
+            dim.NormalizeToPx(VP_SCALE, FP_SCALE, LPX_SCALE, PARENT_LENGTH, result);
+            return result;
+        }));
+    }
+    ReportAllocations(state, LayoutBenchmarkEnv::GetAllocationCount() - before);
+}
+BENCHMARK(BM_CalcLengthByString)->DenseRange(0, EXPRESSION_COUNT - 1);
+
+void BM_CalcLengthNormalizeToPx(benchmark::State& state)
+{
+    CalcLength calcLength(GetExpressions()[state.range(0)]);
+    uint64_t before = LayoutBenchmarkEnv::GetAllocationCount();
+    for (auto _ : state) {
+        double result = 0.0;
+        benchmark::DoNotOptimize(calcLength.NormalizeToPx(VP_SCALE, FP_SCALE, LPX_SCALE, PARENT_LENGTH, result));
+        benchmark::DoNotOptimize(result);
+    }
+    ReportAllocations(state, LayoutBenchmarkEnv::GetAllocationCount() - before);
+}
+BENCHMARK(BM_CalcLengthNormalizeToPx)->DenseRange(0, EXPRESSION_COUNT - 1);
+
+// the items of the column take the width of a list item with its margins, resizing the column measures all of them.
+void BM_CalcWidthColumnLayout(benchmark::State& state)
+{
+    ColumnModelNG model;
+    model.Create(std::nullopt, nullptr, "");
+    ViewAbstract::SetWidth(CalcLength(CONTAINER_WIDTH));
+    ViewAbstract::SetHeight(CalcLength(CONTAINER_HEIGHT));
+    for (int32_t index = 0; index < state.range(0); ++index) {
+        ColumnModelNG childModel;
+        childModel.Create(std::nullopt, nullptr, "");
+        ViewAbstract::SetWidth(CalcLength(CHILD_WIDTH));
+        ViewAbstract::SetHeight(CalcLength(CHILD_HEIGHT));
+        ViewStackProcessor::GetInstance()->Pop();
+        ViewStackProcessor::GetInstance()->StopGetAccessRecording();
+    }
+    auto frameNode = LayoutBenchmarkEnv::CreateDone();
+    if (!frameNode) {
+        state.SkipWithError("failed to create the column");
+        return;
+    }
+    bool wide = false;
+    LayoutBenchmarkEnv::RunFrames(state, frameNode, [&frameNode, &wide]() {
+        wide = !wide;
+        ViewAbstract::SetWidth(AceType::RawPtr(frameNode), CalcLength(CONTAINER_WIDTH + (wide ? 1.0f : 0.0f)));
+        LayoutBenchmarkEnv::FlushLayout(frameNode);
+    });
+}
+BENCHMARK(BM_CalcWidthColumnLayout)
+    ->RangeMultiplier(NODE_COUNT_MULTIPLIER)
+    ->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)
+    ->Complexity();
+} // namespace
+} // namespace OHOS::Ace::NG
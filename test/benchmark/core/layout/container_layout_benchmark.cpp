@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+#include "benchmark/benchmark.h"
+#include "test/benchmark/core/layout/layout_benchmark_env.h"
+
+#include "core/components/common/layout/position_param.h"
+#include "core/components_ng/base/view_abstract.h"
+#include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/flex/flex_model_ng.h"
+#include "core/components_ng/pattern/linear_layout/column_model_ng.h"
+#include "core/components_ng/pattern/relative_container/relative_container_model_ng.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr float CONTAINER_WIDTH = 480.0f;
+constexpr float CONTAINER_HEIGHT = 800.0f;
+constexpr float CHILD_SIZE = 40.0f;
+constexpr int32_t RELATIVE_COLUMNS = 8;
+constexpr int32_t MIN_NODE_COUNT = 64;
+constexpr int32_t MAX_NODE_COUNT = 4096;
+constexpr int32_t NODE_COUNT_MULTIPLIER = 4;
+const std::string CONTAINER_ID = "__container__";
+
+void CreateChild()
+{
+    ColumnModelNG model;
+    model.Create(std::nullopt, nullptr, "");
+    ViewAbstract::SetWidth(CalcLength(CHILD_SIZE));
+    ViewAbstract::SetHeight(CalcLength(CHILD_SIZE));
+}
+
+void PopChild()
+{
+    ViewStackProcessor::GetInstance()->Pop();
+    ViewStackProcessor::GetInstance()->StopGetAccessRecording();
+}
+
+// Resizes the container by a pixel per iteration, which changes the constraint of every child so that all of them
+// are measured again, as in a window resize or a fold.
+void RunResizeFrames(benchmark::State& state, const RefPtr<FrameNode>& frameNode)
+{
+    if (!frameNode) {
+        state.SkipWithError("failed to create the container");
+        return;
+    }
+    bool wide = false;
+    LayoutBenchmarkEnv::RunFrames(state, frameNode, [&frameNode, &wide]() {
+        wide = !wide;
+        ViewAbstract::SetWidth(AceType::RawPtr(frameNode), CalcLength(CONTAINER_WIDTH + (wide ? 1.0f : 0.0f)));
+        LayoutBenchmarkEnv::FlushLayout(frameNode);
+    });
+}
+
+// the children overflow the row, which takes the layout through its shrink pass.
+void BM_FlexLayout(benchmark::State& state)
+{
+    FlexModelNG model;
+    model.CreateFlexRow();
+    ViewAbstract::SetWidth(CalcLength(CONTAINER_WIDTH));
+    ViewAbstract::SetHeight(CalcLength(CONTAINER_HEIGHT));
+    for (int32_t index = 0; index < state.range(0); ++index) {
+        CreateChild();
+        PopChild();
+    }
+    RunResizeFrames(state, LayoutBenchmarkEnv::CreateDone());
+}
+BENCHMARK(BM_FlexLayout)->RangeMultiplier(NODE_COUNT_MULTIPLIER)->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)->Complexity();
+
+// the children form rows, each of them anchored to the one before it and to the one above it, so that the layout
+// has to order a dependency graph as wide as the tree.
+void BM_RelativeContainerLayout(benchmark::State& state)
+{
+    RelativeContainerModelNG model;
+    model.Create();
+    ViewAbstract::SetWidth(CalcLength(CONTAINER_WIDTH));
+    ViewAbstract::SetHeight(CalcLength(CONTAINER_HEIGHT));
+    for (int32_t index = 0; index < state.range(0); ++index) {
+        CreateChild();
+        ViewAbstract::SetInspectorId("item" + std::to_string(index));
+        std::map<AlignDirection, AlignRule> alignRules;
+        AlignRule horizontalRule;
+        if (index % RELATIVE_COLUMNS == 0) {
+            horizontalRule.anchor = CONTAINER_ID;
+            horizontalRule.horizontal = HorizontalAlign::START;
+        } else {
+            horizontalRule.anchor = "item" + std::to_string(index - 1);
+            horizontalRule.horizontal = HorizontalAlign::END;
+        }
+        alignRules[AlignDirection::LEFT] = horizontalRule;
+        AlignRule verticalRule;
+        if (index < RELATIVE_COLUMNS) {
+            verticalRule.anchor = CONTAINER_ID;
+            verticalRule.vertical = VerticalAlign::TOP;
+        } else {
+            verticalRule.anchor = "item" + std::to_string(index - RELATIVE_COLUMNS);
+            verticalRule.vertical = VerticalAlign::BOTTOM;
+        }
+        alignRules[AlignDirection::TOP] = verticalRule;
+        ViewAbstract::SetAlignRules(alignRules);
+        PopChild();
+    }
+    RunResizeFrames(state, LayoutBenchmarkEnv::CreateDone());
+}
+BENCHMARK(BM_RelativeContainerLayout)
+    ->RangeMultiplier(NODE_COUNT_MULTIPLIER)
+    ->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)
+    ->Complexity();
+} // namespace
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "test/benchmark/core/layout/layout_benchmark_env.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "gmock/gmock.h"
+
+#define private public
+#define protected public
+#include "test/mock/base/mock_task_executor.h"
+#include "test/mock/core/common/mock_container.h"
+#include "test/mock/core/common/mock_theme_manager.h"
+#include "test/mock/core/pipeline/mock_pipeline_context.h"
+#undef private
+#undef protected
+
+#include "base/utils/utils.h"
+#include "core/components/button/button_theme.h"
+#include "core/components/list/list_item_theme.h"
+#include "core/components/list/list_theme.h"
+#include "core/components/swiper/swiper_indicator_theme.h"
+#include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/grid/grid_item_theme.h"
+
+namespace {
+std::atomic<uint64_t> g_allocationCount { 0 };
+} // namespace
+
+// every allocation of the process is counted, the frames read the count before and after they run.
+void* operator new(std::size_t size)
+{
+    g_allocationCount.fetch_add(1, std::memory_order_relaxed);
+    void* ptr = std::malloc(size == 0 ? 1 : size);
+    if (ptr == nullptr) {
+        std::abort();
+    }
+    return ptr;
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /* size */) noexcept
+{
+    std::free(ptr);
+}
+
+namespace OHOS::Ace::NG {
+using namespace testing;
+
+void LayoutBenchmarkEnv::SetUp()
+{
+    MockContainer::SetUp();
+    MockContainer::Current()->taskExecutor_ = AceType::MakeRefPtr<MockTaskExecutor>();
+    MockPipelineContext::SetUp();
+    // there is no gtest context around the benchmarks, so the mocks only get default actions and no expectations.
+    GMOCK_FLAG(verbose) = "error";
+    auto themeManager = AceType::MakeRefPtr<NiceMock<MockThemeManager>>();
+    MockPipelineContext::GetCurrent()->SetThemeManager(themeManager);
+    auto buttonTheme = AceType::MakeRefPtr<ButtonTheme>();
+    ON_CALL(*themeManager, GetTheme(_)).WillByDefault(Return(buttonTheme));
+    // the themes built without constants keep their defaults, which is all the layout algorithms read.
+    ON_CALL(*themeManager, GetTheme(ListTheme::TypeId())).WillByDefault(Return(ListTheme::Builder().Build(nullptr)));
+    ON_CALL(*themeManager, GetTheme(ListItemTheme::TypeId()))
+        .WillByDefault(Return(ListItemTheme::Builder().Build(nullptr)));
+    ON_CALL(*themeManager, GetTheme(GridItemTheme::TypeId()))
+        .WillByDefault(Return(GridItemTheme::Builder().Build(nullptr)));
+    ON_CALL(*themeManager, GetTheme(SwiperIndicatorTheme::TypeId()))
+        .WillByDefault(Return(SwiperIndicatorTheme::Builder().Build(nullptr)));
+}
+
+void LayoutBenchmarkEnv::TearDown()
+{
+    MockPipelineContext::TearDown();
+    MockContainer::TearDown();
+}
+
+RefPtr<FrameNode> LayoutBenchmarkEnv::CreateDone()
+{
+    auto* stack = ViewStackProcessor::GetInstance();
+    while (stack->elementsStack_.size() > 1) {
+        stack->Pop();
+        stack->StopGetAccessRecording();
+    }
+    auto frameNode = AceType::DynamicCast<FrameNode>(stack->Finish());
+    stack->StopGetAccessRecording();
+    CHECK_NULL_RETURN(frameNode, nullptr);
+    frameNode->MarkModifyDone();
+    FlushLayout(frameNode);
+    return frameNode;
+}
+
+void LayoutBenchmarkEnv::FlushLayout(const RefPtr<FrameNode>& frameNode)
+{
+    frameNode->SetActive();
+    frameNode->isLayoutDirtyMarked_ = true;
+    frameNode->CreateLayoutTask();
+}
+
+int32_t LayoutBenchmarkEnv::CountActiveChildren(const RefPtr<FrameNode>& frameNode)
+{
+    int32_t count = 0;
+    for (const auto& child : frameNode->GetChildren()) {
+        auto childNode = AceType::DynamicCast<FrameNode>(child);
+        if (childNode && childNode->IsActive()) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+uint64_t LayoutBenchmarkEnv::GetAllocationCount()
+{
+    return g_allocationCount.load(std::memory_order_relaxed);
+}
+
+void LayoutBenchmarkEnv::RunFrames(
+    benchmark::State& state, const RefPtr<FrameNode>& frameNode, const std::function<void()>& frame)
+{
+    uint64_t allocations = 0;
+    for (auto _ : state) {
+        auto before = GetAllocationCount();
+        frame();
+        allocations += GetAllocationCount() - before;
+    }
+    // the virtualized containers lay out about the same window of children in every frame, counting them once
+    // keeps the count out of the measured time.
+    auto nodes = static_cast<double>(std::max(CountActiveChildren(frameNode), 1));
+    state.SetComplexityN(state.range(0));
+    state.counters["nodes"] = nodes;
+    state.counters["time/node"] = benchmark::Counter(
+        nodes * state.iterations(), benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+    state.counters["allocs/frame"] =
+        benchmark::Counter(static_cast<double>(allocations), benchmark::Counter::kAvgIterations);
+}
+
+} // namespace OHOS::Ace::NG
+
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    OHOS::Ace::NG::LayoutBenchmarkEnv::SetUp();
+    benchmark::RunSpecifiedBenchmarks();
+    OHOS::Ace::NG::LayoutBenchmarkEnv::TearDown();
+    return 0;
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef FOUNDATION_ACE_TEST_BENCHMARK_CORE_LAYOUT_LAYOUT_BENCHMARK_ENV_H
+#define FOUNDATION_ACE_TEST_BENCHMARK_CORE_LAYOUT_LAYOUT_BENCHMARK_ENV_H
+
+#include <cstdint>
+#include <functional>
+
+#include "benchmark/benchmark.h"
+
+#include "base/memory/referenced.h"
+#include "core/components_ng/base/frame_node.h"
+
+namespace OHOS::Ace::NG {
+
+// The headless environment of the layout benchmarks: the mocked container, pipeline and theme manager of the
+// pattern unit tests, with the allocations of the process counted so that a frame can report its own.
+class LayoutBenchmarkEnv {
+public:
+    static void SetUp();
+    static void TearDown();
+
+    // Pops the nodes created by the models and returns the root of the tree, ready for its first layout.
+    static RefPtr<FrameNode> CreateDone();
+    // Measures and lays out the node and its children as the pipeline does in a frame.
+    static void FlushLayout(const RefPtr<FrameNode>& frameNode);
+    static int32_t CountActiveChildren(const RefPtr<FrameNode>& frameNode);
+    static uint64_t GetAllocationCount();
+
+    // Runs one frame per iteration and reports the time per laid out node, the nodes laid out and the allocations
+    // per frame, with the size of the tree as the complexity of the benchmark.
+    static void RunFrames(
+        benchmark::State& state, const RefPtr<FrameNode>& frameNode, const std::function<void()>& frame);
+};
+
+} // namespace OHOS::Ace::NG
+
+#endif // FOUNDATION_ACE_TEST_BENCHMARK_CORE_LAYOUT_LAYOUT_BENCHMARK_ENV_H
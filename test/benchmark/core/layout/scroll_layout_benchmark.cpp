@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <set>
+
+#include "benchmark/benchmark.h"
+#include "test/benchmark/core/layout/layout_benchmark_env.h"
+#include "test/mock/base/mock_system_properties.h"
+
+#include "core/components_ng/base/view_abstract.h"
+#include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/button/button_model_ng.h"
+#include "core/components_ng/pattern/grid/grid_item_model_ng.h"
+#include "core/components_ng/pattern/grid/grid_model_ng.h"
+#include "core/components_ng/pattern/list/list_item_model_ng.h"
+#include "core/components_ng/pattern/list/list_model_ng.h"
+#include "core/components_ng/pattern/scroll_bar/proxy/scroll_bar_proxy.h"
+#include "core/components_ng/pattern/scrollable/scrollable_pattern.h"
+#include "core/components_ng/pattern/swiper/swiper_model_ng.h"
+#include "core/components_ng/pattern/swiper/swiper_pattern.h"
+#include "core/components_ng/pattern/waterflow/water_flow_item_model_ng.h"
+#include "core/components_ng/pattern/waterflow/water_flow_model_ng.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr float VIEWPORT_WIDTH = 480.0f;
+constexpr float VIEWPORT_HEIGHT = 800.0f;
+constexpr float ITEM_HEIGHT = 100.0f;
+constexpr float ITEM_HEIGHT_STEP = 20.0f;
+constexpr int32_t ITEM_HEIGHT_VARIANTS = 4;
+// the distance a fling moves the content in one frame.
+constexpr float FRAME_DELTA = 120.0f;
+constexpr int32_t IRREGULAR_ITEM_INTERVAL = 5;
+constexpr int32_t SWIPER_DISPLAY_COUNT = 2;
+constexpr int32_t MIN_NODE_COUNT = 64;
+constexpr int32_t MAX_NODE_COUNT = 4096;
+constexpr int32_t NODE_COUNT_MULTIPLIER = 4;
+const CalcLength FILL_LENGTH = CalcLength(Dimension(1.0, DimensionUnit::PERCENT));
+
+float GetItemHeight(int32_t index)
+{
+    return ITEM_HEIGHT + static_cast<float>(index % ITEM_HEIGHT_VARIANTS) * ITEM_HEIGHT_STEP;
+}
+
+void PopItem()
+{
+    ViewStackProcessor::GetInstance()->Pop();
+    ViewStackProcessor::GetInstance()->StopGetAccessRecording();
+}
+
+// Scrolls the content by one fling frame per iteration, turning back at either end so that a long run keeps
+// bringing new items into the viewport.
+void RunScrollFrames(benchmark::State& state, const RefPtr<FrameNode>& frameNode)
+{
+    auto pattern = frameNode ? frameNode->GetPattern<ScrollablePattern>() : nullptr;
+    if (!pattern) {
+        state.SkipWithError("failed to create the scrollable node");
+        return;
+    }
+    float delta = -FRAME_DELTA;
+    LayoutBenchmarkEnv::RunFrames(state, frameNode, [&frameNode, &pattern, &delta]() {
+        if ((delta < 0.0f && pattern->IsAtBottom()) || (delta > 0.0f && pattern->IsAtTop())) {
+            delta = -delta;
+        }
+        pattern->UpdateCurrentOffset(delta, SCROLL_FROM_UPDATE);
+        LayoutBenchmarkEnv::FlushLayout(frameNode);
+    });
+}
+
+void BM_ListLayout(benchmark::State& state)
+{
+    ListModelNG model;
+    model.Create();
+    ViewAbstract::SetWidth(CalcLength(VIEWPORT_WIDTH));
+    ViewAbstract::SetHeight(CalcLength(VIEWPORT_HEIGHT));
+    model.SetScroller(model.CreateScrollController(), AceType::MakeRefPtr<ScrollBarProxy>());
+    for (int32_t index = 0; index < state.range(0); ++index) {
+        ListItemModelNG itemModel;
+        itemModel.Create([](int32_t) {}, V2::ListItemStyle::NONE);
+        ViewAbstract::SetWidth(FILL_LENGTH);
+        ViewAbstract::SetHeight(CalcLength(GetItemHeight(index)));
+        PopItem();
+    }
+    RunScrollFrames(state, LayoutBenchmarkEnv::CreateDone());
+}
+BENCHMARK(BM_ListLayout)->RangeMultiplier(NODE_COUNT_MULTIPLIER)->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)->Complexity();
+
+// every fifth item spans two columns, which takes the grid to the irregular layout algorithm.
+void BM_GridIrregularLayout(benchmark::State& state)
+{
+    g_irregularGrid = true;
+    GridModelNG model;
+    model.Create(model.CreatePositionController(), model.CreateScrollBarProxy());
+    ViewAbstract::SetWidth(CalcLength(VIEWPORT_WIDTH));
+    ViewAbstract::SetHeight(CalcLength(VIEWPORT_HEIGHT));
+    model.SetColumnsTemplate("1fr 1fr 1fr");
+    GridLayoutOptions options;
+    for (int32_t index = 0; index < state.range(0); index += IRREGULAR_ITEM_INTERVAL) {
+        options.irregularIndexes.insert(index);
+    }
+    options.getSizeByIndex = [](int32_t /* index */) -> GridItemSize { return { .rows = 1, .columns = 2 }; };
+    model.SetLayoutOptions(options);
+    for (int32_t index = 0; index < state.range(0); ++index) {
+        GridItemModelNG itemModel;
+        itemModel.Create(GridItemStyle::NONE);
+        ViewAbstract::SetHeight(CalcLength(ITEM_HEIGHT));
+        PopItem();
+    }
+    RunScrollFrames(state, LayoutBenchmarkEnv::CreateDone());
+}
+BENCHMARK(BM_GridIrregularLayout)
+    ->RangeMultiplier(NODE_COUNT_MULTIPLIER)
+    ->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)
+    ->Complexity();
+
+void CreateWaterFlow(int32_t itemCount, bool slidingWindow)
+{
+    WaterFlowModelNG model;
+    model.Create();
+    if (slidingWindow) {
+        model.SetLayoutMode(WaterFlowLayoutMode::SLIDING_WINDOW);
+    }
+    ViewAbstract::SetWidth(CalcLength(VIEWPORT_WIDTH));
+    ViewAbstract::SetHeight(CalcLength(VIEWPORT_HEIGHT));
+    model.SetScroller(model.CreateScrollController(), model.CreateScrollBarProxy());
+    model.SetColumnsTemplate("1fr 1fr");
+    for (int32_t index = 0; index < itemCount; ++index) {
+        WaterFlowItemModelNG itemModel;
+        itemModel.Create();
+        ViewAbstract::SetWidth(FILL_LENGTH);
+        ViewAbstract::SetHeight(CalcLength(GetItemHeight(index)));
+        PopItem();
+    }
+}
+
+void BM_WaterFlowTopDownLayout(benchmark::State& state)
+{
+    // the segmented layout replaces the top down one when it is enabled.
+    g_segmentedWaterflow = false;
+    CreateWaterFlow(state.range(0), false);
+    RunScrollFrames(state, LayoutBenchmarkEnv::CreateDone());
+}
+BENCHMARK(BM_WaterFlowTopDownLayout)
+    ->RangeMultiplier(NODE_COUNT_MULTIPLIER)
+    ->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)
+    ->Complexity();
+
+void BM_WaterFlowSlidingWindowLayout(benchmark::State& state)
+{
+    CreateWaterFlow(state.range(0), true);
+    RunScrollFrames(state, LayoutBenchmarkEnv::CreateDone());
+}
+BENCHMARK(BM_WaterFlowSlidingWindowLayout)
+    ->RangeMultiplier(NODE_COUNT_MULTIPLIER)
+    ->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)
+    ->Complexity();
+
+// drags a looping swiper by one frame per iteration, it never reaches an end.
+void BM_SwiperLayout(benchmark::State& state)
+{
+    SwiperModelNG model;
+    model.Create();
+    model.SetIndicatorType(SwiperIndicatorType::DOT);
+    model.SetLoop(true);
+    model.SetDisplayCount(SWIPER_DISPLAY_COUNT);
+    ViewAbstract::SetWidth(CalcLength(VIEWPORT_WIDTH));
+    ViewAbstract::SetHeight(CalcLength(VIEWPORT_HEIGHT));
+    for (int32_t index = 0; index < state.range(0); ++index) {
+        ButtonModelNG::CreateWithLabel("label");
+        PopItem();
+    }
+    auto frameNode = LayoutBenchmarkEnv::CreateDone();
+    auto pattern = frameNode ? frameNode->GetPattern<SwiperPattern>() : nullptr;
+    if (!pattern) {
+        state.SkipWithError("failed to create the swiper");
+        return;
+    }
+    LayoutBenchmarkEnv::RunFrames(state, frameNode, [&frameNode, &pattern]() {
+        pattern->UpdateCurrentOffset(-FRAME_DELTA);
+        LayoutBenchmarkEnv::FlushLayout(frameNode);
+    });
+}
+BENCHMARK(BM_SwiperLayout)->RangeMultiplier(NODE_COUNT_MULTIPLIER)->Range(MIN_NODE_COUNT, MAX_NODE_COUNT)->Complexity();
+} // namespace
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "core/pipeline_ng/dirty_node_queue.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t DIRTY_NODE_COUNT = 10000;
+constexpr int32_t MAX_DEPTH = 32;
+constexpr int32_t PAGE_COUNT = 2;
+constexpr int32_t PRIORITY_INTERVAL = 97;
+
+// carries exactly the fields UITaskScheduler reads from a FrameNode.
+class BenchmarkNode : public Referenced {
+public:
+    BenchmarkNode(int32_t layoutPriority, int32_t pageId, int32_t depth)
+        : layoutPriority_(layoutPriority), pageId_(pageId), depth_(depth)
+    {}
+    ~BenchmarkNode() override = default;
+
+    int32_t GetLayoutPriority() const
+    {
+        return layoutPriority_;
+    }
+
+    int32_t GetPageId() const
+    {
+        return pageId_;
+    }
+
+    int32_t GetDepth() const
+    {
+        return depth_;
+    }
+
+    const void* GetDirtyQueueOwner(DirtyQueueType queueType) const
+    {
+        return dirtyQueueOwners_[queueType];
+    }
+
+    void SetDirtyQueueOwner(DirtyQueueType queueType, const void* owner)
+    {
+        dirtyQueueOwners_[queueType] = owner;
+    }
+
+private:
+    int32_t layoutPriority_ = 0;
+    int32_t pageId_ = 0;
+    int32_t depth_ = 0;
+    const void* dirtyQueueOwners_[DIRTY_QUEUE_TYPE_COUNT] = { nullptr };
+};
+
+struct NodeCompare {
+    bool operator()(const RefPtr<BenchmarkNode>& left, const RefPtr<BenchmarkNode>& right) const
+    {
+        if (left->GetLayoutPriority() != right->GetLayoutPriority()) {
+            return left->GetLayoutPriority() > right->GetLayoutPriority();
+        }
+        if (left->GetPageId() != right->GetPageId()) {
+            return left->GetPageId() < right->GetPageId();
+        }
+        if (left->GetDepth() != right->GetDepth()) {
+            return left->GetDepth() < right->GetDepth();
+        }
+        return left < right;
+    }
+};
+
+std::vector<RefPtr<BenchmarkNode>> CreateNodes(int32_t count)
+{
+    std::vector<RefPtr<BenchmarkNode>> nodes;
+    nodes.reserve(count);
+    for (int32_t i = 0; i < count; ++i) {
+        auto priority = (i % PRIORITY_INTERVAL == 0) ? 1 : 0;
+        nodes.emplace_back(Referenced::MakeRefPtr<BenchmarkNode>(priority, i % PAGE_COUNT, i % MAX_DEPTH));
+    }
+    return nodes;
+}
+
+// the std::list + std::set path UITaskScheduler::FlushLayoutTask used before DirtyNodeQueue.
+void BM_ListAndSetLayoutFlush(benchmark::State& state)
+{
+    auto nodes = CreateNodes(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        std::list<RefPtr<BenchmarkNode>> dirtyNodes;
+        for (const auto& node : nodes) {
+            dirtyNodes.emplace_back(node);
+        }
+        std::set<RefPtr<BenchmarkNode>, NodeCompare> dirtySet(dirtyNodes.begin(), dirtyNodes.end());
+        int64_t visited = 0;
+        for (const auto& node : dirtySet) {
+            visited += node->GetDepth();
+        }
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ListAndSetLayoutFlush)->Arg(DIRTY_NODE_COUNT);
+
+// the page keyed map of sets UITaskScheduler::FlushRenderTask used before DirtyNodeQueue.
+void BM_MapOfSetsRenderFlush(benchmark::State& state)
+{
+    auto nodes = CreateNodes(static_cast<int32_t>(state.range(0)));
+    for (auto _ : state) {
+        std::map<uint32_t, std::set<RefPtr<BenchmarkNode>, NodeCompare>> dirtyNodes;
+        for (const auto& node : nodes) {
+            dirtyNodes[node->GetPageId()].emplace(node);
+        }
+        int64_t visited = 0;
+        for (const auto& pageNodes : dirtyNodes) {
+            for (const auto& node : pageNodes.second) {
+                visited += node->GetDepth();
+            }
+        }
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_MapOfSetsRenderFlush)->Arg(DIRTY_NODE_COUNT);
+
+void RunDirtyNodeQueueFlush(benchmark::State& state, DirtyQueueType queueType, DirtyNodeOrder order)
+{
+    auto nodes = CreateNodes(static_cast<int32_t>(state.range(0)));
+    DirtyNodeQueue<BenchmarkNode> queue(queueType, order);
+    std::vector<RefPtr<BenchmarkNode>> flushNodes;
+    for (auto _ : state) {
+        for (const auto& node : nodes) {
+            queue.Add(node);
+        }
+        // marking a node twice in one frame is common and must stay cheap.
+        for (const auto& node : nodes) {
+            queue.Add(node);
+        }
+        queue.TakeOrdered(flushNodes);
+        int64_t visited = 0;
+        for (const auto& node : flushNodes) {
+            visited += node->GetDepth();
+        }
+        flushNodes.clear();
+        benchmark::DoNotOptimize(visited);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void BM_DirtyNodeQueueLayoutFlush(benchmark::State& state)
+{
+    RunDirtyNodeQueueFlush(state, DIRTY_LAYOUT_QUEUE, DirtyNodeOrder::PRIORITY_FIRST);
+}
+BENCHMARK(BM_DirtyNodeQueueLayoutFlush)->Arg(DIRTY_NODE_COUNT);
+
+void BM_DirtyNodeQueueRenderFlush(benchmark::State& state)
+{
+    RunDirtyNodeQueueFlush(state, DIRTY_RENDER_QUEUE, DirtyNodeOrder::PAGE_FIRST);
+}
+BENCHMARK(BM_DirtyNodeQueueRenderFlush)->Arg(DIRTY_NODE_COUNT);
+} // namespace
+} // namespace OHOS::Ace::NG
+
+BENCHMARK_MAIN();
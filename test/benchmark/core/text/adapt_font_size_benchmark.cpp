@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "test/mock/core/common/mock_container.h"
+#include "test/mock/core/pipeline/mock_pipeline_context.h"
+#include "test/mock/core/render/mock_paragraph.h"
+
+#include "base/memory/referenced.h"
+#include "core/components/common/properties/text_style.h"
+#include "core/components_ng/pattern/text/text_adapt_font_sizer.h"
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr double MAX_FONT_SIZE = 40.0;
+constexpr double MIN_FONT_SIZE = 8.0;
+constexpr double FONT_SIZE_STEP = 1.0;
+constexpr int32_t CASE_COUNT = 64;
+constexpr int32_t WORD_COUNT = 24;
+// adapting to the max font size lays out a single line, the cases have fewer words.
+constexpr int32_t SINGLE_LINE_WORD_COUNT = WORD_COUNT / 4;
+constexpr int32_t MAX_WORD_LENGTH = 9;
+constexpr uint32_t MAX_LINES = 2;
+constexpr float SINGLE_LINE_HEIGHT_SCALE = 1.0f;
+constexpr float HEIGHT_LINES = 1.5f;
+constexpr float LINE_HEIGHT_SCALE = 1.2f;
+constexpr float HINTING_UNITS = 64.0f;
+// the advances of the glyphs in units of the font size, from GLYPH_MIN_ADVANCE in GLYPH_ADVANCE_STEPS steps.
+constexpr float SPACE_ADVANCE = 0.3f;
+constexpr float GLYPH_MIN_ADVANCE = 0.4f;
+constexpr float GLYPH_ADVANCE_STEP = 0.01f;
+constexpr uint32_t GLYPH_ADVANCE_STEPS = 40;
+constexpr float MIN_WIDTH = 60.0f;
+constexpr uint32_t WIDTH_RANGE = 400;
+constexpr uint32_t RANDOM_MULTIPLIER = 1664525;
+constexpr uint32_t RANDOM_INCREMENT = 1013904223;
+constexpr uint32_t RANDOM_SHIFT = 16;
+
+uint32_t NextRandom(uint32_t& seed)
+{
+    seed = seed * RANDOM_MULTIPLIER + RANDOM_INCREMENT;
+    return seed >> RANDOM_SHIFT;
+}
+
+// a paragraph of words shaped per glyph, with advances rounded to the hinting grid as a font engine does. The
+// metrics read by the sizer are served by it, the other methods of the paragraph stay mocked.
+class ShapedParagraph : public MockParagraph {
+    DECLARE_ACE_TYPE(ShapedParagraph, MockParagraph);
+
+public:
+    explicit ShapedParagraph(std::vector<std::vector<float>> words) : words_(std::move(words)) {}
+    ~ShapedParagraph() override = default;
+
+    void SetTextStyle(const TextStyle& textStyle)
+    {
+        fontSize_ = textStyle.GetFontSize().Value();
+        maxLines_ = textStyle.GetMaxLines();
+    }
+
+    void Layout(float width) override
+    {
+        auto space = Advance(SPACE_ADVANCE);
+        size_t lineCount = 0;
+        longestLine_ = 0.0f;
+        intrinsicWidth_ = 0.0f;
+        float lineWidth = 0.0f;
+        for (const auto& word : words_) {
+            float wordWidth = 0.0f;
+            for (auto glyph : word) {
+                wordWidth += Advance(glyph);
+            }
+            intrinsicWidth_ += (intrinsicWidth_ > 0.0f ? space : 0.0f) + wordWidth;
+            if (lineCount == 0 || lineWidth + space + wordWidth > width) {
+                ++lineCount;
+                longestLine_ = std::max(longestLine_, lineWidth);
+                lineWidth = wordWidth;
+            } else {
+                lineWidth += space + wordWidth;
+            }
+        }
+        longestLine_ = std::max(longestLine_, lineWidth);
+        exceedMaxLines_ = lineCount > maxLines_;
+        lineCount_ = std::min<size_t>(lineCount, maxLines_);
+        height_ = std::ceil(static_cast<float>(fontSize_) * LINE_HEIGHT_SCALE) * lineCount_;
+        ++layoutCount_;
+    }
+
+    float GetHeight() override
+    {
+        return height_;
+    }
+
+    size_t GetLineCount() override
+    {
+        return lineCount_;
+    }
+
+    float GetMaxIntrinsicWidth() override
+    {
+        return intrinsicWidth_;
+    }
+
+    bool DidExceedMaxLines() override
+    {
+        return exceedMaxLines_;
+    }
+
+    float GetLongestLine() override
+    {
+        return longestLine_;
+    }
+
+    int64_t GetLayoutCount() const
+    {
+        return layoutCount_;
+    }
+
+private:
+    float Advance(float glyph) const
+    {
+        return std::round(static_cast<float>(fontSize_) * glyph * HINTING_UNITS) / HINTING_UNITS;
+    }
+
+    std::vector<std::vector<float>> words_;
+    double fontSize_ = 0.0;
+    uint32_t maxLines_ = std::numeric_limits<uint32_t>::max();
+    size_t lineCount_ = 0;
+    float longestLine_ = 0.0f;
+    float intrinsicWidth_ = 0.0f;
+    float height_ = 0.0f;
+    bool exceedMaxLines_ = false;
+    int64_t layoutCount_ = 0;
+};
+
+// the sizer of the text layout algorithm, which lays out the shaped paragraph of the case at each size it tries.
+class ShapedTextAdaptFontSizer : public TextAdaptFontSizer {
+    DECLARE_ACE_TYPE(ShapedTextAdaptFontSizer, TextAdaptFontSizer);
+
+public:
+    explicit ShapedTextAdaptFontSizer(const RefPtr<ShapedParagraph>& paragraph) : paragraph_(paragraph) {}
+    ~ShapedTextAdaptFontSizer() override = default;
+
+    bool CreateParagraphAndLayout(const TextStyle& textStyle, const std::string& content,
+        const LayoutConstraintF& contentConstraint, LayoutWrapper* layoutWrapper, bool needLayout = true) override
+    {
+        paragraph_->SetTextStyle(textStyle);
+        if (needLayout) {
+            paragraph_->Layout(contentConstraint.maxSize.Width());
+        }
+        return true;
+    }
+
+    RefPtr<Paragraph> GetParagraph() const override
+    {
+        return paragraph_;
+    }
+
+    void GetSuitableSize(SizeF& maxSize, LayoutWrapper* layoutWrapper) override {}
+
+    int64_t GetLayoutCount() const
+    {
+        return paragraph_->GetLayoutCount();
+    }
+
+    // the binary search over every step that AdaptMaxFontSize ran before it predicted the size, as the baseline.
+    bool AdaptMaxFontSizeByStep(TextStyle& textStyle, const std::string& content, const Dimension& stepUnit,
+        const LayoutConstraintF& contentConstraint)
+    {
+        double maxFontSize = 0.0;
+        double minFontSize = 0.0;
+        double stepSize = 0.0;
+        if (!GetAdaptMaxMinFontSize(textStyle, maxFontSize, minFontSize, contentConstraint) ||
+            !GetAdaptFontSizeStep(textStyle, stepSize, stepUnit, contentConstraint)) {
+            return false;
+        }
+        auto maxSize = GetMaxMeasureSize(contentConstraint);
+        textStyle.SetFontSize(Dimension(minFontSize));
+        CreateParagraphAndLayout(textStyle, content, contentConstraint, nullptr);
+        if (IsExceedLimitByStep(maxSize)) {
+            return true;
+        }
+        auto tag = static_cast<int32_t>((maxFontSize - minFontSize) / stepSize);
+        auto length = tag + 1 + (GreatNotEqual(maxFontSize, minFontSize + stepSize * tag) ? 1 : 0);
+        int32_t left = 0;
+        int32_t right = length - 1;
+        while (left <= right) {
+            int32_t mid = left + (right - left) / 2;
+            auto fontSize = (mid == length - 1) ? maxFontSize : (minFontSize + stepSize * mid);
+            textStyle.SetFontSize(Dimension(fontSize));
+            CreateParagraphAndLayout(textStyle, content, contentConstraint, nullptr);
+            if (!IsExceedLimitByStep(maxSize)) {
+                left = mid + 1;
+            } else {
+                right = mid - 1;
+            }
+        }
+        auto fontSize = (left - 1 == length - 1) ? maxFontSize : (minFontSize + stepSize * (left - 1));
+        textStyle.SetFontSize(Dimension(std::clamp(fontSize, minFontSize, maxFontSize)));
+        return CreateParagraphAndLayout(textStyle, content, contentConstraint, nullptr);
+    }
+
+    // the step down from the max size that AdaptMinFontSize ran before it predicted the size, as the baseline.
+    bool AdaptMinFontSizeByStep(TextStyle& textStyle, const std::string& content, const Dimension& stepUnit,
+        const LayoutConstraintF& contentConstraint)
+    {
+        double maxFontSize = 0.0;
+        double minFontSize = 0.0;
+        double stepSize = 0.0;
+        if (!GetAdaptMaxMinFontSize(textStyle, maxFontSize, minFontSize, contentConstraint) ||
+            !GetAdaptFontSizeStep(textStyle, stepSize, stepUnit, contentConstraint)) {
+            return false;
+        }
+        auto maxSize = GetMaxMeasureSize(contentConstraint);
+        while (GreatOrEqual(maxFontSize, minFontSize)) {
+            textStyle.SetFontSize(Dimension(maxFontSize));
+            CreateParagraphAndLayout(textStyle, content, contentConstraint, nullptr);
+            if (!DidExceedMaxLines(maxSize)) {
+                break;
+            }
+            maxFontSize -= stepSize;
+        }
+        return true;
+    }
+
+private:
+    bool IsExceedLimitByStep(const SizeF& maxSize) const
+    {
+        return paragraph_->GetLineCount() > 1 || paragraph_->DidExceedMaxLines() ||
+               GreatNotEqual(paragraph_->GetLongestLine(), maxSize.Width());
+    }
+
+    RefPtr<ShapedParagraph> paragraph_;
+};
+
+struct AdaptCase {
+    RefPtr<ShapedTextAdaptFontSizer> sizer;
+    LayoutConstraintF contentConstraint;
+};
+
+std::vector<AdaptCase> CreateCases(int32_t wordCount, float heightScale)
+{
+    std::vector<AdaptCase> cases;
+    uint32_t seed = 1;
+    for (int32_t i = 0; i < CASE_COUNT; ++i) {
+        std::vector<std::vector<float>> words;
+        auto count = 1 + static_cast<int32_t>(NextRandom(seed) % wordCount);
+        for (int32_t j = 0; j < count; ++j) {
+            std::vector<float> word(1 + NextRandom(seed) % MAX_WORD_LENGTH);
+            for (auto& glyph : word) {
+                glyph = GLYPH_MIN_ADVANCE + (NextRandom(seed) % GLYPH_ADVANCE_STEPS) * GLYPH_ADVANCE_STEP;
+            }
+            words.emplace_back(std::move(word));
+        }
+        LayoutConstraintF contentConstraint;
+        contentConstraint.maxSize =
+            SizeF(MIN_WIDTH + NextRandom(seed) % WIDTH_RANGE, static_cast<float>(MAX_FONT_SIZE) * heightScale);
+        auto paragraph = AceType::MakeRefPtr<ShapedParagraph>(std::move(words));
+        cases.push_back({ AceType::MakeRefPtr<ShapedTextAdaptFontSizer>(paragraph), contentConstraint });
+    }
+    return cases;
+}
+
+TextStyle CreateTextStyle(uint32_t maxLines)
+{
+    TextStyle textStyle;
+    textStyle.SetAdaptMaxFontSize(Dimension(MAX_FONT_SIZE, DimensionUnit::PX));
+    textStyle.SetAdaptMinFontSize(Dimension(MIN_FONT_SIZE, DimensionUnit::PX));
+    textStyle.SetMaxLines(maxLines);
+    return textStyle;
+}
+
+// runs the sizer over every case per iteration, and reports the layouts of the paragraph it takes per case.
+template<typename Adapt>
+void RunAdapt(benchmark::State& state, std::vector<AdaptCase>& cases, uint32_t maxLines, Adapt&& adapt)
+{
+    const std::string content;
+    const Dimension stepUnit(FONT_SIZE_STEP, DimensionUnit::PX);
+    int64_t layoutCount = 0;
+    for (auto _ : state) {
+        for (auto& adaptCase : cases) {
+            auto textStyle = CreateTextStyle(maxLines);
+            auto before = adaptCase.sizer->GetLayoutCount();
+            if (!adapt(*adaptCase.sizer, textStyle, content, stepUnit, adaptCase.contentConstraint)) {
+                state.SkipWithError("failed to adapt the font size");
+                return;
+            }
+            layoutCount += adaptCase.sizer->GetLayoutCount() - before;
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * CASE_COUNT);
+    state.counters["probes"] = benchmark::Counter(
+        static_cast<double>(layoutCount) / CASE_COUNT, benchmark::Counter::kAvgIterations);
+}
+
+bool AdaptMax(TextAdaptFontSizer& sizer, TextStyle& textStyle, const std::string& content, const Dimension& stepUnit,
+    const LayoutConstraintF& contentConstraint)
+{
+    return sizer.AdaptMaxFontSize(textStyle, content, stepUnit, contentConstraint, nullptr);
+}
+
+bool AdaptMin(TextAdaptFontSizer& sizer, TextStyle& textStyle, const std::string& content, const Dimension& stepUnit,
+    const LayoutConstraintF& contentConstraint)
+{
+    return sizer.AdaptMinFontSize(textStyle, content, stepUnit, contentConstraint, nullptr);
+}
+
+bool AdaptMaxByStep(ShapedTextAdaptFontSizer& sizer, TextStyle& textStyle, const std::string& content,
+    const Dimension& stepUnit, const LayoutConstraintF& contentConstraint)
+{
+    return sizer.AdaptMaxFontSizeByStep(textStyle, content, stepUnit, contentConstraint);
+}
+
+bool AdaptMinByStep(ShapedTextAdaptFontSizer& sizer, TextStyle& textStyle, const std::string& content,
+    const Dimension& stepUnit, const LayoutConstraintF& contentConstraint)
+{
+    return sizer.AdaptMinFontSizeByStep(textStyle, content, stepUnit, contentConstraint);
+}
+
+// each case runs with the shipped sizer and with the step by step loop it replaced, on the same cases.
+void BM_AdaptMaxFontSize(benchmark::State& state)
+{
+    auto cases = CreateCases(SINGLE_LINE_WORD_COUNT, SINGLE_LINE_HEIGHT_SCALE);
+    RunAdapt(state, cases, MAX_LINES, AdaptMax);
+}
+BENCHMARK(BM_AdaptMaxFontSize);
+
+void BM_AdaptMaxFontSizeByStep(benchmark::State& state)
+{
+    auto cases = CreateCases(SINGLE_LINE_WORD_COUNT, SINGLE_LINE_HEIGHT_SCALE);
+    RunAdapt(state, cases, MAX_LINES, AdaptMaxByStep);
+}
+BENCHMARK(BM_AdaptMaxFontSizeByStep);
+
+// the number of lines limits the size.
+void BM_AdaptMinFontSize(benchmark::State& state)
+{
+    auto cases = CreateCases(WORD_COUNT, std::numeric_limits<float>::infinity());
+    RunAdapt(state, cases, MAX_LINES, AdaptMin);
+}
+BENCHMARK(BM_AdaptMinFontSize);
+
+void BM_AdaptMinFontSizeByStep(benchmark::State& state)
+{
+    auto cases = CreateCases(WORD_COUNT, std::numeric_limits<float>::infinity());
+    RunAdapt(state, cases, MAX_LINES, AdaptMinByStep);
+}
+BENCHMARK(BM_AdaptMinFontSizeByStep);
+
+// the height of one and a half lines at the max size limits the size.
+void BM_AdaptMinFontSizeByHeight(benchmark::State& state)
+{
+    auto cases = CreateCases(WORD_COUNT, HEIGHT_LINES * LINE_HEIGHT_SCALE);
+    RunAdapt(state, cases, MAX_LINES, AdaptMin);
+}
+BENCHMARK(BM_AdaptMinFontSizeByHeight);
+
+void BM_AdaptMinFontSizeByHeightByStep(benchmark::State& state)
+{
+    auto cases = CreateCases(WORD_COUNT, HEIGHT_LINES * LINE_HEIGHT_SCALE);
+    RunAdapt(state, cases, MAX_LINES, AdaptMinByStep);
+}
+BENCHMARK(BM_AdaptMinFontSizeByHeightByStep);
+} // namespace
+} // namespace OHOS::Ace::NG
+
+// the sizer reads the scales of the current pipeline.
+int main(int argc, char** argv)
+{
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    OHOS::Ace::MockContainer::SetUp();
+    OHOS::Ace::NG::MockPipelineContext::SetUp();
+    benchmark::RunSpecifiedBenchmarks();
+    OHOS::Ace::NG::MockPipelineContext::TearDown();
+    OHOS::Ace::MockContainer::TearDown();
+    return 0;
+}
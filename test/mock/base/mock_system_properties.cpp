@@ -70,6 +70,11 @@ float SystemProperties::dragStartDampingRatio_ = 0.2f;
 float SystemProperties::dragStartPanDisThreshold_ = 10.0f;
 std::pair<float, float> SystemProperties::brightUpPercent_ = {};
 int32_t SystemProperties::imageFileCacheConvertAstcThreshold_ = 3;
+bool SystemProperties::imageFileCachePackEnabled_ = false;
+int32_t SystemProperties::imageDecodedCacheSize_ = 100;
+int32_t SystemProperties::imageObjectCacheSize_ = 100;
+bool SystemProperties::textParagraphCacheEnabled_ = false;
+bool SystemProperties::svgDomCacheEnabled_ = true;
 
 bool g_irregularGrid = true;
 bool g_segmentedWaterflow = true;
@@ -156,6 +161,11 @@ bool SystemProperties::GetGridIrregularLayoutEnabled()
     return g_irregularGrid;
 }
 
+bool SystemProperties::GetParallelLayoutEnabled()
+{
+    return false;
+}
+
 bool SystemProperties::WaterFlowUseSegmentedLayout()
 {
     return g_segmentedWaterflow;
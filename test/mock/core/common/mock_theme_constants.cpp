@@ -32,6 +32,14 @@ const ResValueWrapper* ThemeConstants::GetPlatformConstants(uint32_t key)
     return nullptr;
 }
 
+void ThemeConstants::UpdateThemeConstants(const std::string& bundleName, const std::string& moduleName)
+{
+}
+
+void ThemeConstants::ClearResolvedValues()
+{
+}
+
 Color ThemeConstants::GetColor(uint32_t key) const
 {
     return Color::RED;
@@ -17,7 +17,7 @@
 #include "core/image/image_file_cache.h"
 
 namespace OHOS::Ace {
-void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image) {}
+void ImageCache::CacheImage(const std::string& key, const std::shared_ptr<CachedImage>& image, size_t imageSize) {}
 
 RefPtr<NG::ImageObject> ImageCache::GetCacheImgObjNG(const std::string& key)
 {
@@ -86,6 +86,11 @@ void ImageLoadingContext::CallbackAfterMeasureIfNeed() {}
 
 void ImageLoadingContext::LoadImageData() {}
 
+void ImageLoadingContext::SetLoadPriority(ImageLoadPriority loadPriority)
+{
+    loadPriority_ = loadPriority;
+}
+
 bool ImageLoadingContext::MakeCanvasImageIfNeed(const SizeF& dstSize, bool incomingNeedResize,
     ImageFit incomingImageFit, const std::optional<SizeF>& sourceSize, bool hasValidSlice)
 {
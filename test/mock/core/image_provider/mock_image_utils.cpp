@@ -33,14 +33,15 @@ void ImageUtils::PostToUI(
     }
 }
 
-void ImageUtils::PostToBg(
+bool ImageUtils::PostToBg(
     std::function<void()>&& task, const std::string& name, const int32_t containerId, PriorityType priorityType)
 {
     // mock bg thread pool
     if (g_threads.size() > MAX_THREADS) {
-        return;
+        return false;
     }
     g_threads.emplace_back(std::thread(task));
+    return true;
 }
 } // namespace NG
 } // namespace OHOS::Ace
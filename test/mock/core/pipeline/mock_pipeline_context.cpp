@@ -411,6 +411,8 @@ void PipelineContext::AddBuildFinishCallBack(std::function<void()>&& callback)
 
 void PipelineContext::AddPredictTask(PredictTask&& task) {}
 
+void PipelineContext::AddIdleTask(IdleTask&& task, IdleTaskPriority priority, const std::string& tag, int32_t id) {}
+
 void PipelineContext::AddAfterLayoutTask(std::function<void()>&& task, bool isFlushInImplicitAnimationTask)
 {
     if (task) {
@@ -1100,6 +1100,102 @@ HWTEST_F(BaseUtilsTest, BaseUtilsTest064, TestSize.Level1)
     EXPECT_TRUE(IsUTF8(allByteValues));
 }
 
+/**
+ * @tc.name: BaseUtilsTest065
+ * @tc.desc: Convert texts of ASCII, CJK and emoji between UTF-8 and UTF-16
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest065, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. convert texts longer than the blocks of the fast paths, with the multibyte ones among them.
+     * @tc.expected: the texts convert to each other and their sizes are computed ahead.
+     */
+    std::vector<std::pair<std::string, std::u16string>> texts = {
+        { "", u"" },
+        { "THIS IS A STRING LONGER THAN A BLOCK", u"THIS IS A STRING LONGER THAN A BLOCK" },
+        { "文本输入框中的富文本编辑器", u"文本输入框中的富文本编辑器" },
+        { "emoji 😀👍🏽 in the text of a span, é", u"emoji 😀👍🏽 in the text of a span, é" },
+        { "ArkUI 文本 0123456789 abcdefghijklmnop 😀", u"ArkUI 文本 0123456789 abcdefghijklmnop 😀" },
+    };
+    for (const auto& [utf8, utf16] : texts) {
+        EXPECT_EQ(Utf8ToUtf16Size(utf8.data(), utf8.size()), utf16.size());
+        EXPECT_EQ(Utf16ToUtf8Size(utf16.data(), utf16.size()), utf8.size());
+        EXPECT_EQ(StringUtils::Str8ToStr16(utf8), utf16);
+        EXPECT_EQ(StringUtils::Str16ToStr8(utf16), utf8);
+    }
+}
+
+/**
+ * @tc.name: BaseUtilsTest066
+ * @tc.desc: Convert ill-formed texts between UTF-8 and UTF-16
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest066, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. convert UTF-8 with a truncated sequence, a surrogate, an overlong form and a code point above
+     *                   0x10ffff.
+     * @tc.expected: the conversion fails, or gives a replacement character for each maximal ill-formed subpart.
+     */
+    std::vector<std::pair<std::string, std::u16string>> utf8Texts = {
+        { "a\xF0\x9F\x98" "b", u"a�b" },
+        { "\xED\xA0\x80", u"���" },
+        { "\xC0\xAF", u"��" },
+        { "\xF4\x90\x80\x80", u"����" },
+        { "\xE6\x96", u"�" },
+    };
+    for (const auto& [utf8, replaced] : utf8Texts) {
+        EXPECT_EQ(Utf8ToUtf16Size(utf8.data(), utf8.size()), UTF_CONVERT_FAILED);
+        EXPECT_EQ(StringUtils::Str8ToStr16(utf8), u"");
+        std::u16string utf16;
+        EXPECT_TRUE(Utf8ToUtf16(utf8, utf16, InvalidUtfPolicy::REPLACE));
+        EXPECT_EQ(utf16, replaced);
+    }
+
+    /**
+     * @tc.steps: step2. convert UTF-16 with lone surrogates.
+     * @tc.expected: the conversion fails, or gives a replacement character for each of them.
+     */
+    const std::u16string utf16 = { u'a', 0xdc00, 0xd83d, u'b', 0xd83d };
+    EXPECT_EQ(Utf16ToUtf8Size(utf16.data(), utf16.size()), UTF_CONVERT_FAILED);
+    EXPECT_EQ(StringUtils::Str16ToStr8(utf16), "");
+    std::string utf8;
+    EXPECT_TRUE(Utf16ToUtf8(utf16, utf8, InvalidUtfPolicy::REPLACE));
+    EXPECT_EQ(utf8, "a\xEF\xBF\xBD\xEF\xBF\xBD" "b\xEF\xBF\xBD");
+}
+
+/**
+ * @tc.name: BaseUtilsTest067
+ * @tc.desc: Convert texts into buffers between UTF-8 and UTF-16
+ * @tc.type: FUNC
+ */
+HWTEST_F(BaseUtilsTest, BaseUtilsTest067, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. convert a text into a buffer one code unit short, then into one of its size.
+     * @tc.expected: the short buffer fails the conversion, the other one takes the text.
+     */
+    const std::string utf8 = "文本 text 😀";
+    const std::u16string utf16 = u"文本 text 😀";
+    std::vector<char16_t> utf16Buffer(utf16.size());
+    EXPECT_EQ(ConvertUtf8ToUtf16(utf8.data(), utf8.size(), utf16Buffer.data(), utf16.size() - 1), UTF_CONVERT_FAILED);
+    EXPECT_EQ(ConvertUtf8ToUtf16(utf8.data(), utf8.size(), utf16Buffer.data(), utf16.size()), utf16.size());
+    EXPECT_EQ(std::u16string(utf16Buffer.begin(), utf16Buffer.end()), utf16);
+
+    std::vector<char> utf8Buffer(utf8.size());
+    EXPECT_EQ(ConvertUtf16ToUtf8(utf16.data(), utf16.size(), utf8Buffer.data(), utf8.size() - 1), UTF_CONVERT_FAILED);
+    EXPECT_EQ(ConvertUtf16ToUtf8(utf16.data(), utf16.size(), utf8Buffer.data(), utf8.size()), utf8.size());
+    EXPECT_EQ(std::string(utf8Buffer.begin(), utf8Buffer.end()), utf8);
+
+    /**
+     * @tc.steps: step2. convert null texts.
+     * @tc.expected: an empty one converts to nothing, one with a length fails.
+     */
+    EXPECT_EQ(ConvertUtf8ToUtf16(nullptr, 0, nullptr, 0), 0);
+    EXPECT_EQ(ConvertUtf16ToUtf8(nullptr, 1, utf8Buffer.data(), utf8.size()), UTF_CONVERT_FAILED);
+}
+
 /**
  * @tc.name: StringExpressionTest001
  * @tc.desc: InitMapping()
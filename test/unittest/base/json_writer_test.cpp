@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "base/json/json_util.h"
+#include "base/json/json_writer.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+const char TEST_KEY[] = "key";
+const std::string ESCAPED_STRING = "a\"b\\c\b\f\n\r\t\x01/\xe4\xb8\xad";
+constexpr int32_t LARGE_STRING_SIZE = 4096;
+} // namespace
+
+class JsonWriterTest : public testing::Test {};
+
+/**
+ * @tc.name: JsonWriterTest001
+ * @tc.desc: Check the writer writes members and values in the format of JsonValue::ToString
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonWriterTest, JsonWriterTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. build the same object with JsonValue and JsonWriter.
+     */
+    auto json = JsonUtil::Create(true);
+    json->Put("string", ESCAPED_STRING.c_str());
+    json->Put("int", -7);
+    json->Put("size", static_cast<size_t>(3000000000));
+    json->Put("int64", static_cast<int64_t>(1) << 40);
+    json->Put("double", 0.1);
+    json->Put("third", 1.0 / 3);
+    json->Put("bool", true);
+    auto array = JsonUtil::CreateArray(true);
+    array->Put(JsonUtil::ParseJsonString("{\"a\":[1,2.5,false,null]}"));
+    json->Put("array", array);
+
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put("string", ESCAPED_STRING.c_str());
+    writer.Put("int", -7);
+    writer.Put("size", static_cast<size_t>(3000000000));
+    writer.Put("int64", static_cast<int64_t>(1) << 40);
+    writer.Put("double", 0.1);
+    writer.Put("third", 1.0 / 3);
+    writer.Put("bool", true);
+    writer.Key("array");
+    writer.StartArray();
+    writer.Value(JsonUtil::ParseJsonString("{\"a\":[1,2.5,false,null]}"));
+    writer.EndArray();
+    writer.EndObject();
+
+    /**
+     * @tc.steps: step2. compare the output.
+     * @tc.expected: the writer output equals the serialized JsonValue and parses back.
+     */
+    EXPECT_EQ(writer.GetString(), json->ToString());
+    auto parsed = JsonUtil::ParseJsonString(writer.GetString());
+    ASSERT_TRUE(parsed->IsObject());
+    EXPECT_EQ(parsed->GetString("string"), ESCAPED_STRING);
+    EXPECT_EQ(parsed->GetInt("int"), -7);
+}
+
+/**
+ * @tc.name: JsonWriterTest002
+ * @tc.desc: Check the writer separates values in nested containers
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonWriterTest, JsonWriterTest002, TestSize.Level1)
+{
+    JsonWriter writer;
+    writer.StartArray();
+    writer.Int(1);
+    writer.StartObject();
+    writer.EndObject();
+    writer.StartArray();
+    writer.String("a");
+    writer.Null();
+    writer.EndArray();
+    writer.Double(std::numeric_limits<double>::quiet_NaN());
+    writer.Bool(false);
+    writer.EndArray();
+    EXPECT_EQ(writer.GetString(), "[1,{},[\"a\",null],null,false]");
+}
+
+/**
+ * @tc.name: JsonWriterTest003
+ * @tc.desc: Check Rollback drops the members written after the mark
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonWriterTest, JsonWriterTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. write an empty array member, then roll it back.
+     * @tc.expected: the member is dropped and the next member is separated correctly.
+     */
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put("first", 1);
+    auto mark = writer.GetMark();
+    writer.Key("children");
+    writer.StartArray();
+    writer.EndArray();
+    writer.Rollback(mark);
+    writer.Put("last", 2);
+    writer.EndObject();
+    EXPECT_EQ(writer.GetString(), "{\"first\":1,\"last\":2}");
+
+    /**
+     * @tc.steps: step2. roll back to a mark taken before the first member of an object.
+     * @tc.expected: the next member is written without a separator.
+     */
+    writer.Clear();
+    writer.StartObject();
+    mark = writer.GetMark();
+    writer.Put("dropped", true);
+    writer.Rollback(mark);
+    writer.Put(TEST_KEY, false);
+    writer.EndObject();
+    EXPECT_EQ(writer.GetString(), "{\"key\":false}");
+}
+
+/**
+ * @tc.name: JsonWriterTest004
+ * @tc.desc: Check the writer skips empty values and prints large cJSON trees
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonWriterTest, JsonWriterTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. put an empty value.
+     * @tc.expected: neither the key nor the value is written.
+     */
+    JsonWriter writer;
+    writer.StartObject();
+    std::unique_ptr<JsonValue> empty;
+    EXPECT_FALSE(writer.Put(TEST_KEY, empty));
+    EXPECT_FALSE(writer.Put(TEST_KEY, std::make_unique<JsonValue>()));
+
+    /**
+     * @tc.steps: step2. put a value larger than the first print buffer.
+     * @tc.expected: the value is printed completely.
+     */
+    auto json = JsonUtil::Create(true);
+    json->Put(TEST_KEY, std::string(LARGE_STRING_SIZE, 'x').c_str());
+    EXPECT_TRUE(writer.Put(TEST_KEY, json));
+    writer.EndObject();
+    EXPECT_EQ(writer.GetString(), "{\"key\":" + json->ToString() + "}");
+
+    /**
+     * @tc.steps: step3. release the written json.
+     * @tc.expected: the writer is empty and can be reused.
+     */
+    auto result = writer.ReleaseString();
+    EXPECT_FALSE(result.empty());
+    EXPECT_EQ(writer.GetSize(), static_cast<size_t>(0));
+    writer.StartObject();
+    writer.EndObject();
+    EXPECT_EQ(writer.GetString(), "{}");
+}
+
+/**
+ * @tc.name: JsonWriterTest005
+ * @tc.desc: Check ReopenObject appends members to the object written last
+ * @tc.type: FUNC
+ */
+HWTEST_F(JsonWriterTest, JsonWriterTest005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. reopen a closed object and an empty object.
+     * @tc.expected: the new members are appended with the right separators.
+     */
+    JsonWriter writer;
+    writer.StartObject();
+    writer.Put("first", 1);
+    writer.EndObject();
+    EXPECT_TRUE(writer.ReopenObject());
+    writer.Put("last", 2);
+    writer.EndObject();
+    EXPECT_EQ(writer.GetString(), "{\"first\":1,\"last\":2}");
+    writer.Clear();
+    writer.StartObject();
+    writer.EndObject();
+    EXPECT_TRUE(writer.ReopenObject());
+    writer.Put(TEST_KEY, true);
+    writer.EndObject();
+    EXPECT_EQ(writer.GetString(), "{\"key\":true}");
+
+    /**
+     * @tc.steps: step2. reopen when the last value is not an object.
+     * @tc.expected: ReopenObject fails and writes nothing.
+     */
+    writer.Clear();
+    EXPECT_FALSE(writer.ReopenObject());
+    writer.StartArray();
+    writer.EndArray();
+    EXPECT_FALSE(writer.ReopenObject());
+    EXPECT_EQ(writer.GetString(), "[]");
+}
+} // namespace OHOS::Ace
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <array>
+
 #include "gtest/gtest.h"
 
 #include "base/geometry/least_square_impl.h"
@@ -28,6 +30,18 @@ const int32_t PARAMS_NUM1 = 1;
 const int32_t PARAMS_NUM2 = 2;
 const int32_t PARAMS_NUM3 = 3;
 const int32_t PARAMS_NUM4 = 4;
+const int32_t COUNT_NUM = 5;
+const double START_TIME = 1000.0;
+const double SAMPLE_INTERVAL = 1.0 / 240.0;
+const double PARAM_A = 600.0;
+const double PARAM_B = -40.0;
+const double PARAM_C = 3.0;
+const double ERROR_LIMIT = 1e-3;
+
+double GetCurveValue(double x)
+{
+    return PARAM_A * x * x + PARAM_B * x + PARAM_C;
+}
 } // namespace
 
 class LeastSquareImplTest : public testing::Test {};
@@ -67,4 +81,44 @@ HWTEST_F(LeastSquareImplTest, LeastSquareImplTest001, TestSize.Level1)
     // In the second call, the function is not calculated and returns directly.
     EXPECT_TRUE(leastSquareImpl4.GetLeastSquareParams(params));
 }
+
+/**
+ * @tc.name: LeastSquareImplTest002
+ * @tc.desc: Test fitting the last points kept in the ring buffer.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LeastSquareImplTest, LeastSquareImplTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. update more points than the buffer keeps, the last ones on a quadratic far from the origin.
+     * @tc.expected: the buffer keeps the last points and the fit finds the quadratic.
+     */
+    LeastSquareImpl leastSquareImpl(PARAMS_NUM3, COUNT_NUM);
+    auto pointNum = LeastSquareImpl::MAX_COUNT_NUM + COUNT_NUM;
+    for (auto i = 0; i < pointNum; i++) {
+        auto x = START_TIME + i * SAMPLE_INTERVAL;
+        auto y = i < LeastSquareImpl::MAX_COUNT_NUM ? 0.0 : GetCurveValue(x - START_TIME);
+        leastSquareImpl.UpdatePoint(x, y);
+    }
+    EXPECT_EQ(leastSquareImpl.GetTrackNum(), pointNum);
+    ASSERT_EQ(leastSquareImpl.GetPointNum(), LeastSquareImpl::MAX_COUNT_NUM);
+    auto lastX = START_TIME + (pointNum - 1) * SAMPLE_INTERVAL;
+    EXPECT_DOUBLE_EQ(leastSquareImpl.GetXVal(LeastSquareImpl::MAX_COUNT_NUM - 1), lastX);
+    std::array<double, LeastSquareImpl::MAX_PARAMS_NUM> params {};
+    ASSERT_TRUE(leastSquareImpl.GetLeastSquareParams(params));
+    auto velocity = 2 * params[0] * lastX + params[1];
+    EXPECT_NEAR(params[0], PARAM_A, ERROR_LIMIT);
+    EXPECT_NEAR(velocity, 2 * PARAM_A * (lastX - START_TIME) + PARAM_B, ERROR_LIMIT);
+    EXPECT_EQ(params[PARAMS_NUM3], 0.0);
+
+    /**
+     * @tc.steps: step2. reset and update one point.
+     * @tc.expected: no point is kept before it and there is no fit.
+     */
+    leastSquareImpl.Reset();
+    leastSquareImpl.UpdatePoint(NUM_D1, NUM_D2);
+    EXPECT_EQ(leastSquareImpl.GetPointNum(), 1);
+    EXPECT_DOUBLE_EQ(leastSquareImpl.GetYVal(0), NUM_D2);
+    EXPECT_FALSE(leastSquareImpl.GetLeastSquareParams(params));
+}
 } // namespace OHOS::Ace
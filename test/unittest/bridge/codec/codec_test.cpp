@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "frameworks/bridge/codec/standard_codec_buffer_operator.h"
+#include "frameworks/bridge/codec/standard_function_codec.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::Framework {
+namespace {
+const std::string FUNC_NAME = "getImage";
+const std::string LONG_STRING(1024, 'a');
+const std::vector<int8_t> PIXELS = { 1, 2, 3, 4, 5, 6, 7, 8 };
+const std::vector<int32_t> INTS = { 1, -2, 3 };
+constexpr int64_t LONG_VALUE = 1LL << 40;
+
+std::vector<CodecData> CreateArgs()
+{
+    return { CodecData(LONG_STRING), CodecData(PIXELS), CodecData(INTS), CodecData(LONG_VALUE),
+        CodecData(std::map<std::string, std::string> { { "key", "value" } }),
+        CodecData(std::set<std::string> { "item" }), CodecData(true), CodecData() };
+}
+} // namespace
+
+class CodecTest : public testing::Test {};
+
+/**
+ * @tc.name: CodecTest001
+ * @tc.desc: Test reading the values borrowed from the buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(CodecTest, CodecTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. write the args and read them back without borrowing.
+     * @tc.expected: the values are owned copies, written in the size computed beforehand.
+     */
+    auto args = CreateArgs();
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter writer(buffer);
+    writer.WriteDataList(args);
+    EXPECT_EQ(buffer.size(), StandardCodecBufferWriter::GetEncodedSize(args));
+    std::vector<CodecData> copies;
+    StandardCodecBufferReader reader(buffer.data(), buffer.size());
+    ASSERT_TRUE(reader.ReadDataList(copies));
+    ASSERT_EQ(copies.size(), args.size());
+    EXPECT_FALSE(copies[0].IsBorrowed());
+    EXPECT_EQ(copies[0].GetStringValue(), LONG_STRING);
+    EXPECT_EQ(copies[1].GetInt8ArrayValue(), PIXELS);
+
+    /**
+     * @tc.steps: step2. read them back borrowing the values.
+     * @tc.expected: the string and the bytes point into the buffer, the other values are the same.
+     */
+    std::vector<CodecData> views;
+    StandardCodecBufferReader borrowingReader(buffer.data(), buffer.size(), true);
+    ASSERT_TRUE(borrowingReader.ReadDataList(views));
+    ASSERT_EQ(views.size(), args.size());
+    EXPECT_TRUE(views[0].IsString());
+    EXPECT_TRUE(views[0].IsBorrowed());
+    EXPECT_EQ(views[0].GetStringView(), LONG_STRING);
+    auto pixels = views[1].GetInt8ArrayView();
+    EXPECT_GE(reinterpret_cast<const uint8_t*>(pixels.data), buffer.data());
+    EXPECT_LT(reinterpret_cast<const uint8_t*>(pixels.data), buffer.data() + buffer.size());
+    EXPECT_EQ(std::vector<int8_t>(pixels.begin(), pixels.end()), PIXELS);
+    auto ints = views[2].GetInt32ArrayView();
+    EXPECT_EQ(std::vector<int32_t>(ints.begin(), ints.end()), INTS);
+    EXPECT_EQ(views[3].GetLongValue(), LONG_VALUE);
+    EXPECT_EQ(views[4].GetMapValue(), args[4].GetMapValue());
+    EXPECT_EQ(views[5].GetSetValue(), args[5].GetSetValue());
+    EXPECT_TRUE(views[6].GetBoolValue());
+    EXPECT_TRUE(views[7].IsNull());
+
+    /**
+     * @tc.steps: step3. write the borrowed values to another buffer.
+     * @tc.expected: the buffers are the same.
+     */
+    std::vector<uint8_t> copied;
+    StandardCodecBufferWriter copyWriter(copied);
+    copyWriter.WriteDataList(views);
+    EXPECT_EQ(copied, buffer);
+}
+
+/**
+ * @tc.name: CodecTest002
+ * @tc.desc: Test encoding and decoding a function call and reading a truncated buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(CodecTest, CodecTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. encode a function call into a buffer reused after a previous call.
+     * @tc.expected: the call is decoded with the same name and args.
+     */
+    StandardFunctionCodec codec;
+    std::vector<uint8_t> buffer;
+    FunctionCall functionCall(FUNC_NAME, CreateArgs());
+    ASSERT_TRUE(codec.EncodeFunctionCall(functionCall, buffer));
+    auto capacity = buffer.capacity();
+    buffer.clear();
+    ASSERT_TRUE(codec.EncodeFunctionCall(functionCall, buffer));
+    EXPECT_EQ(buffer.capacity(), capacity);
+    FunctionCall decoded;
+    ASSERT_TRUE(codec.DecodeFunctionCall(buffer, decoded));
+    EXPECT_EQ(decoded.GetFuncName(), FUNC_NAME);
+    ASSERT_EQ(decoded.GetArgs().size(), functionCall.GetArgs().size());
+    EXPECT_EQ(decoded.GetArgs()[0].GetStringValue(), LONG_STRING);
+
+    /**
+     * @tc.steps: step2. decode a message from memory, then from the same memory truncated.
+     * @tc.expected: the truncated message fails to decode.
+     */
+    std::vector<uint8_t> message;
+    StandardCodecBufferWriter writer(message);
+    writer.WriteData(CodecData(LONG_STRING));
+    CodecData result;
+    ASSERT_TRUE(codec.DecodePlatformMessage(message.data(), message.size(), result));
+    EXPECT_EQ(result.GetStringValue(), LONG_STRING);
+    EXPECT_FALSE(codec.DecodePlatformMessage(message.data(), message.size() - 1, result));
+    EXPECT_FALSE(codec.DecodePlatformMessage(nullptr, 0, result));
+}
+
+/**
+ * @tc.name: CodecTest003
+ * @tc.desc: Test the owning accessors of the values borrowed from the buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(CodecTest, CodecTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. decode a message borrowing its string, then read it through the owning accessor.
+     * @tc.expected: the string is copied out of the buffer once, the copy outlives the buffer content.
+     */
+    StandardFunctionCodec codec;
+    std::vector<uint8_t> message;
+    StandardCodecBufferWriter writer(message);
+    writer.WriteData(CodecData(LONG_STRING));
+    CodecData result;
+    ASSERT_TRUE(codec.DecodePlatformMessage(message.data(), message.size(), result, true));
+    EXPECT_TRUE(result.IsBorrowed());
+    const auto& owned = result.GetStringValue();
+    EXPECT_EQ(owned, LONG_STRING);
+    EXPECT_EQ(&result.GetStringValue(), &owned);
+    EXPECT_TRUE(result.IsBorrowed());
+    std::fill(message.begin(), message.end(), 0);
+    EXPECT_EQ(owned, LONG_STRING);
+
+    /**
+     * @tc.steps: step2. read the borrowed arrays through the owning accessors.
+     * @tc.expected: the arrays are the ones written.
+     */
+    auto args = CreateArgs();
+    std::vector<uint8_t> buffer;
+    StandardCodecBufferWriter argsWriter(buffer);
+    argsWriter.WriteDataList(args);
+    std::vector<CodecData> views;
+    StandardCodecBufferReader reader(buffer.data(), buffer.size(), true);
+    ASSERT_TRUE(reader.ReadDataList(views));
+    ASSERT_EQ(views.size(), args.size());
+    EXPECT_TRUE(views[1].IsBorrowed());
+    EXPECT_EQ(views[1].GetInt8ArrayValue(), PIXELS);
+    EXPECT_EQ(views[2].GetInt32ArrayValue(), INTS);
+
+    /**
+     * @tc.steps: step3. read a borrowed string through the owning accessor from several threads at once.
+     * @tc.expected: every thread gets the same copy.
+     */
+    const CodecData shared = views[0];
+    constexpr size_t threadCount = 4;
+    std::vector<const std::string*> values(threadCount, nullptr);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&shared, &values, i]() { values[i] = &shared.GetStringValue(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (const auto* value : values) {
+        ASSERT_NE(value, nullptr);
+        EXPECT_EQ(value, values[0]);
+        EXPECT_EQ(*value, LONG_STRING);
+    }
+}
+} // namespace OHOS::Ace::Framework
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "core/animation/curves.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t FRACTION_COUNT = 1001;
+constexpr int32_t REFERENCE_ITERATIONS = 64;
+// the bisection CubicCurve used before stopped 0.001 away from the time, which is off by more than this.
+constexpr double ERROR_LIMIT = 0.001;
+constexpr float OUT_OF_RANGE_TIME = 1.5f;
+
+double Cubic(double a, double b, double m)
+{
+    return 3.0 * a * (1.0 - m) * (1.0 - m) * m + 3.0 * b * (1.0 - m) * m * m + m * m * m;
+}
+
+double MoveByReference(const RefPtr<CubicCurve>& curve, double time)
+{
+    double start = 0.0;
+    double end = 1.0;
+    for (int32_t iteration = 0; iteration < REFERENCE_ITERATIONS; ++iteration) {
+        double midpoint = (start + end) / 2;
+        if (Cubic(curve->GetX0(), curve->GetX1(), midpoint) < time) {
+            start = midpoint;
+        } else {
+            end = midpoint;
+        }
+    }
+    return Cubic(curve->GetY0(), curve->GetY1(), (start + end) / 2);
+}
+
+std::vector<RefPtr<CubicCurve>> GetCubicCurves()
+{
+    return { Curves::EASE, Curves::EASE_IN, Curves::EASE_OUT, Curves::EASE_IN_OUT, Curves::FAST_OUT_SLOW_IN,
+        Curves::LINEAR_OUT_SLOW_IN, Curves::FAST_OUT_LINEAR_IN, Curves::FRICTION, Curves::EXTREME_DECELERATION,
+        Curves::SHARP, Curves::RHYTHM, Curves::SMOOTH, Curves::MAGNETIC,
+        AceType::MakeRefPtr<CubicCurve>(0.0f, 0.0f, 0.0f, 1.0f),
+        AceType::MakeRefPtr<CubicCurve>(1.0f, 0.0f, 1.0f, 1.0f),
+        AceType::MakeRefPtr<CubicCurve>(0.5f, -1.0f, 0.5f, 2.0f) };
+}
+} // namespace
+
+class CubicCurveTestNg : public testing::Test {};
+
+/**
+ * @tc.name: CubicCurveTest001
+ * @tc.desc: Test the values of the cubic curves against a solve in double precision
+ * @tc.type: FUNC
+ */
+HWTEST_F(CubicCurveTestNg, CubicCurveTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. move the presets and the curves with flat ends through evenly spaced times.
+     * @tc.expected: every value is within the error limit of the reference.
+     */
+    for (const auto& curve : GetCubicCurves()) {
+        for (int32_t index = 0; index < FRACTION_COUNT; ++index) {
+            float time = static_cast<float>(index) / (FRACTION_COUNT - 1);
+            EXPECT_NEAR(curve->Move(time), MoveByReference(curve, time), ERROR_LIMIT) << curve->ToString();
+        }
+    }
+
+    /**
+     * @tc.steps: step2. move a curve with a nan time and a time out of range.
+     * @tc.expected: the values are 1.
+     */
+    EXPECT_FLOAT_EQ(Curves::EASE->Move(std::nanf("")), 1.0f);
+    EXPECT_FLOAT_EQ(Curves::EASE->Move(OUT_OF_RANGE_TIME), 1.0f);
+}
+
+/**
+ * @tc.name: CubicCurveTest002
+ * @tc.desc: Test the batch move of a cubic curve gives the values of the move of each time
+ * @tc.type: FUNC
+ */
+HWTEST_F(CubicCurveTestNg, CubicCurveTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. move the curves through the times in a batch, with a nan time and a time out of range.
+     * @tc.expected: the values are within the error limit of the reference, those of the invalid times are 1.
+     */
+    std::vector<float> times(FRACTION_COUNT);
+    for (int32_t index = 0; index < FRACTION_COUNT; ++index) {
+        times[index] = static_cast<float>(index) / (FRACTION_COUNT - 1);
+    }
+    times[1] = std::nanf("");
+    times[2] = OUT_OF_RANGE_TIME;
+    std::vector<float> values(FRACTION_COUNT);
+    for (const auto& curve : GetCubicCurves()) {
+        curve->MoveBatch(times.data(), values.data(), times.size());
+        EXPECT_FLOAT_EQ(values[1], 1.0f);
+        EXPECT_FLOAT_EQ(values[2], 1.0f);
+        for (int32_t index = 3; index < FRACTION_COUNT; ++index) {
+            EXPECT_NEAR(values[index], MoveByReference(curve, times[index]), ERROR_LIMIT) << curve->ToString();
+        }
+    }
+
+    /**
+     * @tc.steps: step2. move a curve without its own batch move in a batch.
+     * @tc.expected: the values are those of the move of each valid time.
+     */
+    Curves::SINE->MoveBatch(times.data(), values.data(), times.size());
+    for (int32_t index = 3; index < FRACTION_COUNT; ++index) {
+        EXPECT_FLOAT_EQ(values[index], Curves::SINE->Move(times[index]));
+    }
+}
+} // namespace OHOS::Ace::NG
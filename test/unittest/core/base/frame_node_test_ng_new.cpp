@@ -16,6 +16,9 @@
 #include "base/memory/referenced.h"
 #include "base/memory/ace_type.h"
 #include "frameworks/core/components_ng/pattern/image/image_pattern.h"
+#include "frameworks/core/components_ng/pattern/shape/rect_pattern.h"
+#include "frameworks/core/components_ng/pattern/stack/stack_layout_algorithm.h"
+#include "frameworks/core/pipeline_ng/ui_task_scheduler.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -1801,4 +1804,265 @@ HWTEST_F(FrameNodeTestNg, GetPreviewOptionFromModifier014, TestSize.Level1)
     dragPreviewOption = frameNode->GetDragPreviewOption();
     EXPECT_EQ(dragPreviewOption.options.opacity, 0.95f);
 }
+
+/**
+ * @tc.name: FrameNodeCanMeasureOnBackground001
+ * @tc.desc: Test CanMeasureOnBackground and the split layout task phases.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeCanMeasureOnBackground001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a column with a row child.
+     * @tc.expected: linear layout can be measured on background.
+     */
+    auto column = FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<LinearLayoutPattern>(true));
+    auto row = FrameNode::CreateFrameNode(V2::ROW_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<LinearLayoutPattern>(false));
+    column->AddChild(row);
+    EXPECT_TRUE(column->CanMeasureOnBackground());
+
+    /**
+     * @tc.steps: step2. add a child whose layout algorithm must run on main thread.
+     * @tc.expected: the whole subtree must be measured on main thread.
+     */
+    auto child = FrameNode::CreateFrameNode("child", ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<Pattern>());
+    row->AddChild(child);
+    EXPECT_FALSE(column->CanMeasureOnBackground());
+
+    /**
+     * @tc.steps: step3. run the layout task phases one by one.
+     * @tc.expected: the node is not layout dirty after measure.
+     */
+    column->isLayoutDirtyMarked_ = true;
+    EXPECT_TRUE(column->PrepareLayoutTask());
+    column->MeasureLayoutTask();
+    EXPECT_FALSE(column->isLayoutDirtyMarked_);
+    column->FinishLayoutTask();
+    EXPECT_FALSE(column->IsRootMeasureNode());
+    EXPECT_FALSE(column->PrepareLayoutTask());
+}
+
+/**
+ * @tc.name: FrameNodeTouchTestIndex001
+ * @tc.desc: Test the hit test index of a large container gives the same touch test region as testing every child.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeTouchTestIndex001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a column of 100 children, each one 10 high.
+     */
+    constexpr int32_t childCount = 100;
+    constexpr float childHeight = 10.0f;
+    auto column = FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<LinearLayoutPattern>(true));
+    std::vector<RefPtr<FrameNode>> children;
+    for (int32_t i = 0; i < childCount; ++i) {
+        auto child = FrameNode::CreateFrameNode("child", ElementRegister::GetInstance()->MakeUniqueId(),
+            AceType::MakeRefPtr<Pattern>());
+        child->GetRenderContext()->UpdatePaintRect(RectF(0.0f, i * childHeight, 100.0f, childHeight));
+        column->AddChild(child);
+        column->frameChildren_.emplace(child);
+        children.emplace_back(child);
+    }
+
+    /**
+     * @tc.steps: step2. get the candidates in the middle of a child.
+     * @tc.expected: the index is used and only the child under the point is a candidate.
+     */
+    std::vector<WeakPtr<FrameNode>> candidates;
+    ASSERT_TRUE(column->GetTouchTestCandidates(PointF(50.0f, 255.0f), candidates));
+    ASSERT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates[0].Upgrade(), children[25]);
+    EXPECT_TRUE(column->GetTouchTestCandidates(PointF(150.0f, 255.0f), candidates));
+    EXPECT_TRUE(candidates.empty());
+
+    /**
+     * @tc.steps: step3. test the region of the column, which holds no region itself.
+     * @tc.expected: the column is hit through its unclipped children only.
+     */
+    EXPECT_FALSE(column->IsOutOfTouchTestRegion(PointF(50.0f, 255.0f), 0));
+    EXPECT_TRUE(column->IsOutOfTouchTestRegion(PointF(150.0f, 255.0f), 0));
+
+    /**
+     * @tc.steps: step4. move a child as the render context does, then drop the children under the threshold.
+     * @tc.expected: only the index of the column holding the child is marked dirty, it is rebuilt, then dropped.
+     */
+    auto otherColumn = FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<LinearLayoutPattern>(true));
+    otherColumn->hitTestIndexDirty_ = false;
+    EXPECT_FALSE(column->hitTestIndexDirty_);
+    children[25]->GetRenderContext()->UpdatePaintRect(RectF(200.0f, 250.0f, 100.0f, childHeight));
+    children[25]->NotifyGeometryChanged();
+    EXPECT_TRUE(column->hitTestIndexDirty_);
+    EXPECT_FALSE(otherColumn->hitTestIndexDirty_);
+    EXPECT_TRUE(column->GetTouchTestCandidates(PointF(250.0f, 255.0f), candidates));
+    EXPECT_FALSE(column->hitTestIndexDirty_);
+    ASSERT_EQ(candidates.size(), 1);
+    EXPECT_EQ(candidates[0].Upgrade(), children[25]);
+    column->frameChildren_.clear();
+    EXPECT_FALSE(column->GetTouchTestCandidates(PointF(50.0f, 255.0f), candidates));
+    EXPECT_EQ(column->hitTestIndex_, nullptr);
+}
+
+/**
+ * @tc.name: FrameNodeTouchTestIndex002
+ * @tc.desc: Test the touch test bounds follow unclipped descendants up to a bounded depth.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeTouchTestIndex002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a chain of unclipped nodes deeper than the bounds follow.
+     */
+    constexpr int32_t chainLength = 12;
+    std::vector<RefPtr<FrameNode>> chain;
+    for (int32_t i = 0; i < chainLength; ++i) {
+        auto node = FrameNode::CreateFrameNode("node", ElementRegister::GetInstance()->MakeUniqueId(),
+            AceType::MakeRefPtr<Pattern>());
+        node->GetRenderContext()->UpdatePaintRect(RectF(0.0f, 0.0f, 10.0f, 10.0f));
+        if (!chain.empty()) {
+            chain.back()->AddChild(node);
+            chain.back()->frameChildren_.emplace(node);
+        }
+        chain.emplace_back(node);
+    }
+
+    /**
+     * @tc.steps: step2. get the bounds of the chain below the head, and from a node near the end of the chain.
+     * @tc.expected: the chain is too deep to be bounded, its tail is bounded.
+     */
+    EXPECT_FALSE(chain[1]->GetTouchTestBounds(0).has_value());
+    EXPECT_TRUE(chain[chainLength - 3]->GetTouchTestBounds(0).has_value());
+
+    /**
+     * @tc.steps: step3. move the last node.
+     * @tc.expected: only ancestors up to the depth the bounds follow are marked dirty.
+     */
+    for (const auto& node : chain) {
+        node->hitTestIndexDirty_ = false;
+    }
+    chain.back()->NotifyGeometryChanged();
+    EXPECT_TRUE(chain[chainLength - 2]->hitTestIndexDirty_);
+    EXPECT_TRUE(chain[2]->hitTestIndexDirty_);
+    EXPECT_FALSE(chain[1]->hitTestIndexDirty_);
+    EXPECT_FALSE(chain[0]->hitTestIndexDirty_);
+
+    /**
+     * @tc.steps: step4. clip a node in the middle and move the last node again.
+     * @tc.expected: the walk stops at the clipping node.
+     */
+    chain[8]->GetRenderContext()->UpdateClipEdge(true);
+    for (const auto& node : chain) {
+        node->hitTestIndexDirty_ = false;
+    }
+    chain.back()->NotifyGeometryChanged();
+    EXPECT_TRUE(chain[8]->hitTestIndexDirty_);
+    EXPECT_FALSE(chain[7]->hitTestIndexDirty_);
+}
+
+/**
+ * @tc.name: FrameNodeCanMeasureOnBackground002
+ * @tc.desc: Test the cached result of CanMeasureOnBackground is reset when the subtree changes.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeCanMeasureOnBackground002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create a column with a rect leaf.
+     * @tc.expected: shape leaves can be measured on background.
+     */
+    auto column = FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<LinearLayoutPattern>(true));
+    auto rect = FrameNode::CreateFrameNode(V2::RECT_ETS_TAG, ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<RectPattern>());
+    column->AddChild(rect);
+    EXPECT_TRUE(column->CanMeasureOnBackground());
+    EXPECT_TRUE(rect->CanMeasureOnBackground());
+
+    /**
+     * @tc.steps: step2. add a main thread child under the rect, then remove it.
+     * @tc.expected: the cached results of the rect and the column follow the children.
+     */
+    auto child = FrameNode::CreateFrameNode("child", ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<Pattern>());
+    rect->AddChild(child);
+    EXPECT_FALSE(column->CanMeasureOnBackground());
+    rect->RemoveChild(child);
+    EXPECT_TRUE(column->CanMeasureOnBackground());
+
+    /**
+     * @tc.steps: step3. set an overlay node on the rect.
+     * @tc.expected: the column must be measured on main thread.
+     */
+    rect->SetOverlayNode(child);
+    EXPECT_FALSE(column->CanMeasureOnBackground());
+    rect->SetOverlayNode(nullptr);
+    EXPECT_TRUE(column->CanMeasureOnBackground());
+}
+
+namespace {
+class TestLinearLayoutAlgorithm : public LinearLayoutAlgorithm {
+    DECLARE_ACE_TYPE(TestLinearLayoutAlgorithm, LinearLayoutAlgorithm);
+};
+} // namespace
+
+/**
+ * @tc.name: FrameNodeCanMeasureOnBackground003
+ * @tc.desc: Test only the audited linear, flex and stack algorithms opt in, not their subclasses.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeCanMeasureOnBackground003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. ask the audited algorithms and a subclass of the linear algorithm.
+     * @tc.expected: the subclass stays on the main thread.
+     */
+    EXPECT_EQ(AceType::MakeRefPtr<LinearLayoutAlgorithm>()->CanRunOnWhichThread(), BACKGROUND_TASK);
+    EXPECT_EQ(AceType::MakeRefPtr<FlexLayoutAlgorithm>()->CanRunOnWhichThread(), BACKGROUND_TASK);
+    EXPECT_EQ(AceType::MakeRefPtr<StackLayoutAlgorithm>()->CanRunOnWhichThread(), BACKGROUND_TASK);
+    EXPECT_EQ(AceType::MakeRefPtr<TestLinearLayoutAlgorithm>()->CanRunOnWhichThread(), MAIN_TASK);
+}
+
+/**
+ * @tc.name: FrameNodeParallelMeasure001
+ * @tc.desc: Test the parallel measure keeps the roots in the dirty nodes and records them in dirty order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(FrameNodeTestNg, FrameNodeParallelMeasure001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create two independent layout dirty columns and a main thread node between them.
+     */
+    std::vector<RefPtr<FrameNode>> dirtyNodes;
+    dirtyNodes.emplace_back(FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG,
+        ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<LinearLayoutPattern>(true)));
+    dirtyNodes.emplace_back(FrameNode::CreateFrameNode("child", ElementRegister::GetInstance()->MakeUniqueId(),
+        AceType::MakeRefPtr<Pattern>()));
+    dirtyNodes.emplace_back(FrameNode::CreateFrameNode(V2::COLUMN_ETS_TAG,
+        ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<LinearLayoutPattern>(true)));
+    for (const auto& node : dirtyNodes) {
+        node->isLayoutDirtyMarked_ = true;
+    }
+
+    /**
+     * @tc.steps: step2. measure the roots in parallel.
+     * @tc.expected: the columns are measured and recorded in dirty order, the dirty nodes are unchanged.
+     */
+    UITaskScheduler taskScheduler;
+    taskScheduler.FlushParallelMeasureTask(dirtyNodes);
+    EXPECT_EQ(taskScheduler.parallelRoots_, std::vector<size_t>({ 0, 2 }));
+    EXPECT_EQ(taskScheduler.parallelCosts_.size(), 2);
+    ASSERT_EQ(dirtyNodes.size(), 3);
+    EXPECT_FALSE(dirtyNodes[0]->isLayoutDirtyMarked_);
+    EXPECT_TRUE(dirtyNodes[1]->isLayoutDirtyMarked_);
+    EXPECT_FALSE(dirtyNodes[2]->isLayoutDirtyMarked_);
+    for (auto index : taskScheduler.parallelRoots_) {
+        dirtyNodes[index]->FinishLayoutTask();
+        EXPECT_FALSE(dirtyNodes[index]->IsRootMeasureNode());
+    }
+}
 } // namespace OHOS::Ace::NG
\ No newline at end of file
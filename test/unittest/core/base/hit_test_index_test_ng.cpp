@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "core/components_ng/base/hit_test_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr int32_t ITEM_COUNT = 1000;
+constexpr int32_t ITEM_COLUMNS = 10;
+constexpr float ITEM_SIZE = 10.0f;
+
+// the items the index must return: every item whose bounds contain point, in ascending order.
+std::vector<int32_t> LinearQuery(const std::vector<std::optional<RectF>>& bounds, const PointF& point)
+{
+    std::vector<int32_t> result;
+    for (int32_t i = 0; i < static_cast<int32_t>(bounds.size()); ++i) {
+        const auto& rect = bounds[i];
+        if (!rect || (point.GetX() >= rect->Left() && point.GetX() <= rect->Right() &&
+                         point.GetY() >= rect->Top() && point.GetY() <= rect->Bottom())) {
+            result.emplace_back(i);
+        }
+    }
+    return result;
+}
+} // namespace
+
+class HitTestIndexTestNg : public testing::Test {};
+
+/**
+ * @tc.name: HitTestIndexTest001
+ * @tc.desc: Test query returns the items containing the point in ascending order
+ * @tc.type: FUNC
+ */
+HWTEST_F(HitTestIndexTestNg, HitTestIndexTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. index a grid of items, with an unbounded item and an item covering all the others.
+     */
+    std::vector<std::optional<RectF>> bounds;
+    for (int32_t i = 0; i < ITEM_COUNT; ++i) {
+        bounds.emplace_back(RectF((i % ITEM_COLUMNS) * ITEM_SIZE, (i / ITEM_COLUMNS) * ITEM_SIZE, ITEM_SIZE - 1.0f,
+            ITEM_SIZE - 1.0f));
+    }
+    bounds[3] = std::nullopt;
+    bounds[500] = RectF(0.0f, 0.0f, ITEM_COLUMNS * ITEM_SIZE, ITEM_COUNT);
+    HitTestIndex index;
+    index.Build(bounds);
+    EXPECT_EQ(index.GetItemCount(), ITEM_COUNT);
+
+    /**
+     * @tc.steps: step2. query points inside, between and out of the items.
+     * @tc.expected: the result equals the linear scan.
+     */
+    std::vector<int32_t> result;
+    for (auto point : { PointF(5.0f, 5.0f), PointF(55.0f, 505.0f), PointF(9.5f, 9.5f), PointF(99.0f, 999.0f),
+             PointF(-50.0f, 300.0f), PointF(1000.0f, 1000.0f) }) {
+        index.Query(point, result);
+        EXPECT_EQ(result, LinearQuery(bounds, point));
+    }
+    index.Query(PointF(55.0f, 505.0f), result);
+    EXPECT_EQ(result, std::vector<int32_t>({ 3, 500, 505 }));
+}
+
+/**
+ * @tc.name: HitTestIndexTest002
+ * @tc.desc: Test degenerated bounds and reset
+ * @tc.type: FUNC
+ */
+HWTEST_F(HitTestIndexTestNg, HitTestIndexTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. index items at one point and an item with infinite bounds.
+     * @tc.expected: the infinite item is tested at every point.
+     */
+    std::vector<std::optional<RectF>> bounds(ITEM_COLUMNS, RectF(1.0f, 1.0f, 0.0f, 0.0f));
+    bounds.emplace_back(RectF(0.0f, 0.0f, std::numeric_limits<float>::infinity(), 1.0f));
+    HitTestIndex index;
+    index.Build(bounds);
+    std::vector<int32_t> result;
+    index.Query(PointF(1.0f, 1.0f), result);
+    EXPECT_EQ(result, LinearQuery(bounds, PointF(1.0f, 1.0f)));
+    index.Query(PointF(-1.0f, -1.0f), result);
+    EXPECT_EQ(result, std::vector<int32_t>({ ITEM_COLUMNS }));
+
+    /**
+     * @tc.steps: step2. reset the index.
+     * @tc.expected: query finds nothing.
+     */
+    index.Reset();
+    EXPECT_EQ(index.GetItemCount(), 0);
+    index.Query(PointF(1.0f, 1.0f), result);
+    EXPECT_TRUE(result.empty());
+}
+} // namespace OHOS::Ace::NG
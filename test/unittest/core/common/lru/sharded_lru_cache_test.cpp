@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "core/common/lru/sharded_lru_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+constexpr size_t COUNT_LIMIT = 3;
+constexpr size_t SIZE_LIMIT = 100;
+constexpr size_t ENTRY_SIZE = 10;
+constexpr size_t LARGE_ENTRY_SIZE = 80;
+constexpr int32_t THREAD_COUNT = 4;
+constexpr int32_t LOOP_COUNT = 10000;
+constexpr int32_t KEY_COUNT = 500;
+
+using TestCache = ShardedLRUCache<std::shared_ptr<int32_t>>;
+
+std::string MakeKey(int32_t index)
+{
+    return "key" + std::to_string(index);
+}
+} // namespace
+
+class ShardedLRUCacheTest : public testing::Test {};
+
+/**
+ * @tc.name: ShardedLRUCacheTest001
+ * @tc.desc: Test the count limit evicts the least recently used entry.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShardedLRUCacheTest, ShardedLRUCacheTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Fill the cache and use the first entry again.
+     */
+    TestCache cache(COUNT_LIMIT, SIZE_LIMIT);
+    for (int32_t i = 0; i < static_cast<int32_t>(COUNT_LIMIT); ++i) {
+        EXPECT_TRUE(cache.Put(MakeKey(i), std::make_shared<int32_t>(i), ENTRY_SIZE));
+    }
+    EXPECT_EQ(cache.Count(), COUNT_LIMIT);
+    EXPECT_EQ(cache.Bytes(), COUNT_LIMIT * ENTRY_SIZE);
+    auto value = cache.Get(MakeKey(0));
+    ASSERT_NE(value, nullptr);
+    EXPECT_EQ(*value, 0);
+
+    /**
+     * @tc.steps: step2. Add one more entry.
+     * @tc.expected: The entry used least recently is evicted, whatever shard it is in.
+     */
+    cache.Put(MakeKey(COUNT_LIMIT), std::make_shared<int32_t>(COUNT_LIMIT), ENTRY_SIZE);
+    EXPECT_EQ(cache.Count(), COUNT_LIMIT);
+    EXPECT_EQ(cache.Peek(MakeKey(1)), nullptr);
+    EXPECT_NE(cache.Peek(MakeKey(0)), nullptr);
+    EXPECT_EQ(cache.Get("missing"), nullptr);
+
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    for (const auto& stats : cache.GetStats()) {
+        hits += stats.hits;
+        misses += stats.misses;
+        evictions += stats.evictions;
+    }
+    EXPECT_EQ(hits, 1);
+    EXPECT_EQ(misses, 1);
+    EXPECT_EQ(evictions, 1);
+}
+
+/**
+ * @tc.name: ShardedLRUCacheTest002
+ * @tc.desc: Test the byte limit of the cache.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShardedLRUCacheTest, ShardedLRUCacheTest002, TestSize.Level1)
+{
+    TestCache cache(TestCache::NO_LIMIT, SIZE_LIMIT);
+    for (int32_t i = 0; i < static_cast<int32_t>(COUNT_LIMIT); ++i) {
+        cache.Put(MakeKey(i), std::make_shared<int32_t>(i), ENTRY_SIZE);
+    }
+
+    /**
+     * @tc.steps: step1. Add an entry which needs the space of older ones.
+     * @tc.expected: The oldest entries are evicted until the bytes fit in the limit.
+     */
+    EXPECT_TRUE(cache.Put("large", std::make_shared<int32_t>(0), LARGE_ENTRY_SIZE));
+    EXPECT_LE(cache.Bytes(), SIZE_LIMIT);
+    EXPECT_EQ(cache.Peek(MakeKey(0)), nullptr);
+    EXPECT_NE(cache.Peek("large"), nullptr);
+
+    /**
+     * @tc.steps: step2. Add an entry larger than the limit, then replace and erase entries.
+     * @tc.expected: The large entry is rejected and the byte count follows the changes.
+     */
+    EXPECT_FALSE(cache.Put("huge", std::make_shared<int32_t>(0), SIZE_LIMIT + 1));
+    EXPECT_EQ(cache.Peek("huge"), nullptr);
+    auto bytes = cache.Bytes();
+    cache.Put("large", std::make_shared<int32_t>(1), ENTRY_SIZE);
+    EXPECT_EQ(cache.Bytes(), bytes - LARGE_ENTRY_SIZE + ENTRY_SIZE);
+    EXPECT_TRUE(cache.Erase("large"));
+    EXPECT_FALSE(cache.Erase("large"));
+    cache.Clear();
+    EXPECT_EQ(cache.Count(), 0);
+    EXPECT_EQ(cache.Bytes(), 0);
+}
+
+/**
+ * @tc.name: ShardedLRUCacheTest003
+ * @tc.desc: Test the cache stays within its limits when used from several threads.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ShardedLRUCacheTest, ShardedLRUCacheTest003, TestSize.Level1)
+{
+    TestCache cache(KEY_COUNT / 2, KEY_COUNT * ENTRY_SIZE / 4);
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < THREAD_COUNT; ++i) {
+        threads.emplace_back([&cache, i]() {
+            for (int32_t loop = 0; loop < LOOP_COUNT; ++loop) {
+                auto key = MakeKey((loop + i * KEY_COUNT / THREAD_COUNT) % KEY_COUNT);
+                if (!cache.Get(key)) {
+                    cache.Put(key, std::make_shared<int32_t>(loop), ENTRY_SIZE);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_LE(cache.Count(), KEY_COUNT / 2);
+    EXPECT_LE(cache.Bytes(), KEY_COUNT * ENTRY_SIZE / 4);
+
+    size_t count = 0;
+    size_t bytes = 0;
+    cache.ForEach([&count, &bytes](const std::string& key, const std::shared_ptr<int32_t>& value, size_t cost) {
+        ++count;
+        bytes += cost;
+    });
+    EXPECT_EQ(count, cache.Count());
+    EXPECT_EQ(bytes, cache.Bytes());
+}
+} // namespace OHOS::Ace
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <chrono>
+#include <cstdint>
+
+#include "gtest/gtest.h"
+
+#include "core/gestures/velocity_tracker.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+// the touch sampling of 240Hz.
+constexpr auto SAMPLE_INTERVAL = std::chrono::microseconds(4167);
+constexpr auto PAUSE_INTERVAL = std::chrono::milliseconds(200);
+constexpr double SAMPLE_SECONDS = 0.004167;
+constexpr double MOVE_DISTANCE = 4.0;
+constexpr double SLOW_MOVE_DISTANCE = 1.0;
+constexpr int32_t SAMPLE_COUNT = 40;
+constexpr int32_t SLOW_SAMPLE_COUNT = 4;
+constexpr double ERROR_LIMIT = 0.01;
+
+void MoveVertically(VelocityTracker& tracker, TimeStamp& time, double& y, int32_t count, double distance)
+{
+    for (int32_t i = 0; i < count; i++) {
+        time += SAMPLE_INTERVAL;
+        y += distance;
+        tracker.UpdateTrackerPoint(0.0, y, time);
+    }
+}
+} // namespace
+
+class VelocityTrackerTestNg : public testing::Test {};
+
+/**
+ * @tc.name: VelocityTrackerTest001
+ * @tc.desc: Test the velocity of a move at a constant speed with each strategy
+ * @tc.type: FUNC
+ */
+HWTEST_F(VelocityTrackerTestNg, VelocityTrackerTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. move at a constant speed, sampled more often than the buffer of the tracker keeps.
+     * @tc.expected: both strategies give the speed of the move.
+     */
+    for (auto strategy : { VelocityStrategy::LEAST_SQUARE, VelocityStrategy::IMPULSE }) {
+        VelocityTracker tracker(Axis::VERTICAL);
+        tracker.SetStrategy(strategy);
+        TimeStamp time;
+        double y = 0.0;
+        MoveVertically(tracker, time, y, SAMPLE_COUNT, MOVE_DISTANCE);
+        EXPECT_NEAR(tracker.GetMainAxisVelocity(), MOVE_DISTANCE / SAMPLE_SECONDS, ERROR_LIMIT);
+        EXPECT_NEAR(tracker.GetVelocity().GetVelocityX(), 0.0, ERROR_LIMIT);
+
+        /**
+         * @tc.steps: step2. reset the tracker and move backwards.
+         * @tc.expected: the velocity only takes the points after the reset.
+         */
+        tracker.Reset();
+        MoveVertically(tracker, time, y, SAMPLE_COUNT, -MOVE_DISTANCE);
+        EXPECT_NEAR(tracker.GetMainAxisVelocity(), -MOVE_DISTANCE / SAMPLE_SECONDS, ERROR_LIMIT);
+    }
+}
+
+/**
+ * @tc.name: VelocityTrackerTest002
+ * @tc.desc: Test the impulse velocity ignoring the points before its horizon
+ * @tc.type: FUNC
+ */
+HWTEST_F(VelocityTrackerTestNg, VelocityTrackerTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. move fast after a pause, with and without slow moves before the pause.
+     * @tc.expected: the impulse velocities are the same, as the slow moves are older than 100ms.
+     */
+    VelocityTracker fastTracker(Axis::VERTICAL);
+    fastTracker.SetStrategy(VelocityStrategy::IMPULSE);
+    TimeStamp time;
+    double y = 0.0;
+    time += PAUSE_INTERVAL;
+    fastTracker.UpdateTrackerPoint(0.0, y, time);
+    MoveVertically(fastTracker, time, y, SLOW_SAMPLE_COUNT, MOVE_DISTANCE);
+
+    VelocityTracker tracker(Axis::VERTICAL);
+    tracker.SetStrategy(VelocityStrategy::IMPULSE);
+    TimeStamp otherTime;
+    double otherY = 0.0;
+    MoveVertically(tracker, otherTime, otherY, SLOW_SAMPLE_COUNT, SLOW_MOVE_DISTANCE);
+    otherTime += PAUSE_INTERVAL;
+    tracker.UpdateTrackerPoint(0.0, otherY, otherTime);
+    MoveVertically(tracker, otherTime, otherY, SLOW_SAMPLE_COUNT, MOVE_DISTANCE);
+    EXPECT_NEAR(tracker.GetMainAxisVelocity(), fastTracker.GetMainAxisVelocity(), ERROR_LIMIT);
+    EXPECT_NEAR(tracker.GetMainAxisVelocity(), MOVE_DISTANCE / SAMPLE_SECONDS, ERROR_LIMIT);
+
+    /**
+     * @tc.steps: step2. switch the tracker to the least square strategy.
+     * @tc.expected: the velocity is computed again, the fit of the last points gives the same speed.
+     */
+    tracker.SetStrategy(VelocityStrategy::LEAST_SQUARE);
+    EXPECT_NEAR(tracker.GetMainAxisVelocity(), MOVE_DISTANCE / SAMPLE_SECONDS, ERROR_LIMIT);
+}
+} // namespace OHOS::Ace::NG
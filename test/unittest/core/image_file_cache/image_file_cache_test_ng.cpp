@@ -13,6 +13,7 @@
  * limitations under the License.
  */
 
+#include <cstdlib>
 #include <vector>
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
@@ -21,6 +22,7 @@
 #define private public
 
 #include "core/image/image_file_cache.h"
+#include "core/image/image_pack_file_store.h"
 #include "base/utils/system_properties.h"
 
 #include "test/mock/base/mock_image_packer.h"
@@ -34,6 +36,19 @@ namespace OHOS::Ace::NG {
 const std::string ASTC_SUFFIX = ".astc";
 const std::string CACHE_FILE_PATH = "/data/test/resource/imagecache/images";
 const std::string SVG_FORMAT = "image/svg+xml";
+const std::string PACK_FILE_PATH_TEMPLATE = "/tmp/image_pack_XXXXXX";
+
+std::string MakePackFileDir()
+{
+    std::vector<char> dirPath(PACK_FILE_PATH_TEMPLATE.begin(), PACK_FILE_PATH_TEMPLATE.end());
+    dirPath.push_back('\0');
+    return mkdtemp(dirPath.data()) == nullptr ? "" : std::string(dirPath.data());
+}
+
+std::string GetRecordData(const ImagePackRecord& record)
+{
+    return std::string(reinterpret_cast<const char*>(record.data), record.size);
+}
 class ImageFileCacheTestNg : public testing::Test {
 public:
     static void SetUpTestSuite();
@@ -267,4 +282,301 @@ HWTEST_F(ImageFileCacheTestNg, WriteCacheFileFunc004, TestSize.Level1)
         ASSERT_EQ(fileInfo.accessCount, accessCount);
     }
 }
+
+/**
+ * @tc.name: ImagePackFileStore001
+ * @tc.desc: Test records of ImagePackFileStore are found by key and suffix and persist after reopening.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageFileCacheTestNg, ImagePackFileStore001, TestSize.Level1)
+{
+    auto dirPath = MakePackFileDir();
+    ASSERT_FALSE(dirPath.empty());
+    std::string pngData = "png image data";
+    std::string astcData = "astc image data";
+    {
+        /**
+         * @tc.steps: step1. put two records into an empty store.
+         * @tc.expected: records are found by key, an empty suffix matches any suffix.
+         */
+        ImagePackFileStore store;
+        ASSERT_TRUE(store.Open(dirPath));
+        EXPECT_EQ(store.GetRecordCount(), 0);
+        EXPECT_TRUE(store.Put("http:/testpackfile001/image1", "", pngData.data(), pngData.size()));
+        EXPECT_TRUE(store.Put("http:/testpackfile001/image2", ASTC_SUFFIX, astcData.data(), astcData.size()));
+        EXPECT_EQ(store.GetRecordCount(), 2);
+        EXPECT_EQ(store.GetLiveSize(), store.GetPackSize());
+
+        ImagePackRecord record;
+        ASSERT_TRUE(store.Get("http:/testpackfile001/image1", "", record));
+        EXPECT_EQ(GetRecordData(record), pngData);
+        EXPECT_FALSE(store.Get("http:/testpackfile001/image1", ASTC_SUFFIX, record));
+        EXPECT_TRUE(store.Contains("http:/testpackfile001/image2", ""));
+        EXPECT_TRUE(store.Contains("http:/testpackfile001/image2", ASTC_SUFFIX));
+        EXPECT_FALSE(store.Contains("http:/testpackfile001/image3", ""));
+    }
+
+    /**
+     * @tc.steps: step2. reopen the store.
+     * @tc.expected: records are loaded from the index without writing them again.
+     */
+    ImagePackFileStore store;
+    ASSERT_TRUE(store.Open(dirPath));
+    EXPECT_EQ(store.GetRecordCount(), 2);
+    ImagePackRecord record;
+    ASSERT_TRUE(store.Get("http:/testpackfile001/image2", ASTC_SUFFIX, record));
+    EXPECT_EQ(GetRecordData(record), astcData);
+    EXPECT_EQ(record.suffix, ASTC_SUFFIX);
+    store.Close();
+    EXPECT_FALSE(store.IsOpen());
+}
+
+/**
+ * @tc.name: ImagePackFileStore002
+ * @tc.desc: Test Erase and Trim of ImagePackFileStore, and that data handed out survives compaction.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageFileCacheTestNg, ImagePackFileStore002, TestSize.Level1)
+{
+    auto dirPath = MakePackFileDir();
+    ASSERT_FALSE(dirPath.empty());
+    ImagePackFileStore store;
+    ASSERT_TRUE(store.Open(dirPath));
+
+    /**
+     * @tc.steps: step1. put ten records and hold the data of the first one.
+     */
+    const size_t recordCount = 10;
+    const std::string recordData(100, 'a');
+    for (size_t i = 0; i < recordCount; ++i) {
+        auto key = "http:/testpackfile002/image" + std::to_string(i);
+        ASSERT_TRUE(store.Put(key, "", recordData.data(), recordData.size()));
+    }
+    ImagePackRecord heldRecord;
+    ASSERT_TRUE(store.Get("http:/testpackfile002/image0", "", heldRecord));
+
+    /**
+     * @tc.steps: step2. erase one record and replace another.
+     * @tc.expected: the pack file keeps the dropped bytes until it is compacted.
+     */
+    EXPECT_TRUE(store.Erase("http:/testpackfile002/image1"));
+    EXPECT_FALSE(store.Erase("http:/testpackfile002/image1"));
+    const std::string newData(50, 'b');
+    ASSERT_TRUE(store.Put("http:/testpackfile002/image2", "", newData.data(), newData.size()));
+    EXPECT_EQ(store.GetRecordCount(), recordCount - 1);
+    EXPECT_GT(store.GetPackSize(), store.GetLiveSize());
+
+    /**
+     * @tc.steps: step3. trim the store to a third of its size.
+     * @tc.expected: records fit in the target size, the pack file is compacted and held data is still readable.
+     */
+    auto targetSize = store.GetLiveSize() / 3;
+    store.Trim(targetSize);
+    EXPECT_LE(store.GetLiveSize(), targetSize);
+    EXPECT_EQ(store.GetPackSize(), store.GetLiveSize());
+    EXPECT_EQ(GetRecordData(heldRecord), recordData);
+
+    ImagePackRecord record;
+    ASSERT_TRUE(store.Get("http:/testpackfile002/image2", "", record));
+    EXPECT_EQ(GetRecordData(record), newData);
+}
+
+/**
+ * @tc.name: ImagePackFileStore003
+ * @tc.desc: Test the index of ImagePackFileStore grows and keeps all records.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageFileCacheTestNg, ImagePackFileStore003, TestSize.Level1)
+{
+    auto dirPath = MakePackFileDir();
+    ASSERT_FALSE(dirPath.empty());
+    const size_t recordCount = 3000;
+    {
+        ImagePackFileStore store;
+        ASSERT_TRUE(store.Open(dirPath));
+        for (size_t i = 0; i < recordCount; ++i) {
+            auto key = "http:/testpackfile003/image" + std::to_string(i);
+            ASSERT_TRUE(store.Put(key, "", key.data(), key.size()));
+        }
+        EXPECT_EQ(store.GetRecordCount(), recordCount);
+    }
+    ImagePackFileStore store;
+    ASSERT_TRUE(store.Open(dirPath));
+    EXPECT_EQ(store.GetRecordCount(), recordCount);
+    for (size_t i = 0; i < recordCount; ++i) {
+        auto key = "http:/testpackfile003/image" + std::to_string(i);
+        ImagePackRecord record;
+        ASSERT_TRUE(store.Get(key, "", record));
+        EXPECT_EQ(GetRecordData(record), key);
+    }
+}
+
+/**
+ * @tc.name: ImagePackFileStore004
+ * @tc.desc: Test data handed out by ImagePackFileStore survives a reset of its files.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageFileCacheTestNg, ImagePackFileStore004, TestSize.Level1)
+{
+    auto dirPath = MakePackFileDir();
+    ASSERT_FALSE(dirPath.empty());
+    ImagePackFileStore store;
+    ASSERT_TRUE(store.Open(dirPath));
+
+    /**
+     * @tc.steps: step1. put a record and hold its data.
+     */
+    const std::string key = "http:/testpackfile004/image0";
+    const std::string recordData(100, 'a');
+    ASSERT_TRUE(store.Put(key, "", recordData.data(), recordData.size()));
+    ImagePackRecord heldRecord;
+    ASSERT_TRUE(store.Get(key, "", heldRecord));
+
+    /**
+     * @tc.steps: step2. reset the files, as opening a corrupted index does.
+     * @tc.expected: the store is empty and usable, and the held data is still readable.
+     */
+    ASSERT_TRUE(store.ResetFiles());
+    EXPECT_EQ(store.GetRecordCount(), 0);
+    EXPECT_EQ(store.GetPackSize(), 0);
+    EXPECT_EQ(GetRecordData(heldRecord), recordData);
+    const std::string newData(50, 'b');
+    ASSERT_TRUE(store.Put(key, "", newData.data(), newData.size()));
+    ImagePackRecord record;
+    ASSERT_TRUE(store.Get(key, "", record));
+    EXPECT_EQ(GetRecordData(record), newData);
+}
+
+/**
+ * @tc.name: ImagePackFileStore005
+ * @tc.desc: Test records within and across the mapped chunks of the pack file stay readable while the pack grows.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageFileCacheTestNg, ImagePackFileStore005, TestSize.Level1)
+{
+    auto dirPath = MakePackFileDir();
+    ASSERT_FALSE(dirPath.empty());
+    ImagePackFileStore store;
+    ASSERT_TRUE(store.Open(dirPath));
+
+    /**
+     * @tc.steps: step1. put records of 1MB, read each one after the next is put, and hold the first one.
+     * @tc.expected: the records are read through the mapped chunks, some of them cross a chunk boundary.
+     */
+    const size_t recordCount = 10;
+    const size_t recordSize = 1 << 20;
+    ImagePackRecord heldRecord;
+    for (size_t i = 0; i < recordCount; ++i) {
+        auto key = "http:/testpackfile006/image" + std::to_string(i);
+        std::string recordData(recordSize, static_cast<char>('a' + i));
+        ASSERT_TRUE(store.Put(key, "", recordData.data(), recordData.size()));
+        ImagePackRecord record;
+        ASSERT_TRUE(store.Get(key, "", i == 0 ? heldRecord : record));
+        EXPECT_EQ(GetRecordData(i == 0 ? heldRecord : record), recordData);
+    }
+    EXPECT_EQ(store.packChunks_.size(), store.GetPackSize() / (4 << 20) + 1);
+
+    /**
+     * @tc.steps: step2. read all records again.
+     * @tc.expected: all records, and the held one, are intact.
+     */
+    for (size_t i = 0; i < recordCount; ++i) {
+        auto key = "http:/testpackfile006/image" + std::to_string(i);
+        ImagePackRecord record;
+        ASSERT_TRUE(store.Get(key, "", record));
+        EXPECT_EQ(GetRecordData(record), std::string(recordSize, static_cast<char>('a' + i)));
+    }
+    EXPECT_EQ(GetRecordData(heldRecord), std::string(recordSize, 'a'));
+}
+
+/**
+ * @tc.name: WriteCacheFileFunc005
+ * @tc.desc: Test WriteCacheFile and EraseCacheFile with the pack file store.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageFileCacheTestNg, WriteCacheFileFunc005, TestSize.Level1)
+{
+    auto dirPath = MakePackFileDir();
+    ASSERT_FALSE(dirPath.empty());
+    auto& fileCache = ImageFileCache::GetInstance();
+    ASSERT_TRUE(fileCache.packFileStore_.Open(dirPath));
+    fileCache.usePackFileStore_ = true;
+
+    /**
+     * @tc.steps: step1. write an image to the cache.
+     * @tc.expected: the image is in the pack file and not in the list of cache files.
+     */
+    std::vector<uint8_t> imageData = { 1, 2, 3, 4, 5, 6 };
+    std::string url = "http:/testfilecache005/image";
+    fileCache.WriteCacheFile(url, imageData.data(), imageData.size());
+    EXPECT_TRUE(fileCache.packFileStore_.Contains(url, ""));
+    EXPECT_TRUE(fileCache.cacheFileInfo_.empty());
+    EXPECT_EQ(fileCache.GetCacheFilePath(url), "");
+
+    /**
+     * @tc.steps: step2. limit the cache to about four images and write five more.
+     * @tc.expected: the least recently used images are dropped when the limit is exceeded.
+     */
+    auto fileLimit = fileCache.fileLimit_.load();
+    auto recordSize = fileCache.packFileStore_.GetLiveSize();
+    auto newFileLimit = recordSize * 4 + recordSize / 2;
+    fileCache.SetCacheFileLimit(newFileLimit);
+    for (int32_t i = 0; i < 5; ++i) {
+        fileCache.WriteCacheFile(url + std::to_string(i), imageData.data(), imageData.size());
+    }
+    EXPECT_LE(fileCache.packFileStore_.GetLiveSize(), newFileLimit);
+    EXPECT_FALSE(fileCache.packFileStore_.Contains(url, ""));
+    EXPECT_FALSE(fileCache.packFileStore_.Contains(url + "1", ""));
+    EXPECT_TRUE(fileCache.packFileStore_.Contains(url + "3", ""));
+    EXPECT_TRUE(fileCache.packFileStore_.Contains(url + "4", ""));
+
+    /**
+     * @tc.steps: step3. erase the last image.
+     */
+    fileCache.EraseCacheFile(url + "4");
+    EXPECT_FALSE(fileCache.packFileStore_.Contains(url + "4", ""));
+
+    fileCache.SetCacheFileLimit(fileLimit);
+    fileCache.usePackFileStore_ = false;
+    fileCache.packFileStore_.Close();
+}
+
+/**
+ * @tc.name: WriteCacheFileFunc006
+ * @tc.desc: Test an image in the pack file store is converted to astc.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageFileCacheTestNg, WriteCacheFileFunc006, TestSize.Level1)
+{
+    auto dirPath = MakePackFileDir();
+    ASSERT_FALSE(dirPath.empty());
+    auto& fileCache = ImageFileCache::GetInstance();
+    ASSERT_TRUE(fileCache.packFileStore_.Open(dirPath));
+    fileCache.usePackFileStore_ = true;
+    RefPtr<MockImagePacker> mockImagePacker = AceType::MakeRefPtr<MockImagePacker>();
+    RefPtr<MockImageSource> mockImageSource = AceType::MakeRefPtr<MockImageSource>();
+    RefPtr<MockPixelMap> mockPixelMap = AceType::MakeRefPtr<MockPixelMap>();
+    MockImagePacker::mockImagePacker_ = mockImagePacker;
+    MockImageSource::mockImageSource_ = mockImageSource;
+
+    /**
+     * @tc.steps: step1. write an image to the cache and convert it to astc.
+     * @tc.expected: the record of the image is replaced by the astc one.
+     */
+    std::vector<uint8_t> imageData = { 1, 2, 3, 4, 5, 6 };
+    std::string url = "http:/testfilecache006/image";
+    fileCache.WriteCacheFile(url, imageData.data(), imageData.size());
+    const int64_t astcSize = 48;
+    EXPECT_CALL(*mockImageSource, GetFrameCount()).WillOnce(Return(1));
+    EXPECT_CALL(*mockImageSource, CreatePixelMap(_, AIImageQuality::NONE, false)).WillOnce(Return(mockPixelMap));
+    EXPECT_CALL(*mockPixelMap, GetWidth()).WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockPixelMap, GetHeight()).WillRepeatedly(Return(8));
+    EXPECT_CALL(*mockImagePacker, FinalizePacking(_)).WillOnce(DoAll(SetArgReferee<0>(astcSize), Return(0)));
+    fileCache.ConvertToAstcAndWriteToPackFileStore(url, imageData.data(), imageData.size());
+    EXPECT_TRUE(fileCache.packFileStore_.Contains(url, ASTC_SUFFIX));
+    EXPECT_EQ(fileCache.packFileStore_.GetRecordCount(), 1);
+
+    fileCache.usePackFileStore_ = false;
+    fileCache.packFileStore_.Close();
+}
 } // namespace OHOS::Ace::NG
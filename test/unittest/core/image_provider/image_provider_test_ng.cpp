@@ -53,6 +53,8 @@ using namespace testing::ext;
 namespace {
 const char* SRC_JPG = "file://data/data/com.example.test/res/exampleAlt.jpg";
 const char* SRC_THUMBNAIL = "datashare:///media/9/thumbnail/300/300";
+const char* SRC_PNG = "file://data/data/com.example.test/res/example.png";
+const char* SRC_NETWORK = "https://www.example.com/example.png";
 constexpr int32_t LENGTH_100 = 100;
 constexpr int32_t LENGTH_65 = 65;
 constexpr int32_t LENGTH_64 = 64;
@@ -526,8 +528,11 @@ HWTEST_F(ImageProviderTestNg, ImageProviderTestNg006, TestSize.Level1)
  */
 HWTEST_F(ImageProviderTestNg, ImageProviderTestNg007, TestSize.Level1)
 {
-    EXPECT_CALL(*g_loader, LoadImageData).Times(1);
+    EXPECT_CALL(*g_loader, LoadImageData).Times(0);
     auto src = ImageSourceInfo(SRC_JPG);
+    // occupy all slots so the task stays pending
+    auto runningTasks = ImageProvider::runningTasks_;
+    ImageProvider::runningTasks_.fill(INT32_MAX);
     // create 2 repeated tasks
     std::vector<RefPtr<ImageLoadingContext>> contexts(2);
     for (auto& ctx : contexts) {
@@ -538,9 +543,8 @@ HWTEST_F(ImageProviderTestNg, ImageProviderTestNg007, TestSize.Level1)
         std::scoped_lock<std::mutex> lock(ImageProvider::taskMtx_);
         EXPECT_EQ(ImageProvider::tasks_.size(), (size_t)1);
         auto it = ImageProvider::tasks_.find(src.GetKey());
-        EXPECT_NE(it, ImageProvider::tasks_.end());
-        // set impl_ to false to force successful cancellation
-        it->second.bgTask_.impl_ = nullptr;
+        ASSERT_NE(it, ImageProvider::tasks_.end());
+        EXPECT_TRUE(it->second.pending_);
     }
 
     for (auto& ctx : contexts) {
@@ -551,7 +555,9 @@ HWTEST_F(ImageProviderTestNg, ImageProviderTestNg007, TestSize.Level1)
     {
         std::scoped_lock<std::mutex> lock(ImageProvider::taskMtx_);
         EXPECT_EQ(ImageProvider::tasks_.size(), (size_t)0);
+        EXPECT_TRUE(ImageProvider::pendingTasks_[static_cast<size_t>(ImageLoadPriority::ONSCREEN)].empty());
     }
+    ImageProvider::runningTasks_ = runningTasks;
     WaitForAsyncTasks();
     {
         std::scoped_lock<std::mutex> lock(ImageProvider::taskMtx_);
@@ -559,6 +565,145 @@ HWTEST_F(ImageProviderTestNg, ImageProviderTestNg007, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: ImageProviderTestNg010
+ * @tc.desc: Test a running task stops at its next check after its last LoadingContext cancels it
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTestNg, ImageProviderTestNg010, TestSize.Level1)
+{
+    auto src = ImageSourceInfo(SRC_JPG);
+    ASSERT_TRUE(ImageProvider::RegisterTask(src.GetKey(), nullptr));
+    {
+        std::scoped_lock<std::mutex> lock(ImageProvider::taskMtx_);
+        ImageProvider::tasks_[src.GetKey()].running_ = true;
+    }
+    /**
+     * @tc.steps: step1. cancel the running task.
+     * @tc.expected: the task is kept until it checks, then it stops and is removed.
+     */
+    ImageProvider::CancelTask(src.GetKey(), nullptr);
+    EXPECT_EQ(ImageProvider::tasks_.size(), (size_t)1);
+    EXPECT_CALL(*g_loader, LoadImageData).Times(0);
+    ImageProvider::CreateImageObjHelper(src);
+    EXPECT_EQ(ImageProvider::tasks_.size(), (size_t)0);
+
+    /**
+     * @tc.steps: step2. cancel a running task, then register another LoadingContext for it.
+     * @tc.expected: the task is no longer canceled and loads for the new LoadingContext.
+     */
+    ASSERT_TRUE(ImageProvider::RegisterTask(src.GetKey(), nullptr));
+    ImageProvider::tasks_[src.GetKey()].running_ = true;
+    ImageProvider::CancelTask(src.GetKey(), nullptr);
+    EXPECT_TRUE(ImageProvider::tasks_[src.GetKey()].canceled_);
+    auto ctx = AceType::MakeRefPtr<ImageLoadingContext>(src, LoadNotifier(nullptr, nullptr, nullptr));
+    EXPECT_FALSE(ImageProvider::RegisterTask(src.GetKey(), WeakClaim(RawPtr(ctx))));
+    EXPECT_FALSE(ImageProvider::AbortIfCanceled(src.GetKey()));
+    ImageProvider::EndTask(src.GetKey());
+    EXPECT_EQ(ImageProvider::tasks_.size(), (size_t)0);
+}
+
+/**
+ * @tc.name: ImageProviderTestNg011
+ * @tc.desc: Test pending tasks start by priority and follow priority changes of their LoadingContexts
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTestNg, ImageProviderTestNg011, TestSize.Level1)
+{
+    auto runningTasks = ImageProvider::runningTasks_;
+    ImageProvider::runningTasks_.fill(INT32_MAX);
+    /**
+     * @tc.steps: step1. load an image built ahead of being shown and an image on screen.
+     * @tc.expected: both tasks wait in the queue of their priority.
+     */
+    auto prefetchSrc = ImageSourceInfo(SRC_JPG);
+    auto prefetchCtx = AceType::MakeRefPtr<ImageLoadingContext>(prefetchSrc, LoadNotifier(nullptr, nullptr, nullptr));
+    prefetchCtx->SetLoadPriority(ImageLoadPriority::PREFETCH);
+    prefetchCtx->LoadImageData();
+    auto onscreenSrc = ImageSourceInfo(SRC_PNG);
+    auto onscreenCtx = AceType::MakeRefPtr<ImageLoadingContext>(onscreenSrc, LoadNotifier(nullptr, nullptr, nullptr));
+    onscreenCtx->LoadImageData();
+    const auto& onscreenTasks = ImageProvider::pendingTasks_[static_cast<size_t>(ImageLoadPriority::ONSCREEN)];
+    const auto& prefetchTasks = ImageProvider::pendingTasks_[static_cast<size_t>(ImageLoadPriority::PREFETCH)];
+    const auto& offscreenTasks = ImageProvider::pendingTasks_[static_cast<size_t>(ImageLoadPriority::OFFSCREEN)];
+    EXPECT_EQ(onscreenTasks.size(), (size_t)1);
+    EXPECT_EQ(prefetchTasks.size(), (size_t)1);
+
+    /**
+     * @tc.steps: step2. move the images on and off the screen.
+     * @tc.expected: the pending tasks move to the queue of the new priority.
+     */
+    onscreenCtx->SetLoadPriority(ImageLoadPriority::OFFSCREEN);
+    prefetchCtx->SetLoadPriority(ImageLoadPriority::ONSCREEN);
+    ASSERT_EQ(onscreenTasks.size(), (size_t)1);
+    EXPECT_EQ(onscreenTasks.front(), prefetchSrc.GetKey());
+    EXPECT_TRUE(prefetchTasks.empty());
+    ASSERT_EQ(offscreenTasks.size(), (size_t)1);
+    EXPECT_EQ(offscreenTasks.front(), onscreenSrc.GetKey());
+
+    /**
+     * @tc.steps: step3. free one slot of each priority.
+     * @tc.expected: both tasks start.
+     */
+    // 4 onscreen, 2 prefetch and 1 offscreen tasks run at most
+    ImageProvider::runningTasks_ = { 3, 1, 0 };
+    ImageProvider::PostPendingTasks();
+    EXPECT_TRUE(onscreenTasks.empty());
+    EXPECT_TRUE(offscreenTasks.empty());
+    WaitForAsyncTasks();
+    EXPECT_EQ(ImageProvider::runningTasks_[static_cast<size_t>(ImageLoadPriority::ONSCREEN)], 3);
+    EXPECT_EQ(ImageProvider::runningTasks_[static_cast<size_t>(ImageLoadPriority::OFFSCREEN)], 0);
+    ImageProvider::runningTasks_ = runningTasks;
+}
+
+/**
+ * @tc.name: ImageProviderTestNg012
+ * @tc.desc: Test network loads use their own slots and do not hold back other tasks
+ * @tc.type: FUNC
+ */
+HWTEST_F(ImageProviderTestNg, ImageProviderTestNg012, TestSize.Level1)
+{
+    auto runningTasks = ImageProvider::runningTasks_;
+    auto networkRunningTasks = ImageProvider::networkRunningTasks_;
+    ImageProvider::runningTasks_.fill(INT32_MAX);
+    ImageProvider::networkRunningTasks_.fill(INT32_MAX);
+    /**
+     * @tc.steps: step1. load a network image and a local image on screen.
+     * @tc.expected: each task waits in its own queue.
+     */
+    auto networkSrc = ImageSourceInfo(SRC_NETWORK);
+    auto networkCtx = AceType::MakeRefPtr<ImageLoadingContext>(networkSrc, LoadNotifier(nullptr, nullptr, nullptr));
+    networkCtx->LoadImageData();
+    auto localSrc = ImageSourceInfo(SRC_PNG);
+    auto localCtx = AceType::MakeRefPtr<ImageLoadingContext>(localSrc, LoadNotifier(nullptr, nullptr, nullptr));
+    localCtx->LoadImageData();
+    const auto& networkTasks = ImageProvider::networkPendingTasks_[static_cast<size_t>(ImageLoadPriority::ONSCREEN)];
+    const auto& localTasks = ImageProvider::pendingTasks_[static_cast<size_t>(ImageLoadPriority::ONSCREEN)];
+    ASSERT_EQ(networkTasks.size(), (size_t)1);
+    EXPECT_EQ(networkTasks.front(), networkSrc.GetKey());
+    ASSERT_EQ(localTasks.size(), (size_t)1);
+    EXPECT_EQ(localTasks.front(), localSrc.GetKey());
+
+    /**
+     * @tc.steps: step2. free one slot of the other tasks while all network slots are taken.
+     * @tc.expected: the local task starts, the network task keeps waiting.
+     */
+    ImageProvider::runningTasks_ = { 3, 2, 1 };
+    ImageProvider::PostPendingTasks();
+    EXPECT_TRUE(localTasks.empty());
+    EXPECT_EQ(networkTasks.size(), (size_t)1);
+    WaitForAsyncTasks();
+
+    /**
+     * @tc.steps: step3. release the network image.
+     * @tc.expected: its pending task is dropped.
+     */
+    networkCtx = nullptr;
+    EXPECT_TRUE(networkTasks.empty());
+    ImageProvider::runningTasks_ = runningTasks;
+    ImageProvider::networkRunningTasks_ = networkRunningTasks;
+}
+
 /**
  * @tc.name: RoundUp001
  * @tc.desc: Test RoundUp with invalid input (infinite loop)
@@ -0,0 +1,318 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "test/mock/core/common/mock_container.h"
+#include "test/mock/core/pipeline/mock_pipeline_context.h"
+
+#include "base/memory/ace_type.h"
+#include "core/common/ace_application_info.h"
+#include "core/components/common/layout/constants.h"
+#include "core/components/common/properties/color.h"
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/property/property.h"
+#include "core/interfaces/arkoala/arkoala_api.h"
+#include "core/interfaces/native/node/node_common_modifier.h"
+#include "core/pipeline/base/element_register.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr double UNIT_VP = static_cast<double>(DimensionUnit::VP);
+constexpr double WIDTH = 100.0;
+constexpr double HEIGHT = 50.0;
+constexpr double OPACITY = 0.5;
+constexpr double Z_INDEX = 3.0;
+constexpr double UINT32_RANGE = 4294967296.0;
+constexpr double UNKNOWN_OP = ARKUI_ATTRIBUTE_BATCH_OP_COUNT;
+constexpr double OPAQUE_RED = 0xFFFF0000;
+constexpr double TRANSLUCENT_RED = 0x80FF0000;
+constexpr double RED_WITHOUT_ALPHA = 0x00FF0000;
+constexpr int32_t API_VERSION_ELEVEN = 11;
+constexpr int32_t API_VERSION_TWELVE = 12;
+} // namespace
+
+class NodeCommonModifierTestNg : public testing::Test {
+public:
+    static void SetUpTestSuite();
+    static void TearDownTestSuite();
+    void SetUp() override;
+
+    int32_t ApplyBatch(const std::vector<double>& commands)
+    {
+        return NodeModifier::GetCommonModifier()->applyAttributeBatch(reinterpret_cast<ArkUINodeHandle>(
+            AceType::RawPtr(frameNode_)), commands.data(), static_cast<ArkUI_Int32>(commands.size()));
+    }
+
+    std::optional<CalcLength> GetWidth() const
+    {
+        const auto& constraint = frameNode_->GetLayoutProperty()->GetCalcLayoutConstraint();
+        if (!constraint || !constraint->selfIdealSize) {
+            return std::nullopt;
+        }
+        return constraint->selfIdealSize->Width();
+    }
+
+    std::optional<CalcLength> GetHeight() const
+    {
+        const auto& constraint = frameNode_->GetLayoutProperty()->GetCalcLayoutConstraint();
+        if (!constraint || !constraint->selfIdealSize) {
+            return std::nullopt;
+        }
+        return constraint->selfIdealSize->Height();
+    }
+
+    std::optional<FlexAlign> GetAlignSelf() const
+    {
+        const auto& flexItemProperty = frameNode_->GetLayoutProperty()->GetFlexItemProperty();
+        if (!flexItemProperty) {
+            return std::nullopt;
+        }
+        return flexItemProperty->GetAlignSelf();
+    }
+
+    RefPtr<FrameNode> frameNode_;
+};
+
+void NodeCommonModifierTestNg::SetUpTestSuite()
+{
+    MockPipelineContext::SetUp();
+    MockContainer::SetUp();
+}
+
+void NodeCommonModifierTestNg::TearDownTestSuite()
+{
+    MockPipelineContext::TearDown();
+    MockContainer::TearDown();
+}
+
+void NodeCommonModifierTestNg::SetUp()
+{
+    AceApplicationInfo::GetInstance().SetApiTargetVersion(API_VERSION_TWELVE);
+    frameNode_ = FrameNode::CreateFrameNode(
+        "Column", ElementRegister::GetInstance()->MakeUniqueId(), AceType::MakeRefPtr<Pattern>());
+    ASSERT_NE(frameNode_, nullptr);
+    frameNode_->SetLayoutDirtyMarked(false);
+}
+
+/**
+ * @tc.name: ApplyAttributeBatch001
+ * @tc.desc: Test the commands of a batch are applied in order and counted.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NodeCommonModifierTestNg, ApplyAttributeBatch001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. apply a width, a height, an opacity and a zIndex in one batch.
+     * @tc.expected: the four commands are applied and returned as the count.
+     */
+    auto applied = ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_WIDTH, 2, WIDTH, UNIT_VP, ARKUI_ATTRIBUTE_BATCH_HEIGHT, 2,
+        HEIGHT, UNIT_VP, ARKUI_ATTRIBUTE_BATCH_OPACITY, 1, OPACITY, ARKUI_ATTRIBUTE_BATCH_Z_INDEX, 1, Z_INDEX });
+    EXPECT_EQ(applied, 4);
+    ASSERT_TRUE(GetWidth().has_value());
+    EXPECT_EQ(GetWidth()->GetDimension(), Dimension(WIDTH, DimensionUnit::VP));
+    ASSERT_TRUE(GetHeight().has_value());
+    EXPECT_EQ(GetHeight()->GetDimension(), Dimension(HEIGHT, DimensionUnit::VP));
+    auto renderContext = frameNode_->GetRenderContext();
+    EXPECT_DOUBLE_EQ(renderContext->GetOpacityValue(1.0), OPACITY);
+    EXPECT_EQ(renderContext->GetZIndexValue(0), static_cast<int32_t>(Z_INDEX));
+
+    /**
+     * @tc.steps: step2. set and reset the width in one batch, then reset and set the height.
+     * @tc.expected: the last command of each attribute wins.
+     */
+    applied = ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_WIDTH, 2, WIDTH, UNIT_VP, ARKUI_ATTRIBUTE_BATCH_WIDTH, 0,
+        ARKUI_ATTRIBUTE_BATCH_HEIGHT, 0, ARKUI_ATTRIBUTE_BATCH_HEIGHT, 2, WIDTH, UNIT_VP });
+    EXPECT_EQ(applied, 4);
+    EXPECT_FALSE(GetWidth().has_value());
+    ASSERT_TRUE(GetHeight().has_value());
+    EXPECT_EQ(GetHeight()->GetDimension(), Dimension(WIDTH, DimensionUnit::VP));
+}
+
+/**
+ * @tc.name: ApplyAttributeBatch002
+ * @tc.desc: Test a command with a wrong count of arguments or an unknown attribute is skipped.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NodeCommonModifierTestNg, ApplyAttributeBatch002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. apply a width with one argument, an opacity with two and an unknown attribute.
+     * @tc.expected: they are skipped by their count of arguments and the zIndex after them is applied.
+     */
+    auto applied = ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_WIDTH, 1, WIDTH, ARKUI_ATTRIBUTE_BATCH_OPACITY, 2, OPACITY,
+        OPACITY, UNKNOWN_OP, 1, WIDTH, -1, 1, WIDTH, ARKUI_ATTRIBUTE_BATCH_Z_INDEX, 1, Z_INDEX });
+    EXPECT_EQ(applied, 1);
+    EXPECT_FALSE(GetWidth().has_value());
+    auto renderContext = frameNode_->GetRenderContext();
+    EXPECT_FALSE(renderContext->HasOpacity());
+    EXPECT_EQ(renderContext->GetZIndexValue(0), static_cast<int32_t>(Z_INDEX));
+
+    /**
+     * @tc.steps: step2. apply a batch of only skipped commands.
+     * @tc.expected: nothing is applied and the node is not marked dirty.
+     */
+    frameNode_->SetLayoutDirtyMarked(false);
+    applied = ApplyBatch({ UNKNOWN_OP, 0, ARKUI_ATTRIBUTE_BATCH_WIDTH, 1, WIDTH });
+    EXPECT_EQ(applied, 0);
+    EXPECT_FALSE(frameNode_->IsLayoutDirtyMarked());
+}
+
+/**
+ * @tc.name: ApplyAttributeBatch003
+ * @tc.desc: Test a truncated batch stops at the command running past its end.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NodeCommonModifierTestNg, ApplyAttributeBatch003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. apply a zIndex followed by a width missing its unit.
+     * @tc.expected: the zIndex is applied and the width is not.
+     */
+    auto applied =
+        ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_Z_INDEX, 1, Z_INDEX, ARKUI_ATTRIBUTE_BATCH_WIDTH, 2, WIDTH });
+    EXPECT_EQ(applied, 1);
+    EXPECT_EQ(frameNode_->GetRenderContext()->GetZIndexValue(0), static_cast<int32_t>(Z_INDEX));
+    EXPECT_FALSE(GetWidth().has_value());
+
+    /**
+     * @tc.steps: step2. apply a batch whose last command has a header only, and one with a huge count of arguments.
+     * @tc.expected: the commands before them are applied.
+     */
+    applied = ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_OPACITY, 1, OPACITY, ARKUI_ATTRIBUTE_BATCH_WIDTH });
+    EXPECT_EQ(applied, 1);
+    applied = ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_WIDTH, UINT32_RANGE, WIDTH, UNIT_VP });
+    EXPECT_EQ(applied, 0);
+    EXPECT_FALSE(GetWidth().has_value());
+
+    /**
+     * @tc.steps: step3. apply an empty batch and a null buffer.
+     * @tc.expected: nothing is applied.
+     */
+    EXPECT_EQ(ApplyBatch({}), 0);
+    EXPECT_EQ(NodeModifier::GetCommonModifier()->applyAttributeBatch(
+        reinterpret_cast<ArkUINodeHandle>(AceType::RawPtr(frameNode_)), nullptr, 1), 0);
+}
+
+/**
+ * @tc.name: ApplyAttributeBatch004
+ * @tc.desc: Test the node is marked dirty once for the batch and its frame requests are resumed.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NodeCommonModifierTestNg, ApplyAttributeBatch004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. apply a render and a measure attribute, then a truncated batch.
+     * @tc.expected: the node is marked dirty for a layout and its property flag needs a measure.
+     */
+    auto applied = ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_OPACITY, 1, OPACITY, ARKUI_ATTRIBUTE_BATCH_WIDTH, 2, WIDTH,
+        UNIT_VP, ARKUI_ATTRIBUTE_BATCH_HEIGHT, 2, HEIGHT });
+    EXPECT_EQ(applied, 2);
+    EXPECT_TRUE(frameNode_->IsLayoutDirtyMarked());
+    EXPECT_TRUE(CheckNeedMeasure(frameNode_->GetLayoutProperty()->GetPropertyChangeFlag()));
+
+    /**
+     * @tc.steps: step2. request a frame of the render context after the batches.
+     * @tc.expected: the request is made at once, so the batches did not leave the requests suspended.
+     */
+    int32_t requestCount = 0;
+    auto renderContext = frameNode_->GetRenderContext();
+    renderContext->SetRequestFrame([&requestCount]() { ++requestCount; });
+    renderContext->RequestNextFrame();
+    EXPECT_EQ(requestCount, 1);
+}
+
+/**
+ * @tc.name: ApplyAttributeBatch005
+ * @tc.desc: Test the batch checks a color, a visibility, an alignSelf and a zIndex the way the setters of the bridge do.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NodeCommonModifierTestNg, ApplyAttributeBatch005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. apply a color without alpha, then a translucent one.
+     * @tc.expected: the color without alpha is opaque and the alpha of the other one is kept.
+     */
+    auto renderContext = frameNode_->GetRenderContext();
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_BACKGROUND_COLOR, 1, RED_WITHOUT_ALPHA });
+    EXPECT_EQ(renderContext->GetBackgroundColorValue(Color::TRANSPARENT).GetValue(),
+        static_cast<uint32_t>(OPAQUE_RED));
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_BACKGROUND_COLOR, 1, TRANSLUCENT_RED });
+    EXPECT_EQ(renderContext->GetBackgroundColorValue(Color::TRANSPARENT).GetValue(),
+        static_cast<uint32_t>(TRANSLUCENT_RED));
+
+    /**
+     * @tc.steps: step2. apply a visibility in the range, then out of it.
+     * @tc.expected: the visibility out of the range is VISIBLE.
+     */
+    auto layoutProperty = frameNode_->GetLayoutProperty();
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_VISIBILITY, 1, static_cast<double>(VisibleType::GONE) });
+    EXPECT_EQ(layoutProperty->GetVisibilityValue(VisibleType::VISIBLE), VisibleType::GONE);
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_VISIBILITY, 1, static_cast<double>(VisibleType::GONE) + 1 });
+    EXPECT_EQ(layoutProperty->GetVisibilityValue(VisibleType::GONE), VisibleType::VISIBLE);
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_VISIBILITY, 1, -1 });
+    EXPECT_EQ(layoutProperty->GetVisibilityValue(VisibleType::GONE), VisibleType::VISIBLE);
+
+    /**
+     * @tc.steps: step3. apply an alignSelf in the range, then out of it.
+     * @tc.expected: the alignSelf out of the range is AUTO.
+     */
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_ALIGN_SELF, 1, static_cast<double>(FlexAlign::CENTER) });
+    EXPECT_EQ(GetAlignSelf(), FlexAlign::CENTER);
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_ALIGN_SELF, 1, UINT32_RANGE });
+    EXPECT_EQ(GetAlignSelf(), FlexAlign::AUTO);
+
+    /**
+     * @tc.steps: step4. apply a zIndex out of the range of an int.
+     * @tc.expected: it wraps around as the int32 conversion of the frontend does.
+     */
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_Z_INDEX, 1, UINT32_RANGE + Z_INDEX });
+    EXPECT_EQ(renderContext->GetZIndexValue(0), static_cast<int32_t>(Z_INDEX));
+}
+
+/**
+ * @tc.name: ApplyAttributeBatch006
+ * @tc.desc: Test a negative length of the batch depends on the target api version as the setters of the bridge do.
+ * @tc.type: FUNC
+ */
+HWTEST_F(NodeCommonModifierTestNg, ApplyAttributeBatch006, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. apply a width, then a negative one with the target api version 12.
+     * @tc.expected: the negative width resets the width.
+     */
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_WIDTH, 2, WIDTH, UNIT_VP });
+    ASSERT_TRUE(GetWidth().has_value());
+    EXPECT_EQ(ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_WIDTH, 2, -WIDTH, UNIT_VP }), 1);
+    EXPECT_FALSE(GetWidth().has_value());
+
+    /**
+     * @tc.steps: step2. apply a negative height with the target api version 11.
+     * @tc.expected: the negative height is 0.
+     */
+    AceApplicationInfo::GetInstance().SetApiTargetVersion(API_VERSION_ELEVEN);
+    ApplyBatch({ ARKUI_ATTRIBUTE_BATCH_HEIGHT, 2, -HEIGHT, UNIT_VP });
+    ASSERT_TRUE(GetHeight().has_value());
+    EXPECT_EQ(GetHeight()->GetDimension(), Dimension(0.0, DimensionUnit::VP));
+}
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <string>
+
+#include "gtest/gtest.h"
+
+#include "core/components_ng/pattern/custom_paint/canvas_paint_op.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr double LINE_WIDTH = 2.0;
+constexpr double OTHER_LINE_WIDTH = 3.0;
+constexpr size_t PAGE_SIZE = 4096;
+
+template <typename T>
+size_t OpSize()
+{
+    return CanvasPaintOp::AlignPtr(sizeof(T));
+}
+} // namespace
+
+class CanvasPaintOpTestNg : public testing::Test {};
+
+/**
+ * @tc.name: CanvasPaintOpTest001
+ * @tc.desc: Test folding the state ops which do not change the state
+ * @tc.type: FUNC
+ */
+HWTEST_F(CanvasPaintOpTestNg, CanvasPaintOpTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set the same line width around a fill.
+     * @tc.expected: the second op is dropped.
+     */
+    CanvasPaintOp ops;
+    ops.Push<SetLineWidthOp>(0, LINE_WIDTH);
+    ops.Push<FillOp>(0);
+    ops.Push<SetLineWidthOp>(0, LINE_WIDTH);
+    EXPECT_EQ(ops.UsedSize(), OpSize<SetLineWidthOp>() + OpSize<FillOp>());
+
+    /**
+     * @tc.steps: step2. set two other line widths in a row.
+     * @tc.expected: the second op replaces the first one.
+     */
+    ops.Push<SetLineWidthOp>(0, OTHER_LINE_WIDTH);
+    ops.Push<SetLineWidthOp>(0, LINE_WIDTH);
+    EXPECT_EQ(ops.UsedSize(), OpSize<SetLineWidthOp>() * 2 + OpSize<FillOp>());
+
+    /**
+     * @tc.steps: step3. set the same line width after a restore and after a reset.
+     * @tc.expected: the ops are kept.
+     */
+    ops.Push<RestoreOp>(0);
+    ops.Push<SetLineWidthOp>(0, LINE_WIDTH);
+    EXPECT_EQ(ops.UsedSize(), OpSize<SetLineWidthOp>() * 3 + OpSize<FillOp>() + OpSize<RestoreOp>());
+    ops.Reset();
+    EXPECT_TRUE(ops.Empty());
+    ops.Push<SetLineWidthOp>(0, LINE_WIDTH);
+    EXPECT_EQ(ops.UsedSize(), OpSize<SetLineWidthOp>());
+}
+
+/**
+ * @tc.name: CanvasPaintOpTest002
+ * @tc.desc: Test folding the ops setting the fill style
+ * @tc.type: FUNC
+ */
+HWTEST_F(CanvasPaintOpTestNg, CanvasPaintOpTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. set a color, then a gradient, then the color again.
+     * @tc.expected: the gradient changed the fill style, the second color is kept.
+     */
+    CanvasPaintOp ops;
+    ops.Push<SetFillColorOp>(0, Color::RED);
+    ops.Push<FillOp>(0);
+    auto gradient = std::make_shared<Ace::Gradient>();
+    ops.Push<SetFillGradientOp>(0, gradient);
+    ops.Push<FillOp>(0);
+    ops.Push<SetFillColorOp>(0, Color::RED);
+    auto usedSize = ops.UsedSize();
+    EXPECT_EQ(usedSize, OpSize<SetFillColorOp>() * 2 + OpSize<SetFillGradientOp>() + OpSize<FillOp>() * 2);
+
+    /**
+     * @tc.steps: step2. set the color again, then the same gradient.
+     * @tc.expected: the color is dropped, gradients are never folded as they may have changed.
+     */
+    ops.Push<FillOp>(0);
+    ops.Push<SetFillColorOp>(0, Color::RED);
+    EXPECT_EQ(ops.UsedSize(), usedSize + OpSize<FillOp>());
+    ops.Push<SetFillGradientOp>(0, gradient);
+    ops.Push<FillOp>(0);
+    ops.Push<SetFillGradientOp>(0, gradient);
+    EXPECT_EQ(ops.UsedSize(), usedSize + OpSize<FillOp>() * 2 + OpSize<SetFillGradientOp>() * 2);
+}
+
+/**
+ * @tc.name: CanvasPaintOpTest003
+ * @tc.desc: Test growing the op buffer
+ * @tc.type: FUNC
+ */
+HWTEST_F(CanvasPaintOpTestNg, CanvasPaintOpTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. record ops beyond one page.
+     * @tc.expected: the buffer grows and keeps the ops.
+     */
+    CanvasPaintOp ops;
+    size_t count = 0;
+    while (ops.UsedSize() <= PAGE_SIZE) {
+        ops.Push<MoveToOp>(0, static_cast<double>(count), 0.0);
+        count++;
+    }
+    EXPECT_EQ(ops.UsedSize(), OpSize<MoveToOp>() * count);
+    EXPECT_GE(ops.AllocatedSize(), ops.UsedSize());
+}
+} // namespace OHOS::Ace::NG
@@ -13,6 +13,8 @@
  * limitations under the License.
  */
 
+#include <thread>
+
 #include "list_test_ng.h"
 
 namespace OHOS::Ace::NG {
@@ -1148,6 +1150,63 @@ HWTEST_F(ListLayoutTestNg, PaintMethod006, TestSize.Level1)
     }
 }
 
+/**
+ * @tc.name: PaintMethod007
+ * @tc.desc: Test List paint method plans the dividers on a render worker
+ * @tc.type: FUNC
+ */
+HWTEST_F(ListLayoutTestNg, PaintMethod007, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create list with divider and two lanes, press the second item
+     */
+    ListModelNG model = CreateList();
+    model.SetDivider(ITEM_DIVIDER);
+    model.SetLanes(2);
+    CreateListItems(TOTAL_ITEM_NUMBER);
+    CreateDone(frameNode_);
+    pattern_->SetItemPressed(true, GetChildFrameNode(frameNode_, 1)->GetId());
+    auto renderContext = frameNode_->GetRenderContext();
+    renderContext->UpdatePaintRect(frameNode_->GetGeometryNode()->GetFrameRect());
+
+    /**
+     * @tc.steps: step2. Update the content modifier on the UI thread only
+     */
+    UpdateContentModifier();
+    auto dividerList = pattern_->listContentModifier_->dividerList_->Get();
+    auto expectMap = AceType::DynamicCast<ListDividerArithmetic>(dividerList)->GetDividerMap();
+    EXPECT_FALSE(expectMap.empty());
+
+    /**
+     * @tc.steps: step3. Run the background part of the paint wrapper on another thread, then flush the render
+     * @tc.expected: the paint wrapper can run on a render worker and the divider map is the same
+     */
+    auto paintWrapper = frameNode_->CreatePaintWrapper();
+    ASSERT_NE(paintWrapper, nullptr);
+    EXPECT_EQ(paintWrapper->CanRunOnWhichThread(), MAIN_TASK | BACKGROUND_TASK);
+    std::thread worker([paintWrapper]() { paintWrapper->FlushBackground(); });
+    worker.join();
+    paintWrapper->FlushRender();
+    dividerList = pattern_->listContentModifier_->dividerList_->Get();
+    auto dividerMap = AceType::DynamicCast<ListDividerArithmetic>(dividerList)->GetDividerMap();
+    ASSERT_EQ(dividerMap.size(), expectMap.size());
+    for (const auto& [key, divider] : expectMap) {
+        ASSERT_EQ(dividerMap.count(key), 1);
+        EXPECT_EQ(dividerMap[key].offset, divider.offset);
+        EXPECT_EQ(dividerMap[key].length, divider.length);
+    }
+
+    /**
+     * @tc.steps: step4. Create the render task of the list
+     * @tc.expected: the task has a background part
+     */
+    frameNode_->isRenderDirtyMarked_ = true;
+    auto task = frameNode_->CreateRenderTask();
+    ASSERT_TRUE(task.has_value());
+    EXPECT_EQ(task->GetTaskThreadType(), MAIN_TASK | BACKGROUND_TASK);
+    EXPECT_TRUE(task->GetBackgroundTask());
+}
+
 /**
  * @tc.name: OnModifyDone001
  * @tc.desc: Test list_pattern OnModifyDone
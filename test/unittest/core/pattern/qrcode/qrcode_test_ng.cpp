@@ -655,4 +655,46 @@ HWTEST_F(QRCodeTestNg, UpdateContentModifier001, TestSize.Level1)
     qrCodePaintMethod->UpdateContentModifier(paintWrapper2);
     EXPECT_FALSE(renderContext2->HasForegroundColor());
 }
+
+/**
+ * @tc.name: QRCodePaintMethodTaskThread001
+ * @tc.desc: test qrcodePaintMethod modifier update stays on the UI thread
+ * @tc.type: FUNC
+ */
+HWTEST_F(QRCodeTestNg, QRCodePaintMethodTaskThread001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: steps1. Create qrCodeModel and qrCodePaintMethod
+     */
+    QRCodeModelNG qrCodeModelNG;
+    qrCodeModelNG.Create(CREATE_VALUE);
+    auto frameNode = AceType::DynamicCast<FrameNode>(ViewStackProcessor::GetInstance()->Finish());
+    ASSERT_NE(frameNode, nullptr);
+    auto qrCodePattern = frameNode->GetPattern<QRCodePattern>();
+    ASSERT_NE(qrCodePattern, nullptr);
+    auto qrCodePaintMethod = AceType::DynamicCast<QRCodePaintMethod>(qrCodePattern->CreateNodePaintMethod());
+    ASSERT_NE(qrCodePaintMethod, nullptr);
+
+    /**
+     * @tc.steps: steps2. Set the paint method to a paintWrapper
+     * @tc.expected: the paintWrapper has no work for a render worker
+     */
+    auto qrcodePaintProperty = frameNode->GetPaintProperty<QRCodePaintProperty>();
+    auto renderContext = AceType::MakeRefPtr<MockRenderContext>();
+    RefPtr<GeometryNode> geometryNode = AceType::MakeRefPtr<GeometryNode>();
+    auto paintWrapper = AceType::MakeRefPtr<PaintWrapper>(renderContext, geometryNode, qrcodePaintProperty);
+    paintWrapper->SetNodePaintMethod(qrCodePaintMethod);
+    EXPECT_EQ(qrCodePaintMethod->CanRunOnWhichThread(), MAIN_TASK);
+    EXPECT_EQ(paintWrapper->CanRunOnWhichThread(), MAIN_TASK);
+    EXPECT_FALSE(paintWrapper->CanFlushOnBackground());
+
+    /**
+     * @tc.steps: steps3. Flush the render of the paintWrapper
+     * @tc.expected: the modifier gets the value of the paint property
+     */
+    paintWrapper->FlushRender();
+    auto qrCodeModifier = AceType::DynamicCast<QRCodeModifier>(qrCodePaintMethod->GetContentModifier(nullptr));
+    ASSERT_NE(qrCodeModifier, nullptr);
+    EXPECT_EQ(qrCodeModifier->value_->Get(), CREATE_VALUE);
+}
 } // namespace OHOS::Ace::NG
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "test/unittest/core/pattern/rich_editor/rich_editor_common_test_ng.h"
+
+#include "core/components_ng/pattern/rich_editor/rich_editor_paragraph_cache.h"
+#include "core/components_ng/pattern/rich_editor/span_position_index.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+RefPtr<SpanItem> CreateSpanItem(int32_t start, int32_t end)
+{
+    auto spanItem = AceType::MakeRefPtr<SpanItem>();
+    spanItem->content = std::string(end - start, 'a');
+    spanItem->rangeStart = start;
+    spanItem->position = end;
+    return spanItem;
+}
+} // namespace
+
+class RichEditorSpanIndexTestNg : public RichEditorCommonTestNg {
+public:
+    void SetUp() override;
+    void TearDown() override;
+    static void TearDownTestSuite();
+};
+
+void RichEditorSpanIndexTestNg::SetUp()
+{
+    MockPipelineContext::SetUp();
+    MockContainer::SetUp();
+    MockContainer::Current()->taskExecutor_ = AceType::MakeRefPtr<MockTaskExecutor>();
+    auto* stack = ViewStackProcessor::GetInstance();
+    auto nodeId = stack->ClaimNodeId();
+    richEditorNode_ = FrameNode::GetOrCreateFrameNode(
+        V2::RICH_EDITOR_ETS_TAG, nodeId, []() { return AceType::MakeRefPtr<RichEditorPattern>(); });
+    ASSERT_NE(richEditorNode_, nullptr);
+    auto richEditorPattern = richEditorNode_->GetPattern<RichEditorPattern>();
+    richEditorPattern->InitScrollablePattern();
+    richEditorNode_->GetGeometryNode()->SetContentSize({});
+}
+
+void RichEditorSpanIndexTestNg::TearDown()
+{
+    richEditorNode_ = nullptr;
+    SystemProperties::SetTextParagraphCacheEnabled(false);
+    MockParagraph::TearDown();
+}
+
+void RichEditorSpanIndexTestNg::TearDownTestSuite()
+{
+    TestNG::TearDownTestSuite();
+}
+
+/**
+ * @tc.name: SpanPositionIndex001
+ * @tc.desc: Test finding the spans of positions
+ * @tc.type: FUNC
+ */
+HWTEST_F(RichEditorSpanIndexTestNg, SpanPositionIndex001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. build the index of spans [0, 3), [3, 3), [3, 8) and [8, 9).
+     */
+    std::list<RefPtr<SpanItem>> spans = { CreateSpanItem(0, 3), CreateSpanItem(3, 3), CreateSpanItem(3, 8),
+        CreateSpanItem(8, 9) };
+    SpanPositionIndex index;
+    EXPECT_FALSE(index.IsValid(spans));
+    index.Build(spans);
+    EXPECT_TRUE(index.IsValid(spans));
+    EXPECT_EQ(index.GetSpanCount(), 4);
+
+    /**
+     * @tc.steps: step2. find the spans of the positions.
+     * @tc.expected: the empty span contains no position, the end of the text is in no span.
+     */
+    EXPECT_EQ(index.FindSpanIndex(0), 0);
+    EXPECT_EQ(index.FindSpanIndex(2), 0);
+    EXPECT_EQ(index.FindSpanIndex(3), 2);
+    EXPECT_EQ(index.FindSpanIndex(7), 2);
+    EXPECT_EQ(index.FindSpanIndex(8), 3);
+    EXPECT_EQ(index.FindSpanIndex(9), -1);
+    EXPECT_EQ(index.FindSpanIndex(-1), -1);
+    ASSERT_NE(index.GetEntry(2), nullptr);
+    EXPECT_EQ(index.GetEntry(2)->span, *std::next(spans.begin(), 2));
+    EXPECT_EQ(index.GetEntry(4), nullptr);
+
+    /**
+     * @tc.steps: step3. add a span to the spans, and build the index of overlapping spans.
+     * @tc.expected: the index is invalid.
+     */
+    spans.emplace_back(CreateSpanItem(9, 10));
+    EXPECT_FALSE(index.IsValid(spans));
+    spans.emplace_back(CreateSpanItem(5, 12));
+    index.Build(spans);
+    EXPECT_FALSE(index.IsValid(spans));
+    EXPECT_EQ(index.FindSpanIndex(0), -1);
+    index.Reset();
+    EXPECT_EQ(index.GetSpanCount(), 0);
+}
+
+/**
+ * @tc.name: GetSpanPositionInfo001
+ * @tc.desc: Test getting the span position info through the span index
+ * @tc.type: FUNC
+ */
+HWTEST_F(RichEditorSpanIndexTestNg, GetSpanPositionInfo001, TestSize.Level1)
+{
+    auto richEditorPattern = richEditorNode_->GetPattern<RichEditorPattern>();
+    ASSERT_NE(richEditorPattern, nullptr);
+
+    /**
+     * @tc.steps: step1. add two spans and update their positions.
+     * @tc.expected: the positions are found in the spans.
+     */
+    AddSpan(INIT_VALUE_1);
+    AddSpan(INIT_VALUE_2);
+    richEditorPattern->UpdateSpanPosition();
+    auto info = richEditorPattern->GetSpanPositionInfo(7);
+    EXPECT_EQ(info.spanIndex_, 1);
+    EXPECT_EQ(info.spanStart_, 6);
+    EXPECT_EQ(info.spanEnd_, 12);
+    EXPECT_EQ(info.spanOffset_, 1);
+    EXPECT_EQ(richEditorPattern->GetSpanPositionInfo(12).spanIndex_, -1);
+    EXPECT_EQ(richEditorPattern->GetSpanItemByPosition(0), richEditorPattern->spans_.front());
+
+    /**
+     * @tc.steps: step2. change the content of the first span without updating the positions.
+     * @tc.expected: the stale index is dropped, and the spans are walked as before.
+     */
+    richEditorPattern->spans_.front()->content = "hello";
+    info = richEditorPattern->GetSpanPositionInfo(2);
+    EXPECT_EQ(info.spanIndex_, 0);
+    EXPECT_EQ(info.spanStart_, 1);
+    EXPECT_EQ(info.spanOffset_, 1);
+    ClearSpan();
+}
+
+/**
+ * @tc.name: RichEditorParagraphCache001
+ * @tc.desc: Test reusing the paragraph of unchanged spans
+ * @tc.type: FUNC
+ */
+HWTEST_F(RichEditorSpanIndexTestNg, RichEditorParagraphCache001, TestSize.Level1)
+{
+    SystemProperties::SetTextParagraphCacheEnabled(true);
+    auto spanItem = AceType::MakeRefPtr<SpanItem>();
+    spanItem->content = INIT_VALUE_1;
+    spanItem->fontStyle->UpdateFontSize(FONT_SIZE_VALUE);
+    std::list<RefPtr<SpanItem>> group = { spanItem };
+    ParagraphStyle paragraphStyle;
+    RichEditorParagraphCache cache;
+
+    /**
+     * @tc.steps: step1. miss the spans and put their paragraph.
+     * @tc.expected: the paragraph is reused in the next layout.
+     */
+    EXPECT_EQ(cache.Get(group, paragraphStyle, richEditorNode_, false), nullptr);
+    auto paragraph = AceType::MakeRefPtr<MockParagraph>();
+    cache.Put(paragraph);
+    cache.Commit();
+    EXPECT_EQ(cache.GetCount(), 1);
+    EXPECT_EQ(cache.Get(group, paragraphStyle, richEditorNode_, false), paragraph);
+    ASSERT_TRUE(spanItem->GetTextStyle().has_value());
+    cache.Commit();
+
+    /**
+     * @tc.steps: step2. change the style of the span.
+     * @tc.expected: the paragraph is not reused.
+     */
+    spanItem->fontStyle->UpdateTextColor(Color::RED);
+    EXPECT_EQ(cache.Get(group, paragraphStyle, richEditorNode_, false), nullptr);
+    cache.Commit();
+    EXPECT_EQ(cache.GetCount(), 0);
+
+    /**
+     * @tc.steps: step3. get the paragraph of a symbol span.
+     * @tc.expected: the paragraph of the symbol is not kept.
+     */
+    spanItem->unicode = 1;
+    EXPECT_EQ(cache.Get(group, paragraphStyle, richEditorNode_, false), nullptr);
+    cache.Put(paragraph);
+    cache.Commit();
+    EXPECT_EQ(cache.GetCount(), 0);
+}
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/utils/utils.h"
+#include "core/components_ng/pattern/text/adapt_font_size_search.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+constexpr double MAX_FONT_SIZE = 40.0;
+constexpr double MIN_FONT_SIZE = 10.5;
+constexpr double FONT_SIZE_STEP = 2.0;
+constexpr int32_t SEARCH_COUNT = 32;
+
+// the sizes stepping down from maxFontSize as the layout loops did, with minFontSize last if appendMin.
+std::vector<double> StepDownSizes(double maxFontSize, double minFontSize, double step, bool appendMin)
+{
+    std::vector<double> sizes;
+    while (GreatOrEqual(maxFontSize, minFontSize)) {
+        sizes.emplace_back(maxFontSize);
+        bool isEqual = maxFontSize == minFontSize;
+        maxFontSize -= step;
+        if (appendMin && LessNotEqual(maxFontSize, minFontSize) && !isEqual) {
+            maxFontSize = minFontSize;
+        }
+    }
+    return sizes;
+}
+
+std::vector<double> GetSizes(const AdaptFontSizes& fontSizes)
+{
+    std::vector<double> sizes;
+    for (int32_t i = 0; i < fontSizes.GetCount(); ++i) {
+        sizes.emplace_back(fontSizes.GetSize(i));
+    }
+    return sizes;
+}
+
+void ExpectSameSizes(const std::vector<double>& sizes, const std::vector<double>& expected)
+{
+    ASSERT_EQ(sizes.size(), expected.size());
+    for (size_t i = 0; i < sizes.size(); ++i) {
+        EXPECT_TRUE(NearEqual(sizes[i], expected[i]));
+    }
+}
+} // namespace
+
+class AdaptFontSizeSearchTestNg : public testing::Test {};
+
+/**
+ * @tc.name: AdaptFontSizesTest001
+ * @tc.desc: Test the sizes equal the ones the adaptive font size loops tried
+ * @tc.type: FUNC
+ */
+HWTEST_F(AdaptFontSizeSearchTestNg, AdaptFontSizesTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create the step down sizes with and without the min size appended.
+     * @tc.expected: the sizes equal the ones of stepping down.
+     */
+    ExpectSameSizes(GetSizes(AdaptFontSizes::CreateStepDown(MAX_FONT_SIZE, MIN_FONT_SIZE, FONT_SIZE_STEP, false)),
+        StepDownSizes(MAX_FONT_SIZE, MIN_FONT_SIZE, FONT_SIZE_STEP, false));
+    ExpectSameSizes(GetSizes(AdaptFontSizes::CreateStepDown(MAX_FONT_SIZE, MIN_FONT_SIZE, FONT_SIZE_STEP, true)),
+        StepDownSizes(MAX_FONT_SIZE, MIN_FONT_SIZE, FONT_SIZE_STEP, true));
+    ExpectSameSizes(GetSizes(AdaptFontSizes::CreateStepDown(MAX_FONT_SIZE, 20.0, FONT_SIZE_STEP, true)),
+        StepDownSizes(MAX_FONT_SIZE, 20.0, FONT_SIZE_STEP, true));
+    EXPECT_EQ(AdaptFontSizes::CreateStepDown(MAX_FONT_SIZE, MAX_FONT_SIZE, FONT_SIZE_STEP, true).GetCount(), 1);
+    EXPECT_EQ(AdaptFontSizes::CreateStepDown(MAX_FONT_SIZE, MIN_FONT_SIZE, 0.0, true).GetCount(), 2);
+
+    /**
+     * @tc.steps: step2. create the step up sizes.
+     * @tc.expected: the sizes run from the max size down to the min size, stepping up from the min size.
+     */
+    auto fontSizes = AdaptFontSizes::CreateStepUp(MAX_FONT_SIZE, MIN_FONT_SIZE, FONT_SIZE_STEP);
+    ASSERT_EQ(fontSizes.GetCount(), 16);
+    EXPECT_TRUE(NearEqual(fontSizes.GetSize(0), MAX_FONT_SIZE));
+    EXPECT_TRUE(NearEqual(fontSizes.GetSize(1), 38.5));
+    EXPECT_TRUE(NearEqual(fontSizes.GetSize(15), MIN_FONT_SIZE));
+    EXPECT_EQ(AdaptFontSizes::CreateStepUp(30.5, MIN_FONT_SIZE, FONT_SIZE_STEP).GetCount(), 11);
+
+    /**
+     * @tc.steps: step3. find the index of sizes.
+     * @tc.expected: the index of the largest size not above the size, or the last index.
+     */
+    EXPECT_EQ(fontSizes.GetIndexNotAbove(100.0), 0);
+    EXPECT_EQ(fontSizes.GetIndexNotAbove(39.0), 1);
+    EXPECT_EQ(fontSizes.GetIndexNotAbove(38.5), 1);
+    EXPECT_EQ(fontSizes.GetIndexNotAbove(1.0), 15);
+}
+
+/**
+ * @tc.name: AdaptFontSizeSearchTest001
+ * @tc.desc: Test finding the first fit from any guess
+ * @tc.type: FUNC
+ */
+HWTEST_F(AdaptFontSizeSearchTestNg, AdaptFontSizeSearchTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. search every first fit from every guess.
+     * @tc.expected: the first fit is found, a right guess costs two layouts ending on the result.
+     */
+    for (int32_t firstFit = 0; firstFit <= SEARCH_COUNT; ++firstFit) {
+        for (int32_t guess = 0; guess < SEARCH_COUNT; ++guess) {
+            int32_t probeCount = 0;
+            int32_t lastProbe = -1;
+            auto result = AdaptFontSizeSearch::FindFirstFit(
+                0, SEARCH_COUNT, guess, [firstFit, &probeCount, &lastProbe](int32_t index) -> std::optional<bool> {
+                    ++probeCount;
+                    lastProbe = index;
+                    return index >= firstFit;
+                });
+            ASSERT_TRUE(result.has_value());
+            EXPECT_EQ(result.value(), firstFit);
+            if (guess == firstFit && guess > 0) {
+                EXPECT_EQ(probeCount, 2);
+                EXPECT_EQ(lastProbe, firstFit);
+            }
+        }
+    }
+
+    /**
+     * @tc.steps: step2. search an empty range and fail a layout.
+     * @tc.expected: the end of the empty range, and no result for the failed layout.
+     */
+    auto fits = [](int32_t index) -> std::optional<bool> { return true; };
+    EXPECT_EQ(AdaptFontSizeSearch::FindFirstFit(1, 1, 0, fits), 1);
+    auto fails = [](int32_t index) -> std::optional<bool> { return std::nullopt; };
+    EXPECT_FALSE(AdaptFontSizeSearch::FindFirstFit(0, SEARCH_COUNT, 3, fails).has_value());
+}
+
+/**
+ * @tc.name: AdaptFontSizeSearchTest002
+ * @tc.desc: Test predicting the font size from the metrics at a reference size
+ * @tc.type: FUNC
+ */
+HWTEST_F(AdaptFontSizeSearchTestNg, AdaptFontSizeSearchTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. predict a single line text of 100px at 10px in 300px.
+     * @tc.expected: the text fits at three times the size.
+     */
+    AdaptParagraphMetrics metrics { .longestLine = 100.0f, .height = 12.0f, .maxIntrinsicWidth = 100.0f,
+        .lineCount = 1 };
+    EXPECT_TRUE(NearEqual(AdaptFontSizeSearch::PredictSingleLineFontSize(10.0, metrics, SizeF(300.0f, 1000.0f)), 30.0));
+    EXPECT_TRUE(NearEqual(AdaptFontSizeSearch::PredictSingleLineFontSize(10.0, metrics, SizeF(300.0f, 24.0f)), 20.0));
+
+    /**
+     * @tc.steps: step2. predict a text of 1000px at 40px, wrapped in 200px into lines of 50px.
+     * @tc.expected: the size is limited by the max lines, then by the height.
+     */
+    metrics = { .longestLine = 200.0f, .height = 250.0f, .maxIntrinsicWidth = 1000.0f, .lineCount = 5 };
+    EXPECT_TRUE(
+        NearEqual(AdaptFontSizeSearch::PredictMultiLineFontSize(40.0, metrics, SizeF(200.0f, 1000.0f), 2), 16.0));
+    EXPECT_TRUE(NearEqual(
+        AdaptFontSizeSearch::PredictMultiLineFontSize(40.0, metrics, SizeF(200.0f, 160.0f), UINT32_MAX), 32.0));
+}
+} // namespace OHOS::Ace::NG
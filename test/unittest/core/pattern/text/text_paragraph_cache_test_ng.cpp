@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "text_base.h"
+
+#include "base/utils/system_properties.h"
+#include "core/common/font_manager.h"
+#include "core/components_ng/pattern/text/text_layout_algorithm.h"
+#include "core/components_ng/pattern/text/text_paragraph_cache.h"
+
+namespace OHOS::Ace::NG {
+
+namespace {
+const std::string CACHED_CONTENT = "Like";
+constexpr float CACHED_MAX_WIDTH = 200.0f;
+constexpr float CACHED_MAX_HEIGHT = 100.0f;
+} // namespace
+
+class TextParagraphCacheTestNg : public TextBases {
+public:
+    void TearDown() override
+    {
+        TextParagraphCache::GetInstance().Clear();
+        SystemProperties::SetTextParagraphCacheEnabled(false);
+        TextBases::TearDown();
+    }
+
+    static TextParagraphCacheKey CreateKey()
+    {
+        TextParagraphCacheKey key;
+        key.content = CACHED_CONTENT;
+        key.textStyle.SetFontSize(Dimension(16.0, DimensionUnit::FP));
+        key.maxMeasureWidth = CACHED_MAX_WIDTH;
+        key.maxWidth = CACHED_MAX_WIDTH;
+        key.fontGeneration = FontManager::GetFontGeneration();
+        return key;
+    }
+
+    static RefPtr<FrameNode> CreateTextNode(int32_t nodeId)
+    {
+        auto pattern = AceType::MakeRefPtr<TextPattern>();
+        auto frameNode = FrameNode::CreateFrameNode(V2::TEXT_ETS_TAG, nodeId, pattern);
+        pattern->AttachToFrameNode(frameNode);
+        auto layoutProperty = frameNode->GetLayoutProperty<TextLayoutProperty>();
+        layoutProperty->UpdateContent(CACHED_CONTENT);
+        return frameNode;
+    }
+};
+
+/**
+ * @tc.name: TextParagraphCacheTest001
+ * @tc.desc: Test the cache returns a paragraph only for an equal key
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextParagraphCacheTestNg, TextParagraphCacheTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. cache a paragraph and look it up with the same key.
+     * @tc.expected: the cached paragraph, style and indent are returned.
+     */
+    auto& cache = TextParagraphCache::GetInstance();
+    auto paragraph = AceType::MakeRefPtr<MockParagraph>();
+    auto key = CreateKey();
+    ParagraphStyle paragraphStyle { .maxLines = 2 };
+    cache.Put(key, paragraph, paragraphStyle, 4.0f);
+    auto cached = cache.Get(key);
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->paragraph, paragraph);
+    EXPECT_EQ(cached->paragraphStyle.maxLines, static_cast<uint32_t>(2));
+    EXPECT_EQ(cached->indent, 4.0f);
+
+    /**
+     * @tc.steps: step2. look up keys differing in width, in a style field left out of TextStyle::operator== and in
+     *     the font generation.
+     * @tc.expected: nothing is found.
+     */
+    auto otherKey = key;
+    otherKey.maxWidth = CACHED_MAX_WIDTH / 2;
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+    otherKey = key;
+    otherKey.textStyle.SetHalfLeading(true);
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+    otherKey = key;
+    otherKey.paragraphStyle.lineBreakStrategy = LineBreakStrategy::HIGH_QUALITY;
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+    FontManager::MarkFontChanged();
+    otherKey = key;
+    otherKey.fontGeneration = FontManager::GetFontGeneration();
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+
+    /**
+     * @tc.steps: step3. cache a long content, then clear the cache.
+     * @tc.expected: the long content is not cached, nothing is found after clearing.
+     */
+    otherKey = key;
+    otherKey.content = std::string(TextParagraphCache::MAX_CONTENT_LENGTH + 1, 'a');
+    cache.Put(otherKey, paragraph, paragraphStyle, 0.0f);
+    EXPECT_EQ(cache.Get(otherKey), nullptr);
+    EXPECT_EQ(cache.GetCount(), static_cast<size_t>(1));
+    cache.Clear();
+    EXPECT_EQ(cache.Get(key), nullptr);
+}
+
+/**
+ * @tc.name: TextParagraphCacheTest002
+ * @tc.desc: Test texts of the same content and style share the paragraph shaped by the first one
+ * @tc.type: FUNC
+ */
+HWTEST_F(TextParagraphCacheTestNg, TextParagraphCacheTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. measure two texts of the same content with the cache enabled.
+     * @tc.expected: the paragraph is built once, the second text takes it from the cache.
+     */
+    SystemProperties::SetTextParagraphCacheEnabled(true);
+    auto paragraph = MockParagraph::GetOrCreateMockParagraph();
+    EXPECT_CALL(*paragraph, Build()).Times(1);
+    EXPECT_CALL(*paragraph, GetMaxWidth()).WillRepeatedly(Return(CACHED_MAX_WIDTH));
+    LayoutConstraintF contentConstraint;
+    contentConstraint.maxSize = SizeF(CACHED_MAX_WIDTH, CACHED_MAX_HEIGHT);
+    auto firstNode = CreateTextNode(1);
+    auto firstAlgorithm = AceType::DynamicCast<TextLayoutAlgorithm>(
+        firstNode->GetPattern<TextPattern>()->CreateLayoutAlgorithm());
+    ASSERT_NE(firstAlgorithm, nullptr);
+    EXPECT_TRUE(firstAlgorithm->MeasureContent(contentConstraint, AceType::RawPtr(firstNode)).has_value());
+    EXPECT_EQ(TextParagraphCache::GetInstance().GetCount(), static_cast<size_t>(1));
+
+    auto secondNode = CreateTextNode(2);
+    auto secondAlgorithm = AceType::DynamicCast<TextLayoutAlgorithm>(
+        secondNode->GetPattern<TextPattern>()->CreateLayoutAlgorithm());
+    ASSERT_NE(secondAlgorithm, nullptr);
+    EXPECT_TRUE(secondAlgorithm->MeasureContent(contentConstraint, AceType::RawPtr(secondNode)).has_value());
+    EXPECT_NE(secondAlgorithm->GetParagraph(), nullptr);
+
+    /**
+     * @tc.steps: step2. measure with the cache disabled.
+     * @tc.expected: the paragraph is built again.
+     */
+    SystemProperties::SetTextParagraphCacheEnabled(false);
+    EXPECT_CALL(*paragraph, Build()).Times(1);
+    EXPECT_TRUE(secondAlgorithm->MeasureContent(contentConstraint, AceType::RawPtr(secondNode)).has_value());
+}
+} // namespace OHOS::Ace::NG
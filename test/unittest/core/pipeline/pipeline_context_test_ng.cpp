@@ -231,7 +231,7 @@ HWTEST_F(PipelineContextTestNg, PipelineContextTestNg003, TestSize.Level1)
      */
     context_->taskScheduler_->AddDirtyLayoutNode(frameNode_);
     context_->taskScheduler_->AddDirtyRenderNode(frameNode_);
-    context_->taskScheduler_->dirtyRenderNodes_[frameNode_->GetPageId()].emplace(nullptr);
+    context_->taskScheduler_->dirtyRenderNodes_.Add(nullptr);
 
     /**
      * @tc.steps3: Call the function FlushVsync with isEtsCard=true.
@@ -335,18 +335,18 @@ HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg003, TestSize.Level1)
 
     /**
      * @tc.steps3: Call AddPredictTask.
-     * @tc.expected: predictTask_ in the taskScheduler size is 2.
+     * @tc.expected: the null task is dropped, one idle task is pending.
      */
     taskScheduler.AddPredictTask([](int64_t, bool) {});
     taskScheduler.AddPredictTask(nullptr);
-    EXPECT_EQ(taskScheduler.predictTask_.size(), 2);
+    EXPECT_EQ(taskScheduler.idleTasks_[static_cast<size_t>(IdleTaskPriority::NORMAL)].size(), 1);
 
     /**
      * @tc.steps4: Call FlushPredictTask.
-     * @tc.expected: predictTask_ in the taskScheduler size is 0.
+     * @tc.expected: no idle task is pending.
      */
     taskScheduler.FlushPredictTask(0);
-    EXPECT_EQ(taskScheduler.predictTask_.size(), 0);
+    EXPECT_FALSE(taskScheduler.HasPendingIdleTask());
 }
 
 /**
@@ -414,7 +414,7 @@ HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg005, TestSize.Level1)
      */
     auto frameNode = FrameNode::GetOrCreateFrameNode(TEST_TAG, 1, nullptr);
     frameNode->SetInDestroying();
-    taskScheduler.dirtyRenderNodes_[1].emplace(nullptr);
+    taskScheduler.dirtyRenderNodes_.Add(nullptr);
     auto pattern = AceType::MakeRefPtr<Pattern>();
     auto frameNode2 = FrameNode::CreateFrameNode(TEST_TAG, 2, pattern);
 
@@ -467,6 +467,176 @@ HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg006, TestSize.Level1)
     EXPECT_EQ(taskScheduler.afterLayoutTasks_.size(), 0);
 }
 
+/**
+ * @tc.name: UITaskSchedulerTestNg007
+ * @tc.desc: Test the dirty node queue deduplicates nodes and keeps the NodeCompare order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg007, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create nodes of different depth and layout priority.
+     */
+    auto pattern = AceType::MakeRefPtr<Pattern>();
+    auto deepNode = FrameNode::CreateFrameNode(TEST_TAG, 1, pattern);
+    deepNode->depth_ = 3;
+    auto shallowNode = FrameNode::CreateFrameNode(TEST_TAG, 2, AceType::MakeRefPtr<Pattern>());
+    shallowNode->depth_ = 1;
+    auto priorityNode = FrameNode::CreateFrameNode(TEST_TAG, 3, AceType::MakeRefPtr<Pattern>());
+    priorityNode->depth_ = 5;
+    priorityNode->SetLayoutPriority(1);
+
+    /**
+     * @tc.steps2: Add the nodes to a layout queue, one of them twice.
+     * @tc.expected: the second add of the same node is rejected.
+     */
+    DirtyNodeQueue<FrameNode> queue(DIRTY_LAYOUT_QUEUE, DirtyNodeOrder::PRIORITY_FIRST);
+    EXPECT_TRUE(queue.Add(deepNode));
+    EXPECT_TRUE(queue.Add(shallowNode));
+    EXPECT_FALSE(queue.Add(deepNode));
+    EXPECT_TRUE(queue.Add(priorityNode));
+    EXPECT_EQ(queue.Size(), 3);
+
+    /**
+     * @tc.steps3: Take the nodes in flush order.
+     * @tc.expected: higher priority first, then lower depth first, and the queue flags are cleared.
+     */
+    std::vector<RefPtr<FrameNode>> nodes;
+    queue.TakeOrdered(nodes);
+    ASSERT_EQ(nodes.size(), 3);
+    EXPECT_EQ(nodes[0], priorityNode);
+    EXPECT_EQ(nodes[1], shallowNode);
+    EXPECT_EQ(nodes[2], deepNode);
+    EXPECT_TRUE(queue.Empty());
+    EXPECT_EQ(deepNode->GetDirtyQueueOwner(DIRTY_LAYOUT_QUEUE), nullptr);
+    EXPECT_TRUE(queue.Add(deepNode));
+    queue.Clear();
+    EXPECT_EQ(deepNode->GetDirtyQueueOwner(DIRTY_LAYOUT_QUEUE), nullptr);
+}
+
+/**
+ * @tc.name: UITaskSchedulerTestNg009
+ * @tc.desc: Test the dirty node queue orders by the keys nodes have at flush time and is scoped per queue.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg009, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Add a node before it is mounted, then mount it above another dirty node.
+     * @tc.expected: the mounted node is flushed first, by its depth at flush time.
+     */
+    auto mountedNode = FrameNode::CreateFrameNode(TEST_TAG, 1, AceType::MakeRefPtr<Pattern>());
+    mountedNode->depth_ = 2;
+    auto newNode = FrameNode::CreateFrameNode(TEST_TAG, 2, AceType::MakeRefPtr<Pattern>());
+    newNode->depth_ = INT32_MAX;
+    DirtyNodeQueue<FrameNode> queue(DIRTY_LAYOUT_QUEUE, DirtyNodeOrder::PRIORITY_FIRST);
+    EXPECT_TRUE(queue.Add(newNode));
+    EXPECT_TRUE(queue.Add(mountedNode));
+    newNode->depth_ = 1;
+    std::vector<RefPtr<FrameNode>> nodes;
+    queue.TakeOrdered(nodes);
+    ASSERT_EQ(nodes.size(), 2);
+    EXPECT_EQ(nodes[0], newNode);
+    EXPECT_EQ(nodes[1], mountedNode);
+
+    /**
+     * @tc.steps2: Add the same node to the layout queues of two pipelines.
+     * @tc.expected: both queues keep the node, and taking one queue does not release the other.
+     */
+    DirtyNodeQueue<FrameNode> otherQueue(DIRTY_LAYOUT_QUEUE, DirtyNodeOrder::PRIORITY_FIRST);
+    EXPECT_TRUE(queue.Add(mountedNode));
+    EXPECT_TRUE(otherQueue.Add(mountedNode));
+    EXPECT_EQ(otherQueue.Size(), 1);
+    queue.TakeOrdered(nodes);
+    ASSERT_EQ(nodes.size(), 1);
+    EXPECT_EQ(nodes[0], mountedNode);
+    otherQueue.TakeOrdered(nodes);
+    ASSERT_EQ(nodes.size(), 1);
+    EXPECT_EQ(nodes[0], mountedNode);
+    EXPECT_EQ(mountedNode->GetDirtyQueueOwner(DIRTY_LAYOUT_QUEUE), nullptr);
+}
+
+/**
+ * @tc.name: UITaskSchedulerTestNg010
+ * @tc.desc: Test deferred render tasks run their background parts first, then all tasks in order.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg010, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create render tasks in dirty order, the second one with a background part.
+     */
+    UITaskScheduler taskScheduler;
+    std::vector<int32_t> order;
+    std::vector<std::pair<RefPtr<FrameNode>, UITask>> tasks;
+    tasks.emplace_back(frameNode_, UITask([&order]() { order.emplace_back(0); }));
+    UITask backgroundTask([&order]() { order.emplace_back(1); });
+    backgroundTask.SetBackgroundTask([&order]() { order.emplace_back(-1); });
+    tasks.emplace_back(frameNode_, std::move(backgroundTask));
+    tasks.emplace_back(frameNode_, UITask([&order]() { order.emplace_back(2); }));
+
+    /**
+     * @tc.steps2: Call FlushDeferredRenderTask.
+     * @tc.expected: the background part runs before any task, the tasks keep the dirty order.
+     */
+    FrameInfo frameInfo;
+    taskScheduler.StartRecordFrameInfo(&frameInfo);
+    taskScheduler.FlushDeferredRenderTask(tasks);
+    EXPECT_EQ(order, std::vector<int32_t>({ -1, 0, 1, 2 }));
+    EXPECT_EQ(frameInfo.renderInfos_.size(), 3);
+}
+
+/**
+ * @tc.name: UITaskSchedulerTestNg008
+ * @tc.desc: Test idle tasks run by priority within the deadline and resume in the next idle period.
+ * @tc.type: FUNC
+ */
+HWTEST_F(PipelineContextTestNg, UITaskSchedulerTestNg008, TestSize.Level1)
+{
+    /**
+     * @tc.steps1: Create taskScheduler and add idle tasks of different priorities.
+     */
+    UITaskScheduler taskScheduler;
+    std::vector<int32_t> order;
+    int32_t resumeCount = 0;
+    taskScheduler.AddIdleTask([&order](int64_t, bool) {
+        order.emplace_back(2);
+        return true;
+    }, IdleTaskPriority::LOW);
+    taskScheduler.AddIdleTask([&order, &resumeCount](int64_t, bool) {
+        order.emplace_back(1);
+        return ++resumeCount > 1;
+    }, IdleTaskPriority::NORMAL);
+    taskScheduler.AddIdleTask([&order](int64_t, bool) {
+        order.emplace_back(0);
+        return true;
+    }, IdleTaskPriority::HIGH);
+
+    /**
+     * @tc.steps2: Flush with a deadline already passed.
+     * @tc.expected: only the high priority task runs, the others stay pending.
+     */
+    taskScheduler.FlushPredictTask(0);
+    EXPECT_EQ(order, std::vector<int32_t>({ 0 }));
+    EXPECT_TRUE(taskScheduler.HasPendingIdleTask());
+
+    /**
+     * @tc.steps3: Flush with enough budget.
+     * @tc.expected: the unfinished task is resumed once per idle period, the low priority task runs after it.
+     */
+    FrameInfo frameInfo;
+    taskScheduler.StartRecordFrameInfo(&frameInfo);
+    taskScheduler.FlushPredictTask(INT64_MAX);
+    EXPECT_EQ(order, std::vector<int32_t>({ 0, 1, 2 }));
+    EXPECT_EQ(frameInfo.idleInfos_.size(), 2);
+    EXPECT_EQ(frameInfo.idlePendingCount_, 1);
+    taskScheduler.FlushPredictTask(INT64_MAX);
+    taskScheduler.FinishRecordFrameInfo();
+    EXPECT_EQ(order, std::vector<int32_t>({ 0, 1, 2, 1 }));
+    EXPECT_FALSE(taskScheduler.HasPendingIdleTask());
+    EXPECT_EQ(frameInfo.idlePendingCount_, 0);
+}
+
 /**
  * @tc.name: PipelineContextTestNg044
  * @tc.desc: Test the function FlushAnimation.
@@ -13,6 +13,9 @@
  * limitations under the License.
  */
 
+#include <string>
+#include <vector>
+
 #include "gtest/gtest.h"
 
 #define private public
@@ -20,7 +23,7 @@
 #include "core/components_ng/base/frame_node.h"
 #include "core/components_ng/base/view_stack_processor.h"
 #include "frameworks/core/components_ng/property/calc_length.h"
-
+#include "base/utils/string_expression.h"
 
 using namespace testing;
 using namespace testing::ext;
@@ -31,6 +34,17 @@ constexpr double VP_SCALE = 10.0;
 constexpr double FP_SCALE = 10.0;
 constexpr double LPX_SCALE = 10.0;
 constexpr double PARENT_LENGTH = 10.0;
+// deeper than the stack the compiled expression calculates on without allocating.
+constexpr int32_t DEEP_NESTING = 40;
+
+double CalculateByString(const std::string& expression, double vpScale, double parentLength)
+{
+    return StringExpression::CalculateExp(expression, [vpScale, parentLength](const Dimension& dim) -> double {
+        double result = -1.0;
+        dim.NormalizeToPx(vpScale, FP_SCALE, LPX_SCALE, parentLength, result);
+        return result;
+    });
+}
 } // namespace
 
 class CalcLengthTestNg : public testing::Test {
@@ -68,4 +82,74 @@ HWTEST_F(CalcLengthTestNg, calcLengthTest001, TestSize.Level1)
     calc.NormalizeToPx(VP_SCALE, FP_SCALE, LPX_SCALE, PARENT_LENGTH, result);
     EXPECT_TRUE(calcBool);
 }
-} // namespace OHOS::Ace::NG
\ No newline at end of file
+
+/**
+ * @tc.name: CalcLengthTestTest002
+ * @tc.desc: Test the compiled calc expression calculates as the string expression
+ * @tc.type: FUNC
+ */
+HWTEST_F(CalcLengthTestNg, calcLengthTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. normalize the calc lengths, valid ones and ones failing on their units or form, with the
+     *                   scales set and unset.
+     * @tc.expected: step1. the results are those of the string expression.
+     */
+    std::vector<std::string> expressions = { "calc(100% - 20vp)", "calc((100% - 10px) / 3)", "calc(2 * 10vp + 5fp)",
+        "calc(50% + -10px)", "calc(-2 * 3vp)", "calc(10px * 2 - 1lpx / 2)", "calc(100% / 0)", "calc(1px + 2)",
+        "calc(2px * 3px)", "calc(4 / 2px)", "calc(2 * 3)", "calc(1px + )", "calc((1px + 2px)", "calc(10px))",
+        "100px", "calc(1abc)", "calc()" };
+    std::vector<std::pair<double, double>> scales = { { VP_SCALE, PARENT_LENGTH }, { 0.0, -1.0 } };
+    for (const auto& expression : expressions) {
+        CalcLength calc(expression);
+        for (const auto& [vpScale, parentLength] : scales) {
+            double result = -1.0;
+            double expected = CalculateByString(expression, vpScale, parentLength);
+            EXPECT_EQ(calc.NormalizeToPx(vpScale, FP_SCALE, LPX_SCALE, parentLength, result), expected >= 0)
+                << expression;
+            EXPECT_EQ(result, expected) << expression;
+        }
+    }
+
+    /**
+     * @tc.steps: step2. set another calc value on a copy, and reset a calc length.
+     * @tc.expected: step2. the copy calculates its own value, the original keeps its value, the reset one is empty.
+     */
+    CalcLength calc("calc(100% - 2px)");
+    CalcLength copy = calc;
+    copy.SetCalcValue("calc(100% - 4px)");
+    double result = 0.0;
+    EXPECT_TRUE(calc.NormalizeToPx(VP_SCALE, FP_SCALE, LPX_SCALE, PARENT_LENGTH, result));
+    EXPECT_DOUBLE_EQ(result, 8.0);
+    EXPECT_TRUE(copy.NormalizeToPx(VP_SCALE, FP_SCALE, LPX_SCALE, PARENT_LENGTH, result));
+    EXPECT_DOUBLE_EQ(result, 6.0);
+    calc.Reset();
+    EXPECT_EQ(calc.compiledExp_, nullptr);
+    EXPECT_TRUE(calc.CalcValue().empty());
+}
+
+/**
+ * @tc.name: CalcLengthTestTest003
+ * @tc.desc: Test the compiled calc expression nesting deeper than its stack
+ * @tc.type: FUNC
+ */
+HWTEST_F(CalcLengthTestNg, calcLengthTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. normalize a calc length whose values all wait on the stack for the last one.
+     * @tc.expected: step1. the result is the sum of the values.
+     */
+    std::string expression = "calc(";
+    for (int32_t index = 0; index < DEEP_NESTING; ++index) {
+        expression += "1px + (";
+    }
+    expression += "1px";
+    expression += std::string(DEEP_NESTING, ')');
+    expression += ")";
+    CalcLength calc(expression);
+    double result = 0.0;
+    EXPECT_TRUE(calc.NormalizeToPx(VP_SCALE, FP_SCALE, LPX_SCALE, PARENT_LENGTH, result));
+    EXPECT_DOUBLE_EQ(result, DEEP_NESTING + 1.0);
+    EXPECT_EQ(result, CalculateByString(expression, VP_SCALE, PARENT_LENGTH));
+}
+} // namespace OHOS::Ace::NG
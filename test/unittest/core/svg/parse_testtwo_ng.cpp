@@ -24,6 +24,7 @@
 #include "test/mock/core/rosen/mock_canvas.h"
 
 #include "base/memory/ace_type.h"
+#include "base/utils/system_properties.h"
 #include "core/components/common/layout/constants.h"
 #include "core/components/common/properties/color.h"
 #include "core/components/declaration/svg/svg_animate_declaration.h"
@@ -309,6 +310,17 @@ std::unordered_map<std::string, std::shared_ptr<RSImageFilter>> resultHash;
 } // namespace
 class ParseTestTwoNg : public testing::Test {
 public:
+    void SetUp() override
+    {
+        // the nodes are checked and drawn per image here, sharing them is covered by SvgDomCacheTestNg.
+        SystemProperties::SetSvgDomCacheEnabled(false);
+    }
+
+    void TearDown() override
+    {
+        SystemProperties::SetSvgDomCacheEnabled(true);
+    }
+
     static RefPtr<SvgDom> ParseRect(const std::string& svgLabel);
     RefPtr<SvgDom> parsePolygon(const std::string& svgLable);
     static RefPtr<SvgDom> ParsePath(const std::string& svgLabel);
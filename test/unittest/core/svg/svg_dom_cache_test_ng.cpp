@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+#define private public
+#define protected public
+
+#include "test/mock/core/rosen/mock_canvas.h"
+
+#include "base/utils/system_properties.h"
+#include "core/components_ng/svg/parse/svg_svg.h"
+#include "core/components_ng/svg/svg_dom.h"
+#include "core/components_ng/svg/svg_dom_cache.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+const std::string ICON_SRC = "resource://icon.svg";
+const std::string OTHER_SRC = "resource://other.svg";
+const std::string ICON_SVG_LABEL = "<svg width=\"24\" height=\"24\" viewBox=\"0 0 24 24\"><style>circle{fill:gold;}"
+                                   "</style><circle cx=\"12\" cy=\"12\" r=\"8\" class=\"dot\" /><rect width=\"4\" "
+                                   "height=\"4\" fill=\"red\" /></svg>";
+const std::string CHANGED_SVG_LABEL = "<svg width=\"24\" height=\"24\"><rect width=\"8\" height=\"8\" /></svg>";
+const std::string ANIMATED_SVG_LABEL = "<svg width=\"24\" height=\"24\"><rect width=\"8\" height=\"8\"><animate "
+                                       "attributeName=\"width\" from=\"8\" to=\"16\" dur=\"1s\" /></rect></svg>";
+constexpr size_t ICON_CHILD_COUNT = 3;
+const Size LAYOUT = { 48.0, 48.0 };
+const Size LARGE_LAYOUT = { 1024.0, 1024.0 };
+} // namespace
+
+class SvgDomCacheTestNg : public testing::Test {
+public:
+    void SetUp() override
+    {
+        SystemProperties::SetSvgDomCacheEnabled(true);
+        SvgDomCache::GetInstance().Clear();
+    }
+
+    void TearDown() override
+    {
+        SystemProperties::SetSvgDomCacheEnabled(true);
+        SvgDomCache::GetInstance().Clear();
+    }
+
+    static RefPtr<SvgDom> CreateSvgDom(const std::string& src, const std::string& svgLabel,
+        const std::optional<Color>& fillColor = std::nullopt)
+    {
+        auto svgStream = SkMemoryStream::MakeCopy(svgLabel.c_str(), svgLabel.length());
+        EXPECT_NE(svgStream, nullptr);
+        ImageSourceInfo imageSrc(src);
+        if (fillColor) {
+            imageSrc.SetFillColor(fillColor.value());
+        }
+        return SvgDom::CreateSvgDom(*svgStream, imageSrc);
+    }
+
+    static std::shared_ptr<const SvgTemplateNode> GetTemplate(const std::string& src, const std::string& svgLabel)
+    {
+        SkMemoryStream svgStream(svgLabel.c_str(), svgLabel.length());
+        return SvgDomCache::GetInstance().GetTemplate(SvgDomCache::GetCacheKey(src, svgStream), svgStream);
+    }
+};
+
+/**
+ * @tc.name: SvgDomCacheTest001
+ * @tc.desc: Test sharing the parsed template between the images of the same source
+ * @tc.type: FUNC
+ */
+HWTEST_F(SvgDomCacheTestNg, SvgDomCacheTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse the same source twice.
+     * @tc.expected: the template is parsed once and keeps the elements and the style text in order.
+     */
+    auto svgTemplate = GetTemplate(ICON_SRC, ICON_SVG_LABEL);
+    ASSERT_NE(svgTemplate, nullptr);
+    EXPECT_EQ(svgTemplate->name, "svg");
+    ASSERT_EQ(svgTemplate->children.size(), ICON_CHILD_COUNT);
+    const auto& style = svgTemplate->children.front();
+    EXPECT_EQ(style.name, "style");
+    ASSERT_EQ(style.children.size(), 1);
+    EXPECT_TRUE(style.children.front().isText);
+    EXPECT_EQ(GetTemplate(ICON_SRC, ICON_SVG_LABEL), svgTemplate);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetCount(), 1);
+    EXPECT_FALSE(svgTemplate->animated);
+    EXPECT_EQ(SvgDomCache::GetInstance().cache_.Bytes(), SvgDomCache::GetMemorySize(*svgTemplate));
+    EXPECT_GT(SvgDomCache::GetMemorySize(*svgTemplate), sizeof(SvgTemplateNode) * (ICON_CHILD_COUNT + 1));
+
+    /**
+     * @tc.steps: step2. create two images of the source with different fill colors.
+     * @tc.expected: the fill color is parsed into the nodes, so each image gets its own node tree and context.
+     */
+    auto first = CreateSvgDom(ICON_SRC, ICON_SVG_LABEL, Color::RED);
+    auto second = CreateSvgDom(ICON_SRC, ICON_SVG_LABEL, Color::BLUE);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetCount(), 1);
+    EXPECT_NE(first->root_, second->root_);
+    EXPECT_NE(first->svgContext_, second->svgContext_);
+    EXPECT_EQ(first->fillColor_, Color::RED);
+    EXPECT_EQ(second->fillColor_, Color::BLUE);
+    EXPECT_FALSE(second->svgContext_->GetAttrMap("circle").empty());
+    auto svg = AceType::DynamicCast<SvgSvg>(second->root_);
+    ASSERT_NE(svg, nullptr);
+    EXPECT_EQ(svg->children_.size(), ICON_CHILD_COUNT);
+    EXPECT_EQ(first->GetContainerSize(), second->GetContainerSize());
+    EXPECT_EQ(SvgDomCache::GetInstance().GetTreeCount(), 2);
+
+    /**
+     * @tc.steps: step3. create another image of the source with the fill color of the first one.
+     * @tc.expected: it shares the nodes and the context of the first image without parsing them again.
+     */
+    auto third = CreateSvgDom(ICON_SRC, ICON_SVG_LABEL, Color::RED);
+    ASSERT_NE(third, nullptr);
+    EXPECT_EQ(third->root_, first->root_);
+    EXPECT_EQ(third->svgContext_, first->svgContext_);
+    EXPECT_EQ(third->sharedTree_, first->sharedTree_);
+    EXPECT_EQ(third->GetContainerSize(), first->GetContainerSize());
+    EXPECT_TRUE(third->IsStatic());
+    EXPECT_EQ(SvgDomCache::GetInstance().GetTreeCount(), 2);
+}
+
+/**
+ * @tc.name: SvgDomCacheTest002
+ * @tc.desc: Test keying the templates by the source and the content
+ * @tc.type: FUNC
+ */
+HWTEST_F(SvgDomCacheTestNg, SvgDomCacheTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. parse another content under the same source, then the same content under another source.
+     * @tc.expected: each of them is a new template.
+     */
+    auto svgTemplate = GetTemplate(ICON_SRC, ICON_SVG_LABEL);
+    auto changed = GetTemplate(ICON_SRC, CHANGED_SVG_LABEL);
+    auto other = GetTemplate(OTHER_SRC, ICON_SVG_LABEL);
+    ASSERT_NE(changed, nullptr);
+    EXPECT_NE(changed, svgTemplate);
+    EXPECT_NE(other, svgTemplate);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetCount(), 3);
+
+    /**
+     * @tc.steps: step2. parse an invalid content and parse with the cache disabled.
+     * @tc.expected: nothing is cached.
+     */
+    EXPECT_EQ(GetTemplate(OTHER_SRC, "<svg"), nullptr);
+    EXPECT_EQ(CreateSvgDom(OTHER_SRC, "<svg"), nullptr);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetCount(), 3);
+    SvgDomCache::GetInstance().Clear();
+    SystemProperties::SetSvgDomCacheEnabled(false);
+    EXPECT_NE(GetTemplate(ICON_SRC, ICON_SVG_LABEL), nullptr);
+    auto uncached = CreateSvgDom(ICON_SRC, ICON_SVG_LABEL);
+    ASSERT_NE(uncached, nullptr);
+    EXPECT_EQ(uncached->sharedTree_, nullptr);
+    EXPECT_EQ(AceType::DynamicCast<SvgSvg>(uncached->root_)->children_.size(), ICON_CHILD_COUNT);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetCount(), 0);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetTreeCount(), 0);
+}
+
+/**
+ * @tc.name: SvgDomCacheTest003
+ * @tc.desc: Test keeping the nodes of an animated source per image
+ * @tc.type: FUNC
+ */
+HWTEST_F(SvgDomCacheTestNg, SvgDomCacheTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create two images of an animated source.
+     * @tc.expected: the template is shared, the nodes and the animators are not.
+     */
+    auto first = CreateSvgDom(ICON_SRC, ANIMATED_SVG_LABEL);
+    auto second = CreateSvgDom(ICON_SRC, ANIMATED_SVG_LABEL);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_TRUE(GetTemplate(ICON_SRC, ANIMATED_SVG_LABEL)->animated);
+    EXPECT_NE(first->root_, second->root_);
+    EXPECT_EQ(first->sharedTree_, nullptr);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetCount(), 1);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetTreeCount(), 0);
+}
+
+/**
+ * @tc.name: SvgDomCacheTest004
+ * @tc.desc: Test drawing the shared nodes from the raster of their size
+ * @tc.type: FUNC
+ */
+HWTEST_F(SvgDomCacheTestNg, SvgDomCacheTest004, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. draw two images of a static source at the same size.
+     * @tc.expected: the nodes are rasterized once, both images draw the raster.
+     */
+    auto first = CreateSvgDom(ICON_SRC, ICON_SVG_LABEL);
+    auto second = CreateSvgDom(ICON_SRC, ICON_SVG_LABEL);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    NiceMock<Testing::MockCanvas> canvas;
+    ON_CALL(canvas, AttachBrush(_)).WillByDefault(ReturnRef(canvas));
+    ON_CALL(canvas, DetachBrush()).WillByDefault(ReturnRef(canvas));
+    ON_CALL(canvas, AttachPen(_)).WillByDefault(ReturnRef(canvas));
+    ON_CALL(canvas, DetachPen()).WillByDefault(ReturnRef(canvas));
+    EXPECT_CALL(canvas, DrawImage(_, _, _, _)).Times(2);
+    first->DrawImage(canvas, ImageFit::CONTAIN, LAYOUT);
+    second->DrawImage(canvas, ImageFit::CONTAIN, LAYOUT);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetRasterCount(), 1);
+    EXPECT_EQ(SvgDomCache::GetInstance().rasters_.Bytes(), static_cast<size_t>(LAYOUT.Width() * LAYOUT.Height()) * 4);
+
+    /**
+     * @tc.steps: step2. draw at another fit, with a color filter and at a size too large to rasterize.
+     * @tc.expected: the other fit gets its own raster, the others are drawn from the nodes.
+     */
+    EXPECT_CALL(canvas, DrawImage(_, _, _, _)).Times(1);
+    first->DrawImage(canvas, ImageFit::FILL, LAYOUT);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetRasterCount(), 2);
+    second->SetColorFilter(ImageColorFilter());
+    second->DrawImage(canvas, ImageFit::CONTAIN, LAYOUT);
+    first->DrawImage(canvas, ImageFit::CONTAIN, LARGE_LAYOUT);
+    EXPECT_EQ(SvgDomCache::GetInstance().GetRasterCount(), 2);
+}
+} // namespace OHOS::Ace::NG
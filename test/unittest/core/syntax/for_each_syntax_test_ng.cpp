@@ -13,7 +13,9 @@
  * limitations under the License.
  */
 
+#include <thread>
 #include <utility>
+#include <vector>
 
 #include "gtest/gtest.h"
 
@@ -25,6 +27,7 @@
 #include "core/components_ng/base/view_stack_processor.h"
 #include "core/components_ng/syntax/for_each_model_ng.h"
 #include "core/components_ng/syntax/for_each_node.h"
+#include "core/components_ng/syntax/interned_key.h"
 #include "test/mock/core/pipeline/mock_pipeline_context.h"
 
 using namespace testing;
@@ -37,6 +40,10 @@ const std::string LIST_TAG("List");
 constexpr bool IS_ATOMIC_NODE = false;
 const std::list<std::string> ID_ARRAY = { "0" };
 const std::list<std::string> FOR_EACH_ARRAY = { "0", "1", "2", "3" };
+constexpr int32_t THREAD_COUNT = 4;
+constexpr int32_t COPY_COUNT = 1000;
+// the prune limit of ForEachNode for two renders of two keys, plus the keys of the render that triggers it.
+constexpr size_t KEY_TABLE_LIMIT = 2 * (2 + 2) + 64 + 2;
 const std::list<std::string> FOR_EACH_IDS = { "0", "1", "2", "3", "4", "5" };
 constexpr int32_t FOR_EACH_NODE_ID = 1;
 } // namespace
@@ -211,6 +218,7 @@ HWTEST_F(ForEachSyntaxTestNg, ForEachSyntaxUpdateTest006, TestSize.Level1)
     forEachNode->children_ = { node };
     forEachNode->CompareAndUpdateChildren();
     forEachNode->ids_ = forEachNode->tempIds_;
+    forEachNode->keyIds_ = forEachNode->tempKeyIds_;
     forEachNode->FlushUpdateAndMarkDirty();
     auto tempIds = forEachNode->GetTempIds();
     EXPECT_TRUE(tempIds.empty());
@@ -664,4 +672,153 @@ HWTEST_F(ForEachSyntaxTestNg, ForEachInitAllChildrenDragManagerTest001, TestSize
     forEachNode->SetOnMove(SetOnMoveTestNg);
     forEachNode->InitAllChildrenDragManager(true);
 }
+
+/**
+ * @tc.name: ForEachInternedKeyTest001
+ * @tc.desc: Test the reference counting and id reuse of the interned Repeat keys.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ForEachSyntaxTestNg, ForEachInternedKeyTest001, TestSize.Level1)
+{
+    auto& table = KeyInternTable::GetInstance();
+    auto initialSize = table.Size();
+
+    /**
+     * @tc.steps: step1. Intern the same key twice and a different key once.
+     * @tc.expected: Equal keys share the id, different keys do not.
+     */
+    InternedKey first("interned_key_test_0");
+    InternedKey second("interned_key_test_0");
+    InternedKey third("interned_key_test_1");
+    EXPECT_TRUE(first.IsValid());
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, third);
+    EXPECT_EQ(first.GetKey(), "interned_key_test_0");
+    EXPECT_EQ(table.Size(), initialSize + 2);
+
+    /**
+     * @tc.steps: step2. Copy and move the keys, then release all references to the first key.
+     * @tc.expected: The key stays interned while referenced and its id is reused afterwards.
+     */
+    InternedKey copied(first);
+    InternedKey moved(std::move(second));
+    EXPECT_FALSE(second.IsValid());
+    auto firstId = first.GetId();
+    first = InternedKey();
+    copied = InternedKey();
+    EXPECT_EQ(moved.GetKey(), "interned_key_test_0");
+    moved = InternedKey();
+    EXPECT_EQ(table.Size(), initialSize + 1);
+    InternedKey reused("interned_key_test_2");
+    EXPECT_EQ(reused.GetId(), firstId);
+    EXPECT_EQ(reused.GetKey(), "interned_key_test_2");
+    EXPECT_TRUE(InternedKey().GetKey().empty());
+
+    /**
+     * @tc.steps: step3. Copy, release and re-intern a key from several threads.
+     * @tc.expected: The key keeps one id while referenced and is removed once after the last reference.
+     */
+    InternedKey shared("interned_key_test_3");
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < THREAD_COUNT; ++i) {
+        threads.emplace_back([&shared]() {
+            for (int32_t j = 0; j < COPY_COUNT; ++j) {
+                InternedKey copy(shared);
+                InternedKey same("interned_key_test_3");
+                InternedKey other("interned_key_test_4");
+                EXPECT_EQ(copy, same);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(shared.GetKey(), "interned_key_test_3");
+    reused = InternedKey();
+    shared = InternedKey();
+    EXPECT_EQ(table.Size(), initialSize + 1);
+}
+
+/**
+ * @tc.name: ForEachInternedKeyTest002
+ * @tc.desc: Test ForEach keeps the children of interned ids across updates.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ForEachSyntaxTestNg, ForEachInternedKeyTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Create ForEach with a child for each id.
+     */
+    auto forEachNode = ForEachNode::GetOrCreateForEachNode(FOR_EACH_NODE_ID + 1);
+    ASSERT_NE(forEachNode, nullptr);
+    std::list<std::string> ids = FOR_EACH_ARRAY;
+    forEachNode->SetIds(std::move(ids));
+    std::vector<RefPtr<FrameNode>> children;
+    for (size_t i = 0; i < FOR_EACH_ARRAY.size(); ++i) {
+        auto child = FrameNode::CreateFrameNode(V2::BLANK_ETS_TAG, static_cast<int32_t>(i) + 1, AceType::MakeRefPtr<Pattern>());
+        children.emplace_back(child);
+        forEachNode->AddChild(child);
+    }
+
+    /**
+     * @tc.steps: step2. Update with the ids in reversed order.
+     * @tc.expected: The old children are reused in the new order.
+     */
+    forEachNode->CreateTempItems();
+    EXPECT_EQ(forEachNode->GetTempIds(), FOR_EACH_ARRAY);
+    std::list<std::string> reversedIds(FOR_EACH_ARRAY.rbegin(), FOR_EACH_ARRAY.rend());
+    forEachNode->SetIds(std::move(reversedIds));
+    forEachNode->CompareAndUpdateChildren();
+    ASSERT_EQ(forEachNode->GetChildren().size(), children.size());
+    auto childIter = forEachNode->GetChildren().begin();
+    for (auto iter = children.rbegin(); iter != children.rend(); ++iter, ++childIter) {
+        EXPECT_EQ(*childIter, *iter);
+    }
+}
+
+/**
+ * @tc.name: ForEachInternedKeyTest003
+ * @tc.desc: Test ForEach interns its keys per node and prunes the keys of removed items.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ForEachSyntaxTestNg, ForEachInternedKeyTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Set the ids, then render again with the ids shifted by one.
+     * @tc.expected: A key keeps its id across the renders and the frontend reads the previous keys by reference.
+     */
+    auto forEachNode = ForEachNode::GetOrCreateForEachNode(FOR_EACH_NODE_ID + 2);
+    ASSERT_NE(forEachNode, nullptr);
+    std::list<std::string> ids = FOR_EACH_IDS;
+    forEachNode->SetIds(std::move(ids));
+    auto firstKeyIds = forEachNode->keyIds_;
+    ASSERT_EQ(firstKeyIds.size(), FOR_EACH_IDS.size());
+    forEachNode->CreateTempItems();
+    const auto& tempIds = forEachNode->GetTempIds();
+    EXPECT_EQ(&tempIds, &forEachNode->tempIds_);
+    EXPECT_EQ(tempIds, FOR_EACH_IDS);
+    std::list<std::string> shiftedIds(std::next(FOR_EACH_IDS.begin()), FOR_EACH_IDS.end());
+    shiftedIds.emplace_back("6");
+    forEachNode->SetIds(std::move(shiftedIds));
+    EXPECT_EQ(forEachNode->keyIds_.front(), firstKeyIds[1]);
+    EXPECT_EQ(forEachNode->keyTable_.size(), FOR_EACH_IDS.size() + 1);
+    forEachNode->FlushUpdateAndMarkDirty();
+    EXPECT_TRUE(forEachNode->tempKeyIds_.empty());
+
+    /**
+     * @tc.steps: step2. Render many times with new keys only.
+     * @tc.expected: The table stays bounded and the diff still finds the keys of the previous render.
+     */
+    for (int32_t render = 0; render < COPY_COUNT; ++render) {
+        forEachNode->CreateTempItems();
+        std::list<std::string> newIds = { "render_" + std::to_string(render), "stable" };
+        forEachNode->SetIds(std::move(newIds));
+        if (render > 0) {
+            EXPECT_EQ(forEachNode->keyIds_.back(), forEachNode->tempKeyIds_.back());
+            EXPECT_NE(forEachNode->keyIds_.front(), forEachNode->tempKeyIds_.front());
+        }
+        forEachNode->FlushUpdateAndMarkDirty();
+    }
+    EXPECT_LE(forEachNode->keyTable_.size(), KEY_TABLE_LIMIT);
+}
 } // namespace OHOS::Ace::NG
@@ -1866,4 +1866,86 @@ HWTEST_F(LazyForEachSyntaxTestNg, LazyForEachSyntaxRecycleChildByIndexTest001, T
     }
     lazyForEachBuilder->RecycleChildByIndex(INDEX_1);
 }
+
+/**
+ * @tc.name: LazyForEachSyntaxCachedItemsTest001
+ * @tc.desc: Test the index window of cached items keeps index order while it moves.
+ * @tc.type: FUNC
+ */
+HWTEST_F(LazyForEachSyntaxTestNg, LazyForEachSyntaxCachedItemsTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. Fill a window and move it forward by erasing the front and adding at the back.
+     * @tc.expected: items are found by index and iterate in index order.
+     */
+    LazyForEachCachedItems items;
+    for (int32_t index = 0; index < 10; index++) {
+        items.try_emplace(index, LazyForEachChild(std::to_string(index), nullptr));
+    }
+    for (int32_t index = 10; index < 100; index++) {
+        items.erase(items.begin());
+        items[index] = LazyForEachChild(std::to_string(index), nullptr);
+    }
+    EXPECT_EQ(items.size(), 10);
+    EXPECT_EQ(items.begin()->first, 90);
+    EXPECT_EQ(items.rbegin()->first, 99);
+    EXPECT_EQ(items.find(95)->second.first, "95");
+    EXPECT_TRUE(items.find(89) == items.end());
+
+    /**
+     * @tc.steps: step2. Add an item before the window, remove one inside it and shift the tail.
+     * @tc.expected: the window stays sorted and the gap is handled.
+     */
+    EXPECT_TRUE(items.try_emplace(50, LazyForEachChild("50", nullptr)).second);
+    EXPECT_FALSE(items.try_emplace(50, LazyForEachChild("other", nullptr)).second);
+    EXPECT_EQ(items.erase(93), 1);
+    items.ShiftIndexes(94, 1);
+    std::vector<int32_t> indexes;
+    for (const auto& [index, child] : items) {
+        indexes.emplace_back(index);
+    }
+    EXPECT_EQ(indexes, std::vector<int32_t>({ 50, 90, 91, 92, 95, 96, 97, 98, 99, 100 }));
+    EXPECT_EQ(items.find(50)->second.first, "50");
+    EXPECT_EQ(items.find(95)->second.first, "94");
+
+    /**
+     * @tc.steps: step3. Remove the items at both ends of the window in one pass.
+     * @tc.expected: the removed items are moved out in index order and the rest keep their order.
+     */
+    std::vector<std::string> removed;
+    EXPECT_EQ(items.RemoveIf([&removed](auto& item) {
+        if (item.first > 90 && item.first < 99) {
+            return false;
+        }
+        removed.emplace_back(std::move(item.second.first));
+        return true;
+    }), 4);
+    EXPECT_EQ(removed, std::vector<std::string>({ "50", "90", "98", "99" }));
+    indexes.clear();
+    for (const auto& [index, child] : items) {
+        indexes.emplace_back(index);
+    }
+    EXPECT_EQ(indexes, std::vector<int32_t>({ 91, 92, 95, 96, 97, 98 }));
+    EXPECT_EQ(items.find(91)->second.first, "91");
+
+    /**
+     * @tc.steps: step4. Move an item forward, then move an item which is not in the window backward.
+     * @tc.expected: the items between the two indexes fill the gap and the window stays sorted.
+     */
+    items.MoveIndex(92, 97);
+    indexes.clear();
+    for (const auto& [index, child] : items) {
+        indexes.emplace_back(index);
+    }
+    EXPECT_EQ(indexes, std::vector<int32_t>({ 91, 94, 95, 96, 97, 98 }));
+    EXPECT_EQ(items.find(97)->second.first, "92");
+    EXPECT_EQ(items.find(96)->second.first, "96");
+    items.MoveIndex(99, 95);
+    indexes.clear();
+    for (const auto& [index, child] : items) {
+        indexes.emplace_back(index);
+    }
+    EXPECT_EQ(indexes, std::vector<int32_t>({ 91, 94, 96, 97, 98, 99 }));
+    EXPECT_EQ(items.find(98)->second.first, "92");
+}
 } // namespace OHOS::Ace::NG
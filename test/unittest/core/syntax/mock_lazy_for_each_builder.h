@@ -44,7 +44,7 @@ protected:
             AceType::MakeRefPtr<NG::FrameNode>(V2::TEXT_ETS_TAG, -1, AceType::MakeRefPtr<NG::Pattern>()) };
     }
     std::pair<std::string, RefPtr<NG::UINode>> OnGetChildByIndexNew(int32_t index,
-        std::map<int32_t, NG::LazyForEachChild>& cachedItems,
+        NG::LazyForEachCachedItems& cachedItems,
         std::unordered_map<std::string, NG::LazyForEachCacheChild>& expiringItems) override
     {
         return { std::to_string(index),
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/memory/ace_type.h"
+
+#define private public
+#define protected public
+#include "core/components_ng/base/frame_node.h"
+#include "core/components_ng/base/view_stack_processor.h"
+#include "core/components_ng/pattern/pattern.h"
+#include "core/components_ng/syntax/repeat_virtual_scroll_caches.h"
+#include "test/mock/core/pipeline/mock_pipeline_context.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace::NG {
+namespace {
+const std::string NODE_TAG("node");
+const std::string TTYPE_A("a");
+const std::string TTYPE_B("b");
+constexpr uint32_t ITEM_COUNT = 20;
+constexpr uint32_t CACHE_COUNT = 2;
+} // namespace
+
+class RepeatVirtualScrollCachesTestNg : public testing::Test {
+public:
+    static void SetUpTestSuite()
+    {
+        MockPipelineContext::SetUp();
+    }
+
+    static void TearDownTestSuite()
+    {
+        MockPipelineContext::TearDown();
+    }
+
+    void SetUp() override
+    {
+        keys_.clear();
+        ttypes_.clear();
+        for (uint32_t i = 0; i < ITEM_COUNT; i++) {
+            keys_.emplace_back("key" + std::to_string(i));
+            ttypes_.emplace_back(i % 2 == 0 ? TTYPE_A : TTYPE_B);
+        }
+        updatedKeys_.clear();
+        nodeId_ = 1;
+    }
+
+    RepeatVirtualScrollCaches CreateCaches()
+    {
+        std::map<std::string, uint32_t> cacheCounts = { { TTYPE_A, CACHE_COUNT }, { TTYPE_B, CACHE_COUNT } };
+        auto onCreateNode = [this](uint32_t index) {
+            ViewStackProcessor::GetInstance()->Push(
+                FrameNode::CreateFrameNode(NODE_TAG, nodeId_++, AceType::MakeRefPtr<Pattern>()));
+        };
+        auto onUpdateNode = [this](const std::string& fromKey, uint32_t index) { updatedKeys_.push_back(fromKey); };
+        auto onGetKeys4Range = [this](uint32_t from, uint32_t to, std::vector<std::string>& result) {
+            result.clear();
+            for (auto i = from; i <= to && i < keys_.size(); i++) {
+                result.push_back(keys_[i]);
+            }
+        };
+        auto onGetTypes4Range = [this](uint32_t from, uint32_t to, std::vector<std::string>& result) {
+            result.clear();
+            for (auto i = from; i <= to && i < ttypes_.size(); i++) {
+                result.push_back(ttypes_[i]);
+            }
+        };
+        return RepeatVirtualScrollCaches(cacheCounts, onCreateNode, onUpdateNode, onGetKeys4Range, onGetTypes4Range);
+    }
+
+    // creates the nodes of [from, to] and adds them to L1
+    static void CreateL1Nodes(RepeatVirtualScrollCaches& caches, uint32_t from, uint32_t to)
+    {
+        for (auto index = from; index <= to; index++) {
+            auto key = caches.GetKey4Index(index);
+            ASSERT_TRUE(key.has_value());
+            ASSERT_NE(caches.CreateNewNode(index), nullptr);
+            caches.AddKeyToL1(key->GetId());
+        }
+    }
+
+    static std::vector<std::string> GetL2Keys(const RepeatVirtualScrollCaches& caches, const std::string& ttype)
+    {
+        std::vector<std::string> keys;
+        const auto& ttypeCache = caches.ttypes_[caches.ttypeIds_.at(ttype)];
+        for (const auto& l2Key : ttypeCache.l2Keys) {
+            keys.push_back(caches.node4key_.at(l2Key.key).key.GetKey());
+        }
+        return keys;
+    }
+
+    std::vector<std::string> keys_;
+    std::vector<std::string> ttypes_;
+    std::vector<std::string> updatedKeys_;
+    int32_t nodeId_ = 1;
+};
+
+/**
+ * @tc.name: RepeatVirtualScrollCachesTest001
+ * @tc.desc: Test moving the nodes between L1 and L2 and updating the furthest L2 node
+ * @tc.type: FUNC
+ */
+HWTEST_F(RepeatVirtualScrollCachesTestNg, RepeatVirtualScrollCachesTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create the nodes of index 0 to 5 in L1.
+     * @tc.expected: the keys are in L1 and no key is in L2.
+     */
+    auto caches = CreateCaches();
+    caches.SetLastActiveRange(0, 5);
+    CreateL1Nodes(caches, 0, 5);
+    EXPECT_EQ(caches.GetAllNodes().size(), 6);
+    auto key0 = caches.GetKey4Index(0);
+    ASSERT_TRUE(key0.has_value());
+    EXPECT_EQ(key0->GetKey(), "key0");
+    EXPECT_TRUE(caches.IsInL1Cache(key0->GetId()));
+    EXPECT_TRUE(GetL2Keys(caches, TTYPE_A).empty());
+
+    /**
+     * @tc.steps: step2. scroll to 4 to 9 and recycle index 0 to 3.
+     * @tc.expected: the recycled keys are in L2 of their ttype sorted by index.
+     */
+    caches.SetLastActiveRange(4, 9);
+    for (int32_t index = 0; index < 4; index++) {
+        caches.RecycleItemsByIndex(index);
+    }
+    EXPECT_FALSE(caches.IsInL1Cache(key0->GetId()));
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_A), std::vector<std::string>({ "key0", "key2" }));
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_B), std::vector<std::string>({ "key1", "key3" }));
+
+    /**
+     * @tc.steps: step3. get the node of index 8 from L2.
+     * @tc.expected: the node of the furthest key of the ttype is updated and renamed to key8.
+     */
+    auto node0 = caches.GetNode4Index(0);
+    ASSERT_TRUE(caches.GetKey4Index(8).has_value());
+    EXPECT_EQ(caches.GetNode4Index(8), nullptr);
+    auto node8 = caches.UpdateFromL2(8);
+    EXPECT_EQ(node8, node0);
+    EXPECT_EQ(updatedKeys_, std::vector<std::string>({ "key0" }));
+    EXPECT_EQ(caches.GetNode4Index(8), node0);
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_A), std::vector<std::string>({ "key2", "key8" }));
+
+    /**
+     * @tc.steps: step4. add the updated key to L1.
+     * @tc.expected: the key leaves L2.
+     */
+    caches.AddKeyToL1(caches.GetKey4Index(8)->GetId());
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_A), std::vector<std::string>({ "key2" }));
+    EXPECT_EQ(caches.GetAllNodes().size(), 6);
+}
+
+/**
+ * @tc.name: RepeatVirtualScrollCachesTest002
+ * @tc.desc: Test purging L2 down to the cache count of each ttype
+ * @tc.type: FUNC
+ */
+HWTEST_F(RepeatVirtualScrollCachesTestNg, RepeatVirtualScrollCachesTest002, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create the nodes of index 0 to 15 and keep index 6 to 9 in L1.
+     */
+    auto caches = CreateCaches();
+    caches.SetLastActiveRange(0, 15);
+    CreateL1Nodes(caches, 0, 15);
+    caches.SetLastActiveRange(6, 9);
+    caches.SetLastActiveRange(6, 9);
+    EXPECT_TRUE(caches.RebuildL1([](int32_t index, const RefPtr<UINode>& node) { return index >= 6 && index <= 9; }));
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_A).size(), 6);
+
+    /**
+     * @tc.steps: step2. purge L2.
+     * @tc.expected: the nodes nearest to the active range are kept, the others are released.
+     */
+    EXPECT_TRUE(caches.Purge());
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_A), std::vector<std::string>({ "key4", "key10" }));
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_B), std::vector<std::string>({ "key5", "key11" }));
+    EXPECT_EQ(caches.GetAllNodes().size(), 8);
+    EXPECT_EQ(caches.GetNode4Index(0), nullptr);
+    EXPECT_NE(caches.GetNode4Index(4), nullptr);
+    EXPECT_FALSE(caches.Purge());
+}
+
+/**
+ * @tc.name: RepeatVirtualScrollCachesTest003
+ * @tc.desc: Test updating the nodes of keys no longer used first after invalidation
+ * @tc.type: FUNC
+ */
+HWTEST_F(RepeatVirtualScrollCachesTestNg, RepeatVirtualScrollCachesTest003, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. create the nodes of index 0 to 7 and recycle index 4 to 7.
+     */
+    auto caches = CreateCaches();
+    caches.SetLastActiveRange(0, 7);
+    CreateL1Nodes(caches, 0, 7);
+    caches.SetLastActiveRange(0, 3);
+    for (int32_t index = 4; index < 8; index++) {
+        caches.RecycleItemsByIndex(index);
+    }
+    EXPECT_EQ(GetL2Keys(caches, TTYPE_A), std::vector<std::string>({ "key4", "key6" }));
+
+    /**
+     * @tc.steps: step2. remove key6 from the data and invalidate the keys.
+     * @tc.expected: the nodes are marked invalid, the key no longer used sorts last.
+     */
+    keys_[6] = "new6";
+    caches.InvalidateKeyAndTTypeCaches();
+    for (const auto& [key, item] : caches.GetAllNodes()) {
+        EXPECT_FALSE(item.isValid);
+    }
+    ASSERT_TRUE(caches.GetKey4Index(4).has_value());
+    ASSERT_TRUE(caches.GetKey4Index(6).has_value());
+    auto candidate = caches.GetL2KeyToUpdate(caches.ttypeIds_.at(TTYPE_A));
+    ASSERT_TRUE(candidate.has_value());
+    EXPECT_EQ(caches.node4key_.at(candidate.value()).key.GetKey(), "key6");
+
+    /**
+     * @tc.steps: step3. get the node of index 6 and then of index 4.
+     * @tc.expected: the node of key6 is reused for new6, the node of key4 is updated in place.
+     */
+    EXPECT_EQ(caches.GetNode4Index(6), nullptr);
+    auto node = caches.UpdateFromL2(6);
+    EXPECT_NE(node, nullptr);
+    EXPECT_EQ(caches.GetNode4Index(6), node);
+    EXPECT_NE(caches.GetNode4Index(4), nullptr);
+    EXPECT_EQ(updatedKeys_, std::vector<std::string>({ "key6", "key4" }));
+}
+} // namespace OHOS::Ace::NG
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "base/memory/ace_type.h"
+#include "base/utils/device_config.h"
+#include "base/utils/resource_configuration.h"
+#include "core/components/common/properties/color.h"
+#include "core/components/theme/resource_adapter.h"
+#include "core/components/theme/theme_constants.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+namespace OHOS::Ace {
+namespace {
+const std::string RES_NAME = "sys.color.ohos_id_color_primary";
+const std::string OTHER_RES_NAME = "sys.color.ohos_id_color_secondary";
+const std::string RES_TYPE = "color";
+const std::string BUNDLE_NAME = "com.example.theme";
+const std::string MODULE_NAME = "entry";
+constexpr uint32_t RES_ID = 125829120;
+const Color LIGHT_COLOR = Color(0xff0a59f7);
+const Color DARK_COLOR = Color(0xff317af7);
+constexpr int32_t APP_INT = 1;
+constexpr int32_t MODULE_INT = 2;
+
+// an adapter resolving the names by the color mode and the module in use, which counts the names it resolves.
+class FakeResourceAdapter : public ResourceAdapter {
+    DECLARE_ACE_TYPE(FakeResourceAdapter, ResourceAdapter);
+
+public:
+    FakeResourceAdapter()
+    {
+        SetResolvedColorMode(ColorMode::LIGHT);
+    }
+    ~FakeResourceAdapter() override = default;
+
+    void UpdateConfig(const ResourceConfiguration& config, bool themeFlag) override
+    {
+        SetResolvedColorMode(config.GetColorMode());
+        IncreaseConfigVersion();
+    }
+
+    // as the adapter of the system, a switch of the color mode alone keeps the version.
+    void UpdateColorMode(ColorMode colorMode) override
+    {
+        SetResolvedColorMode(colorMode);
+    }
+
+    void UpdateResourceManager(const std::string& bundleName, const std::string& moduleName) override
+    {
+        moduleName_ = moduleName;
+    }
+
+    Color GetColorByName(const std::string& resName) override
+    {
+        ++resolveCount_;
+        auto colorMode = GetResolvedColorMode();
+        if (onResolve_) {
+            onResolve_();
+        }
+        return colorMode == ColorMode::DARK ? DARK_COLOR : LIGHT_COLOR;
+    }
+
+    int32_t GetIntByName(const std::string& resName) override
+    {
+        ++resolveCount_;
+        return moduleName_.empty() ? APP_INT : MODULE_INT;
+    }
+
+    bool GetIdByName(const std::string& resName, const std::string& resType, uint32_t& resId) const override
+    {
+        ++resolveCount_;
+        if (resName != RES_NAME) {
+            return false;
+        }
+        resId = RES_ID;
+        return true;
+    }
+
+    Color GetColor(uint32_t resId) override
+    {
+        return {};
+    }
+
+    Dimension GetDimension(uint32_t resId) override
+    {
+        return {};
+    }
+
+    std::string GetString(uint32_t resId) override
+    {
+        return {};
+    }
+
+    std::vector<std::string> GetStringArray(uint32_t resId) const override
+    {
+        return {};
+    }
+
+    double GetDouble(uint32_t resId) override
+    {
+        return 0.0;
+    }
+
+    int32_t GetInt(uint32_t resId) override
+    {
+        return 0;
+    }
+
+    int32_t GetResolveCount() const
+    {
+        return resolveCount_;
+    }
+
+    void SetOnResolve(std::function<void()>&& onResolve)
+    {
+        onResolve_ = std::move(onResolve);
+    }
+
+private:
+    mutable int32_t resolveCount_ = 0;
+    std::string moduleName_;
+    std::function<void()> onResolve_;
+};
+} // namespace
+
+class ThemeConstantsTest : public testing::Test {
+public:
+    void SetUp() override
+    {
+        resAdapter_ = AceType::MakeRefPtr<FakeResourceAdapter>();
+        themeConstants_ = AceType::MakeRefPtr<ThemeConstants>(resAdapter_);
+    }
+
+    void TearDown() override
+    {
+        themeConstants_ = nullptr;
+        resAdapter_ = nullptr;
+    }
+
+protected:
+    RefPtr<FakeResourceAdapter> resAdapter_;
+    RefPtr<ThemeConstants> themeConstants_;
+};
+
+/**
+ * @tc.name: ThemeConstantsTest001
+ * @tc.desc: Test a value resolved by name is resolved by the adapter once.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ThemeConstantsTest001, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. get a color by name twice.
+     * @tc.expected: the adapter resolves it once and both of the lookups return it.
+     */
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 1);
+
+    /**
+     * @tc.steps: step2. get another name and an int by the same name.
+     * @tc.expected: the values are kept apart by the name and by the type.
+     */
+    EXPECT_EQ(themeConstants_->GetColorByName(OTHER_RES_NAME), LIGHT_COLOR);
+    EXPECT_EQ(themeConstants_->GetIntByName(RES_NAME), APP_INT);
+    EXPECT_EQ(themeConstants_->GetIntByName(RES_NAME), APP_INT);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 3);
+}
+
+/**
+ * @tc.name: ThemeConstantsTest002
+ * @tc.desc: Test a local switch of the color mode keeps the values of each color mode.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ThemeConstantsTest002, TestSize.Level1)
+{
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+    auto configVersion = resAdapter_->GetConfigVersion();
+
+    /**
+     * @tc.steps: step1. switch the adapter to the dark color mode, as a resource wrapper with a local color mode does.
+     * @tc.expected: the version is kept and the dark value is resolved.
+     */
+    resAdapter_->UpdateColorMode(ColorMode::DARK);
+    EXPECT_EQ(resAdapter_->GetConfigVersion(), configVersion);
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), DARK_COLOR);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 2);
+
+    /**
+     * @tc.steps: step2. switch back to the light color mode and to the dark one again.
+     * @tc.expected: the value of each color mode is returned without resolving it again.
+     */
+    resAdapter_->UpdateColorMode(ColorMode::LIGHT);
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+    resAdapter_->UpdateColorMode(ColorMode::DARK);
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), DARK_COLOR);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 2);
+}
+
+/**
+ * @tc.name: ThemeConstantsTest003
+ * @tc.desc: Test the values are resolved again after the configuration is updated or the values are cleared.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ThemeConstantsTest003, TestSize.Level1)
+{
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+
+    /**
+     * @tc.steps: step1. update the configuration of the shared adapter behind the theme constants.
+     * @tc.expected: the version changes and the value is resolved again.
+     */
+    ResourceConfiguration config;
+    config.SetColorMode(ColorMode::LIGHT);
+    resAdapter_->UpdateConfig(config, false);
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 2);
+
+    /**
+     * @tc.steps: step2. update the configuration through the theme constants.
+     * @tc.expected: the value of the new color mode is resolved.
+     */
+    config.SetColorMode(ColorMode::DARK);
+    themeConstants_->UpdateConfig(config);
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), DARK_COLOR);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 3);
+
+    /**
+     * @tc.steps: step3. clear the values, as a reload of the pipeline does.
+     * @tc.expected: the value is resolved again.
+     */
+    themeConstants_->ClearResolvedValues();
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), DARK_COLOR);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 4);
+}
+
+/**
+ * @tc.name: ThemeConstantsTest004
+ * @tc.desc: Test the values are kept by the module of the resources.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ThemeConstantsTest004, TestSize.Level1)
+{
+    EXPECT_EQ(themeConstants_->GetIntByName(RES_NAME), APP_INT);
+
+    /**
+     * @tc.steps: step1. switch to the resources of a module.
+     * @tc.expected: the value of the module is resolved.
+     */
+    themeConstants_->UpdateThemeConstants(BUNDLE_NAME, MODULE_NAME);
+    EXPECT_EQ(themeConstants_->GetIntByName(RES_NAME), MODULE_INT);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 2);
+
+    /**
+     * @tc.steps: step2. switch back to the resources of the application and to the module again.
+     * @tc.expected: the value of each of them is returned without resolving it again.
+     */
+    themeConstants_->UpdateThemeConstants("", "");
+    EXPECT_EQ(themeConstants_->GetIntByName(RES_NAME), APP_INT);
+    themeConstants_->UpdateThemeConstants(BUNDLE_NAME, MODULE_NAME);
+    EXPECT_EQ(themeConstants_->GetIntByName(RES_NAME), MODULE_INT);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 2);
+}
+
+/**
+ * @tc.name: ThemeConstantsTest005
+ * @tc.desc: Test the ids of the names are kept across the color modes and a missing name is not kept.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ThemeConstantsTest005, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. get the id of a name, switch the color mode and get it again.
+     * @tc.expected: the adapter resolves the id once.
+     */
+    uint32_t resId = 0;
+    EXPECT_TRUE(themeConstants_->GetResourceIdByName(RES_NAME, RES_TYPE, resId));
+    EXPECT_EQ(resId, RES_ID);
+    resAdapter_->UpdateColorMode(ColorMode::DARK);
+    resId = 0;
+    EXPECT_TRUE(themeConstants_->GetResourceIdByName(RES_NAME, RES_TYPE, resId));
+    EXPECT_EQ(resId, RES_ID);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 1);
+
+    /**
+     * @tc.steps: step2. get the id of a missing name twice.
+     * @tc.expected: both of the lookups fail and go to the adapter.
+     */
+    EXPECT_FALSE(themeConstants_->GetResourceIdByName(OTHER_RES_NAME, RES_TYPE, resId));
+    EXPECT_FALSE(themeConstants_->GetResourceIdByName(OTHER_RES_NAME, RES_TYPE, resId));
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 3);
+}
+
+/**
+ * @tc.name: ThemeConstantsTest006
+ * @tc.desc: Test a value resolved while the color mode is switched is not kept.
+ * @tc.type: FUNC
+ */
+HWTEST_F(ThemeConstantsTest, ThemeConstantsTest006, TestSize.Level1)
+{
+    /**
+     * @tc.steps: step1. switch the color mode while the adapter resolves a light value.
+     * @tc.expected: the light value is returned.
+     */
+    resAdapter_->SetOnResolve([adapter = resAdapter_]() { adapter->UpdateColorMode(ColorMode::DARK); });
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+    resAdapter_->SetOnResolve(nullptr);
+
+    /**
+     * @tc.steps: step2. get the value in the dark color mode and in the light one.
+     * @tc.expected: both of them are resolved, the light value was not kept for either of the color modes.
+     */
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), DARK_COLOR);
+    resAdapter_->UpdateColorMode(ColorMode::LIGHT);
+    EXPECT_EQ(themeConstants_->GetColorByName(RES_NAME), LIGHT_COLOR);
+    EXPECT_EQ(resAdapter_->GetResolveCount(), 3);
+}
+} // namespace OHOS::Ace